@@ -20,6 +20,8 @@ public class PMXImporter : ModuleRules
             "InterchangeCommonParser",
             "PhysicsCore",
             "MeshDescription",
+            "PMXRuntime",
+            "AnimGraph",
         });
 
         PrivateDependencyModuleNames.AddRange(new string[]
@@ -35,13 +37,24 @@ public class PMXImporter : ModuleRules
             "StaticMeshDescription",
             "SkeletalMeshDescription",
             "AnimationCore",
+            "BlueprintGraph",
             "AssetRegistry",
+            "DerivedDataCache",
+            "Projects",
+            "Json",
+            "Slate",
+            "SlateCore",
+            "ContentBrowser",
             // For image resizing/utilities used by the translator when handling texture payloads
             "ImageCore",
-            // For renaming bones
-            "SkeletalMeshModifiers",
         });
 
+        // VMD names are Shift-JIS: decoded by the OS on Windows and Mac, by ICU on other platforms
+        if (Target.Platform != UnrealTargetPlatform.Win64 && Target.Platform != UnrealTargetPlatform.Mac)
+        {
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "ICU");
+        }
+
         PublicIncludePaths.AddRange(new string[]
         {
             Path.Combine(EngineDirectory, "Plugins/Interchange/Runtime/Source/FactoryNodes/Public"),
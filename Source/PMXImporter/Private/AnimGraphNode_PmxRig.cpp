@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "AnimGraphNode_PmxRig.h"
+#include "PmxRigDefinition.h"
+#include "Animation/Skeleton.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_PmxRig)
+
+#define LOCTEXT_NAMESPACE "PmxAnimGraphNodes"
+
+FText UAnimGraphNode_PmxRig::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if (TitleType == ENodeTitleType::ListView || TitleType == ENodeTitleType::MenuTitle || !Node.RigDefinition)
+	{
+		return LOCTEXT("PmxRigTitle", "PMX Rig (IK / Append)");
+	}
+	return FText::Format(LOCTEXT("PmxRigTitleWithAsset", "PMX Rig\n{0}"), FText::FromString(Node.RigDefinition->GetName()));
+}
+
+FText UAnimGraphNode_PmxRig::GetTooltipText() const
+{
+	return LOCTEXT("PmxRigTooltip", "Evaluates the PMX append (additional parent) links and MMD-style CCD IK chains of a rig generated at import.");
+}
+
+FLinearColor UAnimGraphNode_PmxRig::GetNodeTitleColor() const
+{
+	return FLinearColor(0.7f, 0.7f, 0.7f);
+}
+
+FString UAnimGraphNode_PmxRig::GetNodeCategory() const
+{
+	return TEXT("PMX");
+}
+
+void UAnimGraphNode_PmxRig::ValidateAnimNodeDuringCompilation(USkeleton* ForSkeleton, FCompilerResultsLog& MessageLog)
+{
+	Super::ValidateAnimNodeDuringCompilation(ForSkeleton, MessageLog);
+
+	if (!Node.RigDefinition)
+	{
+		if (!IsPinExposedAndLinked(GET_MEMBER_NAME_STRING_CHECKED(FAnimNode_PmxRig, RigDefinition)))
+		{
+			MessageLog.Warning(*LOCTEXT("NoRigDefinition", "@@ has no PMX rig asset").ToString(), this);
+		}
+		return;
+	}
+
+	const TSoftObjectPtr<USkeleton>& RigSkeleton = Node.RigDefinition->Skeleton;
+	if (ForSkeleton && !RigSkeleton.IsNull() && RigSkeleton.ToSoftObjectPath() != FSoftObjectPath(ForSkeleton))
+	{
+		MessageLog.Note(*LOCTEXT("SkeletonMismatch", "@@ uses a PMX rig generated for a different skeleton; bones are matched by name").ToString(), this);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
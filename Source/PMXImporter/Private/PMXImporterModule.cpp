@@ -6,6 +6,8 @@
 #include "InterchangeProjectSettings.h"
 #include "PmxTranslator.h"
 #include "PmxPipeline.h"
+#include "PmxImportSession.h"
+#include "PmxPostImportQueue.h"
 
 DEFINE_LOG_CATEGORY(LogPMXImporter);
 
@@ -31,9 +33,11 @@ public:
 		// Note: DefaultPipelineInstance cleanup is skipped during engine shutdown
 		// AddToRoot() objects are automatically cleaned up by GC during exit
 
-		// Clear static caches
-		UPmxTranslator::MeshPayloadCache.Empty();
-		UPmxTranslator::PhysicsPayloadCache.Empty();
+		// Finish post-import work still queued (it holds the sessions' profilers)
+		FPmxPostImportQueue::Flush();
+
+		// Drop import session registrations (sessions themselves are owned by their translator / pipeline)
+		FPmxImportSessionRegistry::Reset();
 
 		UE_LOG(LogPMXImporter, Verbose, TEXT("PMX Importer module shutdown"));
 	}
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxBinaryReader.h"
+#include "LogPMXImporter.h"
+
+bool FPmxBinaryReader::ReadBytes(void* OutBytes, int32 NumBytes)
+{
+	if (NumBytes < 0 || !IsValidPosition(NumBytes))
+	{
+		return false;
+	}
+	FMemory::Memcpy(OutBytes, &Data[Position], NumBytes);
+	Position += NumBytes;
+	return true;
+}
+
+bool FPmxBinaryReader::Skip(int32 NumBytes)
+{
+	if (NumBytes < 0 || !IsValidPosition(NumBytes))
+	{
+		return false;
+	}
+	Position += NumBytes;
+	return true;
+}
+
+bool FPmxBinaryReader::ReadVector3f(FVector3f& OutVector)
+{
+	return ReadValue(OutVector.X) && ReadValue(OutVector.Y) && ReadValue(OutVector.Z);
+}
+
+bool FPmxBinaryReader::ReadVector2f(FVector2f& OutVector)
+{
+	return ReadValue(OutVector.X) && ReadValue(OutVector.Y);
+}
+
+bool FPmxBinaryReader::ReadLinearColor(FLinearColor& OutColor)
+{
+	return ReadValue(OutColor.R) && ReadValue(OutColor.G) && ReadValue(OutColor.B) && ReadValue(OutColor.A);
+}
+
+bool FPmxBinaryReader::ReadQuatf(FQuat4f& OutQuat)
+{
+	return ReadValue(OutQuat.X) && ReadValue(OutQuat.Y) && ReadValue(OutQuat.Z) && ReadValue(OutQuat.W);
+}
+
+bool FPmxBinaryReader::IsValidPosition(int32 Size) const
+{
+	if (Position + Size > Data.Num())
+	{
+		LogError(FString::Printf(TEXT("Attempted to read beyond file end. Position: %d, Size: %d, FileSize: %d"), 
+			Position, Size, Data.Num()));
+		return false;
+	}
+	return true;
+}
+
+void FPmxBinaryReader::LogError(const FString& Message) const
+{
+	UE_LOG(LogPMXImporter, Error, TEXT("%s (Position: 0x%08X)"), *Message, Position);
+}
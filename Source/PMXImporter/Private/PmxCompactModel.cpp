@@ -0,0 +1,943 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxCompactModel.h"
+#include "PmxStructs.h"
+#include "PmxImportProfiler.h"
+#include "LogPMXImporter.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, ".pmxc files are little-endian and read in place");
+static_assert(sizeof(FPmxcFileHeader) == 64, "FPmxcFileHeader layout changed");
+static_assert(sizeof(FPmxcSectionEntry) == 24, "FPmxcSectionEntry layout changed");
+static_assert(sizeof(FPmxcModelInfo) == 52, "FPmxcModelInfo layout changed");
+static_assert(sizeof(FPmxcVertexSdef) == 36, "FPmxcVertexSdef layout changed");
+static_assert(sizeof(FPmxcMaterial) == 104, "FPmxcMaterial layout changed");
+static_assert(sizeof(FPmxcBone) == 116, "FPmxcBone layout changed");
+static_assert(sizeof(FPmxcIKLink) == 32, "FPmxcIKLink layout changed");
+static_assert(sizeof(FPmxcMorph) == 56, "FPmxcMorph layout changed");
+static_assert(sizeof(FPmxcBoneMorph) == 32, "FPmxcBoneMorph layout changed");
+static_assert(sizeof(FPmxcMaterialMorph) == 128, "FPmxcMaterialMorph layout changed");
+static_assert(sizeof(FPmxcRigidBody) == 84, "FPmxcRigidBody layout changed");
+static_assert(sizeof(FPmxcJoint) == 116, "FPmxcJoint layout changed");
+
+static TAutoConsoleVariable<int32> CVarPMXImporterCompactCache(
+	TEXT("PMXImporter.CompactCache"),
+	1,
+	TEXT("Pre-parsed .pmxc files written after the first parse of a PMX file. ")
+	TEXT("0 = disabled, 1 = Saved/PmxCompactCache (default), 2 = next to the source file. ")
+	TEXT("A matching .pmxc next to the source is read whenever this is not 0."),
+	ECVF_Default);
+
+namespace PmxCompactModelPrivate
+{
+	static constexpr uint32 FileMagic = 0x43584D50; // 'PMXC'
+
+	static FXxHash128 HashSource(TConstArrayView<uint8> SourceData)
+	{
+		return FXxHash128::HashBuffer(SourceData.GetData(), SourceData.Num());
+	}
+
+	static FString GetCacheFilePath(TConstArrayView<uint8> SourceData)
+	{
+		const FXxHash128 Hash = HashSource(SourceData);
+		return FPaths::ProjectSavedDir() / TEXT("PmxCompactCache") / FString::Printf(TEXT("%016llx%016llx%s"), Hash.HashHigh, Hash.HashLow, FPmxCompactModel::FileExtension);
+	}
+
+	static FString GetSiblingFilePath(const FString& SourceFile)
+	{
+		return FPaths::ChangeExtension(SourceFile, FPmxCompactModel::FileExtension);
+	}
+
+	template <typename ElementType>
+	static ElementType MakeZeroed()
+	{
+		// Unused fields (SDEF of BDEF vertices, flag-dependent bone fields) are written as zeros so output is deterministic
+		ElementType Element;
+		FMemory::Memzero(&Element, sizeof(Element));
+		return Element;
+	}
+
+	static void CopyVector4(float* Out, const FLinearColor& Value)
+	{
+		Out[0] = Value.R; Out[1] = Value.G; Out[2] = Value.B; Out[3] = Value.A;
+	}
+
+	static void CopyVector4(float* Out, const FVector4f& Value)
+	{
+		Out[0] = Value.X; Out[1] = Value.Y; Out[2] = Value.Z; Out[3] = Value.W;
+	}
+
+	static FLinearColor ToLinearColor(const float* Value)
+	{
+		return FLinearColor(Value[0], Value[1], Value[2], Value[3]);
+	}
+
+	static FVector4f ToVector4(const float* Value)
+	{
+		return FVector4f(Value[0], Value[1], Value[2], Value[3]);
+	}
+
+	/** Collects the SoA arrays of one model and lays them out */
+	class FWriter
+	{
+	public:
+		uint32 AddString(const FString& String)
+		{
+			FPmxcString& Entry = Strings.AddDefaulted_GetRef();
+			Entry.Offset = StringData.Num();
+			if (!String.IsEmpty())
+			{
+				const FTCHARToUTF16 Converter(*String, String.Len());
+				StringData.Append(reinterpret_cast<const UTF16CHAR*>(Converter.Get()), Converter.Length());
+			}
+			Entry.Length = StringData.Num() - Entry.Offset;
+			return Strings.Num() - 1;
+		}
+
+		template <typename ElementType>
+		void AddSection(EPmxcSection Section, const TArray<ElementType>& Elements)
+		{
+			FPendingSection& Pending = PendingSections.AddDefaulted_GetRef();
+			Pending.Id = static_cast<uint32>(Section);
+			Pending.ElementSize = sizeof(ElementType);
+			Pending.Count = Elements.Num();
+			Pending.Data = reinterpret_cast<const uint8*>(Elements.GetData());
+		}
+
+		void AddStringSections()
+		{
+			AddSection(EPmxcSection::StringTable, Strings);
+			AddSection(EPmxcSection::StringData, StringData);
+		}
+
+		void Finish(TConstArrayView<uint8> SourceData, TArray<uint8>& OutData) const
+		{
+			const uint64 TableOffset = sizeof(FPmxcFileHeader);
+			uint64 Offset = Align(TableOffset + sizeof(FPmxcSectionEntry) * PendingSections.Num(), FPmxCompactModel::SectionAlignment);
+
+			TArray<FPmxcSectionEntry> Entries;
+			for (const FPendingSection& Pending : PendingSections)
+			{
+				FPmxcSectionEntry& Entry = Entries.AddDefaulted_GetRef();
+				Entry.Id = Pending.Id;
+				Entry.ElementSize = Pending.ElementSize;
+				Entry.Count = Pending.Count;
+				Entry.Offset = Offset;
+				Offset = Align(Offset + Pending.ElementSize * Pending.Count, FPmxCompactModel::SectionAlignment);
+			}
+
+			const FXxHash128 SourceHash = HashSource(SourceData);
+			FPmxcFileHeader Header;
+			Header.Magic = FileMagic;
+			Header.Version = FPmxCompactModel::FormatVersion;
+			Header.HeaderSize = sizeof(FPmxcFileHeader);
+			Header.NumSections = Entries.Num();
+			Header.SectionTableOffset = TableOffset;
+			Header.FileSize = Offset;
+			Header.SourceSize = SourceData.Num();
+			Header.SourceHashHigh = SourceHash.HashHigh;
+			Header.SourceHashLow = SourceHash.HashLow;
+
+			OutData.SetNumZeroed(Offset);
+			FMemory::Memcpy(OutData.GetData(), &Header, sizeof(Header));
+			FMemory::Memcpy(OutData.GetData() + TableOffset, Entries.GetData(), Entries.Num() * sizeof(FPmxcSectionEntry));
+			for (int32 Index = 0; Index < PendingSections.Num(); ++Index)
+			{
+				const uint64 Size = PendingSections[Index].ElementSize * PendingSections[Index].Count;
+				if (Size > 0)
+				{
+					FMemory::Memcpy(OutData.GetData() + Entries[Index].Offset, PendingSections[Index].Data, Size);
+				}
+			}
+		}
+
+	private:
+		struct FPendingSection
+		{
+			uint32 Id = 0;
+			uint32 ElementSize = 0;
+			uint64 Count = 0;
+			const uint8* Data = nullptr;
+		};
+
+		TArray<FPmxcString> Strings;
+		TArray<UTF16CHAR> StringData;
+		TArray<FPendingSection> PendingSections;
+	};
+
+	/** Range of a child array, validated against its section */
+	template <typename ElementType>
+	static bool GetRange(TConstArrayView<ElementType> Elements, const FPmxcRange& Range, TConstArrayView<ElementType>& OutRange)
+	{
+		if (static_cast<uint64>(Range.First) + Range.Num > static_cast<uint64>(Elements.Num()))
+		{
+			return false;
+		}
+		OutRange = Elements.Slice(Range.First, Range.Num);
+		return true;
+	}
+}
+
+const TCHAR* FPmxCompactModel::FileExtension = TEXT(".pmxc");
+
+bool FPmxCompactModelView::Initialize(TConstArrayView<uint8> InData)
+{
+	Data = TConstArrayView<uint8>();
+	FMemory::Memzero(Sections);
+
+	if (InData.Num() < static_cast<int32>(sizeof(FPmxcFileHeader)))
+	{
+		return false;
+	}
+	const FPmxcFileHeader& Header = *reinterpret_cast<const FPmxcFileHeader*>(InData.GetData());
+	if (Header.Magic != PmxCompactModelPrivate::FileMagic || Header.Version != FPmxCompactModel::FormatVersion
+		|| Header.HeaderSize != sizeof(FPmxcFileHeader) || Header.FileSize != static_cast<uint64>(InData.Num()))
+	{
+		return false;
+	}
+
+	const uint64 FileSize = InData.Num();
+	if (Header.SectionTableOffset % alignof(FPmxcSectionEntry) != 0
+		|| Header.SectionTableOffset + static_cast<uint64>(Header.NumSections) * sizeof(FPmxcSectionEntry) > FileSize)
+	{
+		return false;
+	}
+
+	const FPmxcSectionEntry* Entries = reinterpret_cast<const FPmxcSectionEntry*>(InData.GetData() + Header.SectionTableOffset);
+	for (uint32 Index = 0; Index < Header.NumSections; ++Index)
+	{
+		const FPmxcSectionEntry& Entry = Entries[Index];
+		if (Entry.Offset % FPmxCompactModel::SectionAlignment != 0 || Entry.ElementSize == 0 || Entry.Count > static_cast<uint64>(MAX_int32)
+			|| Entry.Offset > FileSize || Entry.Count * Entry.ElementSize > FileSize - Entry.Offset)
+		{
+			return false;
+		}
+		// Unknown sections (from a newer writer of the same version) are ignored
+		if (Entry.Id < static_cast<uint32>(EPmxcSection::Count))
+		{
+			Sections[Entry.Id] = &Entry;
+		}
+	}
+
+	Data = InData;
+	return GetSection<FPmxcModelInfo>(EPmxcSection::ModelInfo).Num() == 1;
+}
+
+FString FPmxCompactModelView::GetString(uint32 StringIndex) const
+{
+	const TConstArrayView<FPmxcString> StringTable = GetSection<FPmxcString>(EPmxcSection::StringTable);
+	const TConstArrayView<UTF16CHAR> StringData = GetSection<UTF16CHAR>(EPmxcSection::StringData);
+	if (StringIndex >= static_cast<uint32>(StringTable.Num()))
+	{
+		return FString();
+	}
+	const FPmxcString& Entry = StringTable[StringIndex];
+	if (Entry.Length == 0 || static_cast<uint64>(Entry.Offset) + Entry.Length > static_cast<uint64>(StringData.Num()))
+	{
+		return FString();
+	}
+	return FString(static_cast<int32>(Entry.Length), StringData.GetData() + Entry.Offset);
+}
+
+bool FPmxCompactModelView::MatchesSource(TConstArrayView<uint8> SourceData) const
+{
+	if (Data.Num() == 0 || GetHeader().SourceSize != static_cast<uint64>(SourceData.Num()))
+	{
+		return false;
+	}
+	const FXxHash128 Hash = PmxCompactModelPrivate::HashSource(SourceData);
+	return GetHeader().SourceHashHigh == Hash.HashHigh && GetHeader().SourceHashLow == Hash.HashLow;
+}
+
+bool FPmxCompactModelView::ToModel(FPmxModel& OutModel) const
+{
+	PMX_IMPORT_SCOPE("Compact Model Expand");
+	using namespace PmxCompactModelPrivate;
+
+	if (Data.Num() == 0)
+	{
+		return false;
+	}
+	OutModel = FPmxModel();
+
+	const FPmxcModelInfo& Info = GetSection<FPmxcModelInfo>(EPmxcSection::ModelInfo)[0];
+	FPmxHeader& Header = OutModel.Header;
+	Header.Version = Info.Version;
+	Header.EncodeType = static_cast<uint8>(Info.EncodeType);
+	Header.AdditionalUVNum = static_cast<uint8>(Info.AdditionalUVNum);
+	Header.VertexIndexSize = static_cast<uint8>(Info.VertexIndexSize);
+	Header.TextureIndexSize = static_cast<uint8>(Info.TextureIndexSize);
+	Header.MaterialIndexSize = static_cast<uint8>(Info.MaterialIndexSize);
+	Header.BoneIndexSize = static_cast<uint8>(Info.BoneIndexSize);
+	Header.MorphIndexSize = static_cast<uint8>(Info.MorphIndexSize);
+	Header.RigidbodyIndexSize = static_cast<uint8>(Info.RigidbodyIndexSize);
+	Header.ModelName = GetString(Info.ModelName);
+	Header.ModelNameEng = GetString(Info.ModelNameEng);
+	Header.Comment = GetString(Info.Comment);
+	Header.CommentEng = GetString(Info.CommentEng);
+
+	// Vertices: every per-vertex section must have one element per vertex
+	const TConstArrayView<FVector3f> Positions = GetSection<FVector3f>(EPmxcSection::VertexPositions);
+	const TConstArrayView<FVector3f> Normals = GetSection<FVector3f>(EPmxcSection::VertexNormals);
+	const TConstArrayView<FVector2f> UVs = GetSection<FVector2f>(EPmxcSection::VertexUVs);
+	const TConstArrayView<FVector4f> AdditionalUVs = GetSection<FVector4f>(EPmxcSection::VertexAdditionalUVs);
+	const TConstArrayView<FPmxcVertexSkin> Skins = GetSection<FPmxcVertexSkin>(EPmxcSection::VertexSkin);
+	const TConstArrayView<FIntVector4> BoneIndices = GetSection<FIntVector4>(EPmxcSection::VertexBoneIndices);
+	const TConstArrayView<FVector4f> BoneWeights = GetSection<FVector4f>(EPmxcSection::VertexBoneWeights);
+	const TConstArrayView<FPmxcVertexSdef> Sdefs = GetSection<FPmxcVertexSdef>(EPmxcSection::VertexSdef);
+	const TConstArrayView<float> EdgeScales = GetSection<float>(EPmxcSection::VertexEdgeScales);
+
+	const int32 NumVertices = Positions.Num();
+	const int32 NumAdditionalUVs = Header.AdditionalUVNum;
+	if (Normals.Num() != NumVertices || UVs.Num() != NumVertices || Skins.Num() != NumVertices || BoneIndices.Num() != NumVertices
+		|| BoneWeights.Num() != NumVertices || Sdefs.Num() != NumVertices || EdgeScales.Num() != NumVertices
+		|| AdditionalUVs.Num() != NumVertices * NumAdditionalUVs)
+	{
+		return false;
+	}
+
+	OutModel.Vertices.SetNum(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		FPmxVertex& Vertex = OutModel.Vertices[VertexIndex];
+		Vertex.Position = Positions[VertexIndex];
+		Vertex.Normal = Normals[VertexIndex];
+		Vertex.UV = UVs[VertexIndex];
+		if (NumAdditionalUVs > 0)
+		{
+			Vertex.AdditionalUV.Append(AdditionalUVs.GetData() + VertexIndex * NumAdditionalUVs, NumAdditionalUVs);
+		}
+
+		const FPmxcVertexSkin Skin = Skins[VertexIndex];
+		const int32 NumInfluences = FMath::Min<int32>((Skin >> 8) & 0xFF, 4);
+		Vertex.WeightType = static_cast<uint8>(Skin & 0xFF);
+		Vertex.BoneIndices.SetNumUninitialized(NumInfluences);
+		Vertex.BoneWeights.SetNumUninitialized(NumInfluences);
+		for (int32 Slot = 0; Slot < NumInfluences; ++Slot)
+		{
+			Vertex.BoneIndices[Slot] = BoneIndices[VertexIndex][Slot];
+			Vertex.BoneWeights[Slot] = BoneWeights[VertexIndex][Slot];
+		}
+
+		Vertex.C = Sdefs[VertexIndex].C;
+		Vertex.R0 = Sdefs[VertexIndex].R0;
+		Vertex.R1 = Sdefs[VertexIndex].R1;
+		Vertex.EdgeScale = EdgeScales[VertexIndex];
+	}
+
+	const TConstArrayView<int32> Indices = GetSection<int32>(EPmxcSection::Indices);
+	OutModel.Indices.Append(Indices.GetData(), Indices.Num());
+
+	for (const uint32 TexturePath : GetSection<uint32>(EPmxcSection::Textures))
+	{
+		OutModel.Textures.AddDefaulted_GetRef().TexturePath = GetString(TexturePath);
+	}
+
+	const TConstArrayView<FPmxcMaterial> Materials = GetSection<FPmxcMaterial>(EPmxcSection::Materials);
+	OutModel.Materials.Reserve(Materials.Num());
+	for (const FPmxcMaterial& In : Materials)
+	{
+		FPmxMaterial& Material = OutModel.Materials.AddDefaulted_GetRef();
+		Material.Name = GetString(In.Name);
+		Material.NameEng = GetString(In.NameEng);
+		Material.Memo = GetString(In.Memo);
+		Material.Diffuse = ToLinearColor(In.Diffuse);
+		Material.Specular = In.Specular;
+		Material.SpecularStrength = In.SpecularStrength;
+		Material.Ambient = In.Ambient;
+		Material.DrawingFlags = static_cast<uint8>(In.DrawingFlags);
+		Material.EdgeColor = ToLinearColor(In.EdgeColor);
+		Material.EdgeSize = In.EdgeSize;
+		Material.TextureIndex = In.TextureIndex;
+		Material.SphereTextureIndex = In.SphereTextureIndex;
+		Material.SphereMode = static_cast<uint8>(In.SphereMode);
+		Material.SharedToonFlag = static_cast<uint8>(In.SharedToonFlag);
+		Material.ToonTextureIndex = In.ToonTextureIndex;
+		Material.SurfaceCount = In.SurfaceCount;
+	}
+
+	const TConstArrayView<FPmxcBone> Bones = GetSection<FPmxcBone>(EPmxcSection::Bones);
+	const TConstArrayView<FPmxcIKLink> IKLinks = GetSection<FPmxcIKLink>(EPmxcSection::IKLinks);
+	OutModel.Bones.Reserve(Bones.Num());
+	for (const FPmxcBone& In : Bones)
+	{
+		TConstArrayView<FPmxcIKLink> Links;
+		if (!GetRange(IKLinks, In.IKLinks, Links))
+		{
+			return false;
+		}
+
+		FPmxBone& Bone = OutModel.Bones.AddDefaulted_GetRef();
+		Bone.Name = GetString(In.Name);
+		Bone.NameEng = GetString(In.NameEng);
+		Bone.Position = In.Position;
+		Bone.ParentBoneIndex = In.ParentBoneIndex;
+		Bone.Layer = In.Layer;
+		Bone.BoneFlags = static_cast<uint16>(In.BoneFlags);
+		Bone.ConnectionIndex = In.ConnectionIndex;
+		Bone.Offset = In.Offset;
+		Bone.AdditionalParentIndex = In.AdditionalParentIndex;
+		Bone.AdditionalRatio = In.AdditionalRatio;
+		Bone.AxisDirection = In.AxisDirection;
+		Bone.XAxisDirection = In.XAxisDirection;
+		Bone.ZAxisDirection = In.ZAxisDirection;
+		Bone.ExternalKey = In.ExternalKey;
+		Bone.IKTargetBoneIndex = In.IKTargetBoneIndex;
+		Bone.IKLoopCount = In.IKLoopCount;
+		Bone.IKLimitAngle = In.IKLimitAngle;
+		Bone.IKLinks.Reserve(Links.Num());
+		for (const FPmxcIKLink& InLink : Links)
+		{
+			FPmxBone::FPmxIKLink& Link = Bone.IKLinks.AddDefaulted_GetRef();
+			Link.BoneIndex = InLink.BoneIndex;
+			Link.AngleLimitFlag = static_cast<uint8>(InLink.AngleLimitFlag);
+			Link.LimitMin = InLink.LimitMin;
+			Link.LimitMax = InLink.LimitMax;
+		}
+	}
+
+	const TConstArrayView<FPmxcMorph> Morphs = GetSection<FPmxcMorph>(EPmxcSection::Morphs);
+	const TConstArrayView<FPmxcVertexMorph> VertexOffsets = GetSection<FPmxcVertexMorph>(EPmxcSection::VertexMorphOffsets);
+	const TConstArrayView<FPmxcUVMorph> UVOffsets = GetSection<FPmxcUVMorph>(EPmxcSection::UVMorphOffsets);
+	const TConstArrayView<FPmxcBoneMorph> BoneOffsets = GetSection<FPmxcBoneMorph>(EPmxcSection::BoneMorphOffsets);
+	const TConstArrayView<FPmxcMaterialMorph> MaterialOffsets = GetSection<FPmxcMaterialMorph>(EPmxcSection::MaterialMorphOffsets);
+	const TConstArrayView<FPmxcGroupMorph> GroupOffsets = GetSection<FPmxcGroupMorph>(EPmxcSection::GroupMorphOffsets);
+	OutModel.Morphs.Reserve(Morphs.Num());
+	for (const FPmxcMorph& In : Morphs)
+	{
+		TConstArrayView<FPmxcVertexMorph> InVertex;
+		TConstArrayView<FPmxcUVMorph> InUV;
+		TConstArrayView<FPmxcBoneMorph> InBone;
+		TConstArrayView<FPmxcMaterialMorph> InMaterial;
+		TConstArrayView<FPmxcGroupMorph> InGroup;
+		if (!GetRange(VertexOffsets, In.VertexOffsets, InVertex) || !GetRange(UVOffsets, In.UVOffsets, InUV)
+			|| !GetRange(BoneOffsets, In.BoneOffsets, InBone) || !GetRange(MaterialOffsets, In.MaterialOffsets, InMaterial)
+			|| !GetRange(GroupOffsets, In.GroupOffsets, InGroup))
+		{
+			return false;
+		}
+
+		FPmxMorph& Morph = OutModel.Morphs.AddDefaulted_GetRef();
+		Morph.Name = GetString(In.Name);
+		Morph.NameEng = GetString(In.NameEng);
+		Morph.ControlPanel = static_cast<uint8>(In.ControlPanel);
+		Morph.MorphType = static_cast<uint8>(In.MorphType);
+
+		Morph.VertexMorphs.SetNumUninitialized(InVertex.Num());
+		for (int32 Index = 0; Index < InVertex.Num(); ++Index)
+		{
+			Morph.VertexMorphs[Index].VertexIndex = InVertex[Index].VertexIndex;
+			Morph.VertexMorphs[Index].Offset = InVertex[Index].Offset;
+		}
+		Morph.UVMorphs.SetNumUninitialized(InUV.Num());
+		for (int32 Index = 0; Index < InUV.Num(); ++Index)
+		{
+			Morph.UVMorphs[Index].VertexIndex = InUV[Index].VertexIndex;
+			Morph.UVMorphs[Index].Offset = ToVector4(InUV[Index].Offset);
+		}
+		Morph.BoneMorphs.SetNumUninitialized(InBone.Num());
+		for (int32 Index = 0; Index < InBone.Num(); ++Index)
+		{
+			const float* Rotation = InBone[Index].Rotation;
+			Morph.BoneMorphs[Index].BoneIndex = InBone[Index].BoneIndex;
+			Morph.BoneMorphs[Index].Translation = InBone[Index].Translation;
+			Morph.BoneMorphs[Index].Rotation = FQuat4f(Rotation[0], Rotation[1], Rotation[2], Rotation[3]);
+		}
+		Morph.MaterialMorphs.Reserve(InMaterial.Num());
+		for (const FPmxcMaterialMorph& InOffset : InMaterial)
+		{
+			FPmxMaterialMorph& Offset = Morph.MaterialMorphs.AddDefaulted_GetRef();
+			Offset.MaterialIndex = InOffset.MaterialIndex;
+			Offset.OffsetType = static_cast<uint8>(InOffset.OffsetType);
+			Offset.Diffuse = ToLinearColor(InOffset.Diffuse);
+			Offset.Specular = ToLinearColor(InOffset.Specular);
+			Offset.SpecularStrength = InOffset.SpecularStrength;
+			Offset.Ambient = ToLinearColor(InOffset.Ambient);
+			Offset.EdgeColor = ToLinearColor(InOffset.EdgeColor);
+			Offset.EdgeSize = InOffset.EdgeSize;
+			Offset.TextureColor = ToVector4(InOffset.TextureColor);
+			Offset.SphereTextureColor = ToVector4(InOffset.SphereTextureColor);
+			Offset.ToonTextureColor = ToVector4(InOffset.ToonTextureColor);
+		}
+		Morph.GroupMorphs.SetNumUninitialized(InGroup.Num());
+		for (int32 Index = 0; Index < InGroup.Num(); ++Index)
+		{
+			Morph.GroupMorphs[Index].MorphIndex = InGroup[Index].MorphIndex;
+			Morph.GroupMorphs[Index].MorphRatio = InGroup[Index].MorphRatio;
+		}
+	}
+
+	const TConstArrayView<FPmxcDisplayFrame> DisplayFrames = GetSection<FPmxcDisplayFrame>(EPmxcSection::DisplayFrames);
+	const TConstArrayView<FPmxcDisplayElement> DisplayElements = GetSection<FPmxcDisplayElement>(EPmxcSection::DisplayElements);
+	OutModel.DisplayFrames.Reserve(DisplayFrames.Num());
+	for (const FPmxcDisplayFrame& In : DisplayFrames)
+	{
+		TConstArrayView<FPmxcDisplayElement> Elements;
+		if (!GetRange(DisplayElements, In.Elements, Elements))
+		{
+			return false;
+		}
+
+		FPmxDisplayFrame& Frame = OutModel.DisplayFrames.AddDefaulted_GetRef();
+		Frame.Name = GetString(In.Name);
+		Frame.NameEng = GetString(In.NameEng);
+		Frame.SpecialFlag = static_cast<uint8>(In.SpecialFlag);
+		Frame.Elements.Reserve(Elements.Num());
+		for (const FPmxcDisplayElement& InElement : Elements)
+		{
+			FPmxDisplayFrame::FPmxDisplayElement& Element = Frame.Elements.AddDefaulted_GetRef();
+			Element.ElementTarget = static_cast<uint8>(InElement.ElementTarget);
+			Element.ElementIndex = InElement.ElementIndex;
+		}
+	}
+
+	const TConstArrayView<FPmxcRigidBody> RigidBodies = GetSection<FPmxcRigidBody>(EPmxcSection::RigidBodies);
+	OutModel.RigidBodies.Reserve(RigidBodies.Num());
+	for (const FPmxcRigidBody& In : RigidBodies)
+	{
+		FPmxRigidBody& Body = OutModel.RigidBodies.AddDefaulted_GetRef();
+		Body.Name = GetString(In.Name);
+		Body.NameEng = GetString(In.NameEng);
+		Body.RelatedBoneIndex = In.RelatedBoneIndex;
+		Body.Group = static_cast<uint8>(In.Group);
+		Body.NonCollisionGroup = static_cast<uint16>(In.NonCollisionGroup);
+		Body.Shape = static_cast<uint8>(In.Shape);
+		Body.Size = In.Size;
+		Body.Position = In.Position;
+		Body.Rotation = In.Rotation;
+		Body.Mass = In.Mass;
+		Body.MoveAttenuation = In.MoveAttenuation;
+		Body.RotationAttenuation = In.RotationAttenuation;
+		Body.Repulsion = In.Repulsion;
+		Body.Friction = In.Friction;
+		Body.PhysicsType = static_cast<uint8>(In.PhysicsType);
+	}
+
+	const TConstArrayView<FPmxcJoint> Joints = GetSection<FPmxcJoint>(EPmxcSection::Joints);
+	OutModel.Joints.Reserve(Joints.Num());
+	for (const FPmxcJoint& In : Joints)
+	{
+		FPmxJoint& Joint = OutModel.Joints.AddDefaulted_GetRef();
+		Joint.Name = GetString(In.Name);
+		Joint.NameEng = GetString(In.NameEng);
+		Joint.JointType = static_cast<uint8>(In.JointType);
+		Joint.RigidBodyIndexA = In.RigidBodyIndexA;
+		Joint.RigidBodyIndexB = In.RigidBodyIndexB;
+		Joint.Position = In.Position;
+		Joint.Rotation = In.Rotation;
+		Joint.MoveRestrictionMin = In.MoveRestrictionMin;
+		Joint.MoveRestrictionMax = In.MoveRestrictionMax;
+		Joint.RotationRestrictionMin = In.RotationRestrictionMin;
+		Joint.RotationRestrictionMax = In.RotationRestrictionMax;
+		Joint.SpringMoveCoefficient = In.SpringMoveCoefficient;
+		Joint.SpringRotationCoefficient = In.SpringRotationCoefficient;
+	}
+
+	return true;
+}
+
+FPmxCompactModelFile::~FPmxCompactModelFile()
+{
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+TUniquePtr<FPmxCompactModelFile> FPmxCompactModelFile::Open(const FString& FilePath)
+{
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FPmxCompactModelFile> File(new FPmxCompactModelFile());
+	TConstArrayView<uint8> Data;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FOpenMappedResult MappedResult = PlatformFile.OpenMappedEx(*FilePath);
+	if (!MappedResult.HasError())
+	{
+		File->MappedHandle = MappedResult.StealValue();
+		const int64 FileSize = File->MappedHandle->GetFileSize();
+		if (FileSize > 0)
+		{
+			File->MappedRegion.Reset(File->MappedHandle->MapRegion(0, FileSize));
+		}
+	}
+
+	if (File->MappedRegion.IsValid())
+	{
+		Data = TConstArrayView<uint8>(File->MappedRegion->GetMappedPtr(), static_cast<int32>(File->MappedRegion->GetMappedSize()));
+	}
+	else
+	{
+		// Platforms without file mapping read the file instead
+		File->MappedHandle.Reset();
+		if (!FFileHelper::LoadFileToArray(File->Buffer, *FilePath, FILEREAD_Silent))
+		{
+			return nullptr;
+		}
+		Data = File->Buffer;
+	}
+
+	if (!File->View.Initialize(Data))
+	{
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX CompactModel: '%s' is not a .pmxc file of version %u"), *FilePath, FPmxCompactModel::FormatVersion);
+		return nullptr;
+	}
+	return File;
+}
+
+bool FPmxCompactModel::IsEnabled()
+{
+	return CVarPMXImporterCompactCache.GetValueOnAnyThread() != 0;
+}
+
+void FPmxCompactModel::Write(const FPmxModel& Model, TConstArrayView<uint8> SourceData, TArray<uint8>& OutData)
+{
+	using namespace PmxCompactModelPrivate;
+
+	FWriter Writer;
+	const FPmxHeader& Header = Model.Header;
+
+	TArray<FPmxcModelInfo> Info;
+	FPmxcModelInfo& OutInfo = Info.Add_GetRef(MakeZeroed<FPmxcModelInfo>());
+	OutInfo.Version = Header.Version;
+	OutInfo.EncodeType = Header.EncodeType;
+	OutInfo.AdditionalUVNum = Header.AdditionalUVNum;
+	OutInfo.VertexIndexSize = Header.VertexIndexSize;
+	OutInfo.TextureIndexSize = Header.TextureIndexSize;
+	OutInfo.MaterialIndexSize = Header.MaterialIndexSize;
+	OutInfo.BoneIndexSize = Header.BoneIndexSize;
+	OutInfo.MorphIndexSize = Header.MorphIndexSize;
+	OutInfo.RigidbodyIndexSize = Header.RigidbodyIndexSize;
+	OutInfo.ModelName = Writer.AddString(Header.ModelName);
+	OutInfo.ModelNameEng = Writer.AddString(Header.ModelNameEng);
+	OutInfo.Comment = Writer.AddString(Header.Comment);
+	OutInfo.CommentEng = Writer.AddString(Header.CommentEng);
+
+	// Vertices (SoA)
+	const int32 NumVertices = Model.Vertices.Num();
+	const int32 NumAdditionalUVs = Header.AdditionalUVNum;
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+	TArray<FVector4f> AdditionalUVs;
+	TArray<FPmxcVertexSkin> Skins;
+	TArray<FIntVector4> BoneIndices;
+	TArray<FVector4f> BoneWeights;
+	TArray<FPmxcVertexSdef> Sdefs;
+	TArray<float> EdgeScales;
+	Positions.Reserve(NumVertices);
+	Normals.Reserve(NumVertices);
+	UVs.Reserve(NumVertices);
+	AdditionalUVs.Reserve(NumVertices * NumAdditionalUVs);
+	Skins.Reserve(NumVertices);
+	BoneIndices.Reserve(NumVertices);
+	BoneWeights.Reserve(NumVertices);
+	Sdefs.Reserve(NumVertices);
+	EdgeScales.Reserve(NumVertices);
+	for (const FPmxVertex& Vertex : Model.Vertices)
+	{
+		Positions.Add(Vertex.Position);
+		Normals.Add(Vertex.Normal);
+		UVs.Add(Vertex.UV);
+		for (int32 Channel = 0; Channel < NumAdditionalUVs; ++Channel)
+		{
+			AdditionalUVs.Add(Vertex.AdditionalUV.IsValidIndex(Channel) ? Vertex.AdditionalUV[Channel] : FVector4f::Zero());
+		}
+
+		const int32 NumInfluences = FMath::Min(Vertex.BoneIndices.Num(), 4);
+		FIntVector4 Indices(INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE);
+		FVector4f Weights = FVector4f::Zero();
+		for (int32 Slot = 0; Slot < NumInfluences; ++Slot)
+		{
+			Indices[Slot] = Vertex.BoneIndices[Slot];
+			Weights[Slot] = Vertex.BoneWeights.IsValidIndex(Slot) ? Vertex.BoneWeights[Slot] : 0.0f;
+		}
+		Skins.Add(static_cast<uint32>(Vertex.WeightType) | (static_cast<uint32>(NumInfluences) << 8));
+		BoneIndices.Add(Indices);
+		BoneWeights.Add(Weights);
+
+		FPmxcVertexSdef& Sdef = Sdefs.Add_GetRef(MakeZeroed<FPmxcVertexSdef>());
+		if (Vertex.WeightType == 3)
+		{
+			Sdef.C = Vertex.C;
+			Sdef.R0 = Vertex.R0;
+			Sdef.R1 = Vertex.R1;
+		}
+		EdgeScales.Add(Vertex.EdgeScale);
+	}
+
+	TArray<uint32> Textures;
+	for (const FPmxTexture& Texture : Model.Textures)
+	{
+		Textures.Add(Writer.AddString(Texture.TexturePath));
+	}
+
+	TArray<FPmxcMaterial> Materials;
+	for (const FPmxMaterial& In : Model.Materials)
+	{
+		FPmxcMaterial& Material = Materials.Add_GetRef(MakeZeroed<FPmxcMaterial>());
+		Material.Name = Writer.AddString(In.Name);
+		Material.NameEng = Writer.AddString(In.NameEng);
+		Material.Memo = Writer.AddString(In.Memo);
+		CopyVector4(Material.Diffuse, In.Diffuse);
+		Material.Specular = In.Specular;
+		Material.SpecularStrength = In.SpecularStrength;
+		Material.Ambient = In.Ambient;
+		Material.DrawingFlags = In.DrawingFlags;
+		CopyVector4(Material.EdgeColor, In.EdgeColor);
+		Material.EdgeSize = In.EdgeSize;
+		Material.TextureIndex = In.TextureIndex;
+		Material.SphereTextureIndex = In.SphereTextureIndex;
+		Material.SphereMode = In.SphereMode;
+		Material.SharedToonFlag = In.SharedToonFlag;
+		Material.ToonTextureIndex = In.ToonTextureIndex;
+		Material.SurfaceCount = In.SurfaceCount;
+	}
+
+	TArray<FPmxcBone> Bones;
+	TArray<FPmxcIKLink> IKLinks;
+	for (const FPmxBone& In : Model.Bones)
+	{
+		FPmxcBone& Bone = Bones.Add_GetRef(MakeZeroed<FPmxcBone>());
+		Bone.Name = Writer.AddString(In.Name);
+		Bone.NameEng = Writer.AddString(In.NameEng);
+		Bone.Position = In.Position;
+		Bone.ParentBoneIndex = In.ParentBoneIndex;
+		Bone.Layer = In.Layer;
+		Bone.BoneFlags = In.BoneFlags;
+		Bone.ConnectionIndex = In.ConnectionIndex;
+		Bone.Offset = In.Offset;
+		Bone.AdditionalParentIndex = In.AdditionalParentIndex;
+		Bone.AdditionalRatio = In.AdditionalRatio;
+		Bone.AxisDirection = In.AxisDirection;
+		Bone.XAxisDirection = In.XAxisDirection;
+		Bone.ZAxisDirection = In.ZAxisDirection;
+		Bone.ExternalKey = In.ExternalKey;
+		Bone.IKTargetBoneIndex = In.IKTargetBoneIndex;
+		Bone.IKLoopCount = In.IKLoopCount;
+		Bone.IKLimitAngle = In.IKLimitAngle;
+		Bone.IKLinks = { static_cast<uint32>(IKLinks.Num()), static_cast<uint32>(In.IKLinks.Num()) };
+		for (const FPmxBone::FPmxIKLink& InLink : In.IKLinks)
+		{
+			FPmxcIKLink& Link = IKLinks.Add_GetRef(MakeZeroed<FPmxcIKLink>());
+			Link.BoneIndex = InLink.BoneIndex;
+			Link.AngleLimitFlag = InLink.AngleLimitFlag;
+			Link.LimitMin = InLink.LimitMin;
+			Link.LimitMax = InLink.LimitMax;
+		}
+	}
+
+	TArray<FPmxcMorph> Morphs;
+	TArray<FPmxcVertexMorph> VertexOffsets;
+	TArray<FPmxcUVMorph> UVOffsets;
+	TArray<FPmxcBoneMorph> BoneOffsets;
+	TArray<FPmxcMaterialMorph> MaterialOffsets;
+	TArray<FPmxcGroupMorph> GroupOffsets;
+	for (const FPmxMorph& In : Model.Morphs)
+	{
+		FPmxcMorph& Morph = Morphs.Add_GetRef(MakeZeroed<FPmxcMorph>());
+		Morph.Name = Writer.AddString(In.Name);
+		Morph.NameEng = Writer.AddString(In.NameEng);
+		Morph.ControlPanel = In.ControlPanel;
+		Morph.MorphType = In.MorphType;
+
+		Morph.VertexOffsets = { static_cast<uint32>(VertexOffsets.Num()), static_cast<uint32>(In.VertexMorphs.Num()) };
+		for (const FPmxVertexMorph& Offset : In.VertexMorphs)
+		{
+			VertexOffsets.Add({ Offset.VertexIndex, Offset.Offset });
+		}
+
+		Morph.UVOffsets = { static_cast<uint32>(UVOffsets.Num()), static_cast<uint32>(In.UVMorphs.Num()) };
+		for (const FPmxUVMorph& Offset : In.UVMorphs)
+		{
+			FPmxcUVMorph& Out = UVOffsets.AddDefaulted_GetRef();
+			Out.VertexIndex = Offset.VertexIndex;
+			CopyVector4(Out.Offset, Offset.Offset);
+		}
+
+		Morph.BoneOffsets = { static_cast<uint32>(BoneOffsets.Num()), static_cast<uint32>(In.BoneMorphs.Num()) };
+		for (const FPmxBoneMorph& Offset : In.BoneMorphs)
+		{
+			FPmxcBoneMorph& Out = BoneOffsets.AddDefaulted_GetRef();
+			Out.BoneIndex = Offset.BoneIndex;
+			Out.Translation = Offset.Translation;
+			CopyVector4(Out.Rotation, FVector4f(Offset.Rotation.X, Offset.Rotation.Y, Offset.Rotation.Z, Offset.Rotation.W));
+		}
+
+		Morph.MaterialOffsets = { static_cast<uint32>(MaterialOffsets.Num()), static_cast<uint32>(In.MaterialMorphs.Num()) };
+		for (const FPmxMaterialMorph& Offset : In.MaterialMorphs)
+		{
+			FPmxcMaterialMorph& Out = MaterialOffsets.Add_GetRef(MakeZeroed<FPmxcMaterialMorph>());
+			Out.MaterialIndex = Offset.MaterialIndex;
+			Out.OffsetType = Offset.OffsetType;
+			CopyVector4(Out.Diffuse, Offset.Diffuse);
+			CopyVector4(Out.Specular, Offset.Specular);
+			Out.SpecularStrength = Offset.SpecularStrength;
+			CopyVector4(Out.Ambient, Offset.Ambient);
+			CopyVector4(Out.EdgeColor, Offset.EdgeColor);
+			Out.EdgeSize = Offset.EdgeSize;
+			CopyVector4(Out.TextureColor, Offset.TextureColor);
+			CopyVector4(Out.SphereTextureColor, Offset.SphereTextureColor);
+			CopyVector4(Out.ToonTextureColor, Offset.ToonTextureColor);
+		}
+
+		Morph.GroupOffsets = { static_cast<uint32>(GroupOffsets.Num()), static_cast<uint32>(In.GroupMorphs.Num()) };
+		for (const FPmxGroupMorph& Offset : In.GroupMorphs)
+		{
+			GroupOffsets.Add({ Offset.MorphIndex, Offset.MorphRatio });
+		}
+	}
+
+	TArray<FPmxcDisplayFrame> DisplayFrames;
+	TArray<FPmxcDisplayElement> DisplayElements;
+	for (const FPmxDisplayFrame& In : Model.DisplayFrames)
+	{
+		FPmxcDisplayFrame& Frame = DisplayFrames.Add_GetRef(MakeZeroed<FPmxcDisplayFrame>());
+		Frame.Name = Writer.AddString(In.Name);
+		Frame.NameEng = Writer.AddString(In.NameEng);
+		Frame.SpecialFlag = In.SpecialFlag;
+		Frame.Elements = { static_cast<uint32>(DisplayElements.Num()), static_cast<uint32>(In.Elements.Num()) };
+		for (const FPmxDisplayFrame::FPmxDisplayElement& Element : In.Elements)
+		{
+			DisplayElements.Add({ Element.ElementTarget, Element.ElementIndex });
+		}
+	}
+
+	TArray<FPmxcRigidBody> RigidBodies;
+	for (const FPmxRigidBody& In : Model.RigidBodies)
+	{
+		FPmxcRigidBody& Body = RigidBodies.Add_GetRef(MakeZeroed<FPmxcRigidBody>());
+		Body.Name = Writer.AddString(In.Name);
+		Body.NameEng = Writer.AddString(In.NameEng);
+		Body.RelatedBoneIndex = In.RelatedBoneIndex;
+		Body.Group = In.Group;
+		Body.NonCollisionGroup = In.NonCollisionGroup;
+		Body.Shape = In.Shape;
+		Body.Size = In.Size;
+		Body.Position = In.Position;
+		Body.Rotation = In.Rotation;
+		Body.Mass = In.Mass;
+		Body.MoveAttenuation = In.MoveAttenuation;
+		Body.RotationAttenuation = In.RotationAttenuation;
+		Body.Repulsion = In.Repulsion;
+		Body.Friction = In.Friction;
+		Body.PhysicsType = In.PhysicsType;
+	}
+
+	TArray<FPmxcJoint> Joints;
+	for (const FPmxJoint& In : Model.Joints)
+	{
+		FPmxcJoint& Joint = Joints.Add_GetRef(MakeZeroed<FPmxcJoint>());
+		Joint.Name = Writer.AddString(In.Name);
+		Joint.NameEng = Writer.AddString(In.NameEng);
+		Joint.JointType = In.JointType;
+		Joint.RigidBodyIndexA = In.RigidBodyIndexA;
+		Joint.RigidBodyIndexB = In.RigidBodyIndexB;
+		Joint.Position = In.Position;
+		Joint.Rotation = In.Rotation;
+		Joint.MoveRestrictionMin = In.MoveRestrictionMin;
+		Joint.MoveRestrictionMax = In.MoveRestrictionMax;
+		Joint.RotationRestrictionMin = In.RotationRestrictionMin;
+		Joint.RotationRestrictionMax = In.RotationRestrictionMax;
+		Joint.SpringMoveCoefficient = In.SpringMoveCoefficient;
+		Joint.SpringRotationCoefficient = In.SpringRotationCoefficient;
+	}
+
+	Writer.AddSection(EPmxcSection::ModelInfo, Info);
+	Writer.AddStringSections();
+	Writer.AddSection(EPmxcSection::VertexPositions, Positions);
+	Writer.AddSection(EPmxcSection::VertexNormals, Normals);
+	Writer.AddSection(EPmxcSection::VertexUVs, UVs);
+	Writer.AddSection(EPmxcSection::VertexAdditionalUVs, AdditionalUVs);
+	Writer.AddSection(EPmxcSection::VertexSkin, Skins);
+	Writer.AddSection(EPmxcSection::VertexBoneIndices, BoneIndices);
+	Writer.AddSection(EPmxcSection::VertexBoneWeights, BoneWeights);
+	Writer.AddSection(EPmxcSection::VertexSdef, Sdefs);
+	Writer.AddSection(EPmxcSection::VertexEdgeScales, EdgeScales);
+	Writer.AddSection(EPmxcSection::Indices, Model.Indices);
+	Writer.AddSection(EPmxcSection::Textures, Textures);
+	Writer.AddSection(EPmxcSection::Materials, Materials);
+	Writer.AddSection(EPmxcSection::Bones, Bones);
+	Writer.AddSection(EPmxcSection::IKLinks, IKLinks);
+	Writer.AddSection(EPmxcSection::Morphs, Morphs);
+	Writer.AddSection(EPmxcSection::VertexMorphOffsets, VertexOffsets);
+	Writer.AddSection(EPmxcSection::UVMorphOffsets, UVOffsets);
+	Writer.AddSection(EPmxcSection::BoneMorphOffsets, BoneOffsets);
+	Writer.AddSection(EPmxcSection::MaterialMorphOffsets, MaterialOffsets);
+	Writer.AddSection(EPmxcSection::GroupMorphOffsets, GroupOffsets);
+	Writer.AddSection(EPmxcSection::DisplayFrames, DisplayFrames);
+	Writer.AddSection(EPmxcSection::DisplayElements, DisplayElements);
+	Writer.AddSection(EPmxcSection::RigidBodies, RigidBodies);
+	Writer.AddSection(EPmxcSection::Joints, Joints);
+	Writer.Finish(SourceData, OutData);
+}
+
+bool FPmxCompactModel::SaveToFile(const FString& FilePath, const FPmxModel& Model, TConstArrayView<uint8> SourceData)
+{
+	TArray<uint8> Data;
+	Write(Model, SourceData, Data);
+
+	// Write then rename so a concurrent import never maps a partial file
+	const FString TempPath = FilePath + FString::Printf(TEXT(".%s.tmp"), *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Data, *TempPath) || !IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX CompactModel: Failed to write '%s'"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FPmxCompactModel::LoadFromFile(const FString& FilePath, FPmxModel& OutModel, TConstArrayView<uint8> SourceData)
+{
+	const TUniquePtr<FPmxCompactModelFile> File = FPmxCompactModelFile::Open(FilePath);
+	if (!File.IsValid() || (SourceData.Num() > 0 && !File->GetView().MatchesSource(SourceData)))
+	{
+		return false;
+	}
+	if (!File->GetView().ToModel(OutModel))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX CompactModel: '%s' is corrupt"), *FilePath);
+		OutModel = FPmxModel();
+		return false;
+	}
+	return true;
+}
+
+bool FPmxCompactModel::LoadForSource(const FString& SourceFile, TConstArrayView<uint8> SourceData, FPmxModel& OutModel)
+{
+	PMX_IMPORT_SCOPE("Compact Model Load");
+	using namespace PmxCompactModelPrivate;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (const FString& FilePath : { GetSiblingFilePath(SourceFile), GetCacheFilePath(SourceData) })
+	{
+		if (LoadFromFile(FilePath, OutModel, SourceData))
+		{
+			UE_LOG(LogPMXImporter, Log, TEXT("PMX CompactModel: Loaded '%s' (%d vertices) in %.3f s"),
+				*FilePath, OutModel.Vertices.Num(), FPlatformTime::Seconds() - StartTime);
+			return true;
+		}
+	}
+	return false;
+}
+
+void FPmxCompactModel::StoreForSource(const FString& SourceFile, TConstArrayView<uint8> SourceData, const FPmxModel& Model)
+{
+	PMX_IMPORT_SCOPE("Compact Model Store");
+	using namespace PmxCompactModelPrivate;
+
+	const FString FilePath = CVarPMXImporterCompactCache.GetValueOnAnyThread() == 2 ? GetSiblingFilePath(SourceFile) : GetCacheFilePath(SourceData);
+	if (SaveToFile(FilePath, Model, SourceData))
+	{
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX CompactModel: Wrote '%s'"), *FilePath);
+	}
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxDisplayBuilder.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "Animation/Skeleton.h"
+#include "Animation/BlendProfile.h"
+
+const TCHAR* FPmxDisplayBuilder::BlendProfilePrefix = TEXT("PMX_");
+
+namespace PmxDisplayBuilderPrivate
+{
+	/** Display element targets */
+	static constexpr uint8 TargetBone = 0;
+	static constexpr uint8 TargetMorph = 1;
+
+	static void CollectNames(const FPmxDisplayFrame& Frame, uint8 Target, const TArray<FString>& Names, TArray<FName>& OutNames)
+	{
+		OutNames.Reset();
+		for (const FPmxDisplayFrame::FPmxDisplayElement& Element : Frame.Elements)
+		{
+			if (Element.ElementTarget == Target && Names.IsValidIndex(Element.ElementIndex) && !Names[Element.ElementIndex].IsEmpty())
+			{
+				OutNames.AddUnique(FName(*Names[Element.ElementIndex]));
+			}
+		}
+	}
+}
+
+bool FPmxDisplayBuilder::BuildDisplayDescription(const FPmxModel& PmxModel, const TArray<FString>& BoneNames, const TArray<FString>& MorphNames, FPmxDisplayDescription& OutDescription)
+{
+	PMX_IMPORT_SCOPE("Build Display Groups");
+	using namespace PmxDisplayBuilderPrivate;
+
+	OutDescription = FPmxDisplayDescription();
+	OutDescription.Groups.Reserve(PmxModel.DisplayFrames.Num());
+
+	bool bHasElements = false;
+	for (const FPmxDisplayFrame& Frame : PmxModel.DisplayFrames)
+	{
+		FPmxDisplayGroup& Group = OutDescription.Groups.AddDefaulted_GetRef();
+		Group.Name = Frame.Name;
+		Group.NameEng = Frame.NameEng;
+		Group.bSpecial = Frame.SpecialFlag != 0;
+		CollectNames(Frame, TargetBone, BoneNames, Group.Bones);
+		CollectNames(Frame, TargetMorph, MorphNames, Group.Morphs);
+		bHasElements |= Group.Bones.Num() > 0 || Group.Morphs.Num() > 0;
+	}
+
+	return bHasElements;
+}
+
+void FPmxDisplayBuilder::UpdateBoneGroups(const FPmxModel& PmxModel, const TArray<FString>& BoneNames, FPmxDisplayDescription& InOutDescription)
+{
+	using namespace PmxDisplayBuilderPrivate;
+
+	if (InOutDescription.Groups.Num() != PmxModel.DisplayFrames.Num())
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX DisplayBuilder: %d groups for %d display frames, bone groups not updated"),
+			InOutDescription.Groups.Num(), PmxModel.DisplayFrames.Num());
+		return;
+	}
+
+	for (int32 FrameIndex = 0; FrameIndex < PmxModel.DisplayFrames.Num(); ++FrameIndex)
+	{
+		CollectNames(PmxModel.DisplayFrames[FrameIndex], TargetBone, BoneNames, InOutDescription.Groups[FrameIndex].Bones);
+	}
+}
+
+int32 FPmxDisplayBuilder::ApplyBlendProfiles(USkeleton& Skeleton, const FPmxDisplayDescription& Description)
+{
+	const FReferenceSkeleton& RefSkeleton = Skeleton.GetReferenceSkeleton();
+
+	int32 NumProfiles = 0;
+	for (const FPmxDisplayGroup& Group : Description.Groups)
+	{
+		if (Group.Bones.IsEmpty())
+		{
+			continue;
+		}
+
+		const FName ProfileName(FString(BlendProfilePrefix) + (Group.NameEng.IsEmpty() ? Group.Name : Group.NameEng));
+		UBlendProfile* Profile = Skeleton.GetBlendProfile(ProfileName);
+		if (!Profile)
+		{
+			Profile = Skeleton.CreateNewBlendProfile(ProfileName);
+		}
+		if (!Profile)
+		{
+			continue;
+		}
+
+		Profile->Modify();
+		for (const FName BoneName : Group.Bones)
+		{
+			if (RefSkeleton.FindBoneIndex(BoneName) != INDEX_NONE)
+			{
+				Profile->SetBoneBlendScale(BoneName, 1.f, false, true);
+			}
+		}
+		++NumProfiles;
+	}
+
+	if (NumProfiles > 0)
+	{
+		Skeleton.MarkPackageDirty();
+	}
+	return NumProfiles;
+}
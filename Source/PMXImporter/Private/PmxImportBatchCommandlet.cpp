@@ -0,0 +1,416 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportBatchCommandlet.h"
+#include "PmxImportSession.h"
+#include "PmxRigDefinition.h"
+#include "PmxSdefData.h"
+#include "PmxDisplayData.h"
+#include "PmxPostImportQueue.h"
+#include "PmxUtils.h"
+#include "LogPMXImporter.h"
+#include "InterchangeManager.h"
+#include "InterchangeResult.h"
+#include "InterchangeResultsContainer.h"
+#include "Animation/MorphTarget.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "Rendering/SkeletalMeshModel.h"
+#include "Rendering/SkeletalMeshLODModel.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "Hash/CityHash.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxImportBatchCommandlet)
+
+namespace PmxImportBatchPrivate
+{
+	/** Main thread sleep between ticks while imports are in flight */
+	static constexpr float TickSleepSeconds = 0.005f;
+
+	/** One model import (one pass) */
+	struct FJob
+	{
+		FString SourceFile;
+		FString DestPath;
+
+		UE::Interchange::FAssetImportResultPtr Result;
+		double StartTime = 0.0;
+		double Seconds = 0.0;
+
+		bool bSucceeded = false;
+		FString Error;
+		int32 NumAssets = 0;
+
+		/** Per asset digest text keyed by package path relative to DestPath */
+		TMap<FString, FString> AssetDigests;
+		FString Digest;
+	};
+
+	static void TickMainThread()
+	{
+		// Interchange completes factories and post-import pipelines on the game thread
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
+		FPlatformProcess::Sleep(TickSleepSeconds);
+	}
+
+	static FString CsvEscape(const FString& Value)
+	{
+		if (Value.Contains(TEXT(",")) || Value.Contains(TEXT("\"")) || Value.Contains(TEXT("\n")))
+		{
+			return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+		}
+		return Value;
+	}
+
+	static void AppendTransform(FString& Out, const FTransform& Transform)
+	{
+		const FVector Location = Transform.GetLocation();
+		const FQuat Rotation = Transform.GetRotation();
+		Out += FString::Printf(TEXT(" (%.3f,%.3f,%.3f|%.4f,%.4f,%.4f,%.4f)"),
+			Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+	}
+
+	/** Content of one imported asset that a serial and a concurrent import must agree on */
+	static FString DigestAsset(const UObject* Asset)
+	{
+		FString Out = Asset->GetClass()->GetName();
+
+		if (const USkeletalMesh* Mesh = Cast<USkeletalMesh>(Asset))
+		{
+			const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+			for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+			{
+				Out += FString::Printf(TEXT("\nBone %s %d"), *RefSkeleton.GetBoneName(BoneIndex).ToString(), RefSkeleton.GetParentIndex(BoneIndex));
+				AppendTransform(Out, RefSkeleton.GetRefBonePose()[BoneIndex]);
+			}
+			for (const UMorphTarget* MorphTarget : Mesh->GetMorphTargets())
+			{
+				Out += FString::Printf(TEXT("\nMorph %s"), MorphTarget ? *MorphTarget->GetName() : TEXT("None"));
+			}
+			for (const FSkeletalMaterial& Material : Mesh->GetMaterials())
+			{
+				Out += FString::Printf(TEXT("\nSlot %s"), *Material.MaterialSlotName.ToString());
+			}
+
+			const FSkeletalMeshModel* ImportedModel = Mesh->GetImportedModel();
+			if (ImportedModel && ImportedModel->LODModels.Num() > 0)
+			{
+				const FSkeletalMeshLODModel& LODModel = ImportedModel->LODModels[0];
+				uint64 PositionHash = 0;
+				for (const FSkelMeshSection& Section : LODModel.Sections)
+				{
+					Out += FString::Printf(TEXT("\nSection %d %d %d"), Section.MaterialIndex, Section.NumTriangles, Section.SoftVertices.Num());
+					for (const FSoftSkinVertex& Vertex : Section.SoftVertices)
+					{
+						const FIntVector Quantized(FMath::RoundToInt(Vertex.Position.X * 1000.f), FMath::RoundToInt(Vertex.Position.Y * 1000.f), FMath::RoundToInt(Vertex.Position.Z * 1000.f));
+						PositionHash = CityHash64WithSeed(reinterpret_cast<const char*>(&Quantized), sizeof(Quantized), PositionHash);
+					}
+				}
+				Out += FString::Printf(TEXT("\nLOD0 %d vertices %016llx"), LODModel.NumVertices, PositionHash);
+			}
+
+			if (const UPmxSdefUserData* SdefData = const_cast<USkeletalMesh*>(Mesh)->GetAssetUserData<UPmxSdefUserData>())
+			{
+				Out += FString::Printf(TEXT("\nSdef %d/%d %d"), SdefData->Description.Vertices.Num(), SdefData->Description.NumMeshVertices, SdefData->Description.PackedUVChannel);
+			}
+			if (const UPmxDisplayUserData* DisplayData = const_cast<USkeletalMesh*>(Mesh)->GetAssetUserData<UPmxDisplayUserData>())
+			{
+				for (const FPmxDisplayGroup& Group : DisplayData->Description.Groups)
+				{
+					Out += FString::Printf(TEXT("\nDisplay %s %d %d"), *Group.Name, Group.BoneIndices.Num(), Group.MorphIndices.Num());
+				}
+			}
+		}
+		else if (const USkeleton* Skeleton = Cast<USkeleton>(Asset))
+		{
+			const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+			for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+			{
+				Out += FString::Printf(TEXT("\nBone %s %d"), *RefSkeleton.GetBoneName(BoneIndex).ToString(), RefSkeleton.GetParentIndex(BoneIndex));
+			}
+		}
+		else if (const UPhysicsAsset* PhysicsAsset = Cast<UPhysicsAsset>(Asset))
+		{
+			for (const USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
+			{
+				if (BodySetup)
+				{
+					Out += FString::Printf(TEXT("\nBody %s %d %d"), *BodySetup->BoneName.ToString(), BodySetup->AggGeom.GetElementCount(), static_cast<int32>(BodySetup->PhysicsType));
+				}
+			}
+			Out += FString::Printf(TEXT("\nConstraints %d"), PhysicsAsset->ConstraintSetup.Num());
+		}
+		else if (const UPmxRigDefinition* Rig = Cast<UPmxRigDefinition>(Asset))
+		{
+			Out += FString::Printf(TEXT("\nRig %d bones %d steps %d IK %d append"),
+				Rig->Description.Bones.Num(), Rig->Description.Steps.Num(), Rig->Description.IKChains.Num(), Rig->Description.Appends.Num());
+		}
+
+		return Out;
+	}
+
+	/** Digest every asset under the job folder and save the dirty packages */
+	static void FinishJob(FJob& Job)
+	{
+		Job.Seconds = FPlatformTime::Seconds() - Job.StartTime;
+
+		TArray<FString> Errors;
+		if (const UInterchangeResultsContainer* Results = Job.Result->GetResults())
+		{
+			for (const UInterchangeResult* Result : Results->GetResults())
+			{
+				if (Result && Result->GetResultType() == EInterchangeResultType::Error)
+				{
+					Errors.Add(Result->GetText().ToString());
+				}
+			}
+		}
+
+		TArray<FAssetData> Assets;
+		IAssetRegistry::GetChecked().GetAssetsByPath(FName(*Job.DestPath), Assets, true, false);
+		Assets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.Error = GWarn;
+		FString DigestText;
+		for (const FAssetData& AssetData : Assets)
+		{
+			UObject* Asset = AssetData.GetAsset();
+			if (!Asset)
+			{
+				continue;
+			}
+
+			FString RelativePath = AssetData.PackageName.ToString();
+			RelativePath.RightChopInline(Job.DestPath.Len());
+			const FString AssetDigest = DigestAsset(Asset);
+			Job.AssetDigests.Add(RelativePath, AssetDigest);
+			DigestText += RelativePath + TEXT("\n") + AssetDigest + TEXT("\n");
+
+			UPackage* Package = Asset->GetPackage();
+			if (Package && Package->IsDirty())
+			{
+				const FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+				if (!UPackage::SavePackage(Package, nullptr, *PackageFilename, SaveArgs))
+				{
+					Errors.Add(FString::Printf(TEXT("Failed to save %s"), *Package->GetName()));
+				}
+			}
+		}
+
+		const FTCHARToUTF8 Utf8(*DigestText);
+		Job.Digest = FString::Printf(TEXT("%016llx"), CityHash64(Utf8.Get(), Utf8.Length()));
+		Job.NumAssets = Job.AssetDigests.Num();
+		Job.Error = FString::Join(Errors, TEXT("; "));
+		Job.bSucceeded = Job.NumAssets > 0 && Errors.IsEmpty();
+	}
+
+	/** Run every job with at most Concurrency imports in flight; returns the number of successful imports */
+	static int32 RunPass(TArray<FJob>& Jobs, int32 Concurrency, const TCHAR* PassName)
+	{
+		UInterchangeManager& InterchangeManager = UInterchangeManager::GetInterchangeManager();
+		const double PassStartTime = FPlatformTime::Seconds();
+
+		TArray<int32> InFlight;
+		int32 NextJob = 0;
+		int32 NumSucceeded = 0;
+		while (NextJob < Jobs.Num() || InFlight.Num() > 0)
+		{
+			while (NextJob < Jobs.Num() && InFlight.Num() < Concurrency)
+			{
+				FJob& Job = Jobs[NextJob];
+				FImportAssetParameters ImportParameters;
+				ImportParameters.bIsAutomated = true;
+				Job.StartTime = FPlatformTime::Seconds();
+				Job.Result = InterchangeManager.ImportAssetAsync(Job.DestPath, UInterchangeManager::CreateSourceData(Job.SourceFile), ImportParameters);
+				InFlight.Add(NextJob++);
+			}
+
+			TickMainThread();
+
+			for (int32 Index = InFlight.Num() - 1; Index >= 0; --Index)
+			{
+				FJob& Job = Jobs[InFlight[Index]];
+				// Queued post-import steps (a material waiting for its texture) belong to some finished import
+				if (Job.Result->GetStatus() != UE::Interchange::FImportResult::EStatus::Done || FPmxPostImportQueue::GetNumPending() > 0)
+				{
+					continue;
+				}
+				InFlight.RemoveAtSwap(Index);
+				FinishJob(Job);
+				NumSucceeded += Job.bSucceeded ? 1 : 0;
+				if (!Job.bSucceeded)
+				{
+					UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBatch: [%s] %s failed: %s"), PassName, *Job.SourceFile, Job.Error.IsEmpty() ? TEXT("No asset imported") : *Job.Error);
+				}
+			}
+		}
+
+		const double PassSeconds = FPlatformTime::Seconds() - PassStartTime;
+		UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBatch: [%s] %d/%d models imported in %.1f s with %d concurrent imports (%.2f models/s)"),
+			PassName, NumSucceeded, Jobs.Num(), PassSeconds, Concurrency, PassSeconds > 0.0 ? Jobs.Num() / PassSeconds : 0.0);
+		return NumSucceeded;
+	}
+
+	static TArray<FJob> MakeJobs(const TArray<FString>& Files, const TArray<FString>& FolderNames, const FString& DestPath)
+	{
+		TArray<FJob> Jobs;
+		Jobs.SetNum(Files.Num());
+		for (int32 Index = 0; Index < Files.Num(); ++Index)
+		{
+			Jobs[Index].SourceFile = Files[Index];
+			Jobs[Index].DestPath = DestPath / FolderNames[Index];
+		}
+		return Jobs;
+	}
+}
+
+UPmxImportBatchCommandlet::UPmxImportBatchCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPmxImportBatchCommandlet::Main(const FString& Params)
+{
+	using namespace PmxImportBatchPrivate;
+
+	FString SourceDir;
+	FString DestPath;
+	if (!FParse::Value(*Params, TEXT("Source="), SourceDir) || !FParse::Value(*Params, TEXT("Dest="), DestPath))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PmxImportBatch: Usage: -run=PmxImportBatch -Source=<PMX directory> -Dest=<Content path> [-Concurrency=N] [-Soak] [-Report=<Csv path>]"));
+		return 1;
+	}
+
+	int32 Concurrency = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn() / 2, 1);
+	FParse::Value(*Params, TEXT("Concurrency="), Concurrency);
+	Concurrency = FMath::Max(Concurrency, 1);
+	const bool bSoak = FParse::Param(*Params, TEXT("Soak"));
+
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("PmxImportBatch") / (FDateTime::Now().ToString() + TEXT(".csv"));
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+
+	// PMX models usually sit in their own folder next to their textures
+	TArray<FString> Files;
+	IFileManager::Get().FindFilesRecursive(Files, *SourceDir, TEXT("*.pmx"), true, false);
+	Files.Sort();
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBatch: No .pmx files in '%s'"), *SourceDir);
+		return 0;
+	}
+
+	// One content folder per model so concurrent imports never write the same package
+	TArray<FString> FolderNames;
+	TSet<FString> UsedFolderNames;
+	for (const FString& File : Files)
+	{
+		const FString BaseName = FPmxUtils::SanitizePackagePath(FPaths::GetBaseFilename(File));
+		FString FolderName = BaseName;
+		for (int32 Suffix = 1; UsedFolderNames.Contains(FolderName); ++Suffix)
+		{
+			FolderName = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+		}
+		UsedFolderNames.Add(FolderName);
+		FolderNames.Add(FolderName);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBatch: %d models -> %s (%d concurrent imports%s)"),
+		Files.Num(), *DestPath, Concurrency, bSoak ? TEXT(", soak test") : TEXT(""));
+
+	FString Csv = TEXT("File,Pass,Status,Error,Seconds,Assets,Digest,MatchesSerial\n");
+	auto AddRows = [&Csv](const TArray<FJob>& Jobs, const TCHAR* PassName, const TArray<FJob>* SerialJobs)
+	{
+		for (int32 Index = 0; Index < Jobs.Num(); ++Index)
+		{
+			const FJob& Job = Jobs[Index];
+			const TCHAR* Match = SerialJobs ? ((*SerialJobs)[Index].Digest == Job.Digest ? TEXT("YES") : TEXT("NO")) : TEXT("");
+			Csv += FString::Printf(TEXT("%s,%s,%s,%s,%.2f,%d,%s,%s\n"),
+				*CsvEscape(Job.SourceFile), PassName, Job.bSucceeded ? TEXT("OK") : TEXT("FAILED"), *CsvEscape(Job.Error),
+				Job.Seconds, Job.NumAssets, *Job.Digest, Match);
+		}
+	};
+
+	int32 ExitCode = 0;
+	if (!bSoak)
+	{
+		TArray<FJob> Jobs = MakeJobs(Files, FolderNames, DestPath);
+		ExitCode = RunPass(Jobs, Concurrency, TEXT("Batch")) == Jobs.Num() ? 0 : 1;
+		AddRows(Jobs, TEXT("Batch"), nullptr);
+	}
+	else
+	{
+		// Serial reference first, then the same models concurrently into a second folder
+		TArray<FJob> SerialJobs = MakeJobs(Files, FolderNames, DestPath / TEXT("Serial"));
+		RunPass(SerialJobs, 1, TEXT("Serial"));
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		TArray<FJob> ConcurrentJobs = MakeJobs(Files, FolderNames, DestPath / TEXT("Concurrent"));
+		RunPass(ConcurrentJobs, Concurrency, TEXT("Concurrent"));
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Files.Num(); ++Index)
+		{
+			const FJob& Serial = SerialJobs[Index];
+			const FJob& Concurrent = ConcurrentJobs[Index];
+			if (Serial.bSucceeded && Concurrent.bSucceeded && Serial.Digest == Concurrent.Digest)
+			{
+				continue;
+			}
+
+			++NumMismatches;
+			FString FirstDifference = TEXT("import failed");
+			for (const TPair<FString, FString>& Pair : Serial.AssetDigests)
+			{
+				const FString* Other = Concurrent.AssetDigests.Find(Pair.Key);
+				if (!Other || *Other != Pair.Value)
+				{
+					FirstDifference = Other ? FString::Printf(TEXT("'%s' differs"), *Pair.Key) : FString::Printf(TEXT("'%s' missing"), *Pair.Key);
+					break;
+				}
+			}
+			if (Serial.AssetDigests.Num() != Concurrent.AssetDigests.Num() && FirstDifference == TEXT("import failed"))
+			{
+				FirstDifference = FString::Printf(TEXT("%d assets vs %d"), Serial.AssetDigests.Num(), Concurrent.AssetDigests.Num());
+			}
+			UE_LOG(LogPMXImporter, Error, TEXT("PmxImportBatch: Soak mismatch for %s: %s"), *Files[Index], *FirstDifference);
+		}
+
+		AddRows(SerialJobs, TEXT("Serial"), nullptr);
+		AddRows(ConcurrentJobs, TEXT("Concurrent"), &SerialJobs);
+		UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBatch: Soak test %s (%d/%d models identical)"),
+			NumMismatches == 0 ? TEXT("passed") : TEXT("FAILED"), Files.Num() - NumMismatches, Files.Num());
+		ExitCode = NumMismatches == 0 ? 0 : 1;
+	}
+
+	// Sessions are owned by translators and pipelines; none may outlive its import
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const int32 NumLiveSessions = FPmxImportSessionRegistry::GetNumSessions();
+	if (NumLiveSessions > 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBatch: %d import sessions still alive after the batch"), NumLiveSessions);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBatch: Failed to write report '%s'"), *ReportPath);
+	}
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBatch: Report: %s"), *ReportPath);
+
+	return ExitCode;
+}
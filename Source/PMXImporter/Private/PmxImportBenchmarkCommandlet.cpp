@@ -0,0 +1,497 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportBenchmarkCommandlet.h"
+#include "PmxReader.h"
+#include "PmxStructs.h"
+#include "PmxSyntheticModel.h"
+#include "PmxWriter.h"
+#include "PmxPostImportQueue.h"
+#include "LogPMXImporter.h"
+#include "InterchangeManager.h"
+#include "InterchangeResult.h"
+#include "InterchangeResultsContainer.h"
+#include "Engine/SkeletalMesh.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxImportBenchmarkCommandlet)
+
+namespace PmxImportBenchmarkPrivate
+{
+	/** Main thread sleep between ticks while an import is in flight */
+	static constexpr float TickSleepSeconds = 0.002f;
+
+	/** Absolute slack added to the relative tolerance so tiny cases do not fail on timer noise */
+	static constexpr double ParseSlackSeconds = 0.02;
+	static constexpr double ImportSlackSeconds = 0.1;
+	static constexpr double MemorySlackMB = 32.0;
+
+	struct FCaseResult
+	{
+		FPmxSyntheticModelSpec Spec;
+		bool bSucceeded = false;
+		FString Error;
+
+		int64 FileBytes = 0;
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+		int32 NumJoints = 0;
+
+		/** Best parse and median import of all iterations; largest memory peak */
+		double ParseSeconds = 0.0;
+		double ImportSeconds = 0.0;
+		double PeakMemoryMB = 0.0;
+	};
+
+	static FString GetCaseName(const FPmxSyntheticModelSpec& Spec)
+	{
+		const FString Vertices = Spec.NumVertices >= 1000000 && Spec.NumVertices % 1000000 == 0
+			? FString::Printf(TEXT("%dM"), Spec.NumVertices / 1000000)
+			: FString::Printf(TEXT("%dk"), Spec.NumVertices / 1000);
+		return FString::Printf(TEXT("V%s_M%d_B%d_I%d_%s"), *Vertices, Spec.NumMorphs, Spec.NumBodies, Spec.IndexSize,
+			Spec.EncodeType == 1 ? TEXT("UTF8") : TEXT("UTF16"));
+	}
+
+	/** One axis varied at a time around a mid-sized model, plus every index width and encoding on a small one */
+	static TArray<FPmxSyntheticModelSpec> MakeCases(bool bQuick)
+	{
+		TArray<FPmxSyntheticModelSpec> Cases;
+		auto AddCase = [&Cases](int32 NumVertices, int32 NumMorphs, int32 NumBodies, uint8 IndexSize, uint8 EncodeType)
+		{
+			FPmxSyntheticModelSpec Spec;
+			Spec.NumVertices = NumVertices;
+			Spec.NumMorphs = NumMorphs;
+			Spec.NumBodies = NumBodies;
+			Spec.IndexSize = IndexSize;
+			Spec.EncodeType = EncodeType;
+			Spec.Name = GetCaseName(Spec);
+			if (!Cases.ContainsByPredicate([&Spec](const FPmxSyntheticModelSpec& Other) { return Other.Name == Spec.Name; }))
+			{
+				Cases.Add(Spec);
+			}
+		};
+
+		for (const int32 NumVertices : { 10000, 100000, 500000, 2000000 })
+		{
+			if (!bQuick || NumVertices <= 100000)
+			{
+				AddCase(NumVertices, 50, 50, 4, 0);
+			}
+		}
+		for (const int32 NumMorphs : { 0, 100, 1000 })
+		{
+			AddCase(50000, NumMorphs, 50, 4, 0);
+		}
+		for (const int32 NumBodies : { 0, 100, 1000 })
+		{
+			AddCase(50000, 50, NumBodies, 4, 0);
+		}
+		for (const uint8 IndexSize : { 1, 2, 4 })
+		{
+			for (const uint8 EncodeType : { 0, 1 })
+			{
+				AddCase(10000, 50, 50, IndexSize, EncodeType);
+			}
+		}
+		return Cases;
+	}
+
+	/** The corpus is only useful if the reader sees exactly what the generator wrote */
+	static bool CheckRoundTrip(const FPmxModel& Generated, const FPmxModel& Parsed, FString& OutError)
+	{
+		struct FCount { const TCHAR* Name; int32 Written; int32 Read; };
+		const FCount Counts[] = {
+			{ TEXT("vertices"), Generated.Vertices.Num(), Parsed.Vertices.Num() },
+			{ TEXT("indices"), Generated.Indices.Num(), Parsed.Indices.Num() },
+			{ TEXT("materials"), Generated.Materials.Num(), Parsed.Materials.Num() },
+			{ TEXT("bones"), Generated.Bones.Num(), Parsed.Bones.Num() },
+			{ TEXT("morphs"), Generated.Morphs.Num(), Parsed.Morphs.Num() },
+			{ TEXT("display frames"), Generated.DisplayFrames.Num(), Parsed.DisplayFrames.Num() },
+			{ TEXT("rigid bodies"), Generated.RigidBodies.Num(), Parsed.RigidBodies.Num() },
+			{ TEXT("joints"), Generated.Joints.Num(), Parsed.Joints.Num() },
+		};
+		for (const FCount& Count : Counts)
+		{
+			if (Count.Written != Count.Read)
+			{
+				OutError = FString::Printf(TEXT("Round trip: %d %s written, %d read"), Count.Written, Count.Name, Count.Read);
+				return false;
+			}
+		}
+		if (Generated.Header.ModelName != Parsed.Header.ModelName || (Generated.Bones.Num() > 0 && Generated.Bones.Last().Name != Parsed.Bones.Last().Name))
+		{
+			OutError = TEXT("Round trip: names differ (string encoding)");
+			return false;
+		}
+		if (Generated.Indices != Parsed.Indices)
+		{
+			OutError = TEXT("Round trip: indices differ");
+			return false;
+		}
+		return true;
+	}
+
+	static void TickMainThread()
+	{
+		// Interchange completes factories and post-import pipelines on the game thread
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
+		FPlatformProcess::Sleep(TickSleepSeconds);
+	}
+
+	/** Drop the imported assets so the next iteration starts from the same memory state */
+	static void ReleaseImportedAssets(const FString& DestPath)
+	{
+		TArray<FAssetData> Assets;
+		IAssetRegistry::GetChecked().GetAssetsByPath(FName(*DestPath), Assets, true, false);
+		for (const FAssetData& AssetData : Assets)
+		{
+			if (UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString()))
+			{
+				ForEachObjectWithPackage(Package, [](UObject* Object)
+				{
+					Object->ClearFlags(RF_Standalone | RF_Public);
+					Object->MarkAsGarbage();
+					return true;
+				});
+				Package->MarkAsGarbage();
+			}
+		}
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	/** Import one file with Interchange and wait for post-import; returns false if the expected assets are missing */
+	static bool ImportOnce(const FPmxSyntheticModelSpec& Spec, const FString& File, const FString& DestPath, double& OutSeconds, double& OutPeakMemoryMB, FString& OutError)
+	{
+		const FPlatformMemoryStats StartStats = FPlatformMemory::GetStats();
+		uint64 MaxUsedPhysical = StartStats.UsedPhysical;
+
+		FImportAssetParameters ImportParameters;
+		ImportParameters.bIsAutomated = true;
+		const double StartTime = FPlatformTime::Seconds();
+		UE::Interchange::FAssetImportResultPtr Result = UInterchangeManager::GetInterchangeManager().ImportAssetAsync(
+			DestPath, UInterchangeManager::CreateSourceData(File), ImportParameters);
+		// Material steps waiting for their texture stay queued until the import has created it
+		while (Result->GetStatus() != UE::Interchange::FImportResult::EStatus::Done || FPmxPostImportQueue::GetNumPending() > 0)
+		{
+			TickMainThread();
+			MaxUsedPhysical = FMath::Max<uint64>(MaxUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+		}
+		OutSeconds = FPlatformTime::Seconds() - StartTime;
+
+		// Sampling misses short spikes on worker threads; the process peak catches them when it moves
+		const FPlatformMemoryStats EndStats = FPlatformMemory::GetStats();
+		const uint64 PeakDelta = FMath::Max<uint64>(MaxUsedPhysical - StartStats.UsedPhysical,
+			EndStats.PeakUsedPhysical > StartStats.PeakUsedPhysical ? EndStats.PeakUsedPhysical - StartStats.UsedPhysical : 0);
+		OutPeakMemoryMB = PeakDelta / (1024.0 * 1024.0);
+
+		TArray<FString> Errors;
+		if (const UInterchangeResultsContainer* Results = Result->GetResults())
+		{
+			for (const UInterchangeResult* ImportResult : Results->GetResults())
+			{
+				if (ImportResult && ImportResult->GetResultType() == EInterchangeResultType::Error)
+				{
+					Errors.Add(ImportResult->GetText().ToString());
+				}
+			}
+		}
+
+		bool bHasMesh = false;
+		bool bHasPhysics = false;
+		for (const UObject* Object : Result->GetImportedObjects())
+		{
+			bHasMesh |= Object && Object->IsA<USkeletalMesh>();
+			const UPhysicsAsset* PhysicsAsset = Cast<UPhysicsAsset>(Object);
+			bHasPhysics |= PhysicsAsset && PhysicsAsset->SkeletalBodySetups.Num() > 0;
+		}
+		if (!bHasMesh)
+		{
+			Errors.Add(TEXT("No skeletal mesh imported"));
+		}
+		if (Spec.NumBodies > 0 && !bHasPhysics)
+		{
+			Errors.Add(TEXT("No physics bodies built"));
+		}
+
+		OutError = FString::Join(Errors, TEXT("; "));
+		return Errors.IsEmpty();
+	}
+
+	static FCaseResult RunCase(const FPmxSyntheticModelSpec& Spec, const FString& CorpusDir, const FString& DestPath, int32 Iterations)
+	{
+		FCaseResult CaseResult;
+		CaseResult.Spec = Spec;
+
+		FPmxModel Generated;
+		FPmxSyntheticModel::Generate(Spec, Generated);
+		CaseResult.NumVertices = Generated.Vertices.Num();
+		CaseResult.NumIndices = Generated.Indices.Num();
+		CaseResult.NumJoints = Generated.Joints.Num();
+
+		TArray<uint8> Data;
+		const FString File = CorpusDir / Spec.Name + TEXT(".pmx");
+		if (!PMXWriter::SavePmxToData(Generated, Data) || !FFileHelper::SaveArrayToFile(Data, *File))
+		{
+			CaseResult.Error = TEXT("Failed to write the model");
+			return CaseResult;
+		}
+		CaseResult.FileBytes = Data.Num();
+
+		TArray<double> ImportTimes;
+		CaseResult.ParseSeconds = TNumericLimits<double>::Max();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			FPmxModel Parsed;
+			const double ParseStart = FPlatformTime::Seconds();
+			const bool bParsed = PMXReader::LoadPmxFromData(Data, Parsed);
+			CaseResult.ParseSeconds = FMath::Min(CaseResult.ParseSeconds, FPlatformTime::Seconds() - ParseStart);
+			if (!bParsed || (Iteration == 0 && !CheckRoundTrip(Generated, Parsed, CaseResult.Error)))
+			{
+				CaseResult.Error = CaseResult.Error.IsEmpty() ? TEXT("Failed to parse the model") : CaseResult.Error;
+				return CaseResult;
+			}
+			Parsed = FPmxModel();
+
+			double Seconds = 0.0;
+			double PeakMemoryMB = 0.0;
+			const FString IterationPath = DestPath / FString::Printf(TEXT("%s_%d"), *Spec.Name, Iteration);
+			const bool bImported = ImportOnce(Spec, File, IterationPath, Seconds, PeakMemoryMB, CaseResult.Error);
+			ReleaseImportedAssets(IterationPath);
+			if (!bImported)
+			{
+				return CaseResult;
+			}
+			ImportTimes.Add(Seconds);
+			CaseResult.PeakMemoryMB = FMath::Max(CaseResult.PeakMemoryMB, PeakMemoryMB);
+		}
+
+		ImportTimes.Sort();
+		CaseResult.ImportSeconds = ImportTimes[ImportTimes.Num() / 2];
+		CaseResult.bSucceeded = true;
+		return CaseResult;
+	}
+
+	static TSharedRef<FJsonObject> MakeReport(const TArray<FCaseResult>& Results)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("PMXImporter"));
+		Root->SetStringField(TEXT("plugin_version"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown"));
+		Root->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+		Root->SetStringField(TEXT("date"), FDateTime::Now().ToIso8601());
+		Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Root->SetNumberField(TEXT("cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Root->SetNumberField(TEXT("physical_memory_gb"), FPlatformMemory::GetConstants().TotalPhysicalGB);
+
+		TArray<TSharedPtr<FJsonValue>> Cases;
+		for (const FCaseResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> Case = MakeShared<FJsonObject>();
+			Case->SetStringField(TEXT("name"), Result.Spec.Name);
+			Case->SetStringField(TEXT("status"), Result.bSucceeded ? TEXT("OK") : TEXT("FAILED"));
+			Case->SetStringField(TEXT("error"), Result.Error);
+			Case->SetNumberField(TEXT("vertices"), Result.NumVertices);
+			Case->SetNumberField(TEXT("indices"), Result.NumIndices);
+			Case->SetNumberField(TEXT("morphs"), Result.Spec.NumMorphs);
+			Case->SetNumberField(TEXT("bodies"), Result.Spec.NumBodies);
+			Case->SetNumberField(TEXT("joints"), Result.NumJoints);
+			Case->SetNumberField(TEXT("index_size"), Result.Spec.IndexSize);
+			Case->SetStringField(TEXT("encoding"), Result.Spec.EncodeType == 1 ? TEXT("UTF-8") : TEXT("UTF-16"));
+			Case->SetNumberField(TEXT("file_bytes"), static_cast<double>(Result.FileBytes));
+			Case->SetNumberField(TEXT("parse_seconds"), Result.ParseSeconds);
+			Case->SetNumberField(TEXT("import_seconds"), Result.ImportSeconds);
+			Case->SetNumberField(TEXT("peak_memory_mb"), Result.PeakMemoryMB);
+			Case->SetNumberField(TEXT("parse_mb_per_second"), Result.ParseSeconds > 0.0 ? Result.FileBytes / (1024.0 * 1024.0) / Result.ParseSeconds : 0.0);
+			Case->SetNumberField(TEXT("import_vertices_per_second"), Result.ImportSeconds > 0.0 ? Result.NumVertices / Result.ImportSeconds : 0.0);
+			Cases.Add(MakeShared<FJsonValueObject>(Case));
+		}
+		Root->SetArrayField(TEXT("cases"), Cases);
+		return Root;
+	}
+
+	static bool SaveReport(const TSharedRef<FJsonObject>& Report, const FString& FilePath)
+	{
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		return FJsonSerializer::Serialize(Report, Writer) && FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	/** Number of cases that regressed against the baseline (cases missing from the baseline are new, not regressions) */
+	static int32 CompareToBaseline(const TArray<FCaseResult>& Results, const FJsonObject& Baseline, double Tolerance, double MemoryTolerance)
+	{
+		FString BaselineCpu;
+		Baseline.TryGetStringField(TEXT("cpu"), BaselineCpu);
+		if (!BaselineCpu.IsEmpty() && BaselineCpu != FPlatformMisc::GetCPUBrand().TrimStartAndEnd())
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBenchmark: Baseline was recorded on '%s'; timings may not be comparable"), *BaselineCpu);
+		}
+
+		TMap<FString, TSharedPtr<FJsonObject>> BaselineCases;
+		const TArray<TSharedPtr<FJsonValue>>* CaseValues = nullptr;
+		if (Baseline.TryGetArrayField(TEXT("cases"), CaseValues))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *CaseValues)
+			{
+				const TSharedPtr<FJsonObject> Case = Value->AsObject();
+				FString Status;
+				if (Case.IsValid() && Case->TryGetStringField(TEXT("status"), Status) && Status == TEXT("OK"))
+				{
+					BaselineCases.Add(Case->GetStringField(TEXT("name")), Case);
+				}
+			}
+		}
+
+		int32 NumRegressions = 0;
+		for (const FCaseResult& Result : Results)
+		{
+			const TSharedPtr<FJsonObject>* Case = BaselineCases.Find(Result.Spec.Name);
+			if (!Result.bSucceeded || !Case)
+			{
+				continue;
+			}
+
+			struct FMetric { const TCHAR* Name; double Current; double RelativeTolerance; double Slack; };
+			const FMetric Metrics[] = {
+				{ TEXT("parse_seconds"), Result.ParseSeconds, Tolerance, ParseSlackSeconds },
+				{ TEXT("import_seconds"), Result.ImportSeconds, Tolerance, ImportSlackSeconds },
+				{ TEXT("peak_memory_mb"), Result.PeakMemoryMB, MemoryTolerance, MemorySlackMB },
+			};
+			bool bRegressed = false;
+			for (const FMetric& Metric : Metrics)
+			{
+				const double Base = (*Case)->GetNumberField(Metric.Name);
+				const double Limit = Base * (1.0 + Metric.RelativeTolerance) + Metric.Slack;
+				if (Metric.Current > Limit)
+				{
+					UE_LOG(LogPMXImporter, Error, TEXT("PmxImportBenchmark: %s %s regressed: %.3f (baseline %.3f, limit %.3f)"),
+						*Result.Spec.Name, Metric.Name, Metric.Current, Base, Limit);
+					bRegressed = true;
+				}
+			}
+			NumRegressions += bRegressed ? 1 : 0;
+		}
+		return NumRegressions;
+	}
+}
+
+UPmxImportBenchmarkCommandlet::UPmxImportBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPmxImportBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace PmxImportBenchmarkPrivate;
+
+	FString DestPath = TEXT("/Game/PmxBenchmark");
+	FParse::Value(*Params, TEXT("Dest="), DestPath);
+	int32 Iterations = 3;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+	double Tolerance = 0.25;
+	FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+	double MemoryTolerance = 0.25;
+	FParse::Value(*Params, TEXT("MemoryTolerance="), MemoryTolerance);
+	FString CaseFilter;
+	FParse::Value(*Params, TEXT("Cases="), CaseFilter);
+	const bool bQuick = FParse::Param(*Params, TEXT("Quick"));
+	const bool bUpdateBaseline = FParse::Param(*Params, TEXT("UpdateBaseline"));
+
+	const FString BenchmarkDir = FPaths::ProjectSavedDir() / TEXT("PmxBenchmark");
+	FString BaselinePath = BenchmarkDir / TEXT("Baseline.json");
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+	FString ReportPath = BenchmarkDir / (FDateTime::Now().ToString() + TEXT(".json"));
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	const FString CorpusDir = BenchmarkDir / TEXT("Corpus");
+	IFileManager::Get().MakeDirectory(*CorpusDir, true);
+
+	TArray<FPmxSyntheticModelSpec> Cases = MakeCases(bQuick);
+	if (!CaseFilter.IsEmpty())
+	{
+		Cases.RemoveAll([&CaseFilter](const FPmxSyntheticModelSpec& Spec) { return !Spec.Name.Contains(CaseFilter); });
+	}
+	if (Cases.Num() == 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBenchmark: No case matches '%s'"), *CaseFilter);
+		return 0;
+	}
+
+	// Every iteration must parse and translate; a cache hit would only measure the DerivedDataCache
+	IConsoleVariable* ModelCacheVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("PMXImporter.ModelCache"));
+	const bool bModelCacheWasEnabled = ModelCacheVariable && ModelCacheVariable->GetBool();
+	if (ModelCacheVariable)
+	{
+		ModelCacheVariable->Set(false, ECVF_SetByCode);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBenchmark: %d cases, %d iterations each"), Cases.Num(), Iterations);
+	TArray<FCaseResult> Results;
+	int32 NumFailed = 0;
+	for (const FPmxSyntheticModelSpec& Spec : Cases)
+	{
+		const FCaseResult& Result = Results.Add_GetRef(RunCase(Spec, CorpusDir, DestPath, Iterations));
+		if (Result.bSucceeded)
+		{
+			UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBenchmark: %-28s parse %7.3f s  import %7.3f s  peak %+8.1f MB  %10.0f vertices/s"),
+				*Spec.Name, Result.ParseSeconds, Result.ImportSeconds, Result.PeakMemoryMB,
+				Result.ImportSeconds > 0.0 ? Result.NumVertices / Result.ImportSeconds : 0.0);
+		}
+		else
+		{
+			++NumFailed;
+			UE_LOG(LogPMXImporter, Error, TEXT("PmxImportBenchmark: %s failed: %s"), *Spec.Name, *Result.Error);
+		}
+	}
+
+	if (ModelCacheVariable)
+	{
+		ModelCacheVariable->Set(bModelCacheWasEnabled, ECVF_SetByCode);
+	}
+
+	const TSharedRef<FJsonObject> Report = MakeReport(Results);
+	if (!SaveReport(Report, ReportPath))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxImportBenchmark: Failed to write report '%s'"), *ReportPath);
+	}
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBenchmark: Report: %s"), *ReportPath);
+
+	int32 NumRegressions = 0;
+	FString BaselineJson;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!bUpdateBaseline && FFileHelper::LoadFileToString(BaselineJson, *BaselinePath)
+		&& FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline) && Baseline.IsValid())
+	{
+		NumRegressions = CompareToBaseline(Results, *Baseline, Tolerance, MemoryTolerance);
+		UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBenchmark: %d regressions against %s (tolerance %.0f%% time, %.0f%% memory)"),
+			NumRegressions, *BaselinePath, Tolerance * 100.0, MemoryTolerance * 100.0);
+	}
+	else if (NumFailed == 0)
+	{
+		// First run (or an explicit update) records the baseline
+		if (SaveReport(Report, BaselinePath))
+		{
+			UE_LOG(LogPMXImporter, Display, TEXT("PmxImportBenchmark: Baseline written to %s"), *BaselinePath);
+		}
+	}
+
+	return NumFailed == 0 && NumRegressions == 0 ? 0 : 1;
+}
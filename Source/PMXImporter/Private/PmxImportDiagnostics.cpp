@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportDiagnostics.h"
+#include "PmxImportProfiler.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<bool> CVarPMXImporterTrace(
+	TEXT("PMXImporter.Trace"),
+	false,
+	TEXT("Log every PMX element (strings, sections, rigid bodies, collision pairs, materials) while importing. ")
+	TEXT("Off by default: imports log one diagnostics summary instead. Compiled out of shipping and test builds."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarPMXImporterMaxImportWarnings(
+	TEXT("PMXImporter.MaxImportWarnings"),
+	32,
+	TEXT("Number of most recent warnings kept per PMX import for the summary and the import report (every warning is still counted)."),
+	ECVF_Default);
+
+FPmxImportDiagnostics::FPmxImportDiagnostics()
+	: MaxWarnings(FMath::Max(0, CVarPMXImporterMaxImportWarnings.GetValueOnAnyThread()))
+{
+}
+
+void FPmxImportDiagnostics::AddCount(FName Counter, int64 Value)
+{
+	FScopeLock ScopeLock(&Lock);
+	Counts.FindOrAdd(Counter) += Value;
+}
+
+void FPmxImportDiagnostics::AddWarning(const TCHAR* Category, FString&& Message)
+{
+	FScopeLock ScopeLock(&Lock);
+	++NumWarnings;
+	if (MaxWarnings <= 0)
+	{
+		return;
+	}
+
+	FPmxImportWarning Warning{ Category, MoveTemp(Message) };
+	if (Warnings.Num() < MaxWarnings)
+	{
+		Warnings.Add(MoveTemp(Warning));
+	}
+	else
+	{
+		Warnings[NextWarning] = MoveTemp(Warning);
+	}
+	NextWarning = (NextWarning + 1) % MaxWarnings;
+}
+
+TMap<FName, int64> FPmxImportDiagnostics::GetCounts() const
+{
+	FScopeLock ScopeLock(&Lock);
+	TMap<FName, int64> Result = Counts;
+	Result.KeySort(FNameLexicalLess());
+	return Result;
+}
+
+TArray<FPmxImportWarning> FPmxImportDiagnostics::GetWarnings() const
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Warnings.Num() < MaxWarnings)
+	{
+		return Warnings;
+	}
+
+	// Full ring: the oldest entry is the next one to be overwritten
+	TArray<FPmxImportWarning> Result;
+	Result.Reserve(Warnings.Num());
+	for (int32 Offset = 0; Offset < Warnings.Num(); ++Offset)
+	{
+		Result.Add(Warnings[(NextWarning + Offset) % Warnings.Num()]);
+	}
+	return Result;
+}
+
+int64 FPmxImportDiagnostics::GetNumWarnings() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumWarnings;
+}
+
+void FPmxImportDiagnostics::LogSummary(const FString& SourceFile) const
+{
+	const TMap<FName, int64> SortedCounts = GetCounts();
+	const TArray<FPmxImportWarning> RetainedWarnings = GetWarnings();
+	const int64 TotalWarnings = GetNumWarnings();
+
+	TArray<FString> CountStrings;
+	CountStrings.Reserve(SortedCounts.Num());
+	for (const TPair<FName, int64>& Pair : SortedCounts)
+	{
+		CountStrings.Add(FString::Printf(TEXT("%s=%lld"), *Pair.Key.ToString(), Pair.Value));
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX Import Diagnostics: '%s' - %lld warnings (%d kept)%s%s"),
+		*FPaths::GetCleanFilename(SourceFile), TotalWarnings, RetainedWarnings.Num(),
+		CountStrings.IsEmpty() ? TEXT("") : TEXT(", "), *FString::Join(CountStrings, TEXT(", ")));
+
+	for (const FPmxImportWarning& Warning : RetainedWarnings)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX Import Diagnostics: [%s] %s"), *Warning.Category, *Warning.Message);
+	}
+	if (TotalWarnings > RetainedWarnings.Num())
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX Import Diagnostics: %lld earlier warnings not kept (PMXImporter.MaxImportWarnings=%d)"),
+			TotalWarnings - RetainedWarnings.Num(), MaxWarnings);
+	}
+}
+
+FPmxImportDiagnostics* FPmxImportDiagnostics::GetCurrent()
+{
+	FPmxImportProfiler* Profiler = FPmxImportProfiler::GetCurrent();
+	return Profiler ? &Profiler->GetDiagnostics() : nullptr;
+}
+
+bool FPmxImportDiagnostics::IsTraceEnabled()
+{
+#if PMX_IMPORT_TRACE_ENABLED
+	return CVarPMXImporterTrace.GetValueOnAnyThread();
+#else
+	return false;
+#endif
+}
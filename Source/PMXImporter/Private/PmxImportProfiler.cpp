@@ -0,0 +1,230 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportProfiler.h"
+#include "LogPMXImporter.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTLS.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "PmxUtils.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<bool> CVarPMXImporterImportReport(
+	TEXT("PMXImporter.ImportReport"),
+	true,
+	TEXT("Write a JSON timing and memory report per PMX import to Saved/PmxImportReports."),
+	ECVF_Default);
+
+namespace PmxImportProfilerPrivate
+{
+	/** Profiler and innermost stage of the calling thread */
+	static thread_local FPmxImportProfiler* CurrentProfiler = nullptr;
+	static thread_local FPmxImportProfiler::FScope* CurrentScope = nullptr;
+}
+
+FPmxImportProfiler::FPmxImportProfiler(const FString& InSourceFile)
+	: SourceFile(InSourceFile)
+	, CreationDate(FDateTime::Now())
+	, CreationTime(FPlatformTime::Seconds())
+{
+	const FString ModelName = FPmxUtils::SanitizePackagePath(FPaths::GetBaseFilename(SourceFile));
+	ReportPath = FPaths::ProjectSavedDir() / TEXT("PmxImportReports") / FString::Printf(TEXT("%s_%s.json"),
+		ModelName.IsEmpty() ? TEXT("PMX") : *ModelName, *CreationDate.ToString(TEXT("%Y%m%d-%H%M%S-%s")));
+}
+
+FPmxImportProfiler::~FPmxImportProfiler()
+{
+	Diagnostics.LogSummary(SourceFile);
+}
+
+FPmxImportProfiler* FPmxImportProfiler::GetCurrent()
+{
+	return PmxImportProfilerPrivate::CurrentProfiler;
+}
+
+FPmxImportProfiler::FScope::FScope(const TCHAR* InName)
+	: FScope(InName, nullptr)
+{
+}
+
+FPmxImportProfiler::FScope::FScope(const TCHAR* InName, const TSharedPtr<FPmxImportProfiler>& InProfiler)
+	: OwnedProfiler(InProfiler)
+	, PreviousProfiler(PmxImportProfilerPrivate::CurrentProfiler)
+	, ParentScope(PmxImportProfilerPrivate::CurrentScope)
+	, Name(InName)
+{
+	using namespace PmxImportProfilerPrivate;
+
+	if (OwnedProfiler.IsValid())
+	{
+		CurrentProfiler = OwnedProfiler.Get();
+	}
+	Profiler = CurrentProfiler;
+	if (!Profiler)
+	{
+		return;
+	}
+
+	// Stages of another import active on this thread are not our parents
+	const FScope* Parent = ParentScope && ParentScope->Profiler == Profiler ? ParentScope : nullptr;
+	Path = Parent ? Parent->Path + TEXT("/") + Name : FString(Name);
+	Depth = Parent ? Parent->Depth + 1 : 0;
+	CurrentScope = this;
+
+	StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	StartTime = FPlatformTime::Seconds();
+}
+
+FPmxImportProfiler::FScope::~FScope()
+{
+	using namespace PmxImportProfilerPrivate;
+
+	if (Profiler)
+	{
+		const double EndTime = FPlatformTime::Seconds();
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+		FPmxImportStage Stage;
+		Stage.Name = Name;
+		Stage.Path = Path;
+		Stage.Depth = Depth;
+		Stage.ThreadId = FPlatformTLS::GetCurrentThreadId();
+		Stage.StartSeconds = StartTime - Profiler->CreationTime;
+		Stage.Seconds = EndTime - StartTime;
+		Stage.ProcessMemoryDeltaBytes = static_cast<int64>(MemoryStats.UsedPhysical) - static_cast<int64>(StartUsedPhysical);
+		Stage.PeakUsedPhysicalBytes = MemoryStats.PeakUsedPhysical;
+
+		// Verbose: payload stages run once per mesh and morph target payload, hundreds of times for large models
+		UE_LOG(LogPMXImporter, Verbose, TEXT("Pmx Import: %s%s took %.3f s (process memory %+.1f MB)"),
+			*FString::ChrN(Depth * 2, TEXT(' ')), Name, Stage.Seconds, Stage.ProcessMemoryDeltaBytes / (1024.0 * 1024.0));
+		Profiler->AddStage(MoveTemp(Stage));
+	}
+
+	CurrentScope = ParentScope;
+	CurrentProfiler = PreviousProfiler;
+}
+
+void FPmxImportProfiler::AddStage(FPmxImportStage&& Stage)
+{
+	FScopeLock ScopeLock(&Lock);
+	Stages.Add(MoveTemp(Stage));
+}
+
+void FPmxImportProfiler::SetCount(const FString& CountName, int64 Value)
+{
+	FScopeLock ScopeLock(&Lock);
+	Counts.Add(CountName, Value);
+}
+
+void FPmxImportProfiler::SetInfo(const FString& Key, const FString& Value)
+{
+	FScopeLock ScopeLock(&Lock);
+	Info.Add(Key, Value);
+}
+
+TArray<FPmxImportStage> FPmxImportProfiler::GetStages() const
+{
+	FScopeLock ScopeLock(&Lock);
+	TArray<FPmxImportStage> Result = Stages;
+	Result.Sort([](const FPmxImportStage& A, const FPmxImportStage& B) { return A.StartSeconds < B.StartSeconds; });
+	return Result;
+}
+
+bool FPmxImportProfiler::IsReportEnabled()
+{
+	return CVarPMXImporterImportReport.GetValueOnAnyThread();
+}
+
+bool FPmxImportProfiler::WriteReport(const FString& FilePath) const
+{
+	const TArray<FPmxImportStage> SortedStages = GetStages();
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("PMXImporter"));
+	Root->SetStringField(TEXT("plugin_version"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown"));
+	Root->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("source_file"), SourceFile);
+	Root->SetStringField(TEXT("date"), CreationDate.ToIso8601());
+
+	// Wall time from the first stage start to the last stage end
+	double WallSeconds = 0.0;
+	uint64 PeakUsedPhysical = 0;
+	for (const FPmxImportStage& Stage : SortedStages)
+	{
+		WallSeconds = FMath::Max(WallSeconds, Stage.StartSeconds + Stage.Seconds);
+		PeakUsedPhysical = FMath::Max(PeakUsedPhysical, Stage.PeakUsedPhysicalBytes);
+	}
+	Root->SetNumberField(TEXT("wall_seconds"), WallSeconds);
+	Root->SetNumberField(TEXT("peak_used_physical_bytes"), static_cast<double>(PeakUsedPhysical));
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		TSharedRef<FJsonObject> InfoObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Pair : Info)
+		{
+			InfoObject->SetStringField(Pair.Key, Pair.Value);
+		}
+		Root->SetObjectField(TEXT("info"), InfoObject);
+
+		TSharedRef<FJsonObject> CountsObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, int64>& Pair : Counts)
+		{
+			CountsObject->SetNumberField(Pair.Key, static_cast<double>(Pair.Value));
+		}
+		Root->SetObjectField(TEXT("counts"), CountsObject);
+	}
+
+	{
+		TSharedRef<FJsonObject> DiagnosticsObject = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> CountersObject = MakeShared<FJsonObject>();
+		for (const TPair<FName, int64>& Pair : Diagnostics.GetCounts())
+		{
+			CountersObject->SetNumberField(Pair.Key.ToString(), static_cast<double>(Pair.Value));
+		}
+		DiagnosticsObject->SetObjectField(TEXT("counters"), CountersObject);
+		DiagnosticsObject->SetNumberField(TEXT("warnings_total"), static_cast<double>(Diagnostics.GetNumWarnings()));
+
+		TArray<TSharedPtr<FJsonValue>> WarningValues;
+		for (const FPmxImportWarning& Warning : Diagnostics.GetWarnings())
+		{
+			TSharedRef<FJsonObject> WarningObject = MakeShared<FJsonObject>();
+			WarningObject->SetStringField(TEXT("category"), Warning.Category);
+			WarningObject->SetStringField(TEXT("message"), Warning.Message);
+			WarningValues.Add(MakeShared<FJsonValueObject>(WarningObject));
+		}
+		DiagnosticsObject->SetArrayField(TEXT("warnings"), WarningValues);
+		Root->SetObjectField(TEXT("diagnostics"), DiagnosticsObject);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> StageValues;
+	StageValues.Reserve(SortedStages.Num());
+	for (const FPmxImportStage& Stage : SortedStages)
+	{
+		TSharedRef<FJsonObject> StageObject = MakeShared<FJsonObject>();
+		StageObject->SetStringField(TEXT("name"), Stage.Name);
+		StageObject->SetStringField(TEXT("path"), Stage.Path);
+		StageObject->SetNumberField(TEXT("depth"), Stage.Depth);
+		StageObject->SetNumberField(TEXT("thread"), Stage.ThreadId);
+		StageObject->SetNumberField(TEXT("start_seconds"), Stage.StartSeconds);
+		StageObject->SetNumberField(TEXT("seconds"), Stage.Seconds);
+		StageObject->SetNumberField(TEXT("process_memory_delta_bytes"), static_cast<double>(Stage.ProcessMemoryDeltaBytes));
+		StageObject->SetNumberField(TEXT("peak_used_physical_bytes"), static_cast<double>(Stage.PeakUsedPhysicalBytes));
+		StageValues.Add(MakeShared<FJsonValueObject>(StageObject));
+	}
+	Root->SetArrayField(TEXT("stages"), StageValues);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("Pmx Import: Failed to write import report '%s'"), *FilePath);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportSession.h"
+#include "PmxStructs.h"
+#include "PmxRigDefinition.h"
+#include "PmxSdefData.h"
+#include "PmxDisplayData.h"
+#include "PmxImportManifest.h"
+#include "PmxImportProfiler.h"
+#include "LogPMXImporter.h"
+#include "Misc/ScopeLock.h"
+
+const FPmxSkeletonLayout& FPmxImportSession::GetSkeletonLayout(const FPmxModel& BoneModel)
+{
+	if (!SkeletonLayout.IsValid() || SkeletonLayout->Num() != BoneModel.Bones.Num())
+	{
+		SkeletonLayout = MakeShared<FPmxSkeletonLayout>();
+		FPmxNodeBuilder::BuildSkeletonLayout(BoneModel, *SkeletonLayout);
+	}
+	return *SkeletonLayout;
+}
+
+int32 FPmxImportSession::GetJointBoneIndex(const FString& JointUid) const
+{
+	const int32 BoneIndex = FPmxNodeBuilder::ParseJointBoneIndex(JointUid);
+	if (BoneIndex == INDEX_NONE || PrunedBoneRemap.IsEmpty())
+	{
+		return BoneIndex;
+	}
+	return PrunedBoneRemap.IsValidIndex(BoneIndex) ? PrunedBoneRemap[BoneIndex] : INDEX_NONE;
+}
+
+const TCHAR* FPmxImportSessionRegistry::SessionIdAttributeKey = TEXT("PMX:SessionId");
+FCriticalSection FPmxImportSessionRegistry::SessionsLock;
+TMap<FGuid, TWeakPtr<FPmxImportSession, ESPMode::ThreadSafe>> FPmxImportSessionRegistry::Sessions;
+
+TSharedRef<FPmxImportSession> FPmxImportSessionRegistry::CreateSession(const FString& SourceFilePath)
+{
+	TSharedRef<FPmxImportSession> Session = MakeShared<FPmxImportSession>();
+	Session->Id = FGuid::NewGuid();
+	Session->SourceFilePath = SourceFilePath;
+	Session->Profiler = MakeShared<FPmxImportProfiler>(SourceFilePath);
+
+	FScopeLock Lock(&SessionsLock);
+
+	// Sessions of imports that ended without ReleaseSession() expire with their owners
+	for (auto It = Sessions.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	Sessions.Add(Session->Id, Session);
+
+	UE_LOG(LogPMXImporter, Verbose, TEXT("PMX ImportSession: Created %s for '%s' (%d live)"), *Session->Id.ToString(), *SourceFilePath, Sessions.Num());
+	return Session;
+}
+
+TSharedPtr<FPmxImportSession> FPmxImportSessionRegistry::FindSession(const FGuid& SessionId)
+{
+	FScopeLock Lock(&SessionsLock);
+	const TWeakPtr<FPmxImportSession, ESPMode::ThreadSafe>* Session = Sessions.Find(SessionId);
+	return Session ? Session->Pin() : nullptr;
+}
+
+void FPmxImportSessionRegistry::ReleaseSession(const FGuid& SessionId)
+{
+	FScopeLock Lock(&SessionsLock);
+	Sessions.Remove(SessionId);
+}
+
+int32 FPmxImportSessionRegistry::GetNumSessions()
+{
+	FScopeLock Lock(&SessionsLock);
+	int32 NumLive = 0;
+	for (const auto& Pair : Sessions)
+	{
+		NumLive += Pair.Value.IsValid() ? 1 : 0;
+	}
+	return NumLive;
+}
+
+void FPmxImportSessionRegistry::Reset()
+{
+	FScopeLock Lock(&SessionsLock);
+	Sessions.Empty();
+}
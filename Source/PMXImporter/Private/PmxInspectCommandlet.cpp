@@ -0,0 +1,592 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxInspectCommandlet.h"
+#include "PmxReader.h"
+#include "PmxStructs.h"
+#include "PmxCompactModel.h"
+#include "PmxUtils.h"
+#include "LogPMXImporter.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Tasks/Task.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxInspectCommandlet)
+
+namespace PmxInspectPrivate
+{
+	static const TCHAR* WeightTypeNames[] = { TEXT("BDEF1"), TEXT("BDEF2"), TEXT("BDEF4"), TEXT("SDEF"), TEXT("QDEF") };
+	static constexpr int32 NumWeightTypes = UE_ARRAY_COUNT(WeightTypeNames);
+
+	/** Findings of one check are reported once with a count and the first few elements */
+	static constexpr int32 MaxExamples = 5;
+
+	struct FFileResult
+	{
+		FString SourceFile;
+		int64 FileBytes = 0;
+
+		bool bParsed = false;
+		double ParseSeconds = 0.0;
+		FPmxHeader Header;
+		TArray<FPmxSectionInfo> Sections;
+
+		int32 NumVertices = 0;
+		int32 NumFaces = 0;
+		int32 NumBones = 0;
+		int32 NumMaterials = 0;
+		int32 NumTextures = 0;
+		int32 NumMorphs = 0;
+		int32 NumRigidBodies = 0;
+		int32 NumJoints = 0;
+
+		int32 WeightTypeCounts[NumWeightTypes] = {};
+		TMap<FString, int32> MorphTypeCounts;
+		int32 NumUnreachableVertices = 0;
+
+		/** Out of range references and other problems that break an import */
+		TArray<FString> Errors;
+
+		/** Suspicious but importable content (duplicate names, unreachable vertices, ...) */
+		TArray<FString> Warnings;
+
+		FString ConvertedFile;
+		int64 ConvertedBytes = 0;
+		double ConvertedLoadSeconds = 0.0;
+	};
+
+	static FString GetMorphTypeName(uint8 MorphType)
+	{
+		switch (MorphType)
+		{
+		case 0: return TEXT("Group");
+		case 1: return TEXT("Vertex");
+		case 2: return TEXT("Bone");
+		case 3: return TEXT("UV");
+		case 4: case 5: case 6: case 7: return FString::Printf(TEXT("AddUV%d"), MorphType - 3);
+		case 8: return TEXT("Material");
+		case 9: return TEXT("Flip");
+		case 10: return TEXT("Impulse");
+		default: return FString::Printf(TEXT("Unknown%d"), MorphType);
+		}
+	}
+
+	/** Collects out of range references of one kind: "<Count> <What> (first: a, b, c)" */
+	struct FRangeCheck
+	{
+		const TCHAR* What = nullptr;
+		int32 Count = 0;
+		TArray<FString> Examples;
+
+		explicit FRangeCheck(const TCHAR* InWhat) : What(InWhat) {}
+
+		/** Index must be in [Min, Num); Context names the referencing element */
+		void Check(int32 Index, int32 Min, int32 Num, const TFunctionRef<FString()>& Context)
+		{
+			if (Index < Min || Index >= Num)
+			{
+				if (Count++ < MaxExamples)
+				{
+					Examples.Add(FString::Printf(TEXT("%s -> %d"), *Context(), Index));
+				}
+			}
+		}
+
+		void Report(TArray<FString>& Out) const
+		{
+			if (Count > 0)
+			{
+				Out.Add(FString::Printf(TEXT("%d %s (first: %s)"), Count, What, *FString::Join(Examples, TEXT(", "))));
+			}
+		}
+	};
+
+	template <typename ElementType>
+	static void FindDuplicateNames(const TArray<ElementType>& Elements, const TCHAR* What, TArray<FString>& OutWarnings)
+	{
+		TMap<FString, int32> NameCounts;
+		for (const ElementType& Element : Elements)
+		{
+			++NameCounts.FindOrAdd(Element.Name);
+		}
+
+		int32 NumDuplicated = 0;
+		TArray<FString> Examples;
+		for (const TPair<FString, int32>& Pair : NameCounts)
+		{
+			if (Pair.Value > 1)
+			{
+				if (NumDuplicated++ < MaxExamples)
+				{
+					Examples.Add(FString::Printf(TEXT("'%s' x%d"), *Pair.Key, Pair.Value));
+				}
+			}
+		}
+		if (NumDuplicated > 0)
+		{
+			OutWarnings.Add(FString::Printf(TEXT("%d duplicate %s names (%s)"), NumDuplicated, What, *FString::Join(Examples, TEXT(", "))));
+		}
+	}
+
+	static void Analyze(const FPmxModel& Model, FFileResult& Result)
+	{
+		const int32 NumVertices = Model.Vertices.Num();
+		const int32 NumBones = Model.Bones.Num();
+		const int32 NumMaterials = Model.Materials.Num();
+		const int32 NumTextures = Model.Textures.Num();
+		const int32 NumMorphs = Model.Morphs.Num();
+		const int32 NumBodies = Model.RigidBodies.Num();
+
+		Result.NumVertices = NumVertices;
+		Result.NumFaces = Model.Indices.Num() / 3;
+		Result.NumBones = NumBones;
+		Result.NumMaterials = NumMaterials;
+		Result.NumTextures = NumTextures;
+		Result.NumMorphs = NumMorphs;
+		Result.NumRigidBodies = NumBodies;
+		Result.NumJoints = Model.Joints.Num();
+
+		// Vertices: weight types and bone references
+		FRangeCheck WeightTypeCheck(TEXT("vertices with an unknown weight type"));
+		FRangeCheck VertexBoneCheck(TEXT("vertex bone references out of range"));
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			const FPmxVertex& Vertex = Model.Vertices[VertexIndex];
+			WeightTypeCheck.Check(Vertex.WeightType, 0, NumWeightTypes, [VertexIndex]() { return FString::Printf(TEXT("vertex %d"), VertexIndex); });
+			if (Vertex.WeightType < NumWeightTypes)
+			{
+				++Result.WeightTypeCounts[Vertex.WeightType];
+			}
+			for (int32 Slot = 0; Slot < Vertex.BoneIndices.Num(); ++Slot)
+			{
+				// Unused BDEF2/BDEF4 slots may hold -1 with a zero weight
+				if (Vertex.BoneIndices[Slot] != INDEX_NONE || (Vertex.BoneWeights.IsValidIndex(Slot) && Vertex.BoneWeights[Slot] > 0.0f))
+				{
+					VertexBoneCheck.Check(Vertex.BoneIndices[Slot], 0, NumBones, [VertexIndex]() { return FString::Printf(TEXT("vertex %d"), VertexIndex); });
+				}
+			}
+		}
+		WeightTypeCheck.Report(Result.Errors);
+		VertexBoneCheck.Report(Result.Errors);
+
+		// Faces: index range, material face counts and vertices no face uses
+		if (Model.Indices.Num() % 3 != 0)
+		{
+			Result.Errors.Add(FString::Printf(TEXT("index count %d is not a multiple of 3"), Model.Indices.Num()));
+		}
+		FRangeCheck IndexCheck(TEXT("face indices out of range"));
+		TBitArray<> Referenced(false, NumVertices);
+		for (int32 Index = 0; Index < Model.Indices.Num(); ++Index)
+		{
+			const int32 VertexIndex = Model.Indices[Index];
+			IndexCheck.Check(VertexIndex, 0, NumVertices, [Index]() { return FString::Printf(TEXT("index %d"), Index); });
+			if (VertexIndex >= 0 && VertexIndex < NumVertices)
+			{
+				Referenced[VertexIndex] = true;
+			}
+		}
+		IndexCheck.Report(Result.Errors);
+		Result.NumUnreachableVertices = NumVertices - Referenced.CountSetBits();
+		if (Result.NumUnreachableVertices > 0)
+		{
+			Result.Warnings.Add(FString::Printf(TEXT("%d vertices are not used by any face"), Result.NumUnreachableVertices));
+		}
+
+		int64 MaterialIndexCount = 0;
+		FRangeCheck TextureCheck(TEXT("material texture references out of range"));
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+		{
+			const FPmxMaterial& Material = Model.Materials[MaterialIndex];
+			MaterialIndexCount += Material.SurfaceCount;
+			auto Context = [&Material]() { return FString::Printf(TEXT("'%s'"), *Material.Name); };
+			TextureCheck.Check(Material.TextureIndex, INDEX_NONE, NumTextures, Context);
+			TextureCheck.Check(Material.SphereTextureIndex, INDEX_NONE, NumTextures, Context);
+			if (Material.SharedToonFlag == 0)
+			{
+				TextureCheck.Check(Material.ToonTextureIndex, INDEX_NONE, NumTextures, Context);
+			}
+		}
+		TextureCheck.Report(Result.Errors);
+		if (MaterialIndexCount != Model.Indices.Num())
+		{
+			Result.Errors.Add(FString::Printf(TEXT("materials cover %lld indices but the model has %d"), MaterialIndexCount, Model.Indices.Num()));
+		}
+
+		// Bones
+		FRangeCheck BoneCheck(TEXT("bone references out of range"));
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FPmxBone& Bone = Model.Bones[BoneIndex];
+			auto Context = [&Bone]() { return FString::Printf(TEXT("'%s'"), *Bone.Name); };
+			BoneCheck.Check(Bone.ParentBoneIndex, INDEX_NONE, NumBones, Context);
+			BoneCheck.Check(Bone.IKTargetBoneIndex, INDEX_NONE, NumBones, Context);
+			BoneCheck.Check(Bone.AdditionalParentIndex, INDEX_NONE, NumBones, Context);
+			for (const FPmxBone::FPmxIKLink& Link : Bone.IKLinks)
+			{
+				BoneCheck.Check(Link.BoneIndex, 0, NumBones, Context);
+			}
+		}
+		BoneCheck.Report(Result.Errors);
+
+		// Morphs
+		FRangeCheck MorphCheck(TEXT("morph offsets referencing missing elements"));
+		for (const FPmxMorph& Morph : Model.Morphs)
+		{
+			++Result.MorphTypeCounts.FindOrAdd(GetMorphTypeName(Morph.MorphType));
+			auto Context = [&Morph]() { return FString::Printf(TEXT("'%s'"), *Morph.Name); };
+			for (const FPmxVertexMorph& Offset : Morph.VertexMorphs)
+			{
+				MorphCheck.Check(Offset.VertexIndex, 0, NumVertices, Context);
+			}
+			for (const FPmxUVMorph& Offset : Morph.UVMorphs)
+			{
+				MorphCheck.Check(Offset.VertexIndex, 0, NumVertices, Context);
+			}
+			for (const FPmxBoneMorph& Offset : Morph.BoneMorphs)
+			{
+				MorphCheck.Check(Offset.BoneIndex, 0, NumBones, Context);
+			}
+			for (const FPmxMaterialMorph& Offset : Morph.MaterialMorphs)
+			{
+				// -1 targets every material
+				MorphCheck.Check(Offset.MaterialIndex, INDEX_NONE, NumMaterials, Context);
+			}
+			for (const FPmxGroupMorph& Offset : Morph.GroupMorphs)
+			{
+				MorphCheck.Check(Offset.MorphIndex, 0, NumMorphs, Context);
+			}
+		}
+		MorphCheck.Report(Result.Errors);
+
+		// Physics (bodies without a bone are imported as skipped bodies, so they are only warnings)
+		FRangeCheck BodyBoneCheck(TEXT("rigid bodies without a valid bone"));
+		for (const FPmxRigidBody& Body : Model.RigidBodies)
+		{
+			BodyBoneCheck.Check(Body.RelatedBoneIndex, 0, NumBones, [&Body]() { return FString::Printf(TEXT("'%s'"), *Body.Name); });
+		}
+		BodyBoneCheck.Report(Result.Warnings);
+
+		FRangeCheck JointCheck(TEXT("joint rigid body references out of range"));
+		for (const FPmxJoint& Joint : Model.Joints)
+		{
+			auto Context = [&Joint]() { return FString::Printf(TEXT("'%s'"), *Joint.Name); };
+			JointCheck.Check(Joint.RigidBodyIndexA, 0, NumBodies, Context);
+			JointCheck.Check(Joint.RigidBodyIndexB, 0, NumBodies, Context);
+		}
+		JointCheck.Report(Result.Errors);
+
+		FindDuplicateNames(Model.Bones, TEXT("bone"), Result.Warnings);
+		FindDuplicateNames(Model.Materials, TEXT("material"), Result.Warnings);
+		FindDuplicateNames(Model.Morphs, TEXT("morph"), Result.Warnings);
+		FindDuplicateNames(Model.RigidBodies, TEXT("rigid body"), Result.Warnings);
+		FindDuplicateNames(Model.Joints, TEXT("joint"), Result.Warnings);
+
+		// Bone names collapse further once sanitized for the skeleton
+		const TArray<FString> UniqueBoneNames = FPmxUtils::BuildUniqueBoneNames(Model);
+		int32 NumRenamed = 0;
+		for (int32 BoneIndex = 0; BoneIndex < FMath::Min(UniqueBoneNames.Num(), NumBones); ++BoneIndex)
+		{
+			NumRenamed += UniqueBoneNames[BoneIndex] != Model.Bones[BoneIndex].Name ? 1 : 0;
+		}
+		if (NumRenamed > 0)
+		{
+			Result.Warnings.Add(FString::Printf(TEXT("%d bones are renamed on import to keep skeleton names unique and valid"), NumRenamed));
+		}
+	}
+
+	static void RunFile(FFileResult& Result, const FString& ConvertedFile)
+	{
+		TArray<uint8> Data;
+		if (!FFileHelper::LoadFileToArray(Data, *Result.SourceFile))
+		{
+			Result.Errors.Add(TEXT("could not read the file"));
+			return;
+		}
+		Result.FileBytes = Data.Num();
+
+		FPmxModel Model;
+		const double ParseStartTime = FPlatformTime::Seconds();
+		Result.bParsed = PMXReader::LoadPmxFromData(Data, Model, Result.Sections);
+		Result.ParseSeconds = FPlatformTime::Seconds() - ParseStartTime;
+		if (!Result.bParsed)
+		{
+			const FPmxSectionInfo* LastSection = Result.Sections.Num() > 0 ? &Result.Sections.Last() : nullptr;
+			Result.Errors.Add(FString::Printf(TEXT("parse failed after section '%s'"), LastSection ? *LastSection->Name : TEXT("Signature")));
+			return;
+		}
+		Result.Header = Model.Header;
+		Analyze(Model, Result);
+
+		if (!ConvertedFile.IsEmpty() && Result.Errors.Num() == 0)
+		{
+			if (!FPmxCompactModel::SaveToFile(ConvertedFile, Model, Data))
+			{
+				Result.Errors.Add(FString::Printf(TEXT("could not write '%s'"), *ConvertedFile));
+				return;
+			}
+
+			// Time the reload so the report shows what the conversion saves
+			FPmxModel Reloaded;
+			const double LoadStartTime = FPlatformTime::Seconds();
+			if (!FPmxCompactModel::LoadFromFile(ConvertedFile, Reloaded, Data) || Reloaded.Vertices.Num() != Model.Vertices.Num())
+			{
+				Result.Errors.Add(FString::Printf(TEXT("'%s' does not read back"), *ConvertedFile));
+				return;
+			}
+			Result.ConvertedLoadSeconds = FPlatformTime::Seconds() - LoadStartTime;
+			Result.ConvertedFile = ConvertedFile;
+			Result.ConvertedBytes = IFileManager::Get().FileSize(*ConvertedFile);
+		}
+	}
+
+	static void LogDetails(const FFileResult& Result)
+	{
+		const FPmxHeader& Header = Result.Header;
+		UE_LOG(LogPMXImporter, Display, TEXT("  '%s' PMX %.1f, %s, %d additional UVs, index sizes: vertex %d, texture %d, material %d, bone %d, morph %d, rigid body %d"),
+			*Header.ModelName, Header.Version, Header.EncodeType == 1 ? TEXT("UTF-8") : TEXT("UTF-16"), Header.AdditionalUVNum,
+			Header.VertexIndexSize, Header.TextureIndexSize, Header.MaterialIndexSize, Header.BoneIndexSize, Header.MorphIndexSize, Header.RigidbodyIndexSize);
+
+		for (const FPmxSectionInfo& Section : Result.Sections)
+		{
+			UE_LOG(LogPMXImporter, Display, TEXT("  %-14s %8d elements  %10d bytes at 0x%08X"), *Section.Name, Section.Count, Section.Size, Section.Offset);
+		}
+
+		TArray<FString> WeightTypes;
+		for (int32 WeightType = 0; WeightType < NumWeightTypes; ++WeightType)
+		{
+			WeightTypes.Add(FString::Printf(TEXT("%s=%d"), WeightTypeNames[WeightType], Result.WeightTypeCounts[WeightType]));
+		}
+		UE_LOG(LogPMXImporter, Display, TEXT("  Weights: %s"), *FString::Join(WeightTypes, TEXT(", ")));
+
+		TArray<FString> MorphTypes;
+		for (const TPair<FString, int32>& Pair : Result.MorphTypeCounts)
+		{
+			MorphTypes.Add(FString::Printf(TEXT("%s=%d"), *Pair.Key, Pair.Value));
+		}
+		UE_LOG(LogPMXImporter, Display, TEXT("  Morphs: %s"), MorphTypes.Num() > 0 ? *FString::Join(MorphTypes, TEXT(", ")) : TEXT("none"));
+
+		if (!Result.ConvertedFile.IsEmpty())
+		{
+			UE_LOG(LogPMXImporter, Display, TEXT("  Converted: %s (%.1f KB, loads in %.1f ms vs %.1f ms parse)"),
+				*Result.ConvertedFile, Result.ConvertedBytes / 1024.0, Result.ConvertedLoadSeconds * 1000.0, Result.ParseSeconds * 1000.0);
+		}
+	}
+
+	static TSharedRef<FJsonObject> MakeFileReport(const FFileResult& Result)
+	{
+		TSharedRef<FJsonObject> File = MakeShared<FJsonObject>();
+		File->SetStringField(TEXT("file"), Result.SourceFile);
+		File->SetStringField(TEXT("status"), Result.Errors.Num() == 0 ? TEXT("OK") : TEXT("FAILED"));
+		File->SetNumberField(TEXT("file_bytes"), static_cast<double>(Result.FileBytes));
+		File->SetNumberField(TEXT("parse_seconds"), Result.ParseSeconds);
+
+		auto ToJsonStrings = [](const TArray<FString>& Strings)
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			for (const FString& String : Strings)
+			{
+				Values.Add(MakeShared<FJsonValueString>(String));
+			}
+			return Values;
+		};
+		File->SetArrayField(TEXT("errors"), ToJsonStrings(Result.Errors));
+		File->SetArrayField(TEXT("warnings"), ToJsonStrings(Result.Warnings));
+		if (!Result.bParsed)
+		{
+			return File;
+		}
+
+		const FPmxHeader& Header = Result.Header;
+		File->SetStringField(TEXT("model_name"), Header.ModelName);
+		File->SetNumberField(TEXT("version"), Header.Version);
+		File->SetStringField(TEXT("encoding"), Header.EncodeType == 1 ? TEXT("UTF-8") : TEXT("UTF-16"));
+		File->SetNumberField(TEXT("additional_uvs"), Header.AdditionalUVNum);
+
+		TSharedRef<FJsonObject> IndexSizes = MakeShared<FJsonObject>();
+		IndexSizes->SetNumberField(TEXT("vertex"), Header.VertexIndexSize);
+		IndexSizes->SetNumberField(TEXT("texture"), Header.TextureIndexSize);
+		IndexSizes->SetNumberField(TEXT("material"), Header.MaterialIndexSize);
+		IndexSizes->SetNumberField(TEXT("bone"), Header.BoneIndexSize);
+		IndexSizes->SetNumberField(TEXT("morph"), Header.MorphIndexSize);
+		IndexSizes->SetNumberField(TEXT("rigid_body"), Header.RigidbodyIndexSize);
+		File->SetObjectField(TEXT("index_sizes"), IndexSizes);
+
+		TArray<TSharedPtr<FJsonValue>> Sections;
+		for (const FPmxSectionInfo& Section : Result.Sections)
+		{
+			TSharedRef<FJsonObject> SectionObject = MakeShared<FJsonObject>();
+			SectionObject->SetStringField(TEXT("name"), Section.Name);
+			SectionObject->SetNumberField(TEXT("offset"), Section.Offset);
+			SectionObject->SetNumberField(TEXT("bytes"), Section.Size);
+			SectionObject->SetNumberField(TEXT("count"), Section.Count);
+			Sections.Add(MakeShared<FJsonValueObject>(SectionObject));
+		}
+		File->SetArrayField(TEXT("sections"), Sections);
+
+		TSharedRef<FJsonObject> WeightTypes = MakeShared<FJsonObject>();
+		for (int32 WeightType = 0; WeightType < NumWeightTypes; ++WeightType)
+		{
+			WeightTypes->SetNumberField(WeightTypeNames[WeightType], Result.WeightTypeCounts[WeightType]);
+		}
+		File->SetObjectField(TEXT("weight_types"), WeightTypes);
+
+		TSharedRef<FJsonObject> MorphTypes = MakeShared<FJsonObject>();
+		for (const TPair<FString, int32>& Pair : Result.MorphTypeCounts)
+		{
+			MorphTypes->SetNumberField(Pair.Key, Pair.Value);
+		}
+		File->SetObjectField(TEXT("morph_types"), MorphTypes);
+		File->SetNumberField(TEXT("unreachable_vertices"), Result.NumUnreachableVertices);
+
+		if (!Result.ConvertedFile.IsEmpty())
+		{
+			File->SetStringField(TEXT("converted_file"), Result.ConvertedFile);
+			File->SetNumberField(TEXT("converted_bytes"), static_cast<double>(Result.ConvertedBytes));
+			File->SetNumberField(TEXT("converted_load_seconds"), Result.ConvertedLoadSeconds);
+		}
+		return File;
+	}
+}
+
+UPmxInspectCommandlet::UPmxInspectCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPmxInspectCommandlet::Main(const FString& Params)
+{
+	using namespace PmxInspectPrivate;
+
+	FString Source;
+	if (!FParse::Value(*Params, TEXT("Source="), Source))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PmxInspect: Usage: -run=PmxInspect -Source=<File or directory> [-Convert=<Output directory>] [-Report=<Json path>] [-Details] [-Workers=N]"));
+		return 1;
+	}
+	FString ConvertDir;
+	FParse::Value(*Params, TEXT("Convert="), ConvertDir);
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("PmxInspect") / (FDateTime::Now().ToString() + TEXT(".json"));
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	int32 NumWorkers = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn(), 1);
+	FParse::Value(*Params, TEXT("Workers="), NumWorkers);
+	NumWorkers = FMath::Max(NumWorkers, 1);
+
+	// Files and where their conversions go (relative paths are kept so same-named models do not collide)
+	TArray<FString> Files;
+	FString SourceRoot;
+	if (IFileManager::Get().DirectoryExists(*Source))
+	{
+		SourceRoot = Source;
+		IFileManager::Get().FindFilesRecursive(Files, *Source, TEXT("*.pmx"), true, false);
+		Files.Sort();
+	}
+	else if (IFileManager::Get().FileExists(*Source))
+	{
+		SourceRoot = FPaths::GetPath(Source);
+		Files.Add(Source);
+	}
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PmxInspect: No PMX files at '%s'"), *Source);
+		return 1;
+	}
+	const bool bDetails = Files.Num() == 1 || FParse::Param(*Params, TEXT("Details"));
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxInspect: %d files, %d workers%s"),
+		Files.Num(), NumWorkers, ConvertDir.IsEmpty() ? TEXT("") : *FString::Printf(TEXT(", converting to %s"), *ConvertDir));
+
+	// Bounded pipeline: workers parse ahead, results are logged in file order
+	TArray<FFileResult> Results;
+	Results.SetNum(Files.Num());
+	TArray<UE::Tasks::FTask> InFlight;
+	int32 NextFile = 0;
+	int32 NumFailed = 0;
+	int64 TotalBytes = 0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	for (int32 FileIndex = 0; FileIndex < Files.Num(); ++FileIndex)
+	{
+		while (NextFile < Files.Num() && NextFile - FileIndex < NumWorkers)
+		{
+			FFileResult* Result = &Results[NextFile];
+			Result->SourceFile = Files[NextFile];
+
+			FString ConvertedFile;
+			if (!ConvertDir.IsEmpty())
+			{
+				FString RelativePath = Result->SourceFile;
+				FPaths::MakePathRelativeTo(RelativePath, *(SourceRoot + TEXT("/")));
+				ConvertedFile = FPaths::ChangeExtension(ConvertDir / RelativePath, FPmxCompactModel::FileExtension);
+				IFileManager::Get().MakeDirectory(*FPaths::GetPath(ConvertedFile), true);
+			}
+
+			InFlight.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Result, ConvertedFile]()
+			{
+				RunFile(*Result, ConvertedFile);
+			}));
+			++NextFile;
+		}
+
+		UE::Tasks::FTask Task = MoveTemp(InFlight[0]);
+		InFlight.RemoveAt(0);
+		Task.Wait();
+
+		const FFileResult& Result = Results[FileIndex];
+		TotalBytes += Result.FileBytes;
+		const bool bFailed = Result.Errors.Num() > 0;
+		NumFailed += bFailed ? 1 : 0;
+
+		UE_LOG(LogPMXImporter, Display, TEXT("PmxInspect: %s %s (%.1f KB, %d vertices, %d faces, %d bones, %d materials, %d morphs, %d bodies, %d joints, parse %.1f ms)"),
+			bFailed ? TEXT("FAILED") : TEXT("OK    "), *Result.SourceFile, Result.FileBytes / 1024.0,
+			Result.NumVertices, Result.NumFaces, Result.NumBones, Result.NumMaterials, Result.NumMorphs, Result.NumRigidBodies, Result.NumJoints,
+			Result.ParseSeconds * 1000.0);
+		if (bDetails && Result.bParsed)
+		{
+			LogDetails(Result);
+		}
+		for (const FString& Error : Result.Errors)
+		{
+			UE_LOG(LogPMXImporter, Error, TEXT("PmxInspect:   %s"), *Error);
+		}
+		for (const FString& Warning : Result.Warnings)
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PmxInspect:   %s"), *Warning);
+		}
+	}
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("PMXImporter"));
+	Report->SetStringField(TEXT("plugin_version"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown"));
+	Report->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+	Report->SetStringField(TEXT("date"), FDateTime::Now().ToIso8601());
+	Report->SetStringField(TEXT("source"), Source);
+	Report->SetNumberField(TEXT("seconds"), Seconds);
+	Report->SetNumberField(TEXT("failed"), NumFailed);
+	TArray<TSharedPtr<FJsonValue>> FileValues;
+	for (const FFileResult& Result : Results)
+	{
+		FileValues.Add(MakeShared<FJsonValueObject>(MakeFileReport(Result)));
+	}
+	Report->SetArrayField(TEXT("files"), FileValues);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(Json, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxInspect: Failed to write report '%s'"), *ReportPath);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxInspect: %d/%d files valid in %.2f s (%.1f MB/s). Report: %s"),
+		Files.Num() - NumFailed, Files.Num(), Seconds, Seconds > 0.0 ? TotalBytes / (1024.0 * 1024.0) / Seconds : 0.0, *ReportPath);
+
+	return NumFailed == 0 ? 0 : 1;
+}
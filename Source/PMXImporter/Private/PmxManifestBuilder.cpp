@@ -0,0 +1,223 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxManifestBuilder.h"
+#include "PmxImportManifest.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UnrealType.h"
+
+const TCHAR* FPmxManifestBuilder::SectionAttributeKey = TEXT("PMX:ManifestSection");
+const TCHAR* FPmxManifestBuilder::VerticesSection = TEXT("Vertices");
+const TCHAR* FPmxManifestBuilder::IndicesSection = TEXT("Indices");
+const TCHAR* FPmxManifestBuilder::BonesSection = TEXT("Bones");
+const TCHAR* FPmxManifestBuilder::MaterialSlotsSection = TEXT("MaterialSlots");
+const TCHAR* FPmxManifestBuilder::DisplayFramesSection = TEXT("DisplayFrames");
+const TCHAR* FPmxManifestBuilder::BodiesSection = TEXT("Bodies");
+const TCHAR* FPmxManifestBuilder::JointsSection = TEXT("Joints");
+const TCHAR* FPmxManifestBuilder::MorphSectionPrefix = TEXT("Morph/");
+const TCHAR* FPmxManifestBuilder::TextureSectionPrefix = TEXT("Texture/");
+const TCHAR* FPmxManifestBuilder::StageMetaDataKey = TEXT("PmxStages");
+const TCHAR* FPmxManifestBuilder::GeometryStage = TEXT("Geometry");
+const TCHAR* FPmxManifestBuilder::SkeletonStage = TEXT("Skeleton");
+const TCHAR* FPmxManifestBuilder::MorphStage = TEXT("Morph");
+const TCHAR* FPmxManifestBuilder::MaterialStage = TEXT("Material");
+const TCHAR* FPmxManifestBuilder::TextureStage = TEXT("Texture");
+const TCHAR* FPmxManifestBuilder::PhysicsStage = TEXT("Physics");
+
+namespace PmxManifestBuilderPrivate
+{
+	/** Hash of anything with an FArchive operator<< (serialized the same way the model cache stores it) */
+	template <typename T>
+	static uint64 HashSerialized(const T& Value)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		Writer << const_cast<T&>(Value);
+		return FXxHash64::HashBuffer(Bytes.GetData(), Bytes.Num()).Hash;
+	}
+
+	/** Whether a property's PmxStages list names Stage (untagged properties affect every stage) */
+	static bool AffectsStage(const FProperty& Property, const TCHAR* Stage)
+	{
+		const FString* Stages = Property.FindMetaData(FPmxManifestBuilder::StageMetaDataKey);
+		if (!Stages)
+		{
+			return true;
+		}
+
+		TArray<FString> StageNames;
+		Stages->ParseIntoArray(StageNames, TEXT(","));
+		for (FString& StageName : StageNames)
+		{
+			if (StageName.TrimStartAndEnd() == Stage)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+FString FPmxManifestBuilder::MaterialSection(int32 MaterialIndex)
+{
+	return FString::Printf(TEXT("Material/%d"), MaterialIndex);
+}
+
+FString FPmxManifestBuilder::TextureSection(int32 TextureIndex)
+{
+	return FString::Printf(TEXT("%s%d"), TextureSectionPrefix, TextureIndex);
+}
+
+FString FPmxManifestBuilder::MorphSection(int32 MorphIndex)
+{
+	return FString::Printf(TEXT("%s%d"), MorphSectionPrefix, MorphIndex);
+}
+
+FString FPmxManifestBuilder::OptionsSection(const TCHAR* Stage)
+{
+	return FString::Printf(TEXT("Options/%s"), Stage);
+}
+
+void FPmxManifestBuilder::BuildManifest(const FPmxModel& PmxModel, const FString& PmxFilePath, FPmxImportManifest& OutManifest)
+{
+	using namespace PmxManifestBuilderPrivate;
+
+	OutManifest.SourceFile = FPaths::ConvertRelativePathToFull(PmxFilePath);
+	OutManifest.SectionHashes.Reset();
+	OutManifest.NodeAssets.Reset();
+
+	OutManifest.SectionHashes.Add(VerticesSection, HashSerialized(PmxModel.Vertices));
+	OutManifest.SectionHashes.Add(IndicesSection, HashSerialized(PmxModel.Indices));
+	OutManifest.SectionHashes.Add(BonesSection, HashSerialized(PmxModel.Bones));
+	OutManifest.SectionHashes.Add(DisplayFramesSection, HashSerialized(PmxModel.DisplayFrames));
+	OutManifest.SectionHashes.Add(BodiesSection, HashSerialized(PmxModel.RigidBodies));
+	OutManifest.SectionHashes.Add(JointsSection, HashSerialized(PmxModel.Joints));
+
+	// Slot names and face ranges are part of the mesh; the material parameters are not
+	TArray<uint8> SlotBytes;
+	FMemoryWriter SlotWriter(SlotBytes);
+	for (const FPmxMaterial& Material : PmxModel.Materials)
+	{
+		FString Name = Material.Name;
+		int32 SurfaceCount = Material.SurfaceCount;
+		SlotWriter << Name << SurfaceCount;
+	}
+	OutManifest.SectionHashes.Add(MaterialSlotsSection, FXxHash64::HashBuffer(SlotBytes.GetData(), SlotBytes.Num()).Hash);
+
+	for (int32 MaterialIndex = 0; MaterialIndex < PmxModel.Materials.Num(); ++MaterialIndex)
+	{
+		// A material references its textures by asset path, so only the texture paths matter here
+		const FPmxMaterial& Material = PmxModel.Materials[MaterialIndex];
+		uint64 Hash = HashSerialized(Material);
+		for (const int32 TextureIndex : { Material.TextureIndex, Material.SphereTextureIndex, Material.ToonTextureIndex })
+		{
+			if (PmxModel.Textures.IsValidIndex(TextureIndex))
+			{
+				const FString& TexturePath = PmxModel.Textures[TextureIndex].TexturePath;
+				Hash = FXxHash64::HashBufferWithSeed(*TexturePath, TexturePath.Len() * sizeof(TCHAR), Hash).Hash;
+			}
+		}
+		OutManifest.SectionHashes.Add(MaterialSection(MaterialIndex), Hash);
+	}
+
+	const FString PmxBaseDir = FPaths::GetPath(PmxFilePath);
+	int32 NumMissingTextures = 0;
+	for (int32 TextureIndex = 0; TextureIndex < PmxModel.Textures.Num(); ++TextureIndex)
+	{
+		FString RelativePath = PmxModel.Textures[TextureIndex].TexturePath;
+		RelativePath.ReplaceInline(TEXT("\\"), TEXT("/"));
+		uint64 Hash = FXxHash64::HashBuffer(*RelativePath, RelativePath.Len() * sizeof(TCHAR)).Hash;
+
+		TArray<uint8> FileData;
+		if (!RelativePath.IsEmpty() && FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(PmxBaseDir, RelativePath), FILEREAD_Silent))
+		{
+			Hash = FXxHash64::HashBufferWithSeed(FileData.GetData(), FileData.Num(), Hash).Hash;
+		}
+		else
+		{
+			++NumMissingTextures;
+		}
+		OutManifest.SectionHashes.Add(TextureSection(TextureIndex), Hash);
+	}
+
+	for (int32 MorphIndex = 0; MorphIndex < PmxModel.Morphs.Num(); ++MorphIndex)
+	{
+		OutManifest.SectionHashes.Add(MorphSection(MorphIndex), HashSerialized(PmxModel.Morphs[MorphIndex]));
+	}
+
+	UE_LOG(LogPMXImporter, Verbose, TEXT("PMX Manifest: %d sections (%d textures not found, hashed by path)"),
+		OutManifest.SectionHashes.Num(), NumMissingTextures);
+}
+
+uint64 FPmxManifestBuilder::HashOptions(const UObject& Options, const TCHAR* Stage)
+{
+	const UClass* OptionsClass = Options.GetClass();
+	FString OptionsText;
+	for (TFieldIterator<FProperty> It(OptionsClass, EFieldIterationFlags::None); It; ++It)
+	{
+		if (It->HasAnyPropertyFlags(CPF_Edit) && PmxManifestBuilderPrivate::AffectsStage(**It, Stage))
+		{
+			OptionsText += It->GetName() + TEXT("=");
+			It->ExportTextItem_InContainer(OptionsText, &Options, nullptr, nullptr, PPF_None);
+			OptionsText += TEXT(";");
+		}
+	}
+	return FXxHash64::HashBuffer(*OptionsText, OptionsText.Len() * sizeof(TCHAR)).Hash;
+}
+
+void FPmxManifestBuilder::AddOptionsSections(const UObject& Options, FPmxImportManifest& OutManifest)
+{
+	for (const TCHAR* Stage : { GeometryStage, SkeletonStage, MorphStage, MaterialStage, TextureStage, PhysicsStage })
+	{
+		OutManifest.SectionHashes.Add(OptionsSection(Stage), HashOptions(Options, Stage));
+	}
+}
+
+TSet<FString> FPmxManifestBuilder::DiffManifests(const FPmxImportManifest& OldManifest, const FPmxImportManifest& NewManifest)
+{
+	TSet<FString> ChangedSections;
+	for (const TPair<FString, uint64>& Pair : NewManifest.SectionHashes)
+	{
+		const uint64* OldHash = OldManifest.SectionHashes.Find(Pair.Key);
+		if (!OldHash || *OldHash != Pair.Value)
+		{
+			ChangedSections.Add(Pair.Key);
+		}
+	}
+	for (const TPair<FString, uint64>& Pair : OldManifest.SectionHashes)
+	{
+		if (!NewManifest.SectionHashes.Contains(Pair.Key))
+		{
+			ChangedSections.Add(Pair.Key);
+		}
+	}
+	return ChangedSections;
+}
+
+bool FPmxManifestBuilder::IsAnyChanged(const TSet<FString>& ChangedSections, const TArray<FString>& Dependencies)
+{
+	for (const FString& Dependency : Dependencies)
+	{
+		if (!Dependency.EndsWith(TEXT("/")))
+		{
+			if (ChangedSections.Contains(Dependency))
+			{
+				return true;
+			}
+			continue;
+		}
+
+		for (const FString& Section : ChangedSections)
+		{
+			if (Section.StartsWith(Dependency))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
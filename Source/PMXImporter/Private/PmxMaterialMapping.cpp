@@ -4,8 +4,11 @@
 
 #include "InterchangeMaterialInstanceNode.h"
 #include "LogPMXImporter.h"
+#include "PmxImportDiagnostics.h"
 #include "HAL/IConsoleManager.h"
 #include "PmxUtils.h"
+#include "PmxManifestBuilder.h"
+#include "PmxOutlineBuilder.h"
 
 // Console variables needed for material mapping
 // Parent material for Material Instances. Users can override via console: PMXImporter.ParentMaterial
@@ -15,6 +18,13 @@ static TAutoConsoleVariable<FString> CVarPMXImporterParentMaterial(
 	TEXT("Parent material path for PMX Material Instances. Default = /PMXImporter/M_PMX_Base.M_PMX_Base"),
 	ECVF_Default);
 
+// Parent material for generated outline sections; ideally unlit, opaque and one-sided
+static TAutoConsoleVariable<FString> CVarPMXImporterOutlineMaterial(
+	TEXT("PMXImporter.OutlineMaterial"),
+	TEXT(""),
+	TEXT("Parent material path for generated outline Material Instances (BaseColorTint receives the PMX edge color). Empty = the PMX parent material"),
+	ECVF_Default);
+
 void FPmxMaterialMapping::CreateMaterials(const FPmxModel& PmxModel, const TMap<int32, FString>& TextureUidMap,
 	UInterchangeBaseNodeContainer& BaseNodeContainer, TArray<FString>& OutMaterialUids, TArray<FString>& OutSlotNames,
 	const FString& InParentMaterialPath)
@@ -77,17 +87,17 @@ void FPmxMaterialMapping::CreateMaterials(const FPmxModel& PmxModel, const TMap<
 		// For NodeUid, use index-based naming to ensure uniqueness even with Unicode names
 		const FString MiNodeUid = FString::Printf(TEXT("/PMX/Materials/%d_%s"), MatIdx, *SanitizedLabel);
 		UInterchangeMaterialInstanceNode* MiNode = UInterchangeMaterialInstanceNode::Create(&BaseNodeContainer, *DisplayLabel, *MiNodeUid);
-		UE_LOG(LogPMXImporter, Verbose, TEXT("PMX Translator: Create MI Node Display='%s' SlotLabel='%s' NodeUid='%s'"), *DisplayLabel, *UniqueLabel, *MiNodeUid);
+		PMX_TRACE(LogPMXImporter, TEXT("PMX Translator: Create MI Node Display='%s' SlotLabel='%s' NodeUid='%s'"), *DisplayLabel, *UniqueLabel, *MiNodeUid);
 		if (ensure(MiNode))
 		{
 			if (!ParentMaterialPath.IsEmpty())
 			{
 				MiNode->SetCustomParent(ParentMaterialPath);
-				UE_LOG(LogPMXImporter, Display, TEXT("PMX Translator: Set parent material to '%s' for MI '%s'"), *ParentMaterialPath, *DisplayLabel);
+				PMX_TRACE(LogPMXImporter, TEXT("PMX Translator: Set parent material to '%s' for MI '%s'"), *ParentMaterialPath, *DisplayLabel);
 			}
 			else
 			{
-				UE_LOG(LogPMXImporter, Warning, TEXT("PMX Translator: No parent material path specified for MI '%s'"), *DisplayLabel);
+				PMX_DIAG_WARNING(LogPMXImporter, TEXT("PMX Translator: No parent material path specified for MI '%s'"), *DisplayLabel);
 			}
 
 			// ---- IM4U-inspired mappings ----
@@ -135,13 +145,16 @@ void FPmxMaterialMapping::CreateMaterials(const FPmxModel& PmxModel, const TMap<
 			MiNode->AddStaticSwitchParameterValue(TEXT("pmx.toon.mode"), static_cast<bool>(PmxMat.SharedToonFlag));
 
 			// Edge, Specular, Ambient (store common fields if available)
-			MiNode->AddStaticSwitchParameterValue(TEXT("pmx.edge.draw"), PmxMat.EdgeSize > 0.0f);
+			MiNode->AddStaticSwitchParameterValue(TEXT("pmx.edge.draw"), FPmxOutlineBuilder::HasOutline(PmxMat));
 			MiNode->AddVectorParameterValue(TEXT("pmx.edge.color"), PmxMat.EdgeColor);
 			MiNode->AddScalarParameterValue(TEXT("pmx.edge.size"), PmxMat.EdgeSize);
 			MiNode->AddVectorParameterValue(TEXT("pmx.specular.rgb"), FLinearColor(PmxMat.Specular.X, PmxMat.Specular.Y, PmxMat.Specular.Z, 1.0f));
 			MiNode->AddScalarParameterValue(TEXT("pmx.specular.power"), PmxMat.SpecularStrength);
 			MiNode->AddVectorParameterValue(TEXT("pmx.ambient.rgb"), FLinearColor(PmxMat.Ambient.X, PmxMat.Ambient.Y, PmxMat.Ambient.Z, 1.0f));
 
+			// Incremental reimport rebuilds this material only if its section changed
+			MiNode->AddStringAttribute(FPmxManifestBuilder::SectionAttributeKey, FPmxManifestBuilder::MaterialSection(MatIdx));
+
 			// Store slot mapping with MI node UID
 			OutSlotNames.Add(UniqueLabel);
 			OutMaterialUids.Add(MiNode->GetUniqueID());
@@ -156,6 +169,54 @@ void FPmxMaterialMapping::CreateMaterials(const FPmxModel& PmxModel, const TMap<
 
 	UE_LOG(LogPMXImporter, Display, TEXT("PMX Translator: Materials=%d, TwoSided=%d, Masked=%d, Translucent=%d"),
 		PmxModel.Materials.Num(), CountTwoSided, CountMasked, CountTranslucent);
+	PMX_DIAG_COUNT("materials.instances", PmxModel.Materials.Num());
+}
+
+void FPmxMaterialMapping::CreateOutlineMaterials(const FPmxOutlineMesh& Outline, UInterchangeBaseNodeContainer& BaseNodeContainer,
+	TArray<FString>& OutMaterialUids, TArray<FString>& OutSlotNames, const FString& InParentMaterialPath)
+{
+	FString ParentMaterialPath = CVarPMXImporterOutlineMaterial.GetValueOnAnyThread();
+	ParentMaterialPath.TrimStartAndEndInline();
+	if (ParentMaterialPath.IsEmpty())
+	{
+		ParentMaterialPath = InParentMaterialPath.TrimStartAndEnd();
+	}
+	if (ParentMaterialPath.IsEmpty())
+	{
+		ParentMaterialPath = CVarPMXImporterParentMaterial.GetValueOnAnyThread().TrimStartAndEnd();
+	}
+
+	for (int32 SectionIdx = 0; SectionIdx < Outline.Sections.Num(); ++SectionIdx)
+	{
+		const FPmxOutlineSection& Section = Outline.Sections[SectionIdx];
+		const FString SlotName = FPmxOutlineBuilder::GetSlotName(SectionIdx);
+		const FString DisplayLabel = FString::Printf(TEXT("MI_%s"), *SlotName);
+		const FString MiNodeUid = FString::Printf(TEXT("/PMX/Materials/%s"), *SlotName);
+
+		UInterchangeMaterialInstanceNode* MiNode = UInterchangeMaterialInstanceNode::Create(&BaseNodeContainer, *DisplayLabel, *MiNodeUid);
+		if (!ensure(MiNode))
+		{
+			OutSlotNames.Add(SlotName);
+			OutMaterialUids.Add(TEXT(""));
+			continue;
+		}
+
+		if (!ParentMaterialPath.IsEmpty())
+		{
+			MiNode->SetCustomParent(ParentMaterialPath);
+		}
+		MiNode->AddVectorParameterValue(TEXT("BaseColorTint"), Section.Color);
+		MiNode->AddScalarParameterValue(TEXT("Opacity"), FMath::Clamp(Section.Color.A, 0.0f, 1.0f));
+		MiNode->AddStaticSwitchParameterValue(TEXT("pmx.edge.draw"), true);
+		MiNode->AddVectorParameterValue(TEXT("pmx.edge.color"), Section.Color);
+		MiNode->AddStaticSwitchParameterValue(TEXT("pmx.outline"), true);
+
+		OutSlotNames.Add(SlotName);
+		OutMaterialUids.Add(MiNode->GetUniqueID());
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX Translator: Outline materials=%d (parent '%s')"), Outline.Sections.Num(), *ParentMaterialPath);
+	PMX_DIAG_COUNT("materials.outline_instances", Outline.Sections.Num());
 }
 
 // SanitizeAsciiToken function moved to FPmxUtils class
\ No newline at end of file
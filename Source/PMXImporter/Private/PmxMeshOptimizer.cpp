@@ -0,0 +1,522 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxMeshOptimizer.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
+#include "Algo/StableSort.h"
+
+namespace PmxMeshOptimizerPrivate
+{
+	/** FIFO post-transform cache simulation over vertex indices in [0, NumVertices) */
+	struct FCacheSimulator
+	{
+		TArray<int32> Stamps;
+		int32 CacheSize = 0;
+		int32 Counter = 0;
+
+		FCacheSimulator(int32 NumVertices, int32 InCacheSize)
+			: CacheSize(InCacheSize)
+			, Counter(InCacheSize + 1)
+		{
+			Stamps.Init(0, NumVertices);
+		}
+
+		/** Empty the cache: every stamp falls out of the window */
+		void Flush()
+		{
+			Counter += CacheSize + 1;
+		}
+
+		/** Reference a vertex; true on a miss */
+		bool Access(int32 Vertex)
+		{
+			if (Counter - Stamps[Vertex] > CacheSize)
+			{
+				Stamps[Vertex] = Counter++;
+				return true;
+			}
+			return false;
+		}
+
+		int32 AccessTriangle(const int32* Triangle)
+		{
+			return (Access(Triangle[0]) ? 1 : 0) + (Access(Triangle[1]) ? 1 : 0) + (Access(Triangle[2]) ? 1 : 0);
+		}
+	};
+
+	struct FCluster
+	{
+		int32 FirstTriangle = 0;
+		int32 NumTriangles = 0;
+		float SortKey = 0.0f;
+	};
+}
+
+float FPmxMeshOptimizer::ComputeAcmr(TConstArrayView<int32> Indices, int32 NumVertices, int32 InCacheSize)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0)
+	{
+		return 0.0f;
+	}
+
+	PmxMeshOptimizerPrivate::FCacheSimulator Cache(NumVertices, InCacheSize);
+	int32 Misses = 0;
+	for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		Misses += Cache.AccessTriangle(&Indices[Tri * 3]);
+	}
+	return static_cast<float>(Misses) / NumTriangles;
+}
+
+void FPmxMeshOptimizer::OptimizeVertexCache(TConstArrayView<int32> Indices, int32 NumVertices, TArray<int32>& OutIndices, TArray<int32>& OutHardBoundaries)
+{
+	// Tipsify (Sander, Nehab, Barczak: "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007)
+	const int32 NumTriangles = Indices.Num() / 3;
+	OutIndices.Reset(NumTriangles * 3);
+	OutHardBoundaries.Reset();
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	// Vertex -> triangle adjacency (CSR); a degenerate triangle is listed once per corner it occupies
+	TArray<int32> LiveTriangles;
+	LiveTriangles.Init(0, NumVertices);
+	for (int32 Corner = 0; Corner < NumTriangles * 3; ++Corner)
+	{
+		++LiveTriangles[Indices[Corner]];
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.SetNumUninitialized(NumVertices + 1);
+	AdjacencyOffsets[0] = 0;
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] = AdjacencyOffsets[Vertex] + LiveTriangles[Vertex];
+	}
+
+	TArray<int32> Adjacency;
+	Adjacency.SetNumUninitialized(NumTriangles * 3);
+	{
+		TArray<int32> Cursor(AdjacencyOffsets.GetData(), NumVertices);
+		for (int32 Corner = 0; Corner < NumTriangles * 3; ++Corner)
+		{
+			Adjacency[Cursor[Indices[Corner]]++] = Corner / 3;
+		}
+	}
+
+	TArray<int32> CacheTime;
+	CacheTime.Init(0, NumVertices);
+	TBitArray<> Emitted(false, NumTriangles);
+	TArray<int32> DeadEndStack;
+	TArray<int32, TInlineAllocator<64>> Candidates;
+
+	int32 Time = CacheSize + 1;
+	int32 SweepCursor = 0;
+	int32 FanVertex = Indices[0];
+	bool bFlushed = true;
+
+	while (FanVertex != INDEX_NONE)
+	{
+		// Emit every remaining triangle around the fanning vertex
+		Candidates.Reset();
+		for (int32 Entry = AdjacencyOffsets[FanVertex]; Entry < AdjacencyOffsets[FanVertex + 1]; ++Entry)
+		{
+			const int32 Tri = Adjacency[Entry];
+			if (Emitted[Tri])
+			{
+				continue;
+			}
+
+			if (bFlushed)
+			{
+				OutHardBoundaries.Add(OutIndices.Num() / 3);
+				bFlushed = false;
+			}
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Vertex = Indices[Tri * 3 + Corner];
+				OutIndices.Add(Vertex);
+				DeadEndStack.Push(Vertex);
+				Candidates.Add(Vertex);
+				--LiveTriangles[Vertex];
+				if (Time - CacheTime[Vertex] > CacheSize)
+				{
+					CacheTime[Vertex] = Time++;
+				}
+			}
+			Emitted[Tri] = true;
+		}
+
+		// Next fanning vertex: the candidate that stays in the cache longest while its remaining triangles are emitted
+		int32 NextVertex = INDEX_NONE;
+		int32 BestPriority = -1;
+		for (const int32 Vertex : Candidates)
+		{
+			if (LiveTriangles[Vertex] <= 0)
+			{
+				continue;
+			}
+
+			int32 Priority = 0;
+			if (Time - CacheTime[Vertex] + 2 * LiveTriangles[Vertex] <= CacheSize)
+			{
+				Priority = Time - CacheTime[Vertex];
+			}
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				NextVertex = Vertex;
+			}
+		}
+
+		// Dead end: recently used vertices first, then the next vertex in index order (a cache flush)
+		while (NextVertex == INDEX_NONE && DeadEndStack.Num() > 0)
+		{
+			const int32 Vertex = DeadEndStack.Pop(EAllowShrinking::No);
+			if (LiveTriangles[Vertex] > 0)
+			{
+				NextVertex = Vertex;
+			}
+		}
+		while (NextVertex == INDEX_NONE && SweepCursor < NumVertices)
+		{
+			if (LiveTriangles[SweepCursor] > 0)
+			{
+				NextVertex = SweepCursor;
+				bFlushed = true;
+			}
+			++SweepCursor;
+		}
+
+		FanVertex = NextVertex;
+	}
+}
+
+int32 FPmxMeshOptimizer::OptimizeOverdraw(TArray<int32>& InOutIndices, const TArray<int32>& HardBoundaries, TConstArrayView<FVector3f> Positions)
+{
+	using namespace PmxMeshOptimizerPrivate;
+
+	const int32 NumTriangles = InOutIndices.Num() / 3;
+	if (NumTriangles < 2)
+	{
+		return NumTriangles;
+	}
+
+	// Split every hard cluster where the ACMR of the part so far (measured from a cold cache, as it will be after
+	// sorting) is close to the ACMR of the whole hard cluster, so sorting the parts costs little cache efficiency
+	TArray<FCluster> Clusters;
+	FCacheSimulator Cache(Positions.Num(), CacheSize);
+	for (int32 HardIndex = 0; HardIndex < HardBoundaries.Num(); ++HardIndex)
+	{
+		const int32 Start = HardBoundaries[HardIndex];
+		const int32 End = HardBoundaries.IsValidIndex(HardIndex + 1) ? HardBoundaries[HardIndex + 1] : NumTriangles;
+
+		Cache.Flush();
+		int32 HardMisses = 0;
+		for (int32 Tri = Start; Tri < End; ++Tri)
+		{
+			HardMisses += Cache.AccessTriangle(&InOutIndices[Tri * 3]);
+		}
+		const float Threshold = OverdrawClusterThreshold * HardMisses / FMath::Max(End - Start, 1);
+
+		Cache.Flush();
+		FCluster Cluster;
+		Cluster.FirstTriangle = Start;
+		int32 Misses = 0;
+		for (int32 Tri = Start; Tri < End; ++Tri)
+		{
+			Misses += Cache.AccessTriangle(&InOutIndices[Tri * 3]);
+			++Cluster.NumTriangles;
+			if (Tri + 1 < End && Misses <= Threshold * Cluster.NumTriangles)
+			{
+				Clusters.Add(Cluster);
+				Cluster.FirstTriangle = Tri + 1;
+				Cluster.NumTriangles = 0;
+				Misses = 0;
+				Cache.Flush();
+			}
+		}
+		Clusters.Add(Cluster);
+	}
+
+	if (Clusters.Num() < 2)
+	{
+		return Clusters.Num();
+	}
+
+	// Area-weighted centroid and normal per cluster
+	TArray<FVector3f> ClusterCentroids;
+	TArray<FVector3f> ClusterNormals;
+	ClusterCentroids.SetNumZeroed(Clusters.Num());
+	ClusterNormals.SetNumZeroed(Clusters.Num());
+	FVector3f MeshCentroid = FVector3f::ZeroVector;
+	float MeshArea = 0.0f;
+
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+	{
+		const FCluster& Cluster = Clusters[ClusterIndex];
+		FVector3f Centroid = FVector3f::ZeroVector;
+		FVector3f Normal = FVector3f::ZeroVector;
+		float Area = 0.0f;
+		for (int32 Tri = Cluster.FirstTriangle; Tri < Cluster.FirstTriangle + Cluster.NumTriangles; ++Tri)
+		{
+			const FVector3f& P0 = Positions[InOutIndices[Tri * 3 + 0]];
+			const FVector3f& P1 = Positions[InOutIndices[Tri * 3 + 1]];
+			const FVector3f& P2 = Positions[InOutIndices[Tri * 3 + 2]];
+			const FVector3f Cross = (P1 - P0) ^ (P2 - P0);
+			const float TriArea = Cross.Size() * 0.5f;
+
+			Centroid += (P0 + P1 + P2) * (TriArea / 3.0f);
+			Normal += Cross;
+			Area += TriArea;
+		}
+
+		MeshCentroid += Centroid;
+		MeshArea += Area;
+		ClusterCentroids[ClusterIndex] = Area > UE_SMALL_NUMBER ? Centroid / Area : Positions[InOutIndices[Cluster.FirstTriangle * 3]];
+		ClusterNormals[ClusterIndex] = Normal.GetSafeNormal();
+	}
+	MeshCentroid = MeshArea > UE_SMALL_NUMBER ? MeshCentroid / MeshArea : ClusterCentroids[0];
+
+	// Clusters facing away from the centre (likely occluders) draw first
+	for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+	{
+		Clusters[ClusterIndex].SortKey = (ClusterCentroids[ClusterIndex] - MeshCentroid) | ClusterNormals[ClusterIndex];
+	}
+	Algo::StableSortBy(Clusters, [](const FCluster& Cluster) { return -Cluster.SortKey; });
+
+	TArray<int32> Sorted;
+	Sorted.Reserve(InOutIndices.Num());
+	for (const FCluster& Cluster : Clusters)
+	{
+		Sorted.Append(&InOutIndices[Cluster.FirstTriangle * 3], Cluster.NumTriangles * 3);
+	}
+	InOutIndices = MoveTemp(Sorted);
+
+	return Clusters.Num();
+}
+
+bool FPmxMeshOptimizer::OptimizeModel(FPmxModel& PmxModel, TMap<int32, int32>& InOutVertexMap, TArray<FPmxMeshSectionStats>* OutStats)
+{
+	PMX_IMPORT_SCOPE("Optimize Vertex Cache");
+
+	const int32 NumVertices = PmxModel.Vertices.Num();
+	if (NumVertices == 0 || PmxModel.Indices.Num() < 3)
+	{
+		return false;
+	}
+
+	// Triangle order per material section
+	TArray<int32> LocalIndexOf;
+	LocalIndexOf.Init(INDEX_NONE, NumVertices);
+	TArray<int32> LocalToGlobal;
+	TArray<int32> LocalIndices;
+	TArray<FVector3f> LocalPositions;
+	TArray<int32> CacheOrder;
+	TArray<int32> HardBoundaries;
+
+	bool bReordered = false;
+	int64 TotalTriangles = 0;
+	double TotalMissesBefore = 0.0;
+	double TotalMissesAfter = 0.0;
+	int32 NumOptimizedSections = 0;
+	// "<material>:<before>-><after>" per section for the import report
+	TArray<FString> SectionAcmr;
+
+	int32 IndexOffset = 0;
+	for (int32 MatIndex = 0; MatIndex < PmxModel.Materials.Num() && IndexOffset < PmxModel.Indices.Num(); ++MatIndex)
+	{
+		const int32 SurfaceCount = FMath::Max(PmxModel.Materials[MatIndex].SurfaceCount, 0);
+		const int32 NumSectionIndices = FMath::Min(SurfaceCount, PmxModel.Indices.Num() - IndexOffset) / 3 * 3;
+		const int32 SectionStart = IndexOffset;
+		IndexOffset += SurfaceCount;
+
+		FPmxMeshSectionStats Stats;
+		Stats.MaterialIndex = MatIndex;
+		Stats.NumTriangles = NumSectionIndices / 3;
+
+		// Section-local vertex numbering keeps the per-section work proportional to the section
+		LocalToGlobal.Reset();
+		LocalIndices.Reset(NumSectionIndices);
+		bool bValid = true;
+		for (int32 Index = SectionStart; Index < SectionStart + NumSectionIndices; ++Index)
+		{
+			const int32 Vertex = PmxModel.Indices[Index];
+			if (!PmxModel.Vertices.IsValidIndex(Vertex))
+			{
+				bValid = false;
+				break;
+			}
+			if (LocalIndexOf[Vertex] == INDEX_NONE)
+			{
+				LocalIndexOf[Vertex] = LocalToGlobal.Add(Vertex);
+			}
+			LocalIndices.Add(LocalIndexOf[Vertex]);
+		}
+
+		if (bValid && Stats.NumTriangles > 0)
+		{
+			const int32 NumLocalVertices = LocalToGlobal.Num();
+			LocalPositions.Reset(NumLocalVertices);
+			for (const int32 Vertex : LocalToGlobal)
+			{
+				LocalPositions.Add(PmxModel.Vertices[Vertex].Position);
+			}
+
+			Stats.AcmrBefore = ComputeAcmr(LocalIndices, NumLocalVertices);
+			OptimizeVertexCache(LocalIndices, NumLocalVertices, CacheOrder, HardBoundaries);
+			const float CacheOrderAcmr = ComputeAcmr(CacheOrder, NumLocalVertices);
+
+			// Overdraw sorting trades a little cache efficiency; fall back to the cache order if it costs too much
+			TArray<int32> SortedOrder = CacheOrder;
+			Stats.NumClusters = OptimizeOverdraw(SortedOrder, HardBoundaries, LocalPositions);
+			Stats.AcmrAfter = ComputeAcmr(SortedOrder, NumLocalVertices);
+			if (Stats.AcmrAfter > Stats.AcmrBefore || Stats.AcmrAfter > CacheOrderAcmr * OverdrawClusterThreshold)
+			{
+				SortedOrder = MoveTemp(CacheOrder);
+				Stats.AcmrAfter = CacheOrderAcmr;
+				Stats.NumClusters = 1;
+			}
+
+			if (Stats.AcmrAfter < Stats.AcmrBefore)
+			{
+				for (int32 Index = 0; Index < SortedOrder.Num(); ++Index)
+				{
+					PmxModel.Indices[SectionStart + Index] = LocalToGlobal[SortedOrder[Index]];
+				}
+				Stats.bOptimized = true;
+				bReordered = true;
+				++NumOptimizedSections;
+			}
+			else
+			{
+				Stats.AcmrAfter = Stats.AcmrBefore;
+			}
+
+			TotalTriangles += Stats.NumTriangles;
+			TotalMissesBefore += static_cast<double>(Stats.AcmrBefore) * Stats.NumTriangles;
+			TotalMissesAfter += static_cast<double>(Stats.AcmrAfter) * Stats.NumTriangles;
+
+			SectionAcmr.Add(FString::Printf(TEXT("%d:%.3f->%.3f"), MatIndex, Stats.AcmrBefore, Stats.AcmrAfter));
+			PMX_TRACE(LogPMXImporter, TEXT("PMX MeshOptimizer: Material %d '%s': %d triangles, ACMR %.3f -> %.3f (%d clusters)%s"),
+				MatIndex, *PmxModel.Materials[MatIndex].Name, Stats.NumTriangles, Stats.AcmrBefore, Stats.AcmrAfter, Stats.NumClusters,
+				Stats.bOptimized ? TEXT("") : TEXT(", kept PMX order"));
+		}
+		else if (!bValid)
+		{
+			PMX_TRACE(LogPMXImporter, TEXT("PMX MeshOptimizer: Material %d '%s' has out of range indices, kept PMX order"),
+				MatIndex, *PmxModel.Materials[MatIndex].Name);
+		}
+
+		for (const int32 Vertex : LocalToGlobal)
+		{
+			LocalIndexOf[Vertex] = INDEX_NONE;
+		}
+
+		if (OutStats)
+		{
+			OutStats->Add(Stats);
+		}
+	}
+
+	// Vertex order: first use by the index buffer, unreferenced vertices last in their original order
+	TArray<int32> OldToNew;
+	OldToNew.Init(INDEX_NONE, NumVertices);
+	int32 NextVertex = 0;
+	for (const int32 Vertex : PmxModel.Indices)
+	{
+		if (PmxModel.Vertices.IsValidIndex(Vertex) && OldToNew[Vertex] == INDEX_NONE)
+		{
+			OldToNew[Vertex] = NextVertex++;
+		}
+	}
+	bool bVerticesMoved = false;
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		if (OldToNew[Vertex] == INDEX_NONE)
+		{
+			OldToNew[Vertex] = NextVertex++;
+		}
+		bVerticesMoved |= OldToNew[Vertex] != Vertex;
+	}
+
+	if (bVerticesMoved)
+	{
+		auto Remap = [&OldToNew](int32& Vertex)
+		{
+			if (OldToNew.IsValidIndex(Vertex))
+			{
+				Vertex = OldToNew[Vertex];
+			}
+		};
+
+		TArray<FPmxVertex> Vertices;
+		Vertices.SetNum(NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			Vertices[OldToNew[Vertex]] = MoveTemp(PmxModel.Vertices[Vertex]);
+		}
+		PmxModel.Vertices = MoveTemp(Vertices);
+
+		for (int32& Vertex : PmxModel.Indices)
+		{
+			Remap(Vertex);
+		}
+		for (FPmxMorph& Morph : PmxModel.Morphs)
+		{
+			for (FPmxVertexMorph& VertexMorph : Morph.VertexMorphs)
+			{
+				Remap(VertexMorph.VertexIndex);
+			}
+			for (FPmxUVMorph& UVMorph : Morph.UVMorphs)
+			{
+				Remap(UVMorph.VertexIndex);
+			}
+		}
+		for (FPmxSoftBody& SoftBody : PmxModel.SoftBodies)
+		{
+			for (int32& Vertex : SoftBody.PinVertexIndices)
+			{
+				Remap(Vertex);
+			}
+		}
+
+		// The map is empty when nothing was welded; it is then the identity this reorder just broke
+		if (InOutVertexMap.IsEmpty())
+		{
+			InOutVertexMap.Reserve(NumVertices);
+			for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+			{
+				InOutVertexMap.Add(Vertex, OldToNew[Vertex]);
+			}
+		}
+		else
+		{
+			for (TPair<int32, int32>& Pair : InOutVertexMap)
+			{
+				Remap(Pair.Value);
+			}
+		}
+	}
+
+	const float AcmrBefore = TotalTriangles > 0 ? static_cast<float>(TotalMissesBefore / TotalTriangles) : 0.0f;
+	const float AcmrAfter = TotalTriangles > 0 ? static_cast<float>(TotalMissesAfter / TotalTriangles) : 0.0f;
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX MeshOptimizer: %d/%d sections reordered, ACMR %.3f -> %.3f (cache size %d)%s"),
+		NumOptimizedSections, PmxModel.Materials.Num(), AcmrBefore, AcmrAfter, CacheSize,
+		bVerticesMoved ? TEXT(", vertices renumbered by first use") : TEXT(""));
+
+	PMX_DIAG_COUNT("mesh.sections_reordered", NumOptimizedSections);
+	if (FPmxImportProfiler* Profiler = FPmxImportProfiler::GetCurrent())
+	{
+		Profiler->SetInfo(TEXT("AcmrBefore"), FString::Printf(TEXT("%.3f"), AcmrBefore));
+		Profiler->SetInfo(TEXT("AcmrAfter"), FString::Printf(TEXT("%.3f"), AcmrAfter));
+		Profiler->SetInfo(TEXT("SectionAcmr"), FString::Join(SectionAcmr, TEXT(", ")));
+	}
+
+	return bReordered || bVerticesMoved;
+}
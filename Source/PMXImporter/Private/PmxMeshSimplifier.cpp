@@ -0,0 +1,571 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxMeshSimplifier.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+namespace PmxMeshSimplifierPrivate
+{
+	/** Area-weighted sum of plane quadrics; Evaluate() returns the weighted mean squared plane distance */
+	struct FQuadric
+	{
+		double A2 = 0.0, AB = 0.0, AC = 0.0, AD = 0.0;
+		double B2 = 0.0, BC = 0.0, BD = 0.0;
+		double C2 = 0.0, CD = 0.0;
+		double D2 = 0.0;
+		double Weight = 0.0;
+
+		static FQuadric FromPlane(const FVector3d& Normal, double Distance, double InWeight)
+		{
+			FQuadric Q;
+			Q.A2 = Normal.X * Normal.X * InWeight;
+			Q.AB = Normal.X * Normal.Y * InWeight;
+			Q.AC = Normal.X * Normal.Z * InWeight;
+			Q.AD = Normal.X * Distance * InWeight;
+			Q.B2 = Normal.Y * Normal.Y * InWeight;
+			Q.BC = Normal.Y * Normal.Z * InWeight;
+			Q.BD = Normal.Y * Distance * InWeight;
+			Q.C2 = Normal.Z * Normal.Z * InWeight;
+			Q.CD = Normal.Z * Distance * InWeight;
+			Q.D2 = Distance * Distance * InWeight;
+			Q.Weight = InWeight;
+			return Q;
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			A2 += Other.A2; AB += Other.AB; AC += Other.AC; AD += Other.AD;
+			B2 += Other.B2; BC += Other.BC; BD += Other.BD;
+			C2 += Other.C2; CD += Other.CD;
+			D2 += Other.D2;
+			Weight += Other.Weight;
+			return *this;
+		}
+
+		double Evaluate(const FVector3d& P) const
+		{
+			const double Error =
+				P.X * (A2 * P.X + 2.0 * (AB * P.Y + AC * P.Z + AD)) +
+				P.Y * (B2 * P.Y + 2.0 * (BC * P.Z + BD)) +
+				P.Z * (C2 * P.Z + 2.0 * CD) +
+				D2;
+			return FMath::Abs(Error) / FMath::Max(Weight, UE_DOUBLE_SMALL_NUMBER);
+		}
+	};
+
+	/** Read-only per-model vertex data shared by the section tasks */
+	struct FModelContext
+	{
+		const FPmxModel& Model;
+		float MaxWeightDifference = 0.5f;
+
+		/** Vertices referenced by more than one material */
+		TBitArray<> SharedVertices;
+
+		/** Hash of the sorted morph indices moving the vertex (0 = none) */
+		TArray<uint32> MorphSignatures;
+
+		/** Vertex morph deltas per vertex sorted by morph index (CSR) */
+		TArray<int32> MorphDeltaOffsets;
+		TArray<TPair<int32, FVector3f>> MorphDeltas;
+
+		explicit FModelContext(const FPmxModel& InModel) : Model(InModel) {}
+	};
+
+	static uint64 EdgeKey(int32 A, int32 B)
+	{
+		return (static_cast<uint64>(FMath::Min(A, B)) << 32) | static_cast<uint32>(FMath::Max(A, B));
+	}
+
+	/** Sum of per-bone absolute weight differences (0 = identical, 2 = disjoint) */
+	static float GetWeightDifference(const FPmxVertex& A, const FPmxVertex& B)
+	{
+		TArray<TPair<int32, float>, TInlineAllocator<8>> Weights;
+		auto Accumulate = [&Weights](const FPmxVertex& Vertex, float Sign)
+		{
+			const int32 NumWeights = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+			for (int32 Slot = 0; Slot < NumWeights; ++Slot)
+			{
+				if (Vertex.BoneWeights[Slot] <= 0.0f)
+				{
+					continue;
+				}
+				TPair<int32, float>* Entry = Weights.FindByPredicate([Bone = Vertex.BoneIndices[Slot]](const TPair<int32, float>& Pair) { return Pair.Key == Bone; });
+				if (!Entry)
+				{
+					Entry = &Weights.Emplace_GetRef(Vertex.BoneIndices[Slot], 0.0f);
+				}
+				Entry->Value += Sign * Vertex.BoneWeights[Slot];
+			}
+		};
+		Accumulate(A, 1.0f);
+		Accumulate(B, -1.0f);
+
+		float Difference = 0.0f;
+		for (const TPair<int32, float>& Entry : Weights)
+		{
+			Difference += FMath::Abs(Entry.Value);
+		}
+		return Difference;
+	}
+
+	/** Squared change of every morph's target position when From is replaced by To */
+	static double GetMorphCost(const FModelContext& Context, int32 From, int32 To)
+	{
+		double Cost = 0.0;
+		int32 IndexA = Context.MorphDeltaOffsets[From];
+		int32 IndexB = Context.MorphDeltaOffsets[To];
+		const int32 EndA = Context.MorphDeltaOffsets[From + 1];
+		const int32 EndB = Context.MorphDeltaOffsets[To + 1];
+		while (IndexA < EndA || IndexB < EndB)
+		{
+			const int32 MorphA = IndexA < EndA ? Context.MorphDeltas[IndexA].Key : MAX_int32;
+			const int32 MorphB = IndexB < EndB ? Context.MorphDeltas[IndexB].Key : MAX_int32;
+			FVector3f Delta = FVector3f::ZeroVector;
+			if (MorphA <= MorphB)
+			{
+				Delta += Context.MorphDeltas[IndexA++].Value;
+			}
+			if (MorphB <= MorphA)
+			{
+				Delta -= Context.MorphDeltas[IndexB++].Value;
+			}
+			Cost += Delta.SizeSquared();
+		}
+		return Cost;
+	}
+
+	/** Simplify one material section (global vertex indices) to about TargetTriangles */
+	static void SimplifySection(const FModelContext& Context, TConstArrayView<int32> SectionIndices, int32 TargetTriangles, TArray<int32>& OutIndices)
+	{
+		const FPmxModel& Model = Context.Model;
+		const int32 NumSectionTriangles = SectionIndices.Num() / 3;
+		if (NumSectionTriangles <= TargetTriangles)
+		{
+			OutIndices = TArray<int32>(SectionIndices.GetData(), SectionIndices.Num());
+			return;
+		}
+
+		// Section-local vertices
+		TMap<int32, int32> GlobalToLocal;
+		GlobalToLocal.Reserve(SectionIndices.Num() / 2);
+		TArray<int32> LocalToGlobal;
+		TArray<int32> Indices;
+		Indices.Reserve(SectionIndices.Num());
+		for (const int32 Vertex : SectionIndices)
+		{
+			int32& Local = GlobalToLocal.FindOrAdd(Vertex, INDEX_NONE);
+			if (Local == INDEX_NONE)
+			{
+				Local = LocalToGlobal.Add(Vertex);
+			}
+			Indices.Add(Local);
+		}
+		const int32 NumLocal = LocalToGlobal.Num();
+
+		TArray<FVector3d> Positions;
+		Positions.Reserve(NumLocal);
+		TBitArray<> Locked(false, NumLocal);
+		for (int32 Local = 0; Local < NumLocal; ++Local)
+		{
+			Positions.Add(FVector3d(Model.Vertices[LocalToGlobal[Local]].Position));
+			Locked[Local] = Context.SharedVertices[LocalToGlobal[Local]];
+		}
+
+		// Open and non-manifold edges: mesh borders and the seams where PMX splits vertices (UV, normal, weights)
+		{
+			TMap<uint64, int32> EdgeUse;
+			EdgeUse.Reserve(Indices.Num());
+			for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+			{
+				const int32 A = Indices[Corner];
+				const int32 B = Indices[(Corner % 3 == 2) ? Corner - 2 : Corner + 1];
+				if (A != B)
+				{
+					++EdgeUse.FindOrAdd(EdgeKey(A, B), 0);
+				}
+			}
+			for (const TPair<uint64, int32>& Edge : EdgeUse)
+			{
+				if (Edge.Value != 2)
+				{
+					Locked[static_cast<int32>(Edge.Key >> 32)] = true;
+					Locked[static_cast<int32>(Edge.Key & 0xffffffffu)] = true;
+				}
+			}
+		}
+
+		TArray<FQuadric> Quadrics;
+		Quadrics.SetNum(NumLocal);
+		for (int32 Tri = 0; Tri < NumSectionTriangles; ++Tri)
+		{
+			const FVector3d& P0 = Positions[Indices[Tri * 3 + 0]];
+			const FVector3d Cross = (Positions[Indices[Tri * 3 + 1]] - P0) ^ (Positions[Indices[Tri * 3 + 2]] - P0);
+			const double DoubleArea = Cross.Size();
+			if (DoubleArea <= UE_DOUBLE_SMALL_NUMBER)
+			{
+				continue;
+			}
+			const FVector3d Normal = Cross / DoubleArea;
+			const FQuadric Plane = FQuadric::FromPlane(Normal, -(Normal | P0), DoubleArea * 0.5);
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Quadrics[Indices[Tri * 3 + Corner]] += Plane;
+			}
+		}
+
+		struct FCollapse
+		{
+			int32 From = INDEX_NONE;
+			int32 To = INDEX_NONE;
+			double Cost = 0.0;
+		};
+
+		auto CanCollapse = [&](int32 From, int32 To)
+		{
+			if (Locked[From])
+			{
+				return false;
+			}
+			const int32 GlobalFrom = LocalToGlobal[From];
+			const int32 GlobalTo = LocalToGlobal[To];
+			return Context.MorphSignatures[GlobalFrom] == Context.MorphSignatures[GlobalTo]
+				&& GetWeightDifference(Model.Vertices[GlobalFrom], Model.Vertices[GlobalTo]) <= Context.MaxWeightDifference;
+		};
+
+		auto GetCost = [&](int32 From, int32 To)
+		{
+			const int32 GlobalFrom = LocalToGlobal[From];
+			double Cost = Quadrics[From].Evaluate(Positions[To]);
+			if (Context.MorphSignatures[GlobalFrom] != 0)
+			{
+				Cost += GetMorphCost(Context, GlobalFrom, LocalToGlobal[To]);
+			}
+			return Cost;
+		};
+
+		TArray<int32> TriangleOffsets;
+		TArray<int32> VertexTriangles;
+		TArray<uint64> Edges;
+		TArray<FCollapse> Collapses;
+		TArray<int32> CollapseTarget;
+
+		// Passes of independent collapses in cost order (each vertex and its neighbourhood changes once per pass)
+		int32 NumTriangles = NumSectionTriangles;
+		while (NumTriangles > TargetTriangles)
+		{
+			// Vertex -> triangle adjacency
+			TriangleOffsets.Init(0, NumLocal + 1);
+			for (const int32 Vertex : Indices)
+			{
+				++TriangleOffsets[Vertex + 1];
+			}
+			for (int32 Local = 0; Local < NumLocal; ++Local)
+			{
+				TriangleOffsets[Local + 1] += TriangleOffsets[Local];
+			}
+			VertexTriangles.SetNumUninitialized(Indices.Num());
+			{
+				TArray<int32> Cursor(TriangleOffsets.GetData(), NumLocal);
+				for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+				{
+					VertexTriangles[Cursor[Indices[Corner]]++] = Corner / 3;
+				}
+			}
+
+			// Cheapest valid direction of every edge
+			Edges.Reset(Indices.Num());
+			for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+			{
+				Edges.Add(EdgeKey(Indices[Corner], Indices[(Corner % 3 == 2) ? Corner - 2 : Corner + 1]));
+			}
+			Algo::Sort(Edges);
+			Collapses.Reset();
+			for (int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); ++EdgeIndex)
+			{
+				if (EdgeIndex > 0 && Edges[EdgeIndex] == Edges[EdgeIndex - 1])
+				{
+					continue;
+				}
+				const int32 A = static_cast<int32>(Edges[EdgeIndex] >> 32);
+				const int32 B = static_cast<int32>(Edges[EdgeIndex] & 0xffffffffu);
+
+				FCollapse Best;
+				Best.Cost = TNumericLimits<double>::Max();
+				if (CanCollapse(A, B))
+				{
+					Best = { A, B, GetCost(A, B) };
+				}
+				if (CanCollapse(B, A))
+				{
+					const double Cost = GetCost(B, A);
+					if (Cost < Best.Cost)
+					{
+						Best = { B, A, Cost };
+					}
+				}
+				if (Best.From != INDEX_NONE)
+				{
+					Collapses.Add(Best);
+				}
+			}
+			if (Collapses.Num() == 0)
+			{
+				break;
+			}
+			Algo::SortBy(Collapses, &FCollapse::Cost);
+
+			CollapseTarget.SetNumUninitialized(NumLocal);
+			for (int32 Local = 0; Local < NumLocal; ++Local)
+			{
+				CollapseTarget[Local] = Local;
+			}
+			TBitArray<> Touched(false, NumLocal);
+			const int32 MaxRemoved = NumTriangles - TargetTriangles;
+			int32 NumRemoved = 0;
+			int32 NumApplied = 0;
+
+			for (const FCollapse& Collapse : Collapses)
+			{
+				if (Touched[Collapse.From] || Touched[Collapse.To])
+				{
+					continue;
+				}
+
+				// Reject collapses that flip or crush a remaining triangle
+				bool bValid = true;
+				int32 NumShared = 0;
+				for (int32 Entry = TriangleOffsets[Collapse.From]; Entry < TriangleOffsets[Collapse.From + 1] && bValid; ++Entry)
+				{
+					const int32* Tri = &Indices[VertexTriangles[Entry] * 3];
+					if (Tri[0] == Collapse.To || Tri[1] == Collapse.To || Tri[2] == Collapse.To)
+					{
+						++NumShared;
+						continue;
+					}
+
+					FVector3d Before[3];
+					FVector3d After[3];
+					for (int32 Corner = 0; Corner < 3; ++Corner)
+					{
+						Before[Corner] = Positions[Tri[Corner]];
+						After[Corner] = Tri[Corner] == Collapse.From ? Positions[Collapse.To] : Before[Corner];
+					}
+					const FVector3d NormalBefore = (Before[1] - Before[0]) ^ (Before[2] - Before[0]);
+					const FVector3d NormalAfter = (After[1] - After[0]) ^ (After[2] - After[0]);
+					const double Scale = NormalBefore.Size() * NormalAfter.Size();
+					bValid = Scale > UE_DOUBLE_SMALL_NUMBER && (NormalBefore | NormalAfter) > 0.25 * Scale;
+				}
+				if (!bValid)
+				{
+					continue;
+				}
+
+				CollapseTarget[Collapse.From] = Collapse.To;
+				Quadrics[Collapse.To] += Quadrics[Collapse.From];
+				for (int32 Entry = TriangleOffsets[Collapse.From]; Entry < TriangleOffsets[Collapse.From + 1]; ++Entry)
+				{
+					const int32* Tri = &Indices[VertexTriangles[Entry] * 3];
+					Touched[Tri[0]] = true;
+					Touched[Tri[1]] = true;
+					Touched[Tri[2]] = true;
+				}
+
+				++NumApplied;
+				NumRemoved += NumShared;
+				if (NumRemoved >= MaxRemoved)
+				{
+					break;
+				}
+			}
+
+			if (NumApplied == 0)
+			{
+				break;
+			}
+
+			// Apply the pass and drop collapsed triangles
+			int32 Write = 0;
+			for (int32 Tri = 0; Tri < Indices.Num() / 3; ++Tri)
+			{
+				const int32 A = CollapseTarget[Indices[Tri * 3 + 0]];
+				const int32 B = CollapseTarget[Indices[Tri * 3 + 1]];
+				const int32 C = CollapseTarget[Indices[Tri * 3 + 2]];
+				if (A != B && B != C && C != A)
+				{
+					Indices[Write++] = A;
+					Indices[Write++] = B;
+					Indices[Write++] = C;
+				}
+			}
+			Indices.SetNum(Write, EAllowShrinking::No);
+			NumTriangles = Write / 3;
+		}
+
+		OutIndices.Reset(Indices.Num());
+		for (const int32 Local : Indices)
+		{
+			OutIndices.Add(LocalToGlobal[Local]);
+		}
+	}
+}
+
+bool FPmxMeshSimplifier::BuildLodChain(const FPmxModel& PmxModel, const FPmxLodSettings& Settings, TArray<FPmxMeshLod>& OutLods)
+{
+	PMX_IMPORT_SCOPE("Simplify");
+	using namespace PmxMeshSimplifierPrivate;
+
+	OutLods.Reset();
+	const int32 NumVertices = PmxModel.Vertices.Num();
+	if (Settings.NumLods <= 0 || NumVertices == 0 || PmxModel.Indices.Num() < 3)
+	{
+		return false;
+	}
+
+	// LOD0 material ranges (only sections with valid indices are simplified)
+	const int32 NumSections = PmxModel.Materials.Num();
+	TArray<TArray<int32>> Sections;
+	Sections.SetNum(NumSections);
+	TBitArray<> Simplifiable(false, NumSections);
+	TArray<int32> FirstSection;
+	FirstSection.Init(INDEX_NONE, NumVertices);
+
+	FModelContext Context(PmxModel);
+	Context.MaxWeightDifference = Settings.MaxWeightDifference;
+	Context.SharedVertices.Init(false, NumVertices);
+
+	int32 IndexOffset = 0;
+	for (int32 MatIndex = 0; MatIndex < NumSections; ++MatIndex)
+	{
+		const int32 SurfaceCount = FMath::Max(PmxModel.Materials[MatIndex].SurfaceCount, 0);
+		const int32 NumSectionIndices = FMath::Clamp(PmxModel.Indices.Num() - IndexOffset, 0, SurfaceCount) / 3 * 3;
+		Sections[MatIndex] = TArray<int32>(PmxModel.Indices.GetData() + IndexOffset, NumSectionIndices);
+		IndexOffset += SurfaceCount;
+
+		bool bValid = true;
+		for (const int32 Vertex : Sections[MatIndex])
+		{
+			if (!PmxModel.Vertices.IsValidIndex(Vertex))
+			{
+				bValid = false;
+				break;
+			}
+			if (FirstSection[Vertex] == INDEX_NONE)
+			{
+				FirstSection[Vertex] = MatIndex;
+			}
+			else if (FirstSection[Vertex] != MatIndex)
+			{
+				Context.SharedVertices[Vertex] = true;
+			}
+		}
+		Simplifiable[MatIndex] = bValid;
+	}
+	const TArray<int32> Uncovered(PmxModel.Indices.GetData() + FMath::Min(IndexOffset, PmxModel.Indices.Num()),
+		FMath::Max(PmxModel.Indices.Num() - IndexOffset, 0) / 3 * 3);
+
+	// Morph membership and deltas per vertex
+	Context.MorphSignatures.Init(0, NumVertices);
+	Context.MorphDeltaOffsets.Init(0, NumVertices + 1);
+	for (int32 MorphIndex = 0; MorphIndex < PmxModel.Morphs.Num(); ++MorphIndex)
+	{
+		const FPmxMorph& Morph = PmxModel.Morphs[MorphIndex];
+		for (const FPmxVertexMorph& VertexMorph : Morph.VertexMorphs)
+		{
+			if (PmxModel.Vertices.IsValidIndex(VertexMorph.VertexIndex))
+			{
+				++Context.MorphDeltaOffsets[VertexMorph.VertexIndex + 1];
+			}
+		}
+	}
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		Context.MorphDeltaOffsets[Vertex + 1] += Context.MorphDeltaOffsets[Vertex];
+	}
+	Context.MorphDeltas.SetNum(Context.MorphDeltaOffsets[NumVertices]);
+	{
+		TArray<int32> Cursor(Context.MorphDeltaOffsets.GetData(), NumVertices);
+		for (int32 MorphIndex = 0; MorphIndex < PmxModel.Morphs.Num(); ++MorphIndex)
+		{
+			const FPmxMorph& Morph = PmxModel.Morphs[MorphIndex];
+			for (const FPmxVertexMorph& VertexMorph : Morph.VertexMorphs)
+			{
+				if (PmxModel.Vertices.IsValidIndex(VertexMorph.VertexIndex))
+				{
+					Context.MorphDeltas[Cursor[VertexMorph.VertexIndex]++] = TPair<int32, FVector3f>(MorphIndex, VertexMorph.Offset);
+				}
+			}
+			// UV morphs only constrain membership (a collapse cannot keep UV deltas of the removed vertex)
+			for (const FPmxUVMorph& UVMorph : Morph.UVMorphs)
+			{
+				if (PmxModel.Vertices.IsValidIndex(UVMorph.VertexIndex))
+				{
+					Context.MorphSignatures[UVMorph.VertexIndex] = HashCombineFast(Context.MorphSignatures[UVMorph.VertexIndex], GetTypeHash(~MorphIndex));
+				}
+			}
+		}
+	}
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		// Morphs were added in index order, so each vertex's deltas are already sorted
+		for (int32 Entry = Context.MorphDeltaOffsets[Vertex]; Entry < Context.MorphDeltaOffsets[Vertex + 1]; ++Entry)
+		{
+			Context.MorphSignatures[Vertex] = HashCombineFast(Context.MorphSignatures[Vertex], GetTypeHash(Context.MorphDeltas[Entry].Key + 1));
+		}
+	}
+
+	const int32 Lod0Triangles = PmxModel.Indices.Num() / 3;
+	int32 PreviousTriangles = Lod0Triangles;
+	const float Ratio = FMath::Clamp(Settings.ReductionRatio, 0.01f, 1.0f);
+
+	for (int32 LodIndex = 1; LodIndex <= Settings.NumLods; ++LodIndex)
+	{
+		TArray<TArray<int32>> Simplified;
+		Simplified.SetNum(NumSections);
+		ParallelFor(NumSections, [&](int32 Section)
+		{
+			const int32 NumTriangles = Sections[Section].Num() / 3;
+			const int32 Target = FMath::Max(FMath::FloorToInt32(NumTriangles * Ratio), 1);
+			if (Simplifiable[Section])
+			{
+				SimplifySection(Context, Sections[Section], Target, Simplified[Section]);
+			}
+			else
+			{
+				Simplified[Section] = Sections[Section];
+			}
+		});
+
+		FPmxMeshLod& Lod = OutLods.AddDefaulted_GetRef();
+		Lod.SurfaceCounts.Reserve(NumSections);
+		for (const TArray<int32>& SectionIndices : Simplified)
+		{
+			Lod.SurfaceCounts.Add(SectionIndices.Num());
+			Lod.Indices.Append(SectionIndices);
+		}
+		Lod.Indices.Append(Uncovered);
+
+		const int32 LodTriangles = GetNumTriangles(Lod);
+		UE_LOG(LogPMXImporter, Display, TEXT("PMX MeshSimplifier: LOD%d %d triangles (%.1f%% of LOD0, target %.1f%% of LOD%d)"),
+			LodIndex, LodTriangles, 100.0f * LodTriangles / FMath::Max(Lod0Triangles, 1), 100.0f * Ratio, LodIndex - 1);
+		PMX_DIAG_COUNT("mesh.lod_triangles", LodTriangles);
+
+		// Everything left is locked: further LODs would be identical
+		if (LodTriangles >= PreviousTriangles)
+		{
+			OutLods.Pop();
+			UE_LOG(LogPMXImporter, Display, TEXT("PMX MeshSimplifier: LOD%d could not be reduced further, stopping at %d LODs"),
+				LodIndex, OutLods.Num() + 1);
+			break;
+		}
+
+		PreviousTriangles = LodTriangles;
+		Sections = MoveTemp(Simplified);
+	}
+
+	return OutLods.Num() > 0;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxModelCache.h"
+#include "PmxStructs.h"
+#include "PmxTranslator.h"
+#include "PmxImportProfiler.h"
+#include "LogPMXImporter.h"
+#include "DerivedDataCacheInterface.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/xxhash.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<bool> CVarPMXImporterModelCache(
+	TEXT("PMXImporter.ModelCache"),
+	true,
+	TEXT("Cache translated PMX models in the DerivedDataCache so unchanged files skip parsing, cleaning and welding."),
+	ECVF_Default);
+
+namespace PmxModelCachePrivate
+{
+	/** Bump when the cached layout or the cleaning/welding output changes */
+	static constexpr uint32 CacheFormatVersion = 1;
+	static constexpr uint32 CacheMagic = 0x434D4D50; // 'PMMC'
+	static const TCHAR* CacheKeyPrefix = TEXT("PMXMODEL");
+
+	struct FStats
+	{
+		FCriticalSection Lock;
+		int32 Hits = 0;
+		int32 Misses = 0;
+		double SecondsSaved = 0.0;
+	};
+
+	static FStats& GetStats()
+	{
+		static FStats Stats;
+		return Stats;
+	}
+
+	static FString GetPluginVersion()
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("PMXImporter"));
+		return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("Unknown");
+	}
+}
+
+bool FPmxModelCache::IsEnabled()
+{
+	return CVarPMXImporterModelCache.GetValueOnAnyThread();
+}
+
+FString FPmxModelCache::BuildCacheKey(const TArray<uint8>& FileData, const FPmxImportOptions& Options)
+{
+	PMX_IMPORT_SCOPE("Hash Source");
+	using namespace PmxModelCachePrivate;
+
+	const FXxHash128 ContentHash = FXxHash128::HashBuffer(FileData.GetData(), FileData.Num());
+
+	// Only the options CleanPmxModel / RemoveDoubles read; everything else, skin weight cleanup and the vertex cache
+	// order included, is applied by the pipeline after translation
+	const FString Suffix = FString::Printf(TEXT("%016llx%016llx_%d_%s_C%dW%dM%d"),
+		ContentHash.HashHigh, ContentHash.HashLow, FileData.Num(), *GetPluginVersion(),
+		Options.bCleanModel ? 1 : 0, Options.bRemoveDoubles ? 1 : 0, Options.bImportMorphs ? 1 : 0);
+
+	return FDerivedDataCacheInterface::BuildCacheKey(CacheKeyPrefix, *FString::FromInt(CacheFormatVersion), *Suffix);
+}
+
+bool FPmxModelCache::Load(const FString& CacheKey, FPmxModel& OutModel, TMap<int32, int32>& OutVertexMap)
+{
+	PMX_IMPORT_SCOPE("Model Cache Load");
+	using namespace PmxModelCachePrivate;
+
+	const double StartTime = FPlatformTime::Seconds();
+	FStats& Stats = GetStats();
+
+	TArray<uint8> Data;
+	bool bHit = GetDerivedDataCacheRef().GetSynchronous(*CacheKey, Data, TEXT("PMXModel"));
+	double BuildSeconds = 0.0;
+	if (bHit)
+	{
+		FMemoryReader Reader(Data);
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic == CacheMagic && Version == CacheFormatVersion)
+		{
+			Reader << BuildSeconds << OutModel << OutVertexMap;
+		}
+		bHit = Magic == CacheMagic && Version == CacheFormatVersion && !Reader.IsError();
+		if (!bHit)
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PMX ModelCache: Discarding unreadable entry %s"), *CacheKey);
+			OutModel = FPmxModel();
+			OutVertexMap.Reset();
+		}
+	}
+
+	const double LoadSeconds = FPlatformTime::Seconds() - StartTime;
+	FScopeLock Lock(&Stats.Lock);
+	if (bHit)
+	{
+		++Stats.Hits;
+		Stats.SecondsSaved += FMath::Max(BuildSeconds - LoadSeconds, 0.0);
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX ModelCache: Hit (%d vertices, %.1f KB) in %.3f s, saved %.3f s"),
+			OutModel.Vertices.Num(), Data.Num() / 1024.0, LoadSeconds, FMath::Max(BuildSeconds - LoadSeconds, 0.0));
+	}
+	else
+	{
+		++Stats.Misses;
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX ModelCache: Miss (%.3f s)"), LoadSeconds);
+	}
+	return bHit;
+}
+
+void FPmxModelCache::Store(const FString& CacheKey, const FPmxModel& Model, const TMap<int32, int32>& VertexMap, double BuildSeconds)
+{
+	PMX_IMPORT_SCOPE("Model Cache Store");
+	using namespace PmxModelCachePrivate;
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	uint32 Magic = CacheMagic;
+	uint32 Version = CacheFormatVersion;
+	Writer << Magic << Version << BuildSeconds;
+	Writer << const_cast<FPmxModel&>(Model) << const_cast<TMap<int32, int32>&>(VertexMap);
+
+	GetDerivedDataCacheRef().Put(*CacheKey, Data, TEXT("PMXModel"));
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX ModelCache: Stored %.1f KB (build %.3f s)"), Data.Num() / 1024.0, BuildSeconds);
+}
+
+void FPmxModelCache::LogStats()
+{
+	using namespace PmxModelCachePrivate;
+
+	FStats& Stats = GetStats();
+	FScopeLock Lock(&Stats.Lock);
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX ModelCache: %d hits, %d misses, %.3f s saved this session"),
+		Stats.Hits, Stats.Misses, Stats.SecondsSaved);
+}
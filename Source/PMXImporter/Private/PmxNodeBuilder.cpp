@@ -8,6 +8,7 @@
 #include "LogPMXImporter.h"
 #include "HAL/IConsoleManager.h"
 #include "PmxUtils.h"
+#include "Math/VectorRegister.h"
 
 // Console variables needed for node building
 UInterchangeSceneNode* FPmxNodeBuilder::CreateSceneRoot(const FPmxModel& PmxModel, 
@@ -23,8 +24,122 @@ UInterchangeSceneNode* FPmxNodeBuilder::CreateSceneRoot(const FPmxModel& PmxMode
 	return RootNode;
 }
 
-FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, 
-	UInterchangeSceneNode* RootNode, TMap<int32, UInterchangeSceneNode*>& OutBoneIndexToJointNode)
+void FPmxNodeBuilder::BuildSkeletonLayout(const FPmxModel& PmxModel, FPmxSkeletonLayout& OutLayout)
+{
+	const int32 NumBones = PmxModel.Bones.Num();
+
+	OutLayout.SortedBones.Reset(NumBones);
+	OutLayout.Parents.SetNumUninitialized(NumBones);
+	OutLayout.WorldTransforms.SetNum(NumBones);
+	OutLayout.LocalTransforms.SetNum(NumBones);
+	OutLayout.NumBrokenCycles = 0;
+
+	// Validate parent links (self references and out of range parents become roots)
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const int32 Parent = PmxModel.Bones[BoneIndex].ParentBoneIndex;
+		OutLayout.Parents[BoneIndex] = (Parent >= 0 && Parent < NumBones && Parent != BoneIndex) ? Parent : INDEX_NONE;
+	}
+
+	// Topological sort: walk each unvisited bone up to a visited ancestor (or root), then emit the chain top-down.
+	// PMX allows parents after children, so the file order cannot be used directly.
+	enum class EVisit : uint8 { None, InPath, Done };
+	TArray<EVisit> Visit;
+	Visit.Init(EVisit::None, NumBones);
+	TArray<int32, TInlineAllocator<64>> Path;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		if (Visit[BoneIndex] != EVisit::None)
+		{
+			continue;
+		}
+
+		Path.Reset();
+		int32 Current = BoneIndex;
+		while (Current != INDEX_NONE && Visit[Current] == EVisit::None)
+		{
+			Visit[Current] = EVisit::InPath;
+			Path.Add(Current);
+			Current = OutLayout.Parents[Current];
+		}
+
+		if (Current != INDEX_NONE && Visit[Current] == EVisit::InPath)
+		{
+			// The topmost bone of this walk closes a cycle: detach it and make it a root
+			const int32 CycleBone = Path.Last();
+			UE_LOG(LogPMXImporter, Warning, TEXT("PMX NodeBuilder: Bone '%s' (Index %d) closes a parent cycle via bone %d, parenting to root"),
+				*PmxModel.Bones[CycleBone].Name, CycleBone, OutLayout.Parents[CycleBone]);
+			OutLayout.Parents[CycleBone] = INDEX_NONE;
+			++OutLayout.NumBrokenCycles;
+		}
+
+		for (int32 PathIndex = Path.Num() - 1; PathIndex >= 0; --PathIndex)
+		{
+			Visit[Path[PathIndex]] = EVisit::Done;
+			OutLayout.SortedBones.Add(Path[PathIndex]);
+		}
+	}
+
+	// Single pass in sorted order: PMX -> UE position ((x, y, z) -> (x, -z, y) * Scale, the 90 degree X rotation
+	// used by the mesh payload), world and local bind transforms. Parents are always processed first.
+	const float ImportScale = 8.f;
+	const VectorRegister4Float AxisScale = MakeVectorRegisterFloat(ImportScale, -ImportScale, ImportScale, 0.f);
+	const VectorRegister4Float AbsMax = VectorSetFloat1(100000.f); // 100m in UE units
+
+	TArray<FVector3f> WorldPos;
+	WorldPos.SetNumUninitialized(NumBones);
+	for (const int32 BoneIndex : OutLayout.SortedBones)
+	{
+		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
+		const int32 Parent = OutLayout.Parents[BoneIndex];
+
+		const VectorRegister4Float PmxPos = VectorLoadFloat3(&Bone.Position.X);
+		const VectorRegister4Float World = VectorMultiply(VectorSwizzle(PmxPos, 0, 2, 1, 3), AxisScale);
+		VectorStoreFloat3(World, &WorldPos[BoneIndex].X);
+
+		VectorRegister4Float Local = World;
+		if (Parent != INDEX_NONE)
+		{
+			Local = VectorSubtract(World, VectorLoadFloat3(&WorldPos[Parent].X));
+		}
+
+		// Safety clamp for abnormal bone offsets to avoid bones flying far away due to bad data/flags
+		const bool bFinite = FMath::IsFinite(WorldPos[BoneIndex].X) && FMath::IsFinite(WorldPos[BoneIndex].Y) && FMath::IsFinite(WorldPos[BoneIndex].Z);
+		if (!bFinite || VectorAnyGreaterThan(VectorAbs(Local), AbsMax))
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PMX NodeBuilder: Abnormal local bone offset clamped for bone '%s' (Index %d)."), *Bone.Name, BoneIndex);
+			Local = VectorZeroFloat();
+			WorldPos[BoneIndex] = (Parent != INDEX_NONE) ? WorldPos[Parent] : FVector3f::ZeroVector;
+		}
+
+		FVector3f LocalPos;
+		VectorStoreFloat3(Local, &LocalPos.X);
+		OutLayout.WorldTransforms[BoneIndex] = FTransform(FVector(WorldPos[BoneIndex]));
+		OutLayout.LocalTransforms[BoneIndex] = FTransform(FVector(LocalPos));
+	}
+
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX NodeBuilder: Skeleton layout built for %d bones (%d parent cycles broken)"),
+		NumBones, OutLayout.NumBrokenCycles);
+}
+
+int32 FPmxNodeBuilder::ParseJointBoneIndex(const FString& JointUid)
+{
+	int32 SlashIndex = INDEX_NONE;
+	if (!JointUid.FindLastChar(TEXT('/'), SlashIndex))
+	{
+		return INDEX_NONE;
+	}
+	const FString Leaf = JointUid.Mid(SlashIndex + 1);
+	int32 BoneIndex = INDEX_NONE;
+	if (!Leaf.StartsWith(TEXT("Bone_")) || !LexTryParseString(BoneIndex, *Leaf.RightChop(5)) || BoneIndex < 0)
+	{
+		return INDEX_NONE;
+	}
+	return BoneIndex;
+}
+
+FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, UInterchangeBaseNodeContainer& BaseNodeContainer,
+	UInterchangeSceneNode* RootNode, const FPmxBoneNameOptions& NameOptions, TArray<UInterchangeSceneNode*>& OutBoneJointNodes)
 {
 	using ContainerType = EInterchangeNodeContainerType;
 	
@@ -34,6 +149,12 @@ FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterch
 		UE_LOG(LogPMXImporter, Error, TEXT("PMX NodeBuilder: RootNode is null in CreateBoneHierarchy"));
 		return FString();
 	}
+
+	if (Layout.Num() != PmxModel.Bones.Num())
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PMX NodeBuilder: Skeleton layout (%d bones) does not match model (%d bones)"), Layout.Num(), PmxModel.Bones.Num());
+		return FString();
+	}
 	
 	// Verify RootNode is properly initialized
 	const FString RootNodeUid = RootNode->GetUniqueID();
@@ -65,21 +186,6 @@ FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterch
 	
 	// Strategy A variant: Keep a single synthetic Joint Root in the node graph, but do not add it to mesh JointNames.
 	// Parent all top-level PMX bones to this Joint Root so the skeleton has a single hierarchy.
-	// Precompute transformed (UE) bone positions and local offsets
-	TArray<FVector> BonePosUE;
-	BonePosUE.SetNum(PmxModel.Bones.Num());
-	const FQuat RotX = FQuat(FVector3d::XAxisVector, FMath::DegreesToRadians(90.0f));
-	const float ImportScale = 8.f;
-	const FTransform PMXToUE_X(RotX);
-	const FTransform PMXToUE_Scale(FQuat::Identity, FVector3d::ZeroVector, FVector3d(ImportScale));
-	const FTransform PMXBoneToUE = PMXToUE_X * PMXToUE_Scale;
-	for (int32 i = 0; i < PmxModel.Bones.Num(); ++i)
-	{
-		const FPmxBone& B = PmxModel.Bones[i];
-		const FVector P(static_cast<double>(B.Position.X), static_cast<double>(B.Position.Y), static_cast<double>(B.Position.Z));
-		BonePosUE[i] = PMXBoneToUE.TransformPosition(P);
-	}
-
 	// We will use the created Joint Root as the skeleton root
 	const FString JointRootUid = RootJointUid;
 
@@ -115,15 +221,14 @@ FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterch
 	}
 
 	// Build unique bone names array (resolves duplicate names)
-	// This must match the names used in PmxTranslator's JointNames array
-	TArray<FString> UniqueBoneNames = FPmxUtils::BuildUniqueBoneNames(PmxModel);
+	// This must match the names used in PmxTranslator's JointNames array (same NameOptions)
+	TArray<FString> UniqueBoneNames = FPmxUtils::BuildUniqueBoneNames(PmxModel, NameOptions);
 
-	// Two-pass bone creation to handle forward references in ParentBoneIndex
-	// Pass 1: Create all joint nodes first
-	for (int32 BoneIndex = 0; BoneIndex < PmxModel.Bones.Num(); ++BoneIndex)
+	// Single pass in parent-before-child order: every parent joint exists before its children are attached,
+	// so the skeleton factory receives an already sorted hierarchy.
+	OutBoneJointNodes.Init(nullptr, PmxModel.Bones.Num());
+	for (const int32 BoneIndex : Layout.SortedBones)
 	{
-		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
-
 		// Must be a UInterchangeJointNode: the skeleton factory identifies joints by class, not specialized-type
 		UInterchangeSceneNode* JointNode = NewObject<UInterchangeJointNode>(&BaseNodeContainer);
 		const FString JointUid = FString::Printf(TEXT("%s/Bone_%d"), *JointsPrefix, BoneIndex);
@@ -131,58 +236,28 @@ FString FPmxNodeBuilder::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterch
 
 		JointNode->InitializeNode(JointUid, *BoneName, ContainerType::TranslatedScene);
 
-		// Set local transform (bone position relative to parent, in UE space)
-		FVector LocalPos = BonePosUE[BoneIndex];
-		if (Bone.ParentBoneIndex >= 0 && Bone.ParentBoneIndex < PmxModel.Bones.Num())
-		{
-			LocalPos -= BonePosUE[Bone.ParentBoneIndex];
-		}
-		// Safety clamp for abnormal bone offsets to avoid bones flying far away due to bad data/flags
-		bool bInvalid = (!FMath::IsFinite(LocalPos.X) || !FMath::IsFinite(LocalPos.Y) || !FMath::IsFinite(LocalPos.Z));
-		const double AbsMax = 100000.0; // 100m in UE units
-		if (!bInvalid)
-		{
-			const FVector Abs = LocalPos.GetAbs();
-			bInvalid = (Abs.X > AbsMax) || (Abs.Y > AbsMax) || (Abs.Z > AbsMax);
-		}
-		if (bInvalid)
-		{
-			UE_LOG(LogPMXImporter, Warning, TEXT("PMX Translator: Abnormal local bone offset clamped for bone '%s' (Index %d)."), *BoneName, BoneIndex);
-			LocalPos = FVector::ZeroVector;
-		}
-		FTransform LocalTransform = FTransform::Identity;
-		LocalTransform.SetLocation(LocalPos);
-		JointNode->SetCustomLocalTransform(&BaseNodeContainer, LocalTransform);
+		// Local transform (bone position relative to parent, in UE space) precomputed by BuildSkeletonLayout
+		JointNode->SetCustomLocalTransform(&BaseNodeContainer, Layout.LocalTransforms[BoneIndex]);
 
 		BaseNodeContainer.AddNode(JointNode);
-		OutBoneIndexToJointNode.Add(BoneIndex, JointNode);
-	}
-
-	// Pass 2: Set parent relationships now that all nodes exist
-	for (int32 BoneIndex = 0; BoneIndex < PmxModel.Bones.Num(); ++BoneIndex)
-	{
-		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
-		UInterchangeSceneNode* JointNode = OutBoneIndexToJointNode[BoneIndex];
+		OutBoneJointNodes[BoneIndex] = JointNode;
 
-		// Set parent relationship
-		if (Bone.ParentBoneIndex >= 0 && Bone.ParentBoneIndex < PmxModel.Bones.Num())
+		const int32 Parent = Layout.Parents[BoneIndex];
+		if (Parent != INDEX_NONE)
 		{
-			if (UInterchangeSceneNode** ParentJoint = OutBoneIndexToJointNode.Find(Bone.ParentBoneIndex))
-			{
-				BaseNodeContainer.SetNodeParentUid(JointNode->GetUniqueID(), (*ParentJoint)->GetUniqueID());
-			}
-			else
-			{
-				// Fallback: Parent to Joint Root if parent not found
-				UE_LOG(LogPMXImporter, Warning, TEXT("PMX NodeBuilder: Bone '%s' (Index %d) has invalid parent index %d, parenting to root"),
-					*Bone.Name, BoneIndex, Bone.ParentBoneIndex);
-				BaseNodeContainer.SetNodeParentUid(JointNode->GetUniqueID(), JointRootUid);
-			}
+			BaseNodeContainer.SetNodeParentUid(JointUid, OutBoneJointNodes[Parent]->GetUniqueID());
 		}
 		else
 		{
+			// Cycle breaks are already reported by BuildSkeletonLayout
+			const int32 PmxParent = PmxModel.Bones[BoneIndex].ParentBoneIndex;
+			if (PmxParent >= PmxModel.Bones.Num() || PmxParent == BoneIndex)
+			{
+				UE_LOG(LogPMXImporter, Warning, TEXT("PMX NodeBuilder: Bone '%s' (Index %d) has invalid parent index %d, parenting to root"),
+					*BoneName, BoneIndex, PmxParent);
+			}
 			// Parent to Joint Root if no valid parent (ensure single-root hierarchy)
-			BaseNodeContainer.SetNodeParentUid(JointNode->GetUniqueID(), JointRootUid);
+			BaseNodeContainer.SetNodeParentUid(JointUid, JointRootUid);
 		}
 	}
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxOutlineBuilder.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
+
+int32 FPmxOutlineMesh::GetNumTriangles() const
+{
+	int32 NumTriangles = 0;
+	for (const FPmxOutlineSection& Section : Sections)
+	{
+		NumTriangles += Section.Indices.Num() / 3;
+	}
+	return NumTriangles;
+}
+
+bool FPmxOutlineBuilder::HasOutline(const FPmxMaterial& Material)
+{
+	return (Material.DrawingFlags & DrawEdgeFlag) != 0 && Material.EdgeSize > 0.0f && Material.EdgeColor.A > 0.0f;
+}
+
+FString FPmxOutlineBuilder::GetSlotName(int32 SectionIndex)
+{
+	return FString::Printf(TEXT("Outline_%d"), SectionIndex);
+}
+
+bool FPmxOutlineBuilder::BuildOutline(const FPmxModel& PmxModel, float Thickness, FPmxOutlineMesh& OutOutline)
+{
+	PMX_IMPORT_SCOPE("Build Outline");
+
+	OutOutline = FPmxOutlineMesh();
+	if (Thickness <= 0.0f)
+	{
+		return false;
+	}
+
+	// Group edge materials by color (one section each)
+	TArray<int32> MaterialStarts;
+	MaterialStarts.Reserve(PmxModel.Materials.Num());
+	int32 IndexOffset = 0;
+	for (int32 MatIndex = 0; MatIndex < PmxModel.Materials.Num(); ++MatIndex)
+	{
+		MaterialStarts.Add(IndexOffset);
+		IndexOffset += FMath::Max(PmxModel.Materials[MatIndex].SurfaceCount, 0);
+
+		const FPmxMaterial& Material = PmxModel.Materials[MatIndex];
+		if (!HasOutline(Material))
+		{
+			continue;
+		}
+		FPmxOutlineSection* Section = OutOutline.Sections.FindByPredicate([&Material](const FPmxOutlineSection& Existing) { return Existing.Color.Equals(Material.EdgeColor); });
+		if (!Section)
+		{
+			Section = &OutOutline.Sections.AddDefaulted_GetRef();
+			Section->Color = Material.EdgeColor;
+		}
+		Section->MaterialIndices.Add(MatIndex);
+	}
+
+	if (OutOutline.IsEmpty())
+	{
+		UE_LOG(LogPMXImporter, Display, TEXT("PMX OutlineBuilder: No material has an edge, no outline generated"));
+		return false;
+	}
+
+	// Normals averaged per position, so split vertices extrude to the same point
+	TMap<FVector3f, FVector3f> SmoothNormals;
+	for (const FPmxOutlineSection& Section : OutOutline.Sections)
+	{
+		for (const int32 MatIndex : Section.MaterialIndices)
+		{
+			const int32 Start = MaterialStarts[MatIndex];
+			const int32 End = FMath::Min(Start + FMath::Max(PmxModel.Materials[MatIndex].SurfaceCount, 0), PmxModel.Indices.Num());
+			for (int32 Index = Start; Index < End; ++Index)
+			{
+				if (PmxModel.Vertices.IsValidIndex(PmxModel.Indices[Index]))
+				{
+					const FPmxVertex& Vertex = PmxModel.Vertices[PmxModel.Indices[Index]];
+					SmoothNormals.FindOrAdd(Vertex.Position, FVector3f::ZeroVector) += Vertex.Normal;
+				}
+			}
+		}
+	}
+
+	TArray<int32> OutlineVertexOf;
+	OutlineVertexOf.Init(INDEX_NONE, PmxModel.Vertices.Num());
+	TArray<int32> SectionVertices;
+	int32 NumSkipped = 0;
+	for (FPmxOutlineSection& Section : OutOutline.Sections)
+	{
+		for (const int32 MatIndex : Section.MaterialIndices)
+		{
+			const FPmxMaterial& Material = PmxModel.Materials[MatIndex];
+			const int32 Start = MaterialStarts[MatIndex];
+			const int32 NumIndices = FMath::Clamp(PmxModel.Indices.Num() - Start, 0, FMath::Max(Material.SurfaceCount, 0)) / 3 * 3;
+			for (int32 Index = Start; Index < Start + NumIndices; Index += 3)
+			{
+				const int32 Corners[3] = { PmxModel.Indices[Index], PmxModel.Indices[Index + 1], PmxModel.Indices[Index + 2] };
+				if (!PmxModel.Vertices.IsValidIndex(Corners[0]) || !PmxModel.Vertices.IsValidIndex(Corners[1]) || !PmxModel.Vertices.IsValidIndex(Corners[2]))
+				{
+					++NumSkipped;
+					continue;
+				}
+
+				int32 OutlineCorners[3];
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const int32 Vertex = Corners[Corner];
+					const float Extrusion = Material.EdgeSize * PmxModel.Vertices[Vertex].EdgeScale * Thickness;
+					if (OutlineVertexOf[Vertex] == INDEX_NONE)
+					{
+						OutlineVertexOf[Vertex] = OutOutline.SourceVertices.Add(Vertex);
+						OutOutline.Offsets.Add(FVector3f::ZeroVector);
+						SectionVertices.Add(Vertex);
+					}
+					// A vertex shared by several edge materials takes the widest edge
+					const int32 OutlineVertex = OutlineVertexOf[Vertex];
+					if (Extrusion > OutOutline.Offsets[OutlineVertex].Size())
+					{
+						const FVector3f* Normal = SmoothNormals.Find(PmxModel.Vertices[Vertex].Position);
+						OutOutline.Offsets[OutlineVertex] = (Normal ? Normal->GetSafeNormal() : PmxModel.Vertices[Vertex].Normal.GetSafeNormal()) * Extrusion;
+					}
+					OutlineCorners[Corner] = OutlineVertex;
+				}
+
+				// Reversed winding: with back face culling only the far side of the hull shows, as a rim around the silhouette
+				Section.Indices.Add(OutlineCorners[0]);
+				Section.Indices.Add(OutlineCorners[2]);
+				Section.Indices.Add(OutlineCorners[1]);
+			}
+		}
+
+		// Outline vertices are per section (different colors are separate draws)
+		for (const int32 Vertex : SectionVertices)
+		{
+			OutlineVertexOf[Vertex] = INDEX_NONE;
+		}
+		SectionVertices.Reset();
+	}
+
+	const int32 NumTriangles = OutOutline.GetNumTriangles();
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX OutlineBuilder: %d outline sections, %d vertices, %d triangles (thickness %.3f)%s"),
+		OutOutline.Sections.Num(), OutOutline.SourceVertices.Num(), NumTriangles, Thickness,
+		NumSkipped > 0 ? *FString::Printf(TEXT(", %d invalid triangles skipped"), NumSkipped) : TEXT(""));
+	PMX_DIAG_COUNT("mesh.outline_triangles", NumTriangles);
+
+	if (NumTriangles == 0)
+	{
+		OutOutline = FPmxOutlineMesh();
+		return false;
+	}
+	return true;
+}
@@ -4,6 +4,8 @@
 #include "PmxTranslator.h"
 #include "PmxStructs.h"
 #include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
 
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/SkeletalBodySetup.h"
@@ -27,13 +29,30 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 	USkeletalMesh* SkeletalMesh,
 	const FPmxPhysicsCache& PhysicsData)
 {
+	PMX_IMPORT_SCOPE("Build Physics Asset");
 	if (!PhysicsAsset || !SkeletalMesh)
 	{
 		UE_LOG(LogPMXImporter, Error, TEXT("BuildPhysicsAsset: Invalid PhysicsAsset or SkeletalMesh"));
 		return false;
 	}
 
-	const FReferenceSkeleton& RefSkel = SkeletalMesh->GetRefSkeleton();
+	FPmxPhysicsPlan Plan;
+	if (!PlanPhysicsAsset(SkeletalMesh->GetRefSkeleton(), PhysicsData, Plan))
+	{
+		return false;
+	}
+
+	int32 NextStep = 0;
+	ApplyPhysicsPlan(PhysicsAsset, Plan, NextStep, TNumericLimits<double>::Max());
+	return Plan.Bodies.Num() > 0;
+}
+
+bool FPmxPhysicsBuilder::PlanPhysicsAsset(
+	const FReferenceSkeleton& RefSkel,
+	const FPmxPhysicsCache& PhysicsData,
+	FPmxPhysicsPlan& OutPlan)
+{
+	PMX_IMPORT_SCOPE("Plan Physics Asset");
 	if (RefSkel.GetNum() == 0)
 	{
 		UE_LOG(LogPMXImporter, Error, TEXT("BuildPhysicsAsset: SkeletalMesh has no bones"));
@@ -44,15 +63,13 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 		PhysicsData.RigidBodies.Num(), PhysicsData.Joints.Num(),
 		PhysicsData.MassScale, PhysicsData.DampingScale, PhysicsData.MaxAngularLimit);
 
-	// Clear existing data
-	PhysicsAsset->SkeletalBodySetups.Empty();
-	PhysicsAsset->ConstraintSetup.Empty();
+	OutPlan = FPmxPhysicsPlan();
 
-	// Map from PMX RigidBody index to created BodySetup (for constraint creation)
-	TMap<int32, USkeletalBodySetup*> RigidBodyToBodySetup;
+	// Map from PMX RigidBody index to planned body index (for constraint creation)
+	// Bodies are created in plan order, so a plan index is also the body index in the physics asset
+	TMap<int32, int32> RigidBodyToBody;
 
-	// Create BodySetups for each RigidBody
-	int32 CreatedBodies = 0;
+	// Plan a body for each RigidBody
 	for (int32 RBIndex = 0; RBIndex < PhysicsData.RigidBodies.Num(); ++RBIndex)
 	{
 		const FPmxRigidBody& RB = PhysicsData.RigidBodies[RBIndex];
@@ -60,7 +77,7 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 		// Validate bone index
 		if (RB.RelatedBoneIndex < 0 || RB.RelatedBoneIndex >= PhysicsData.Bones.Num())
 		{
-			UE_LOG(LogPMXImporter, Verbose,  // Warning -> Verbose
+			PMX_TRACE(LogPMXImporter,
 				TEXT("Skipping RigidBody '%s' (Index %d): Invalid bone reference (%d). This is normal for disconnected physics bodies in the PMX file."),
 				*RB.Name, RBIndex, RB.RelatedBoneIndex);
 			continue;
@@ -68,68 +85,58 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 
 		const FPmxBone& Bone = PhysicsData.Bones[RB.RelatedBoneIndex];
 
-		USkeletalBodySetup* BodySetup = CreateBodySetup(
-			PhysicsAsset, RB, RBIndex, Bone, RefSkel, PhysicsData);
-
-		if (BodySetup)
+		FPmxPhysicsBodyPlan Body;
+		if (PlanBody(OutPlan, RB, RBIndex, Bone, RefSkel, PhysicsData, Body))
 		{
-			RigidBodyToBodySetup.Add(RBIndex, BodySetup);
-			++CreatedBodies;
+			RigidBodyToBody.Add(RBIndex, OutPlan.Bodies.Add(MoveTemp(Body)));
 		}
 	}
+	const int32 CreatedBodies = OutPlan.Bodies.Num();
 
-	// Update body index maps
-	PhysicsAsset->UpdateBodySetupIndexMap();
-	PhysicsAsset->UpdateBoundsBodiesArray();
-
-
-	// Create Constraints for each Joint
-	int32 CreatedConstraints = 0;
+	// Plan a constraint for each Joint
 	int32 DisabledCollisionPairs = 0;
 	for (int32 JointIndex = 0; JointIndex < PhysicsData.Joints.Num(); ++JointIndex)
 	{
 		const FPmxJoint& Joint = PhysicsData.Joints[JointIndex];
 
 		// Validate rigid body indices
-		USkeletalBodySetup** BodyAPtr = RigidBodyToBodySetup.Find(Joint.RigidBodyIndexA);
-		USkeletalBodySetup** BodyBPtr = RigidBodyToBodySetup.Find(Joint.RigidBodyIndexB);
+		const int32* BodyAPtr = RigidBodyToBody.Find(Joint.RigidBodyIndexA);
+		const int32* BodyBPtr = RigidBodyToBody.Find(Joint.RigidBodyIndexB);
 
 		if (!BodyAPtr || !BodyBPtr)
 		{
-			UE_LOG(LogPMXImporter, Log,
+			PMX_TRACE(LogPMXImporter,
 				TEXT("Skipping Joint '%s': One or both bodies not found (A=%d, B=%d)"),
 				*Joint.Name, Joint.RigidBodyIndexA, Joint.RigidBodyIndexB);
 			continue;
 		}
 
-		UPhysicsConstraintTemplate* Constraint = CreateConstraint(
-			PhysicsAsset, Joint, PhysicsData.RigidBodies, PhysicsData.Bones, PhysicsData);
-
-		if (Constraint)
+		FPmxPhysicsConstraintPlan Constraint;
+		if (PlanConstraint(OutPlan, Joint, PhysicsData.RigidBodies, PhysicsData.Bones, PhysicsData, Constraint))
 		{
-			++CreatedConstraints;
+			OutPlan.Constraints.Add(MoveTemp(Constraint));
 
 			// Disable collision between constraint-connected bodies if option is enabled
 			// This prevents stiff behavior from overlapping rigid bodies in PMX
-			if (PhysicsData.bDisableConstraintBodyCollision && *BodyAPtr && *BodyBPtr)
+			if (PhysicsData.bDisableConstraintBodyCollision)
 			{
-				const int32 BodyIndexA = PhysicsAsset->FindBodyIndex((*BodyAPtr)->BoneName);
-				const int32 BodyIndexB = PhysicsAsset->FindBodyIndex((*BodyBPtr)->BoneName);
-
-				if (BodyIndexA != INDEX_NONE && BodyIndexB != INDEX_NONE)
-				{
-					PhysicsAsset->DisableCollision(BodyIndexA, BodyIndexB);
-					++DisabledCollisionPairs;
+				OutPlan.DisabledCollisionPairs.Emplace(*BodyAPtr, *BodyBPtr);
+				++DisabledCollisionPairs;
 
-					UE_LOG(LogPMXImporter, Verbose,
-						TEXT("Disabled collision between '%s' and '%s' (constraint: '%s')"),
-						*(*BodyAPtr)->BoneName.ToString(), *(*BodyBPtr)->BoneName.ToString(), *Joint.Name);
-				}
+				PMX_TRACE(LogPMXImporter,
+					TEXT("Disabled collision between '%s' and '%s' (constraint: '%s')"),
+					*OutPlan.Bodies[*BodyAPtr].BoneName.ToString(), *OutPlan.Bodies[*BodyBPtr].BoneName.ToString(), *Joint.Name);
 			}
 		}
 	}
+	const int32 CreatedConstraints = OutPlan.Constraints.Num();
 
 	UE_LOG(LogPMXImporter, Display, TEXT("Created %d bodies, %d constraints"), CreatedBodies, CreatedConstraints);
+	PMX_DIAG_COUNT("physics.bodies", CreatedBodies);
+	PMX_DIAG_COUNT("physics.bodies_skipped", PhysicsData.RigidBodies.Num() - CreatedBodies);
+	PMX_DIAG_COUNT("physics.constraints", CreatedConstraints);
+	PMX_DIAG_COUNT("physics.joints_skipped", PhysicsData.Joints.Num() - CreatedConstraints);
+	PMX_DIAG_COUNT("physics.constraint_disabled_pairs", DisabledCollisionPairs);
 
 	// Apply PMX collision group filtering if enabled
 	// PMX uses NonCollisionGroup bitmask - bodies with matching bits should not collide
@@ -141,8 +148,8 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 		// Check each pair of rigid bodies
 		for (int32 i = 0; i < NumBodies; ++i)
 		{
-			USkeletalBodySetup** BodyIPtr = RigidBodyToBodySetup.Find(i);
-			if (!BodyIPtr || !(*BodyIPtr))
+			const int32* BodyIPtr = RigidBodyToBody.Find(i);
+			if (!BodyIPtr)
 			{
 				continue;
 			}
@@ -151,8 +158,8 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 
 			for (int32 j = i + 1; j < NumBodies; ++j)
 			{
-				USkeletalBodySetup** BodyJPtr = RigidBodyToBodySetup.Find(j);
-				if (!BodyJPtr || !(*BodyJPtr))
+				const int32* BodyJPtr = RigidBodyToBody.Find(j);
+				if (!BodyJPtr)
 				{
 					continue;
 				}
@@ -171,23 +178,18 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 
 				if (bIIgnoresJ || bJIgnoresI)
 				{
-					const int32 BodyIndexI = PhysicsAsset->FindBodyIndex((*BodyIPtr)->BoneName);
-					const int32 BodyIndexJ = PhysicsAsset->FindBodyIndex((*BodyJPtr)->BoneName);
-
-					if (BodyIndexI != INDEX_NONE && BodyIndexJ != INDEX_NONE)
-					{
-						PhysicsAsset->DisableCollision(BodyIndexI, BodyIndexJ);
-						++GroupDisabledPairs;
-
-						UE_LOG(LogPMXImporter, Verbose,
-							TEXT("PMX Group Filter: Disabled collision between '%s' (Group %d, Mask 0x%04X) and '%s' (Group %d, Mask 0x%04X)"),
-							*(*BodyIPtr)->BoneName.ToString(), RBI.Group, RBI.NonCollisionGroup,
-							*(*BodyJPtr)->BoneName.ToString(), RBJ.Group, RBJ.NonCollisionGroup);
-					}
+					OutPlan.DisabledCollisionPairs.Emplace(*BodyIPtr, *BodyJPtr);
+					++GroupDisabledPairs;
+
+					PMX_TRACE(LogPMXImporter,
+						TEXT("PMX Group Filter: Disabled collision between '%s' (Group %d, Mask 0x%04X) and '%s' (Group %d, Mask 0x%04X)"),
+						*OutPlan.Bodies[*BodyIPtr].BoneName.ToString(), RBI.Group, RBI.NonCollisionGroup,
+						*OutPlan.Bodies[*BodyJPtr].BoneName.ToString(), RBJ.Group, RBJ.NonCollisionGroup);
 				}
 			}
 		}
 
+		PMX_DIAG_COUNT("physics.group_disabled_pairs", GroupDisabledPairs);
 	}
 
 	// Enable collision between standard bones (body/limbs) and non-standard bones (cloth/hair)
@@ -198,8 +200,8 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 
 		for (int32 i = 0; i < PhysicsData.RigidBodies.Num(); ++i)
 		{
-			USkeletalBodySetup** BodyIPtr = RigidBodyToBodySetup.Find(i);
-			if (!BodyIPtr || !(*BodyIPtr))
+			const int32* BodyIPtr = RigidBodyToBody.Find(i);
+			if (!BodyIPtr)
 			{
 				continue;
 			}
@@ -215,8 +217,8 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 
 			for (int32 j = i + 1; j < PhysicsData.RigidBodies.Num(); ++j)
 			{
-				USkeletalBodySetup** BodyJPtr = RigidBodyToBodySetup.Find(j);
-				if (!BodyJPtr || !(*BodyJPtr))
+				const int32* BodyJPtr = RigidBodyToBody.Find(j);
+				if (!BodyJPtr)
 				{
 					continue;
 				}
@@ -231,17 +233,11 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 				const bool bIsStandardJ = IsStandardBone(BoneNameJ);
 
 				// If one is standard and the other is non-standard, enable collision
+				// (applied after the disabled pairs, so it overrides the filters above)
 				if (bIsStandardI != bIsStandardJ)
 				{
-					const int32 BodyIndexI = PhysicsAsset->FindBodyIndex((*BodyIPtr)->BoneName);
-					const int32 BodyIndexJ = PhysicsAsset->FindBodyIndex((*BodyJPtr)->BoneName);
-
-					if (BodyIndexI != INDEX_NONE && BodyIndexJ != INDEX_NONE)
-					{
-						// Re-enable collision (may have been disabled by previous filters)
-						PhysicsAsset->EnableCollision(BodyIndexI, BodyIndexJ);
-						++EnabledPairs;
-					}
+					OutPlan.EnabledCollisionPairs.Emplace(*BodyIPtr, *BodyJPtr);
+					++EnabledPairs;
 				}
 			}
 		}
@@ -250,24 +246,89 @@ bool FPmxPhysicsBuilder::BuildPhysicsAsset(
 		{
 			UE_LOG(LogPMXImporter, Display, TEXT("Enabled %d standard-nonstandard body collision pairs"), EnabledPairs);
 		}
+		PMX_DIAG_COUNT("physics.standard_enabled_pairs", EnabledPairs);
+	}
+
+	return true;
+}
+
+bool FPmxPhysicsBuilder::ApplyPhysicsPlan(
+	UPhysicsAsset* PhysicsAsset,
+	const FPmxPhysicsPlan& Plan,
+	int32& InOutNextStep,
+	double EndTime)
+{
+	PMX_IMPORT_SCOPE("Apply Physics Plan");
+	check(PhysicsAsset);
+
+	// Steps: one per body, one per constraint, then collision filtering and index maps
+	const int32 NumBodies = Plan.Bodies.Num();
+	const int32 NumObjectSteps = NumBodies + Plan.Constraints.Num();
+
+	if (InOutNextStep == 0)
+	{
+		// Clear existing data
+		PhysicsAsset->SkeletalBodySetups.Empty(NumBodies);
+		PhysicsAsset->ConstraintSetup.Empty(Plan.Constraints.Num());
+	}
+
+	while (InOutNextStep < NumObjectSteps)
+	{
+		if (InOutNextStep < NumBodies)
+		{
+			CreateBodySetup(PhysicsAsset, Plan.Bodies[InOutNextStep]);
+		}
+		else
+		{
+			if (InOutNextStep == NumBodies)
+			{
+				// Update body index maps
+				PhysicsAsset->UpdateBodySetupIndexMap();
+				PhysicsAsset->UpdateBoundsBodiesArray();
+			}
+			CreateConstraint(PhysicsAsset, Plan.Constraints[InOutNextStep - NumBodies]);
+		}
+		++InOutNextStep;
+
+		if (InOutNextStep < NumObjectSteps && FPlatformTime::Seconds() >= EndTime)
+		{
+			return false;
+		}
+	}
+
+	PhysicsAsset->UpdateBodySetupIndexMap();
+	PhysicsAsset->UpdateBoundsBodiesArray();
+
+	for (const TPair<int32, int32>& Pair : Plan.DisabledCollisionPairs)
+	{
+		PhysicsAsset->DisableCollision(Pair.Key, Pair.Value);
+	}
+
+	// Re-enable collision (may have been disabled by previous filters)
+	for (const TPair<int32, int32>& Pair : Plan.EnabledCollisionPairs)
+	{
+		PhysicsAsset->EnableCollision(Pair.Key, Pair.Value);
 	}
 
 	// Final update
 	PhysicsAsset->UpdateBodySetupIndexMap();
 
-	return CreatedBodies > 0;
+	InOutNextStep = NumObjectSteps + 1;
+	return true;
 }
 
-USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
-	UPhysicsAsset* Asset,
+bool FPmxPhysicsBuilder::PlanBody(
+	const FPmxPhysicsPlan& Plan,
 	const FPmxRigidBody& RB,
 	int32 RBIndex,
 	const FPmxBone& Bone,
 	const FReferenceSkeleton& RefSkel,
-	const FPmxPhysicsCache& PhysicsData)
+	const FPmxPhysicsCache& PhysicsData,
+	FPmxPhysicsBodyPlan& OutBody)
 {
-	// Find bone in skeleton by PMX bone name
-	const FName PmxBoneName = FName(*Bone.Name);
+	// Find bone in skeleton by its final (translate-time) name
+	const FString& SkeletonBoneName = GetSkeletonBoneName(PhysicsData, RB.RelatedBoneIndex);
+	const FName PmxBoneName = FName(*SkeletonBoneName);
 	int32 BoneIndex = RefSkel.FindBoneIndex(PmxBoneName);
 	FName ActualBoneName = PmxBoneName;
 
@@ -277,11 +338,11 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 	{
 		for (int32 i = 0; i < RefSkel.GetNum(); ++i)
 		{
-			const FName SkeletonBoneName = RefSkel.GetBoneName(i);
-			if (SkeletonBoneName.ToString().Equals(Bone.Name, ESearchCase::CaseSensitive))
+			const FName RefBoneName = RefSkel.GetBoneName(i);
+			if (RefBoneName.ToString().Equals(SkeletonBoneName, ESearchCase::CaseSensitive))
 			{
 				BoneIndex = i;
-				ActualBoneName = SkeletonBoneName; // Use the exact FName from skeleton
+				ActualBoneName = RefBoneName; // Use the exact FName from skeleton
 				break;
 			}
 		}
@@ -289,22 +350,20 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 
 	if (BoneIndex == INDEX_NONE)
 	{
-		UE_LOG(LogPMXImporter, Log,
+		PMX_TRACE(LogPMXImporter,
 			TEXT("CreateBodySetup: Bone '%s' not found in skeleton for RigidBody '%s'"),
-			*Bone.Name, *RB.Name);
-		return nullptr;
+			*SkeletonBoneName, *RB.Name);
+		return false;
 	}
 
 	// Use the actual bone name from the skeleton to ensure exact FName match
 	ActualBoneName = RefSkel.GetBoneName(BoneIndex);
 
 	// Check if body already exists for this bone
-	// NOTE: We cannot use Asset->FindBodyIndex() because BodySetupIndexMap is not updated
-	// during construction. We must manually search the SkeletalBodySetups array.
 	int32 ExistingBodyIndex = INDEX_NONE;
-	for (int32 i = 0; i < Asset->SkeletalBodySetups.Num(); ++i)
+	for (int32 i = 0; i < Plan.Bodies.Num(); ++i)
 	{
-		if (Asset->SkeletalBodySetups[i] && Asset->SkeletalBodySetups[i]->BoneName == ActualBoneName)
+		if (Plan.Bodies[i].BoneName == ActualBoneName)
 		{
 			ExistingBodyIndex = i;
 			break;
@@ -313,15 +372,13 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 
 	if (ExistingBodyIndex != INDEX_NONE)
 	{
-		UE_LOG(LogPMXImporter, Log,
+		PMX_TRACE(LogPMXImporter,
 			TEXT("CreateBodySetup: BodySetup already exists for bone '%s' (index %d), skipping RigidBody '%s'"),
 			*ActualBoneName.ToString(), ExistingBodyIndex, *RB.Name);
-		return nullptr;
+		return false;
 	}
 
-	// Create body setup
-	USkeletalBodySetup* BodySetup = NewObject<USkeletalBodySetup>(Asset, NAME_None, RF_Transactional);
-	BodySetup->BoneName = ActualBoneName; // Use exact FName from skeleton
+	OutBody.BoneName = ActualBoneName; // Use exact FName from skeleton
 
 	// Determine physics type
 	EPhysicsType PhysType = EPhysicsType::PhysType_Kinematic;
@@ -343,7 +400,7 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 			PhysType = EPhysicsType::PhysType_Simulated;
 			break;
 		case EPmxPhysicsType2Handling::Skip:
-			return nullptr;
+			return false;
 		}
 		break;
 	}
@@ -393,24 +450,27 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 		}
 	}
 
-	BodySetup->PhysicsType = PhysType;
+	OutBody.PhysicsType = PhysType;
 
 	// Setup physical properties
-	FBodyInstance& BI = BodySetup->DefaultInstance;
-	BI.SetMassOverride(RB.Mass * PhysicsData.MassScale);
-	BI.bOverrideMass = true;
-	BI.LinearDamping = RB.MoveAttenuation * PhysicsData.DampingScale;
-	BI.AngularDamping = RB.RotationAttenuation * PhysicsData.DampingScale;
+	OutBody.Mass = RB.Mass * PhysicsData.MassScale;
+	OutBody.LinearDamping = RB.MoveAttenuation * PhysicsData.DampingScale;
+	OutBody.AngularDamping = RB.RotationAttenuation * PhysicsData.DampingScale;
 
-	// Setup collision
-	SetupCollisionFiltering(BodySetup, RB);
+	// Log non-collision group for future expansion
+	if (RB.NonCollisionGroup != 0)
+	{
+		PMX_TRACE(LogPMXImporter,
+			TEXT("RigidBody '%s': Group=%d, NonCollisionMask=0x%04X (not fully mapped)"),
+			*RB.Name, RB.Group, RB.NonCollisionGroup);
+	}
 
 	// Get body local transform
 	const FVector LocalPos = GetBodyLocalPosition(RB, Bone, PhysicsData.Scale);
 	const FRotator LocalRot = GetBodyLocalRotation(RB);
 
 	// Create shape based on type
-	FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+	FKAggregateGeom& AggGeom = OutBody.AggGeom;
 	const float BaseScale = PhysicsData.Scale * PhysicsData.ShapeScale;
 
 	switch (RB.Shape)
@@ -425,7 +485,7 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 		SetupCapsuleShape(AggGeom, RB, BaseScale * PhysicsData.CapsuleScale, LocalPos, LocalRot);
 		break;
 	default:
-		UE_LOG(LogPMXImporter, Warning, TEXT("Unknown shape type %d for '%s'"), RB.Shape, *RB.Name);
+		PMX_DIAG_WARNING(LogPMXImporter, TEXT("Unknown shape type %d for '%s'"), RB.Shape, *RB.Name);
 		SetupSphereShape(AggGeom, RB, BaseScale * PhysicsData.SphereScale, LocalPos);
 		break;
 	}
@@ -447,32 +507,29 @@ USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(
 		Sphyl.Rotation = LocalRot;
 	}
 
-	// Add to physics asset
-	Asset->SkeletalBodySetups.Add(BodySetup);
-
-	const int32 NewBodySetupCount = Asset->SkeletalBodySetups.Num();
-	UE_LOG(LogPMXImporter, Verbose,
-		TEXT("✓ Created BodySetup for bone '%s' (RB: '%s', Shape: %d, PhysType: %d) - Total BodySetups: %d"),
-		*Bone.Name, *RB.Name, RB.Shape, static_cast<int32>(PhysType), NewBodySetupCount);
+	PMX_TRACE(LogPMXImporter,
+		TEXT("✓ Planned BodySetup for bone '%s' (RB: '%s', Shape: %d, PhysType: %d) - Total BodySetups: %d"),
+		*Bone.Name, *RB.Name, RB.Shape, static_cast<int32>(PhysType), Plan.Bodies.Num() + 1);
 
-	return BodySetup;
+	return true;
 }
 
-UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
-	UPhysicsAsset* Asset,
+bool FPmxPhysicsBuilder::PlanConstraint(
+	const FPmxPhysicsPlan& Plan,
 	const FPmxJoint& Joint,
 	const TArray<FPmxRigidBody>& RigidBodies,
 	const TArray<FPmxBone>& Bones,
-	const FPmxPhysicsCache& PhysicsData)
+	const FPmxPhysicsCache& PhysicsData,
+	FPmxPhysicsConstraintPlan& OutConstraint)
 {
 	// Validate indices
 	if (Joint.RigidBodyIndexA < 0 || Joint.RigidBodyIndexA >= RigidBodies.Num() ||
 		Joint.RigidBodyIndexB < 0 || Joint.RigidBodyIndexB >= RigidBodies.Num())
 	{
-		UE_LOG(LogPMXImporter, Warning,
+		PMX_DIAG_WARNING(LogPMXImporter,
 			TEXT("CreateConstraint: Invalid rigid body indices for Joint '%s' (A=%d, B=%d)"),
 			*Joint.Name, Joint.RigidBodyIndexA, Joint.RigidBodyIndexB);
-		return nullptr;
+		return false;
 	}
 
 	const FPmxRigidBody& RBA = RigidBodies[Joint.RigidBodyIndexA];
@@ -482,61 +539,57 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 	if (RBA.RelatedBoneIndex < 0 || RBA.RelatedBoneIndex >= Bones.Num() ||
 		RBB.RelatedBoneIndex < 0 || RBB.RelatedBoneIndex >= Bones.Num())
 	{
-		UE_LOG(LogPMXImporter, Warning,
+		PMX_DIAG_WARNING(LogPMXImporter,
 			TEXT("CreateConstraint: Invalid bone indices for Joint '%s'"),
 			*Joint.Name);
-		return nullptr;
+		return false;
 	}
 
-	// Find the actual bone names from existing BodySetups
-	// This ensures we use the exact same FName that was registered in the physics asset
-	const FString& PmxBoneNameA = Bones[RBA.RelatedBoneIndex].Name;
-	const FString& PmxBoneNameB = Bones[RBB.RelatedBoneIndex].Name;
+	// Find the actual bone names from the planned bodies
+	// This ensures we use the exact same FName that will be registered in the physics asset
+	const FString& PmxBoneNameA = GetSkeletonBoneName(PhysicsData, RBA.RelatedBoneIndex);
+	const FString& PmxBoneNameB = GetSkeletonBoneName(PhysicsData, RBB.RelatedBoneIndex);
 
 	FName ActualBoneNameA = NAME_None;
 	FName ActualBoneNameB = NAME_None;
 
-	// Find matching BodySetups by comparing bone name strings
-	for (USkeletalBodySetup* BodySetup : Asset->SkeletalBodySetups)
+	// Find matching bodies by comparing bone name strings
+	for (const FPmxPhysicsBodyPlan& Body : Plan.Bodies)
 	{
-		if (BodySetup)
+		const FString BodyBoneName = Body.BoneName.ToString();
+		if (ActualBoneNameA.IsNone() && BodyBoneName.Equals(PmxBoneNameA, ESearchCase::CaseSensitive))
 		{
-			const FString BodyBoneName = BodySetup->BoneName.ToString();
-			if (ActualBoneNameA.IsNone() && BodyBoneName.Equals(PmxBoneNameA, ESearchCase::CaseSensitive))
-			{
-				ActualBoneNameA = BodySetup->BoneName;
-			}
-			if (ActualBoneNameB.IsNone() && BodyBoneName.Equals(PmxBoneNameB, ESearchCase::CaseSensitive))
-			{
-				ActualBoneNameB = BodySetup->BoneName;
-			}
-			if (!ActualBoneNameA.IsNone() && !ActualBoneNameB.IsNone())
-			{
-				break;
-			}
+			ActualBoneNameA = Body.BoneName;
+		}
+		if (ActualBoneNameB.IsNone() && BodyBoneName.Equals(PmxBoneNameB, ESearchCase::CaseSensitive))
+		{
+			ActualBoneNameB = Body.BoneName;
+		}
+		if (!ActualBoneNameA.IsNone() && !ActualBoneNameB.IsNone())
+		{
+			break;
 		}
 	}
 
 	// Verify both bodies were found
 	if (ActualBoneNameA.IsNone() || ActualBoneNameB.IsNone())
 	{
-		UE_LOG(LogPMXImporter, Warning,
+		PMX_DIAG_WARNING(LogPMXImporter,
 			TEXT("CreateConstraint: Bodies not found for Joint '%s' (Bone1: %s, Bone2: %s)"),
 			*Joint.Name, *PmxBoneNameA, *PmxBoneNameB);
-		return nullptr;
+		return false;
 	}
 
-	// Create constraint
-	UPhysicsConstraintTemplate* Constraint = NewObject<UPhysicsConstraintTemplate>(Asset, NAME_None, RF_Transactional);
-
-	FConstraintInstance& CI = Constraint->DefaultInstance;
-	CI.ConstraintBone1 = ActualBoneNameA;
-	CI.ConstraintBone2 = ActualBoneNameB;
+	// Start from the profile of a new constraint template
+	OutConstraint.BoneNameA = ActualBoneNameA;
+	OutConstraint.BoneNameB = ActualBoneNameB;
+	FConstraintProfileProperties& Profile = OutConstraint.Profile;
+	Profile = FConstraintInstance().ProfileInstance;
 
 	// Joint type handling
 	if (Joint.JointType != 0)
 	{
-		UE_LOG(LogPMXImporter, Verbose,
+		PMX_TRACE(LogPMXImporter,
 			TEXT("Joint '%s' has non-standard type %d, treating as Spring 6DOF"),
 			*Joint.Name, Joint.JointType);
 	}
@@ -565,11 +618,11 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 		return ELinearConstraintMotion::LCM_Limited;
 	};
 
-	// Set linear limits (use ProfileInstance directly - SetXMotion() only works when ConstraintHandle is valid)
-	CI.ProfileInstance.LinearLimit.XMotion = SetLinearMotion(MinMove.X, MaxMove.X);
-	CI.ProfileInstance.LinearLimit.YMotion = SetLinearMotion(MinMove.Y, MaxMove.Y);
-	CI.ProfileInstance.LinearLimit.ZMotion = SetLinearMotion(MinMove.Z, MaxMove.Z);
-	CI.ProfileInstance.LinearLimit.Limit = FMath::Max3(
+	// Set linear limits (on the profile - SetXMotion() only works when ConstraintHandle is valid)
+	Profile.LinearLimit.XMotion = SetLinearMotion(MinMove.X, MaxMove.X);
+	Profile.LinearLimit.YMotion = SetLinearMotion(MinMove.Y, MaxMove.Y);
+	Profile.LinearLimit.ZMotion = SetLinearMotion(MinMove.Z, MaxMove.Z);
+	Profile.LinearLimit.Limit = FMath::Max3(
 		FMath::Max(FMath::Abs(MinMove.X), FMath::Abs(MaxMove.X)),
 		FMath::Max(FMath::Abs(MinMove.Y), FMath::Abs(MaxMove.Y)),
 		FMath::Max(FMath::Abs(MinMove.Z), FMath::Abs(MaxMove.Z)));
@@ -601,7 +654,7 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 
 	// Map PMX XYZ rotation to UE Swing1/Swing2/Twist
 	// PMX: X=Roll, Y=Pitch, Z=Yaw -> UE: Twist=X, Swing1=Y, Swing2=Z
-	// (use ProfileInstance directly - SetAngularXMotion() only works when ConstraintHandle is valid)
+	// (on the profile - SetAngularXMotion() only works when ConstraintHandle is valid)
 
 	// Set angular limits with optional clamping
 	float TwistLimit = FMath::Max(FMath::Abs(MinRotDeg.X), FMath::Abs(MaxRotDeg.X));
@@ -635,39 +688,39 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 	if (PhysicsData.ConstraintMode == EPmxConstraintMode::OverrideAll)
 	{
 		// Override mode: Use user-specified settings for all constraints
-		CI.ProfileInstance.LinearLimit.XMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
-		CI.ProfileInstance.LinearLimit.YMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
-		CI.ProfileInstance.LinearLimit.ZMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
-		CI.ProfileInstance.LinearLimit.Limit = 0.0f;
-
-		CI.ProfileInstance.ConeLimit.Swing1Motion = PhysicsData.OverrideAngularMotion;
-		CI.ProfileInstance.ConeLimit.Swing2Motion = PhysicsData.OverrideAngularMotion;
-		CI.ProfileInstance.ConeLimit.Swing1LimitDegrees = PhysicsData.OverrideSwing1Limit;
-		CI.ProfileInstance.ConeLimit.Swing2LimitDegrees = PhysicsData.OverrideSwing2Limit;
-		CI.ProfileInstance.TwistLimit.TwistMotion = PhysicsData.OverrideAngularMotion;
-		CI.ProfileInstance.TwistLimit.TwistLimitDegrees = PhysicsData.OverrideTwistLimit;
+		Profile.LinearLimit.XMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
+		Profile.LinearLimit.YMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
+		Profile.LinearLimit.ZMotion = PhysicsData.bLockAllLinearMotion ? ELinearConstraintMotion::LCM_Locked : ELinearConstraintMotion::LCM_Free;
+		Profile.LinearLimit.Limit = 0.0f;
+
+		Profile.ConeLimit.Swing1Motion = PhysicsData.OverrideAngularMotion;
+		Profile.ConeLimit.Swing2Motion = PhysicsData.OverrideAngularMotion;
+		Profile.ConeLimit.Swing1LimitDegrees = PhysicsData.OverrideSwing1Limit;
+		Profile.ConeLimit.Swing2LimitDegrees = PhysicsData.OverrideSwing2Limit;
+		Profile.TwistLimit.TwistMotion = PhysicsData.OverrideAngularMotion;
+		Profile.TwistLimit.TwistLimitDegrees = PhysicsData.OverrideTwistLimit;
 	}
 	else
 	{
 		// UsePmxSettings mode: Use PMX joint settings with optional MaxAngularLimit clamp
-		CI.ProfileInstance.ConeLimit.Swing1Motion = Swing1Motion;
-		CI.ProfileInstance.ConeLimit.Swing2Motion = Swing2Motion;
-		CI.ProfileInstance.ConeLimit.Swing1LimitDegrees = Swing1Limit;
-		CI.ProfileInstance.ConeLimit.Swing2LimitDegrees = Swing2Limit;
-		CI.ProfileInstance.TwistLimit.TwistMotion = TwistMotion;
-		CI.ProfileInstance.TwistLimit.TwistLimitDegrees = TwistLimit;
+		Profile.ConeLimit.Swing1Motion = Swing1Motion;
+		Profile.ConeLimit.Swing2Motion = Swing2Motion;
+		Profile.ConeLimit.Swing1LimitDegrees = Swing1Limit;
+		Profile.ConeLimit.Swing2LimitDegrees = Swing2Limit;
+		Profile.TwistLimit.TwistMotion = TwistMotion;
+		Profile.TwistLimit.TwistLimitDegrees = TwistLimit;
 	}
 
 	// Soft Constraint settings (applies to all modes)
 	if (PhysicsData.bUseSoftConstraint)
 	{
-		CI.ProfileInstance.ConeLimit.bSoftConstraint = true;
-		CI.ProfileInstance.ConeLimit.Stiffness = PhysicsData.SoftConstraintStiffness;
-		CI.ProfileInstance.ConeLimit.Damping = PhysicsData.SoftConstraintDamping;
+		Profile.ConeLimit.bSoftConstraint = true;
+		Profile.ConeLimit.Stiffness = PhysicsData.SoftConstraintStiffness;
+		Profile.ConeLimit.Damping = PhysicsData.SoftConstraintDamping;
 
-		CI.ProfileInstance.TwistLimit.bSoftConstraint = true;
-		CI.ProfileInstance.TwistLimit.Stiffness = PhysicsData.SoftConstraintStiffness;
-		CI.ProfileInstance.TwistLimit.Damping = PhysicsData.SoftConstraintDamping;
+		Profile.TwistLimit.bSoftConstraint = true;
+		Profile.TwistLimit.Stiffness = PhysicsData.SoftConstraintStiffness;
+		Profile.TwistLimit.Damping = PhysicsData.SoftConstraintDamping;
 	}
 
 	// Phase 6: Long chain optimization
@@ -676,11 +729,11 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 		// Projection settings - corrects accumulated constraint errors in long chains
 		if (PhysicsData.bEnableProjection)
 		{
-			CI.ProfileInstance.bEnableProjection = true;
-			CI.ProfileInstance.ProjectionLinearTolerance = PhysicsData.ProjectionLinearTolerance;
-			CI.ProfileInstance.ProjectionAngularTolerance = FMath::DegreesToRadians(PhysicsData.ProjectionAngularTolerance);
-			CI.ProfileInstance.ProjectionLinearAlpha = 0.7f;
-			CI.ProfileInstance.ProjectionAngularAlpha = 0.7f;
+			Profile.bEnableProjection = true;
+			Profile.ProjectionLinearTolerance = PhysicsData.ProjectionLinearTolerance;
+			Profile.ProjectionAngularTolerance = FMath::DegreesToRadians(PhysicsData.ProjectionAngularTolerance);
+			Profile.ProjectionLinearAlpha = 0.7f;
+			Profile.ProjectionAngularAlpha = 0.7f;
 		}
 
 		// Parent Dominates - prevents child bodies from affecting parent
@@ -690,18 +743,18 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 			const bool bIsChainEndB = IsChainEnd(Joint.RigidBodyIndexB, PhysicsData.Joints);
 			if (bIsChainRootA || bIsChainEndB)
 			{
-				CI.ProfileInstance.bParentDominates = true;
+				Profile.bParentDominates = true;
 			}
 		}
 
 		// Mass Conditioning - improves stability for bodies with large mass ratio differences
 		if (PhysicsData.bEnableMassConditioning)
 		{
-			CI.ProfileInstance.bEnableMassConditioning = true;
+			Profile.bEnableMassConditioning = true;
 		}
 
 		// Contact Transfer Scale - how much collision force transfers from child to parent
-		CI.ProfileInstance.ContactTransferScale = PhysicsData.ContactTransferScale;
+		Profile.ContactTransferScale = PhysicsData.ContactTransferScale;
 	}
 
 	// Setup spring (for JointType 0 = Spring 6DOF)
@@ -717,15 +770,15 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 		if (!PhysicsData.bDisableLinearSpringDrive)
 		{
 			const FVector SpringMove = ConvertVectorPmxToUE(Joint.SpringMoveCoefficient, 1.0f); // Spring coefficients not scaled by position scale
-			CI.ProfileInstance.LinearDrive.XDrive.bEnablePositionDrive = SpringMove.X > 0.0f;
-			CI.ProfileInstance.LinearDrive.XDrive.Stiffness = SpringMove.X * StiffnessScale;
-			CI.ProfileInstance.LinearDrive.XDrive.Damping = 0.1f * DampingScale; // Base damping 0.1
-			CI.ProfileInstance.LinearDrive.YDrive.bEnablePositionDrive = SpringMove.Y > 0.0f;
-			CI.ProfileInstance.LinearDrive.YDrive.Stiffness = SpringMove.Y * StiffnessScale;
-			CI.ProfileInstance.LinearDrive.YDrive.Damping = 0.1f * DampingScale;
-			CI.ProfileInstance.LinearDrive.ZDrive.bEnablePositionDrive = SpringMove.Z > 0.0f;
-			CI.ProfileInstance.LinearDrive.ZDrive.Stiffness = SpringMove.Z * StiffnessScale;
-			CI.ProfileInstance.LinearDrive.ZDrive.Damping = 0.1f * DampingScale;
+			Profile.LinearDrive.XDrive.bEnablePositionDrive = SpringMove.X > 0.0f;
+			Profile.LinearDrive.XDrive.Stiffness = SpringMove.X * StiffnessScale;
+			Profile.LinearDrive.XDrive.Damping = 0.1f * DampingScale; // Base damping 0.1
+			Profile.LinearDrive.YDrive.bEnablePositionDrive = SpringMove.Y > 0.0f;
+			Profile.LinearDrive.YDrive.Stiffness = SpringMove.Y * StiffnessScale;
+			Profile.LinearDrive.YDrive.Damping = 0.1f * DampingScale;
+			Profile.LinearDrive.ZDrive.bEnablePositionDrive = SpringMove.Z > 0.0f;
+			Profile.LinearDrive.ZDrive.Stiffness = SpringMove.Z * StiffnessScale;
+			Profile.LinearDrive.ZDrive.Damping = 0.1f * DampingScale;
 		}
 
 		// Angular spring with stiffness/damping scale
@@ -735,9 +788,9 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 			Joint.SpringRotationCoefficient.Z);
 		const float AvgSpringRot = (SpringRot.X + SpringRot.Y + SpringRot.Z) / 3.0f;
 
-		CI.ProfileInstance.AngularDrive.SlerpDrive.bEnablePositionDrive = AvgSpringRot > 0.0f;
-		CI.ProfileInstance.AngularDrive.SlerpDrive.Stiffness = AvgSpringRot * StiffnessScale;
-		CI.ProfileInstance.AngularDrive.SlerpDrive.Damping = 0.1f * DampingScale; // Base damping 0.1
+		Profile.AngularDrive.SlerpDrive.bEnablePositionDrive = AvgSpringRot > 0.0f;
+		Profile.AngularDrive.SlerpDrive.Stiffness = AvgSpringRot * StiffnessScale;
+		Profile.AngularDrive.SlerpDrive.Damping = 0.1f * DampingScale; // Base damping 0.1
 	}
 
 	// Convert joint position from world to bone-local coordinates
@@ -755,32 +808,68 @@ UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(
 	const FVector JointLocalPosA = JointWorldPos - BonePosA;
 	const FVector JointLocalPosB = JointWorldPos - BonePosB;
 
-	CI.SetRefPosition(EConstraintFrame::Frame1, JointLocalPosA);
-	CI.SetRefPosition(EConstraintFrame::Frame2, JointLocalPosB);
+	OutConstraint.PositionA = JointLocalPosA;
+	OutConstraint.PositionB = JointLocalPosB;
 
 	// UE 5.7: SetRefOrientation requires PriAxis and SecAxis vectors
 	const FQuat JointQuat = JointRot.Quaternion().GetNormalized();
-	const FVector PriAxis = JointQuat.GetAxisX();
-	const FVector SecAxis = JointQuat.GetAxisY();
-	CI.SetRefOrientation(EConstraintFrame::Frame1, PriAxis, SecAxis);
-	CI.SetRefOrientation(EConstraintFrame::Frame2, PriAxis, SecAxis);
+	OutConstraint.PrimaryAxis = JointQuat.GetAxisX();
+	OutConstraint.SecondaryAxis = JointQuat.GetAxisY();
+
+	PMX_TRACE(LogPMXImporter,
+		TEXT("Planned Constraint '%s' (Bone1: %s, Bone2: %s)"),
+		*Joint.Name, *ActualBoneNameA.ToString(), *ActualBoneNameB.ToString());
+
+	return true;
+}
+
+USkeletalBodySetup* FPmxPhysicsBuilder::CreateBodySetup(UPhysicsAsset* Asset, const FPmxPhysicsBodyPlan& Body)
+{
+	USkeletalBodySetup* BodySetup = NewObject<USkeletalBodySetup>(Asset, NAME_None, RF_Transactional);
+	BodySetup->BoneName = Body.BoneName;
+	BodySetup->PhysicsType = Body.PhysicsType;
+
+	// Setup physical properties
+	FBodyInstance& BI = BodySetup->DefaultInstance;
+	BI.SetMassOverride(Body.Mass);
+	BI.bOverrideMass = true;
+	BI.LinearDamping = Body.LinearDamping;
+	BI.AngularDamping = Body.AngularDamping;
+
+	// Setup collision
+	SetupCollisionFiltering(BodySetup);
+
+	BodySetup->AggGeom = Body.AggGeom;
+
+	// Add to physics asset
+	Asset->SkeletalBodySetups.Add(BodySetup);
+	return BodySetup;
+}
+
+UPhysicsConstraintTemplate* FPmxPhysicsBuilder::CreateConstraint(UPhysicsAsset* Asset, const FPmxPhysicsConstraintPlan& Constraint)
+{
+	UPhysicsConstraintTemplate* Template = NewObject<UPhysicsConstraintTemplate>(Asset, NAME_None, RF_Transactional);
+
+	FConstraintInstance& CI = Template->DefaultInstance;
+	CI.ConstraintBone1 = Constraint.BoneNameA;
+	CI.ConstraintBone2 = Constraint.BoneNameB;
+	CI.ProfileInstance = Constraint.Profile;
+	CI.SetRefPosition(EConstraintFrame::Frame1, Constraint.PositionA);
+	CI.SetRefPosition(EConstraintFrame::Frame2, Constraint.PositionB);
+	CI.SetRefOrientation(EConstraintFrame::Frame1, Constraint.PrimaryAxis, Constraint.SecondaryAxis);
+	CI.SetRefOrientation(EConstraintFrame::Frame2, Constraint.PrimaryAxis, Constraint.SecondaryAxis);
 
 	// CRITICAL: Sync DefaultProfile with ProfileInstance
 	// Without this, empty DefaultProfile values will overwrite ProfileInstance during Serialize
 	// When setting values manually in editor, PostEditChangeProperty handles this,
 	// but when creating via code, we must call it explicitly
 #if WITH_EDITOR
-	Constraint->UpdateProfileInstance();
+	Template->UpdateProfileInstance();
 #endif
 
 	// Add to physics asset
-	Asset->ConstraintSetup.Add(Constraint);
-
-	UE_LOG(LogPMXImporter, Verbose,
-		TEXT("Created Constraint '%s' (Bone1: %s, Bone2: %s)"),
-		*Joint.Name, *ActualBoneNameA.ToString(), *ActualBoneNameB.ToString());
-
-	return Constraint;
+	Asset->ConstraintSetup.Add(Template);
+	return Template;
 }
 
 void FPmxPhysicsBuilder::SetupSphereShape(FKAggregateGeom& Geom, const FPmxRigidBody& RB, float Scale, const FVector& LocalPos)
@@ -830,6 +919,15 @@ FRotator FPmxPhysicsBuilder::GetBodyLocalRotation(const FPmxRigidBody& RB)
 	return ConvertRotationPmxToUE(RB.Rotation);
 }
 
+const FString& FPmxPhysicsBuilder::GetSkeletonBoneName(const FPmxPhysicsCache& PhysicsData, int32 BoneIndex)
+{
+	if (PhysicsData.BoneNames.IsValidIndex(BoneIndex))
+	{
+		return PhysicsData.BoneNames[BoneIndex];
+	}
+	return PhysicsData.Bones[BoneIndex].Name;
+}
+
 FVector FPmxPhysicsBuilder::ConvertVectorPmxToUE(const FVector3f& PmxVector, float Scale)
 {
 	// PMX: Right-handed Y-up (X right, Y up, Z forward)
@@ -1033,21 +1131,13 @@ bool FPmxPhysicsBuilder::IsStandardBone(const FString& BoneName)
 	return false;
 }
 
-void FPmxPhysicsBuilder::SetupCollisionFiltering(USkeletalBodySetup* Body, const FPmxRigidBody& RB)
+void FPmxPhysicsBuilder::SetupCollisionFiltering(USkeletalBodySetup* Body)
 {
 	FBodyInstance& BI = Body->DefaultInstance;
 
 	// Use PhysicsBody collision profile as default
 	BI.SetObjectType(ECollisionChannel::ECC_PhysicsBody);
 	BI.SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
-
-	// Log non-collision group for future expansion
-	if (RB.NonCollisionGroup != 0)
-	{
-		UE_LOG(LogPMXImporter, Verbose,
-			TEXT("RigidBody '%s': Group=%d, NonCollisionMask=0x%04X (not fully mapped)"),
-			*RB.Name, RB.Group, RB.NonCollisionGroup);
-	}
 }
 
 bool FPmxPhysicsBuilder::IsRigidBodyConnectedToConstraint(int32 RigidBodyIndex, const TArray<FPmxJoint>& Joints)
@@ -22,11 +22,38 @@
 #include "Engine/Texture.h"
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/SkeletalBodySetup.h"
-#include "HAL/PlatformProcess.h"
 #include "Rendering/SkeletalMeshLODModel.h"
 #include "Rendering/SkeletalMeshModel.h"
-
-#include "SkeletonModifier.h"
+#include "InterchangeJointNode.h"
+#include "PmxUtils.h"
+#include "PmxNodeBuilder.h"
+#include "PmxRigBuilder.h"
+#include "PmxRigDefinition.h"
+#include "PmxSkeletonPruner.h"
+#include "PmxSkinOptimizer.h"
+#include "PmxMeshOptimizer.h"
+#include "PmxMeshSimplifier.h"
+#include "PmxOutlineBuilder.h"
+#include "PmxMaterialMapping.h"
+#include "PmxSdefBuilder.h"
+#include "PmxVertexStreams.h"
+#include "MeshTypes.h"
+#include "PmxSkeletonMatcher.h"
+#include "PmxSkeletonIndex.h"
+#include "PmxDisplayBuilder.h"
+#include "PmxImportSession.h"
+#include "PmxImportManifest.h"
+#include "PmxManifestBuilder.h"
+#include "PmxImportProfiler.h"
+#include "PmxPostImportQueue.h"
+#include "InterchangeSkeletonFactoryNode.h"
+#include "Animation/Skeleton.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "Tasks/Task.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PmxPipeline)
 
@@ -36,14 +63,20 @@ namespace PmxPipelineAttributeKeys
 	const FString Scale = TEXT("PMX:Scale");
 	const FString ImportMesh = TEXT("PMX:ImportMesh");
 	const FString ImportMorphs = TEXT("PMX:ImportMorphs");
+	const FString ImportSdef = TEXT("PMX:ImportSdef");
 	const FString ImportArmature = TEXT("PMX:ImportArmature");
 	const FString ImportPhysics = TEXT("PMX:ImportPhysics");
 	const FString ImportDisplay = TEXT("PMX:ImportDisplay");
 	const FString CleanModel = TEXT("PMX:CleanModel");
 	const FString RemoveDoubles = TEXT("PMX:RemoveDoubles");
+	const FString OptimizeVertexCache = TEXT("PMX:OptimizeVertexCache");
 	const FString RenameLRBones = TEXT("PMX:RenameLRBones");
+	const FString TranslateBoneNames = TEXT("PMX:TranslateBoneNames");
+	const FString BoneRenameTable = TEXT("PMX:BoneRenameTable");
 	const FString FixIKLinks = TEXT("PMX:FixIKLinks");
 	const FString ApplyBoneFixedAxis = TEXT("PMX:ApplyBoneFixedAxis");
+	const FString PruneUnusedBones = TEXT("PMX:PruneUnusedBones");
+	const FString ShareCompatibleSkeletons = TEXT("PMX:ShareCompatibleSkeletons");
 	const FString UseUnderscore = TEXT("PMX:UseUnderscore");
 	const FString UseMipmap = TEXT("PMX:UseMipmap");
 	const FString SphBlendFactor = TEXT("PMX:SphBlendFactor");
@@ -66,104 +99,99 @@ namespace PmxPipelineAttributeKeys
 	const FString MarkSharpEdges = TEXT("PMX:MarkSharpEdges");
 	const FString SharpEdgeAngle = TEXT("PMX:SharpEdgeAngle");
 	const FString ImportAddUV2AsVertexColors = TEXT("PMX:ImportAddUV2AsVertexColors");
+	const FString AddUVChannels = TEXT("PMX:AddUVChannels");
 	// Mesh Build options
 	const FString RecomputeNormals = TEXT("PMX:RecomputeNormals");
 	const FString RecomputeTangents = TEXT("PMX:RecomputeTangents");
 	const FString UseMikkTSpace = TEXT("PMX:UseMikkTSpace");
+	// Mesh LOD options
+	const FString LodCount = TEXT("PMX:LodCount");
+	const FString LodReductionRatio = TEXT("PMX:LodReductionRatio");
+	const FString LodMaxInfluences = TEXT("PMX:LodMaxInfluences");
+	// Mesh skinning options
+	const FString MinInfluenceWeight = TEXT("PMX:MinInfluenceWeight");
+	const FString MaxBonesPerSection = TEXT("PMX:MaxBonesPerSection");
+	// Mesh outline options
+	const FString GenerateOutline = TEXT("PMX:GenerateOutline");
+	const FString OutlineThickness = TEXT("PMX:OutlineThickness");
 }
 
-UPmxPipeline::UPmxPipeline()
-{
-	// Default values are set in header
-}
-
-bool UPmxPipeline::CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask)
+namespace PmxPipelinePrivate
 {
-	// PostImport needs to run on game thread for physics asset creation
-	if (PipelineTask == EInterchangePipelineTask::PostImport)
+	/** Material instance parameters read from the node container, applied by a queued post-import step */
+	struct FMaterialParameters
 	{
-		return false;
-	}
-	return true;
-}
-
-void UPmxPipeline::RenameLRBones(USkeletalMesh* SkeletalMesh) const
-{
-	if (!bRenameLRBones)
+		FSoftObjectPath BaseColorTexture;
+		TArray<TPair<FName, float>> Scalars;
+		TArray<TPair<FName, FLinearColor>> Vectors;
+		TArray<TPair<FName, bool>> StaticSwitches;
+		FString NodeLabel;
+	};
+
+	/** Seconds a material keeps waiting for its base color texture to be created */
+	constexpr double TextureLoadTimeout = 0.5;
+
+	/** Translated skeletal mesh nodes of the model (ImportMeshSection); all null if the mesh was not imported */
+	struct FBaseMeshNodes
 	{
-		return;
-	}
+		UInterchangeSkeletalMeshFactoryNode* SkeletalMesh = nullptr;
+		UInterchangeSkeletalMeshLodDataNode* Lod0 = nullptr;
+		UInterchangeMeshNode* Lod0Mesh = nullptr;
+	};
 
-	USkeleton* Skeleton = SkeletalMesh->GetSkeleton();
-	if (!Skeleton)
+	static FBaseMeshNodes FindBaseMeshNodes(UInterchangeBaseNodeContainer* BaseNodeContainer)
 	{
-		return;
-	}
-
-	USkeletonModifier* SkeletonModifier = NewObject<USkeletonModifier>();
-	SkeletonModifier->SetSkeletalMesh(SkeletalMesh);
-
-	const TArray<FMeshBoneInfo>& BoneInfoArray = SkeletalMesh->GetRefSkeleton().GetRefBoneInfo();
-
-	bool bChanged = false;
-	for (const FMeshBoneInfo& BoneInfo : BoneInfoArray)
-	{
-		if (BoneInfo.Name.ToString().StartsWith(TEXT("左")))
+		FBaseMeshNodes Nodes;
+		BaseNodeContainer->IterateNodesOfType<UInterchangeSkeletalMeshFactoryNode>([BaseNodeContainer, &Nodes](const FString& NodeUid, UInterchangeSkeletalMeshFactoryNode* SkeletalMeshNode)
 		{
-			SkeletonModifier->RenameBone(BoneInfo.Name, FName(BoneInfo.Name.ToString().RightChop(1) + TEXT("_L")));
-			bChanged = true;
-		}
-		else if (BoneInfo.Name.ToString().StartsWith(TEXT("右")))
-		{
-			SkeletonModifier->RenameBone(BoneInfo.Name, FName(BoneInfo.Name.ToString().RightChop(1) + TEXT("_R")));
-			bChanged = true;
-		}
-	}
-
-	if (!bChanged)
-	{
-		return;
+			TArray<FString> LodDataUids;
+			SkeletalMeshNode->GetLodDataUniqueIds(LodDataUids);
+			const UInterchangeSkeletalMeshLodDataNode* Lod0Node = LodDataUids.Num() > 0
+				? Cast<UInterchangeSkeletalMeshLodDataNode>(BaseNodeContainer->GetNode(LodDataUids[0])) : nullptr;
+			TArray<FInterchangeLODMeshData> LodMeshes;
+			if (Lod0Node)
+			{
+				Lod0Node->GetLODMeshDataArray(LodMeshes);
+			}
+			const UInterchangeMeshNode* MeshNode = LodMeshes.Num() > 0 ? Cast<UInterchangeMeshNode>(BaseNodeContainer->GetNode(LodMeshes[0].MeshUid)) : nullptr;
+			if (MeshNode && !Nodes.SkeletalMesh)
+			{
+				Nodes.SkeletalMesh = SkeletalMeshNode;
+				Nodes.Lod0 = const_cast<UInterchangeSkeletalMeshLodDataNode*>(Lod0Node);
+				Nodes.Lod0Mesh = const_cast<UInterchangeMeshNode*>(MeshNode);
+			}
+		});
+		return Nodes;
 	}
 
-	SkeletalMesh->MarkPackageDirty();
-	Skeleton->MarkPackageDirty();
-	SkeletonModifier->CommitSkeletonToSkeletalMesh();
-
-	// After rename, the Skeleton still holds the original 左/右 bones as orphans.
-	// Collect bones that remain in the Skeleton but are no longer referenced by
-	// the SkeletalMesh, keep any parent of a retained bone, and remove the rest.
-	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
-	const FReferenceSkeleton& MeshRefSkeleton = SkeletalMesh->GetRefSkeleton();
-
-	TArray<FName> OrphanedBones;
-	OrphanedBones.Reserve(RefSkeleton.GetRawBoneNum());
-	for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetRawBoneNum(); ++BoneIndex)
+	/** Physics plan built on a worker task and applied in game thread slices */
+	struct FPhysicsBuild
 	{
-		OrphanedBones.Add(RefSkeleton.GetBoneName(BoneIndex));
-	}
+		FPmxPhysicsPlan Plan;
+		bool bPlanned = false;
+		int32 NextStep = 0;
+	};
+}
 
-	for (int32 BoneIndex = 0; BoneIndex < MeshRefSkeleton.GetRawBoneNum() && OrphanedBones.Num() > 0; ++BoneIndex)
-	{
-		OrphanedBones.Remove(MeshRefSkeleton.GetBoneName(BoneIndex));
-	}
+UPmxPipeline::UPmxPipeline()
+{
+	// Default values are set in header
+}
 
-	for (int32 BoneIndex = RefSkeleton.GetRawBoneNum() - 1; BoneIndex >= 0; --BoneIndex)
+bool UPmxPipeline::CanExecuteOnAnyThread(EInterchangePipelineTask PipelineTask)
+{
+	// PostImport needs to run on game thread for physics asset creation
+	// (the heavy parts are planned on worker tasks and applied in slices by FPmxPostImportQueue)
+	if (PipelineTask == EInterchangePipelineTask::PostImport)
 	{
-		const FName CurrBoneName = RefSkeleton.GetBoneName(BoneIndex);
-		if (!OrphanedBones.Contains(CurrBoneName))
-		{
-			const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
-			if (ParentIndex != INDEX_NONE)
-			{
-				OrphanedBones.Remove(RefSkeleton.GetBoneName(ParentIndex));
-			}
-		}
+		return false;
 	}
-
-	if (OrphanedBones.Num() > 0)
+	// MatchSharedSkeleton loads the candidate skeleton to check it before redirecting the factory nodes
+	if (PipelineTask == EInterchangePipelineTask::PreFactoryImport && bImportArmature && bShareCompatibleSkeletons)
 	{
-		Skeleton->RemoveBonesFromSkeleton(OrphanedBones, true);
+		return false;
 	}
+	return true;
 }
 
 void UPmxPipeline::ExecutePipeline(UInterchangeBaseNodeContainer* BaseNodeContainer, const TArray<UInterchangeSourceData*>& SourceDatas, const FString& ContentBasePath)
@@ -174,12 +202,39 @@ void UPmxPipeline::ExecutePipeline(UInterchangeBaseNodeContainer* BaseNodeContai
 		return;
 	}
 
-	// Cache for post-import use
-	CachedBaseNodeContainer = BaseNodeContainer;
+	// Per-import state created by this import's Translate(); other imports running concurrently have their own
+	Session.Reset();
+	FString SessionId;
+	FGuid SessionGuid;
+	const UInterchangeSourceNode* SourceNode = UInterchangeSourceNode::GetUniqueInstance(BaseNodeContainer);
+	if (SourceNode && SourceNode->GetStringAttribute(FPmxImportSessionRegistry::SessionIdAttributeKey, SessionId) && FGuid::Parse(SessionId, SessionGuid))
+	{
+		Session = FPmxImportSessionRegistry::FindSession(SessionGuid);
+	}
+	if (!Session.IsValid())
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline::ExecutePipeline - No PMX import session found (id '%s'), PMX specific data will not be imported"), *SessionId);
+	}
+
+	// Report after each phase so it is complete whichever phase the import ends in
+	ON_SCOPE_EXIT { WriteImportReport(); };
+	PMX_IMPORT_ROOT_SCOPE("Pipeline", Session.IsValid() ? Session->Profiler : nullptr);
 
 	// Store options to SourceNode for Translator to read
 	StoreOptionsToSourceNode(BaseNodeContainer);
 
+	// Resolve final bone names with the dialog options before any factory runs
+	UpdateBoneNames(BaseNodeContainer);
+	OptimizeMesh();
+	PruneUnusedBones(BaseNodeContainer);
+	GenerateMeshLods(BaseNodeContainer);
+	GenerateOutline(BaseNodeContainer);
+	UpdateRigCache();
+	UpdateSdefCache();
+	UpdateAddUVOptions();
+	UpdateDisplayCache();
+	MatchSharedSkeleton(BaseNodeContainer);
+
 	// CRITICAL: Update physics cache with current pipeline options
 	// The Translator may have already created the cache with default values,
 	// so we need to update it here with the user's settings from the import dialog
@@ -192,12 +247,22 @@ void UPmxPipeline::ExecutePipeline(UInterchangeBaseNodeContainer* BaseNodeContai
 	// Configure factory nodes with import options
 	ConfigureFactoryNodes(BaseNodeContainer);
 
+	// Skip the factory nodes whose PMX sections did not change since the existing import
+	ApplyIncrementalReimport(BaseNodeContainer, ContentBasePath);
+
 	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline::ExecutePipeline completed (Scale=%.2f, ShapeScale=%.2f, BoxScale=%.2f)"),
 		Scale, PhysicsShapeScale, PhysicsBoxScale);
 }
 
+FPmxModel* UPmxPipeline::GetSessionModel() const
+{
+	return Session.IsValid() ? Session->Model.Get() : nullptr;
+}
+
 void UPmxPipeline::StoreOptionsToSourceNode(UInterchangeBaseNodeContainer* BaseNodeContainer) const
 {
+	PMX_IMPORT_SCOPE("Store Options");
+
 	UInterchangeSourceNode* SourceNode = UInterchangeSourceNode::FindOrCreateUniqueInstance(BaseNodeContainer);
 	if (!SourceNode)
 	{
@@ -214,12 +279,25 @@ void UPmxPipeline::StoreOptionsToSourceNode(UInterchangeBaseNodeContainer* BaseN
 	// Mesh options
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportMesh, bImportMesh);
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportMorphs, bImportMorphs);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportSdef, bImportSdef);
 
 	// Skeleton options
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportArmature, bImportArmature);
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RenameLRBones, bRenameLRBones);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::TranslateBoneNames, bTranslateBoneNames);
+	// One source / target attribute pair per entry, so names may contain any character
+	SourceNode->AddInt32Attribute(PmxPipelineAttributeKeys::BoneRenameTable, BoneRenameTable.Num());
+	int32 RenameEntryIndex = 0;
+	for (const TPair<FString, FString>& Entry : BoneRenameTable)
+	{
+		SourceNode->AddStringAttribute(FString::Printf(TEXT("%s:Source%d"), *PmxPipelineAttributeKeys::BoneRenameTable, RenameEntryIndex), Entry.Key);
+		SourceNode->AddStringAttribute(FString::Printf(TEXT("%s:Target%d"), *PmxPipelineAttributeKeys::BoneRenameTable, RenameEntryIndex), Entry.Value);
+		++RenameEntryIndex;
+	}
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::FixIKLinks, bFixIKLinks);
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ApplyBoneFixedAxis, bApplyBoneFixedAxis);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::PruneUnusedBones, bPruneUnusedBones);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ShareCompatibleSkeletons, bShareCompatibleSkeletons);
 
 	// Physics options
 	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportPhysics, bImportPhysics);
@@ -246,99 +324,596 @@ void UPmxPipeline::StoreOptionsToSourceNode(UInterchangeBaseNodeContainer* BaseN
 	SourceNode->AddStringAttribute(PmxPipelineAttributeKeys::ParentMaterial, ParentMaterial.GetAssetPathString());
 	UE_LOG(LogPMXImporter, Display, TEXT("PmxPipeline: Storing ParentMaterial='%s'"), *ParentMaterial.GetAssetPathString());
 
-	// Mesh Build options
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RecomputeNormals, bRecomputeNormals);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RecomputeTangents, bRecomputeTangents);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::UseMikkTSpace, bUseMikkTSpace);
+	// Mesh Build options
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RecomputeNormals, bRecomputeNormals);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RecomputeTangents, bRecomputeTangents);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::UseMikkTSpace, bUseMikkTSpace);
+
+	// Mesh LOD options
+	SourceNode->AddInt32Attribute(PmxPipelineAttributeKeys::LodCount, LodCount);
+	SourceNode->AddFloatAttribute(PmxPipelineAttributeKeys::LodReductionRatio, LodReductionRatio);
+	SourceNode->AddInt32Attribute(PmxPipelineAttributeKeys::LodMaxInfluences, LodMaxInfluences);
+
+	// Mesh skinning options
+	SourceNode->AddFloatAttribute(PmxPipelineAttributeKeys::MinInfluenceWeight, MinInfluenceWeight);
+	SourceNode->AddInt32Attribute(PmxPipelineAttributeKeys::MaxBonesPerSection, MaxBonesPerSection);
+
+	// Mesh outline options
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::GenerateOutline, bGenerateOutline);
+	SourceNode->AddFloatAttribute(PmxPipelineAttributeKeys::OutlineThickness, OutlineThickness);
+
+	// Advanced options
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::CleanModel, bCleanModel);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RemoveDoubles, bRemoveDoubles);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::OptimizeVertexCache, bOptimizeVertexCache);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::MarkSharpEdges, bMarkSharpEdges);
+	SourceNode->AddFloatAttribute(PmxPipelineAttributeKeys::SharpEdgeAngle, SharpEdgeAngle);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportAddUV2AsVertexColors, bImportAddUV2AsVertexColors);
+	SourceNode->AddInt32Attribute(PmxPipelineAttributeKeys::AddUVChannels, AddUVChannels);
+	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportDisplay, bImportDisplay);
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline::StoreOptionsToSourceNode - Scale=%.2f, ShapeScale=%.2f, SphereScale=%.2f, BoxScale=%.2f, CapsuleScale=%.2f"),
+		Scale, PhysicsShapeScale, PhysicsSphereScale, PhysicsBoxScale, PhysicsCapsuleScale);
+}
+
+void UPmxPipeline::UpdateBoneNames(UInterchangeBaseNodeContainer* BaseNodeContainer) const
+{
+	PMX_IMPORT_SCOPE("Update Bone Names");
+
+	// Translate() may have resolved bone names with default options before ExecutePipeline() is called,
+	// so resolve them again here with the user's settings. Names are final before the skeleton,
+	// mesh payload and physics asset are built; no post-import skeleton rename is needed.
+	FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || Session->bBoneNamesResolved)
+	{
+		return;
+	}
+	FPmxModel& Model = *SessionModel;
+
+	TMap<FString, FString> RenameTable;
+	if (bTranslateBoneNames)
+	{
+		RenameTable = FPmxUtils::GetStandardBoneRenameTable();
+	}
+	RenameTable.Append(BoneRenameTable);
+
+	FPmxBoneNameOptions NameOptions;
+	NameOptions.bRenameLRBones = bRenameLRBones;
+	NameOptions.RenameTable = RenameTable.IsEmpty() ? nullptr : &RenameTable;
+
+	const TArray<FString> FinalNames = FPmxUtils::BuildUniqueBoneNames(Model, NameOptions);
+
+	// Joint nodes are keyed by PMX bone index ("<JointsPrefix>/Bone_<Index>")
+	int32 RenamedCount = 0;
+	BaseNodeContainer->IterateNodesOfType<UInterchangeJointNode>([this, &FinalNames, &RenamedCount](const FString& NodeUid, UInterchangeJointNode* JointNode)
+	{
+		const int32 BoneIndex = Session->GetJointBoneIndex(NodeUid);
+		if (!FinalNames.IsValidIndex(BoneIndex))
+		{
+			return;
+		}
+		if (JointNode->GetDisplayLabel() != FinalNames[BoneIndex])
+		{
+			JointNode->SetDisplayLabel(FinalNames[BoneIndex]);
+			++RenamedCount;
+		}
+	});
+
+	// Payload JointNames are built from the cached model, so store the final names there as well
+	for (int32 BoneIndex = 0; BoneIndex < Model.Bones.Num(); ++BoneIndex)
+	{
+		Model.Bones[BoneIndex].Name = FinalNames[BoneIndex];
+	}
+	Session->bBoneNamesResolved = true;
+
+	if (Session->Physics.IsValid() && Session->Physics->Bones.Num() == FinalNames.Num())
+	{
+		Session->Physics->BoneNames = FinalNames;
+	}
+
+	UE_LOG(LogPMXImporter, Log, TEXT("UPmxPipeline: Resolved %d bone names (%d joint labels updated, RenameLR=%d, Translate=%d)"),
+		FinalNames.Num(), RenamedCount, bRenameLRBones, bTranslateBoneNames);
+}
+
+void UPmxPipeline::OptimizeMesh() const
+{
+	PMX_IMPORT_SCOPE("Optimize Mesh");
+
+	// Not in the cached translated model: Translate() runs before the dialog options are known
+	FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel)
+	{
+		return;
+	}
+	FPmxModel& Model = *SessionModel;
+
+	// After welding (Translate()) and before bone pruning, so bones left with only negligible influences can be removed
+	FPmxSkinOptimizer::PruneInfluences(Model, FMath::Clamp(MinInfluenceWeight, 0.0f, 0.25f));
+
+	// Triangle order per material for the vertex cache and overdraw, then vertex order for fetch locality
+	if (bOptimizeVertexCache)
+	{
+		TMap<int32, int32> VertexMap;
+		FPmxMeshOptimizer::OptimizeModel(Model, VertexMap);
+	}
+
+	// Bone-bounded triangle runs per material; keeps the cache order within each run
+	FPmxSkinOptimizer::PartitionSections(Model, FMath::Max(MaxBonesPerSection, 0));
+}
+
+void UPmxPipeline::PruneUnusedBones(UInterchangeBaseNodeContainer* BaseNodeContainer) const
+{
+	PMX_IMPORT_SCOPE("Prune Unused Bones");
+
+	// Topology changes must happen here rather than in Translate(), which runs before the dialog options are known
+	if (!bPruneUnusedBones || !bImportArmature)
+	{
+		return;
+	}
+
+	FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel)
+	{
+		return;
+	}
+	FPmxModel& Model = *SessionModel;
+	const int32 OldBoneCount = Model.Bones.Num();
+
+	FPmxBonePruneResult PruneResult;
+	if (!FPmxSkeletonPruner::PruneUnusedBones(Model, Session->GetSkeletonLayout(Model), FPmxBonePruneOptions(), PruneResult))
+	{
+		UE_LOG(LogPMXImporter, Log, TEXT("UPmxPipeline: No unused bones to prune (%d bones)"), OldBoneCount);
+		return;
+	}
+	Session->SkeletonLayout.Reset();
+
+	// Weights collapsed into a kept ancestor can repeat a bone the vertex already uses
+	FPmxSkinOptimizer::MergeRepeatedBones(Model);
+
+	// Joint nodes are keyed by PMX bone index; removed bones form whole leaf subtrees
+	TArray<FString> RemovedJointUids;
+	BaseNodeContainer->IterateNodesOfType<UInterchangeJointNode>([this, &PruneResult, &RemovedJointUids](const FString& NodeUid, UInterchangeJointNode* JointNode)
+	{
+		const int32 BoneIndex = Session->GetJointBoneIndex(NodeUid);
+		if (PruneResult.OldToNew.IsValidIndex(BoneIndex) && PruneResult.OldToNew[BoneIndex] == INDEX_NONE)
+		{
+			RemovedJointUids.Add(NodeUid);
+		}
+	});
+	for (const FString& JointUid : RemovedJointUids)
+	{
+		BaseNodeContainer->RemoveNode(JointUid);
+	}
+
+	// Kept joints keep their original "Bone_<Index>" UIDs (node UIDs cannot change); from here on they resolve to
+	// model bones through the session's remap. The payload maps weights by position in the cached model.
+	Session->PrunedBoneRemap = PruneResult.OldToNew;
+	TArray<FString> BoneNames;
+	BoneNames.Reserve(Model.Bones.Num());
+	for (const FPmxBone& Bone : Model.Bones)
+	{
+		BoneNames.Add(Bone.Name);
+	}
+
+	if (Session->Physics.IsValid() && Session->Physics->Bones.Num() == OldBoneCount)
+	{
+		Session->Physics->Bones = Model.Bones;
+		Session->Physics->BoneNames = BoneNames;
+		Session->Physics->RigidBodies = Model.RigidBodies;
+	}
+
+	// UpdateRigCache() keeps the original PMX names by position, so reorder them to the kept bones
+	if (Session->Rig.IsValid() && Session->Rig->Bones.Num() == OldBoneCount)
+	{
+		TArray<FPmxRigBone> KeptBones;
+		KeptBones.Reserve(PruneResult.NewToOld.Num());
+		for (const int32 OldIndex : PruneResult.NewToOld)
+		{
+			KeptBones.Add(Session->Rig->Bones[OldIndex]);
+		}
+		Session->Rig->Bones = MoveTemp(KeptBones);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Pruned %d unused bones (%d -> %d), removed %d joint nodes"),
+		PruneResult.RemovedBones.Num(), OldBoneCount, Model.Bones.Num(), RemovedJointUids.Num());
+}
+
+void UPmxPipeline::GenerateMeshLods(UInterchangeBaseNodeContainer* BaseNodeContainer) const
+{
+	PMX_IMPORT_SCOPE("Generate LODs");
+
+	// Built here rather than in Translate() so they see the dialog options and the final vertex order
+	if (!Session.IsValid())
+	{
+		return;
+	}
+	Session->Lods.Reset();
+	// Read by the LOD payloads
+	Session->Options.LodMaxInfluences = FMath::Clamp(LodMaxInfluences, 0, FPmxSkinOptimizer::MaxInfluences);
+
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !bImportMesh || LodCount <= 0)
+	{
+		return;
+	}
+
+	const PmxPipelinePrivate::FBaseMeshNodes MeshNodes = PmxPipelinePrivate::FindBaseMeshNodes(BaseNodeContainer);
+	if (!MeshNodes.Lod0Mesh)
+	{
+		return;
+	}
+
+	FPmxLodSettings LodSettings;
+	LodSettings.NumLods = FMath::Clamp(LodCount, 0, 7);
+	LodSettings.ReductionRatio = FMath::Clamp(LodReductionRatio, 0.1f, 0.9f);
+	FPmxMeshSimplifier::BuildLodChain(*SessionModel, LodSettings, Session->Lods);
+
+	// Same skeleton, material slots and morph targets as LOD0; payloads are LOD0's prefixed with "PMX_LOD<n>:"
+	FString SkeletonUid;
+	MeshNodes.Lod0->GetCustomSkeletonUid(SkeletonUid);
+	TMap<FString, FString> SlotMaterialDependencies;
+	MeshNodes.Lod0Mesh->GetSlotMaterialDependencies(SlotMaterialDependencies);
+	TArray<FString> MorphUids;
+	MeshNodes.Lod0Mesh->GetMorphTargetDependencies(MorphUids);
+
+	for (int32 LodIdx = 1; LodIdx <= Session->Lods.Num(); ++LodIdx)
+	{
+		const FPmxMeshLod& Lod = Session->Lods[LodIdx - 1];
+
+		UInterchangeSkeletalMeshLodDataNode* LodNode = NewObject<UInterchangeSkeletalMeshLodDataNode>(BaseNodeContainer);
+		const FString LodUid = FString::Printf(TEXT("%s/LOD%d"), *MeshNodes.SkeletalMesh->GetUniqueID(), LodIdx);
+		LodNode->InitializeNode(LodUid, FString::Printf(TEXT("LOD%d"), LodIdx), EInterchangeNodeContainerType::TranslatedAsset);
+		LodNode->SetCustomSkeletonUid(SkeletonUid);
+		BaseNodeContainer->AddNode(LodNode);
+		MeshNodes.SkeletalMesh->AddLodDataUniqueId(LodUid);
+
+		TSet<int32> LodVertices;
+		LodVertices.Append(Lod.Indices);
+
+		UInterchangeMeshNode* LodMeshNode = NewObject<UInterchangeMeshNode>(BaseNodeContainer);
+		const FString LodMeshUid = FString::Printf(TEXT("/PMX/Meshes/LOD%d_Mesh"), LodIdx);
+		LodMeshNode->InitializeNode(LodMeshUid, FString::Printf(TEXT("PMX_LOD%d_Mesh"), LodIdx), EInterchangeNodeContainerType::TranslatedAsset);
+		LodMeshNode->SetSkinnedMesh(true);
+		LodMeshNode->SetPayLoadKey(FString::Printf(TEXT("PMX_LOD%d:PMX_GEOMETRY"), LodIdx), EInterchangeMeshPayLoadType::SKELETAL);
+		LodMeshNode->SetCustomVertexCount(LodVertices.Num());
+		LodMeshNode->SetCustomPolygonCount(FPmxMeshSimplifier::GetNumTriangles(Lod));
+		for (const TPair<FString, FString>& Slot : SlotMaterialDependencies)
+		{
+			LodMeshNode->SetSlotMaterialDependencyUid(Slot.Key, Slot.Value);
+		}
+		BaseNodeContainer->AddNode(LodMeshNode);
+		LodNode->AddLODMeshData(FInterchangeLODMeshData(LodMeshUid, FTransform::Identity));
+
+		for (const FString& MorphUid : MorphUids)
+		{
+			const UInterchangeMeshNode* MorphNode = Cast<UInterchangeMeshNode>(BaseNodeContainer->GetNode(MorphUid));
+			const TOptional<FInterchangeMeshPayLoadKey> MorphPayloadKey = MorphNode ? MorphNode->GetPayLoadKey() : TOptional<FInterchangeMeshPayLoadKey>();
+			FString MorphTargetName;
+			if (!MorphPayloadKey.IsSet() || !MorphNode->GetMorphTargetName(MorphTargetName))
+			{
+				continue;
+			}
+
+			UInterchangeMeshNode* LodMorphNode = NewObject<UInterchangeMeshNode>(BaseNodeContainer);
+			const FString LodMorphUid = FString::Printf(TEXT("/PMX/Morphs/LOD%d/%s"), LodIdx, *MorphTargetName);
+			LodMorphNode->InitializeNode(LodMorphUid, MorphTargetName, EInterchangeNodeContainerType::TranslatedAsset);
+			LodMorphNode->SetSkinnedMesh(true);
+			LodMorphNode->SetMorphTarget(true);
+			LodMorphNode->SetMorphTargetName(MorphTargetName);
+			LodMorphNode->SetPayLoadKey(FString::Printf(TEXT("PMX_LOD%d:%s"), LodIdx, *MorphPayloadKey->UniqueId), EInterchangeMeshPayLoadType::MORPHTARGET);
+			BaseNodeContainer->AddNode(LodMorphNode);
+			LodMeshNode->SetMorphTargetDependencyUid(LodMorphUid);
+		}
+	}
+}
+
+void UPmxPipeline::GenerateOutline(UInterchangeBaseNodeContainer* BaseNodeContainer) const
+{
+	PMX_IMPORT_SCOPE("Generate Outline");
+
+	// Built here rather than in Translate() so it sees the dialog options and the final vertex order
+	if (!Session.IsValid())
+	{
+		return;
+	}
+	Session->Outline = FPmxOutlineMesh();
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !bImportMesh || !bGenerateOutline)
+	{
+		return;
+	}
+
+	const PmxPipelinePrivate::FBaseMeshNodes MeshNodes = PmxPipelinePrivate::FindBaseMeshNodes(BaseNodeContainer);
+	if (!MeshNodes.Lod0Mesh)
+	{
+		return;
+	}
+
+	FPmxOutlineBuilder::BuildOutline(*SessionModel, FMath::Max(OutlineThickness, 0.0f), Session->Outline);
+	if (Session->Outline.IsEmpty())
+	{
+		return;
+	}
+
+	// One slot per edge color; the payload appends the hull after the model's vertices and triangles
+	TArray<FString> OutlineMaterialUids;
+	TArray<FString> OutlineSlotNames;
+	FPmxMaterialMapping::CreateOutlineMaterials(Session->Outline, *BaseNodeContainer, OutlineMaterialUids, OutlineSlotNames, ParentMaterial.GetAssetPathString());
+	for (int32 SectionIdx = 0; SectionIdx < OutlineSlotNames.Num(); ++SectionIdx)
+	{
+		MeshNodes.Lod0Mesh->SetSlotMaterialDependencyUid(OutlineSlotNames[SectionIdx], OutlineMaterialUids[SectionIdx]);
+	}
+	MeshNodes.Lod0Mesh->SetCustomVertexCount(SessionModel->Vertices.Num() + Session->Outline.SourceVertices.Num());
+	MeshNodes.Lod0Mesh->SetCustomPolygonCount(SessionModel->Indices.Num() / 3 + Session->Outline.GetNumTriangles());
+}
+
+void UPmxPipeline::UpdateRigCache() const
+{
+	PMX_IMPORT_SCOPE("Update Rig");
+
+	// Like the physics cache, the rig cache may have been built with default options in Translate()
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !Session->Rig.IsValid())
+	{
+		return;
+	}
+	const FPmxModel& Model = *SessionModel;
+
+	// Bone names in the cached model are final after UpdateBoneNames()
+	TArray<FString> BoneNames;
+	BoneNames.Reserve(Model.Bones.Num());
+	for (const FPmxBone& Bone : Model.Bones)
+	{
+		BoneNames.Add(Bone.Name);
+	}
+
+	const FPmxSkeletonLayout& Layout = Session->GetSkeletonLayout(Model);
+
+	// The cached model already carries final names; keep the original PMX names from the translator pass
+	FPmxRigDescription& RigDescription = *Session->Rig;
+	TArray<FString> SourceNames;
+	for (const FPmxRigBone& RigBone : RigDescription.Bones)
+	{
+		SourceNames.Add(RigBone.SourceName);
+	}
+
+	FPmxRigBuilder::BuildRigDescription(Model, Layout, BoneNames, bFixIKLinks, RigDescription);
+	if (SourceNames.Num() == RigDescription.Bones.Num())
+	{
+		for (int32 BoneIndex = 0; BoneIndex < SourceNames.Num(); ++BoneIndex)
+		{
+			RigDescription.Bones[BoneIndex].SourceName = SourceNames[BoneIndex];
+		}
+	}
+}
+
+void UPmxPipeline::UpdateSdefCache() const
+{
+	PMX_IMPORT_SCOPE("Update SDEF");
+
+	// Built here rather than in Translate() so it sees pruned bones and final names
+	if (Session.IsValid())
+	{
+		Session->Sdef.Reset();
+	}
+	if (!bImportMesh || !bImportArmature || !bImportSdef)
+	{
+		return;
+	}
+
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel)
+	{
+		return;
+	}
+	const FPmxModel& Model = *SessionModel;
+
+	TArray<FString> BoneNames;
+	BoneNames.Reserve(Model.Bones.Num());
+	for (const FPmxBone& Bone : Model.Bones)
+	{
+		BoneNames.Add(Bone.Name);
+	}
+
+	TSharedPtr<FPmxSdefDescription> SdefDescription = MakeShared<FPmxSdefDescription>();
+	if (!FPmxSdefBuilder::BuildSdefDescription(Model, BoneNames, FPmxSdefBuilder::GetPmxToMeshTransform(), *SdefDescription))
+	{
+		return;
+	}
+	SdefDescription->PackedUVChannel = 1;
+
+	Session->Sdef = SdefDescription;
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Cached %d SDEF vertices of %d (%d bones, UV channels %d-%d)"),
+		SdefDescription->Vertices.Num(), Model.Vertices.Num(), SdefDescription->Bones.Num(),
+		SdefDescription->PackedUVChannel, SdefDescription->PackedUVChannel + FPmxSdefDescription::NumPackedUVChannels - 1);
+}
+
+void UPmxPipeline::UpdateAddUVOptions() const
+{
+	if (!Session.IsValid())
+	{
+		return;
+	}
+
+	// Read by the mesh payload; Translate() runs before the dialog options are known
+	Session->Options.AddUVChannels = AddUVChannels & ((1 << FPmxVertexStreams::MaxAddUV) - 1);
+	Session->Options.bImportAddUV2AsVertexColors = bImportAddUV2AsVertexColors;
+
+	// The packed SDEF channels follow UV0, so only the channels after them are left for the selected AddUVs
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !Session->Sdef.IsValid() || Session->Options.AddUVChannels == 0)
+	{
+		return;
+	}
+	const int32 NumAddUV = FMath::Min<int32>(SessionModel->Header.AdditionalUVNum, FPmxVertexStreams::MaxAddUV);
+	const int32 NumSelected = FMath::CountBits(Session->Options.AddUVChannels & ((1 << NumAddUV) - 1));
+	const int32 NumFreeChannels = MAX_MESH_TEXTURE_COORDS_MD - Session->Sdef->PackedUVChannel - FPmxSdefDescription::NumPackedUVChannels;
+	if (NumSelected > NumFreeChannels)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: %d AddUVs selected but SDEF leaves %d UV channels, the rest will be skipped (disable Import SDEF to import them all)"),
+			NumSelected, NumFreeChannels);
+	}
+}
+
+void UPmxPipeline::UpdateDisplayCache() const
+{
+	PMX_IMPORT_SCOPE("Update Display");
+
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !Session->Display.IsValid())
+	{
+		return;
+	}
+	if (!bImportDisplay)
+	{
+		Session->Display.Reset();
+		return;
+	}
+	const FPmxModel& Model = *SessionModel;
+
+	// Display frame bone elements of the cached model are already remapped by PruneUnusedBones()
+	TArray<FString> BoneNames;
+	BoneNames.Reserve(Model.Bones.Num());
+	for (const FPmxBone& Bone : Model.Bones)
+	{
+		BoneNames.Add(Bone.Name);
+	}
+
+	FPmxDisplayBuilder::UpdateBoneGroups(Model, BoneNames, *Session->Display);
+}
+
+void UPmxPipeline::MatchSharedSkeleton(UInterchangeBaseNodeContainer* BaseNodeContainer)
+{
+	PMX_IMPORT_SCOPE("Match Shared Skeleton");
+
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel || !bImportArmature || !bShareCompatibleSkeletons)
+	{
+		return;
+	}
+
+	// Names are final and unused bones pruned at this point, so the fingerprint matches the skeleton that will be built
+	const FPmxSkeletonLayout& Layout = Session->GetSkeletonLayout(*SessionModel);
+	Session->SkeletonFingerprint = FPmxSkeletonMatcher::ComputeFingerprint(*SessionModel, Layout, SkeletonMatchTolerance);
+	if (Session->SkeletonFingerprint.IsEmpty())
+	{
+		return;
+	}
+
+	const FSoftObjectPath SharedSkeletonPath = GetDefault<UPmxSkeletonIndex>()->FindSkeleton(Session->SkeletonFingerprint);
+	Session->SharedSkeletonPath = SharedSkeletonPath;
+	if (SharedSkeletonPath.IsNull())
+	{
+		UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: No shared skeleton for fingerprint %s, a new skeleton will be registered"), *Session->SkeletonFingerprint);
+		return;
+	}
+
+	// The fingerprint quantizes positions and only covers the standard bones; the full check decides
+	const USkeleton* SharedSkeleton = Cast<USkeleton>(SharedSkeletonPath.TryLoad());
+	if (!SharedSkeleton)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Shared skeleton '%s' no longer exists, a new skeleton will be registered"), *SharedSkeletonPath.ToString());
+		Session->SharedSkeletonPath.Reset();
+		return;
+	}
 
-	// Advanced options
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::CleanModel, bCleanModel);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::RemoveDoubles, bRemoveDoubles);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::MarkSharpEdges, bMarkSharpEdges);
-	SourceNode->AddFloatAttribute(PmxPipelineAttributeKeys::SharpEdgeAngle, SharpEdgeAngle);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportAddUV2AsVertexColors, bImportAddUV2AsVertexColors);
-	SourceNode->AddBooleanAttribute(PmxPipelineAttributeKeys::ImportDisplay, bImportDisplay);
+	TArray<FString> ExtraBones;
+	FString Reason;
+	if (!FPmxSkeletonMatcher::CheckCompatibility(*SessionModel, Layout, SharedSkeleton->GetReferenceSkeleton(), SkeletonMatchTolerance, ExtraBones, Reason))
+	{
+		// Keep the registered skeleton for the models it fits; this one gets its own, unregistered
+		UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Fingerprint %s matches shared skeleton '%s' but the model is not compatible: %s. A separate skeleton will be created."),
+			*Session->SkeletonFingerprint, *SharedSkeletonPath.ToString(), *Reason);
+		Session->SharedSkeletonPath.Reset();
+		Session->SkeletonFingerprint.Reset();
+		return;
+	}
 
-	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline::StoreOptionsToSourceNode - Scale=%.2f, ShapeScale=%.2f, SphereScale=%.2f, BoxScale=%.2f, CapsuleScale=%.2f"),
-		Scale, PhysicsShapeScale, PhysicsSphereScale, PhysicsBoxScale, PhysicsCapsuleScale);
+	BaseNodeContainer->IterateNodesOfType<UInterchangeSkeletonFactoryNode>([&SharedSkeletonPath](const FString& NodeUid, UInterchangeSkeletonFactoryNode* SkeletonNode)
+	{
+		SkeletonNode->SetCustomReferenceObject(SharedSkeletonPath);
+		SkeletonNode->SetEnabled(false);
+	});
+	BaseNodeContainer->IterateNodesOfType<UInterchangeSkeletalMeshFactoryNode>([&SharedSkeletonPath](const FString& NodeUid, UInterchangeSkeletalMeshFactoryNode* SkeletalMeshNode)
+	{
+		SkeletalMeshNode->SetCustomSkeletonSoftObjectPath(SharedSkeletonPath);
+	});
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Sharing skeleton '%s' (fingerprint %s)"), *SharedSkeletonPath.ToString(), *Session->SkeletonFingerprint);
 }
 
 void UPmxPipeline::UpdatePhysicsCacheOptions() const
 {
-	// Update all physics caches with current pipeline options
-	// This is necessary because Translate() may have already created caches with default values
-	// before ExecutePipeline() is called with user-modified options
+	PMX_IMPORT_SCOPE("Update Physics Options");
 
-	int32 UpdatedCount = 0;
-	for (auto& CachePair : UPmxTranslator::PhysicsPayloadCache)
-	{
-		if (CachePair.Value.IsValid())
-		{
-			FPmxPhysicsCache& Cache = *CachePair.Value;
-
-			// Update scale options
-			Cache.Scale = Scale;
-			Cache.ShapeScale = PhysicsShapeScale;
-			Cache.SphereScale = PhysicsSphereScale;
-			Cache.BoxScale = PhysicsBoxScale;
-			Cache.CapsuleScale = PhysicsCapsuleScale;
-
-			// Update other physics options
-			Cache.Type2Mode = PhysicsType2Mode;
-			Cache.MassScale = PhysicsMassScale;
-			Cache.DampingScale = PhysicsDampingScale;
-			Cache.bForceStandardBonesKinematic = bForceStandardBonesKinematic;
-			Cache.bForceNonStandardBonesSimulated = bForceNonStandardBonesSimulated;
-
-			// Update collision filtering options
-			Cache.bDisableConstraintBodyCollision = bDisableConstraintBodyCollision;
-			Cache.bUsePmxCollisionGroups = bUsePmxCollisionGroups;
-			Cache.bEnableStandardNonStandardCollision = bEnableStandardNonStandardCollision;
-
-			// Update constraint scale options
-			Cache.ConstraintStiffnessScale = ConstraintStiffnessScale;
-			Cache.ConstraintDampingScale = ConstraintDampingScale;
-			Cache.MaxAngularLimit = MaxAngularLimit;
-			Cache.bForceAllLinearMotionLocked = bForceAllLinearMotionLocked;
-			Cache.bDisableLinearSpringDrive = bDisableLinearSpringDrive;
-			Cache.LinearMotionTolerance = LinearMotionTolerance;
-
-			// Constraint mode options (Phase 2)
-			Cache.ConstraintMode = ConstraintMode;
-			Cache.bLockAllLinearMotion = bLockAllLinearMotion;
-			Cache.OverrideAngularMotion = OverrideAngularMotion;
-			Cache.OverrideSwing1Limit = OverrideSwing1Limit;
-			Cache.OverrideSwing2Limit = OverrideSwing2Limit;
-			Cache.OverrideTwistLimit = OverrideTwistLimit;
-
-			// Soft Constraint options
-			Cache.bUseSoftConstraint = bUseSoftConstraint;
-			Cache.SoftConstraintStiffness = SoftConstraintStiffness;
-			Cache.SoftConstraintDamping = SoftConstraintDamping;
-
-			// Long chain optimization - hardcoded defaults (not exposed in UI)
-			// These options have minimal impact and add unnecessary complexity
-			Cache.bOptimizeForLongChains = true;
-			Cache.bEnableProjection = true;
-			Cache.ProjectionLinearTolerance = 1.0f;
-			Cache.ProjectionAngularTolerance = 10.0f;
-			Cache.bAutoParentDominates = false;
-			Cache.bEnableMassConditioning = false;
-			Cache.ContactTransferScale = 0.3f;
-
-			UpdatedCount++;
-		}
-	}
-
-	if (UpdatedCount > 0)
+	// Update the session physics cache with current pipeline options
+	// This is necessary because Translate() may have already created it with default values
+	// before ExecutePipeline() is called with user-modified options
+	if (!Session.IsValid() || !Session->Physics.IsValid())
 	{
-		UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Updated %d physics cache(s) with pipeline options (ShapeScale=%.2f, BoxScale=%.2f)"),
-			UpdatedCount, PhysicsShapeScale, PhysicsBoxScale);
+		return;
 	}
+	FPmxPhysicsCache& Cache = *Session->Physics;
+
+	// Update scale options
+	Cache.Scale = Scale;
+	Cache.ShapeScale = PhysicsShapeScale;
+	Cache.SphereScale = PhysicsSphereScale;
+	Cache.BoxScale = PhysicsBoxScale;
+	Cache.CapsuleScale = PhysicsCapsuleScale;
+
+	// Update other physics options
+	Cache.Type2Mode = PhysicsType2Mode;
+	Cache.MassScale = PhysicsMassScale;
+	Cache.DampingScale = PhysicsDampingScale;
+	Cache.bForceStandardBonesKinematic = bForceStandardBonesKinematic;
+	Cache.bForceNonStandardBonesSimulated = bForceNonStandardBonesSimulated;
+
+	// Update collision filtering options
+	Cache.bDisableConstraintBodyCollision = bDisableConstraintBodyCollision;
+	Cache.bUsePmxCollisionGroups = bUsePmxCollisionGroups;
+	Cache.bEnableStandardNonStandardCollision = bEnableStandardNonStandardCollision;
+
+	// Update constraint scale options
+	Cache.ConstraintStiffnessScale = ConstraintStiffnessScale;
+	Cache.ConstraintDampingScale = ConstraintDampingScale;
+	Cache.MaxAngularLimit = MaxAngularLimit;
+	Cache.bForceAllLinearMotionLocked = bForceAllLinearMotionLocked;
+	Cache.bDisableLinearSpringDrive = bDisableLinearSpringDrive;
+	Cache.LinearMotionTolerance = LinearMotionTolerance;
+
+	// Constraint mode options (Phase 2)
+	Cache.ConstraintMode = ConstraintMode;
+	Cache.bLockAllLinearMotion = bLockAllLinearMotion;
+	Cache.OverrideAngularMotion = OverrideAngularMotion;
+	Cache.OverrideSwing1Limit = OverrideSwing1Limit;
+	Cache.OverrideSwing2Limit = OverrideSwing2Limit;
+	Cache.OverrideTwistLimit = OverrideTwistLimit;
+
+	// Soft Constraint options
+	Cache.bUseSoftConstraint = bUseSoftConstraint;
+	Cache.SoftConstraintStiffness = SoftConstraintStiffness;
+	Cache.SoftConstraintDamping = SoftConstraintDamping;
+
+	// Long chain optimization - hardcoded defaults (not exposed in UI)
+	// These options have minimal impact and add unnecessary complexity
+	Cache.bOptimizeForLongChains = true;
+	Cache.bEnableProjection = true;
+	Cache.ProjectionLinearTolerance = 1.0f;
+	Cache.ProjectionAngularTolerance = 10.0f;
+	Cache.bAutoParentDominates = false;
+	Cache.bEnableMassConditioning = false;
+	Cache.ContactTransferScale = 0.3f;
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Updated physics cache with pipeline options (ShapeScale=%.2f, BoxScale=%.2f)"),
+		PhysicsShapeScale, PhysicsBoxScale);
 }
 
 void UPmxPipeline::ConfigureFactoryNodes(UInterchangeBaseNodeContainer* BaseNodeContainer) const
 {
+	PMX_IMPORT_SCOPE("Configure Factory Nodes");
+
 	// Configure SkeletalMesh factory nodes
 	BaseNodeContainer->IterateNodesOfType<UInterchangeSkeletalMeshFactoryNode>(
 		[this](const FString& NodeUid, UInterchangeSkeletalMeshFactoryNode* SkeletalMeshNode)
@@ -356,6 +931,16 @@ void UPmxPipeline::ConfigureFactoryNodes(UInterchangeBaseNodeContainer* BaseNode
 				SkeletalMeshNode->SetCustomRecomputeTangents(bRecomputeTangents);
 				SkeletalMeshNode->SetCustomUseMikkTSpace(bUseMikkTSpace);
 
+				// Packed SDEF centers are positions; half precision UVs would lose them
+				if (Session.IsValid() && Session->Sdef.IsValid())
+				{
+					SkeletalMeshNode->SetCustomUseFullPrecisionUVs(true);
+				}
+				else if (AddUVChannels != 0)
+				{
+					SkeletalMeshNode->SetCustomUseFullPrecisionUVs(!bAddUVHalfPrecision);
+				}
+
 				UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxPipeline: Configured SkeletalMeshFactoryNode '%s' (Morphs=%d, Physics=%d, RecomputeNormals=%d, RecomputeTangents=%d, MikkTSpace=%d)"),
 					*NodeUid, bImportMorphs, bImportPhysics, bRecomputeNormals, bRecomputeTangents, bUseMikkTSpace);
 			}
@@ -377,6 +962,8 @@ void UPmxPipeline::ConfigureFactoryNodes(UInterchangeBaseNodeContainer* BaseNode
 
 void UPmxPipeline::CreateTextureFactoryNodes(UInterchangeBaseNodeContainer* BaseNodeContainer) const
 {
+    PMX_IMPORT_SCOPE("Texture Factory Nodes");
+
     // Collect node snapshots first since we'll be modifying the container
     TArray<UInterchangeTexture2DNode*> TextureNodes;
     TextureNodes.Reserve(64);
@@ -409,6 +996,13 @@ void UPmxPipeline::CreateTextureFactoryNodes(UInterchangeBaseNodeContainer* Base
         // Set translated node UID (required for payload retrieval)
         FactoryNode->SetCustomTranslatedTextureNodeUid(NodeUid);
 
+        // Manifest section for incremental reimport
+        FString ManifestSection;
+        if (TextureNode->GetStringAttribute(FPmxManifestBuilder::SectionAttributeKey, ManifestSection))
+        {
+            FactoryNode->AddStringAttribute(FPmxManifestBuilder::SectionAttributeKey, ManifestSection);
+        }
+
         // Bidirectional connection
         FactoryNode->AddTargetNodeUid(NodeUid);
         TextureNode->AddTargetNodeUid(FactoryUid);
@@ -454,6 +1048,8 @@ void UPmxPipeline::CreateTextureFactoryNodes(UInterchangeBaseNodeContainer* Base
 
 void UPmxPipeline::CreateMaterialFactoryNodes(UInterchangeBaseNodeContainer* BaseNodeContainer) const
 {
+    PMX_IMPORT_SCOPE("Material Factory Nodes");
+
     // Collect node snapshots first since we'll be modifying the container
     TArray<UInterchangeMaterialInstanceNode*> MaterialNodes;
     MaterialNodes.Reserve(64);
@@ -498,6 +1094,13 @@ void UPmxPipeline::CreateMaterialFactoryNodes(UInterchangeBaseNodeContainer* Bas
             FactoryNode->SetCustomParent(ParentPath);
         }
 
+        // Manifest section for incremental reimport
+        FString ManifestSection;
+        if (MaterialNode->GetStringAttribute(FPmxManifestBuilder::SectionAttributeKey, ManifestSection))
+        {
+            FactoryNode->AddStringAttribute(FPmxManifestBuilder::SectionAttributeKey, ManifestSection);
+        }
+
         // Set instance class (use MaterialInstanceConstant in editor)
         FactoryNode->SetCustomInstanceClassName(UMaterialInstanceConstant::StaticClass()->GetPathName());
 
@@ -590,6 +1193,11 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 		return;
 	}
 
+	ON_SCOPE_EXIT { WriteImportReport(); };
+	PMX_IMPORT_ROOT_SCOPE("Post Import", Session.IsValid() ? Session->Profiler : nullptr);
+
+	UpdateImportManifest(BaseNodeContainer, NodeKey, CreatedAsset);
+
 	// Handle Material Instance parameter setting (workaround for missing Factory API)
 	if (UMaterialInstanceConstant* MI = Cast<UMaterialInstanceConstant>(CreatedAsset))
 	{
@@ -610,7 +1218,10 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 
 			if (MaterialNode)
 			{
-				// Set Textures
+				PmxPipelinePrivate::FMaterialParameters Parameters;
+				Parameters.NodeLabel = MaterialNode->GetDisplayLabel();
+
+				// Textures
 				FString TextureUid;
 				if (MaterialNode->GetTextureParameterValue(TEXT("BaseColorTexture"), TextureUid))
 				{
@@ -624,37 +1235,7 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 							// Only proceed if texture path is valid and not empty
 							if (TexPath.IsValid() && !TexPath.ToString().IsEmpty())
 							{
-								// Retry logic for texture loading
-								UTexture* Texture = nullptr;
-								int32 MaxRetries = 5;
-								for (int32 Retry = 0; Retry < MaxRetries && !Texture; ++Retry)
-								{
-									if (Retry > 0)
-									{
-										// Wait a bit before retrying (not on first attempt)
-										FPlatformProcess::Sleep(0.1f); // 100ms
-									}
-
-									Texture = Cast<UTexture>(TexPath.TryLoad());
-
-									if (!Texture)
-									{
-										UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxPipeline: Texture load retry %d/%d for '%s'"),
-											Retry + 1, MaxRetries, *TexPath.ToString());
-									}
-								}
-
-								if (Texture)
-								{
-									MI->SetTextureParameterValueEditorOnly(FName("BaseColorTexture"), Texture);
-									UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Successfully set BaseColorTexture for MI '%s'"),
-										*MI->GetName());
-								}
-								else
-								{
-									UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Failed to load texture '%s' after %d retries for MI '%s'"),
-										*TexPath.ToString(), MaxRetries, *MI->GetName());
-								}
+								Parameters.BaseColorTexture = TexPath;
 							}
 							else
 							{
@@ -665,59 +1246,158 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 					}
 				}
 
-				// Set Scalars
-				auto ApplyScalar = [&](const FString& ParamName)
+				// Scalars
+				auto GatherScalar = [&](const FString& ParamName)
 				{
 					float Val;
 					if (MaterialNode->GetScalarParameterValue(ParamName, Val))
 					{
-						MI->SetScalarParameterValueEditorOnly(FName(*ParamName), Val);
+						Parameters.Scalars.Emplace(FName(*ParamName), Val);
 					}
 				};
-				ApplyScalar(TEXT("Opacity"));
-				ApplyScalar(TEXT("pmx.mat.index"));
-				ApplyScalar(TEXT("pmx.sphere.mode"));
-				ApplyScalar(TEXT("pmx.edge.size"));
-				ApplyScalar(TEXT("pmx.specular.power"));
-
-				// Set Vectors
-				auto ApplyVector = [&](const FString& ParamName)
+				GatherScalar(TEXT("Opacity"));
+				GatherScalar(TEXT("pmx.mat.index"));
+				GatherScalar(TEXT("pmx.sphere.mode"));
+				GatherScalar(TEXT("pmx.edge.size"));
+				GatherScalar(TEXT("pmx.specular.power"));
+
+				// Vectors
+				auto GatherVector = [&](const FString& ParamName)
 				{
 					FLinearColor Val;
 					if (MaterialNode->GetVectorParameterValue(ParamName, Val))
 					{
-						MI->SetVectorParameterValueEditorOnly(FName(*ParamName), Val);
+						Parameters.Vectors.Emplace(FName(*ParamName), Val);
 					}
 				};
-				ApplyVector(TEXT("BaseColorTint"));
-				ApplyVector(TEXT("pmx.edge.color"));
-				ApplyVector(TEXT("pmx.specular.rgb"));
-				ApplyVector(TEXT("pmx.ambient.rgb"));
+				GatherVector(TEXT("BaseColorTint"));
+				GatherVector(TEXT("pmx.edge.color"));
+				GatherVector(TEXT("pmx.specular.rgb"));
+				GatherVector(TEXT("pmx.ambient.rgb"));
 
-				// Set Static Switches
-				auto ApplySwitch = [&](const FString& ParamName)
+				// Static Switches
+				auto GatherSwitch = [&](const FString& ParamName)
 				{
 					bool Val;
 					if (MaterialNode->GetStaticSwitchParameterValue(ParamName, Val))
 					{
-						MI->SetStaticSwitchParameterValueEditorOnly(FName(*ParamName), Val);
+						Parameters.StaticSwitches.Emplace(FName(*ParamName), Val);
 					}
 				};
-				ApplySwitch(TEXT("bTwoSided"));
-				ApplySwitch(TEXT("bTranslucentHint"));
-				ApplySwitch(TEXT("pmx.toon.mode"));
-				ApplySwitch(TEXT("pmx.edge.draw"));
+				GatherSwitch(TEXT("bTwoSided"));
+				GatherSwitch(TEXT("bTranslucentHint"));
+				GatherSwitch(TEXT("pmx.toon.mode"));
+				GatherSwitch(TEXT("pmx.edge.draw"));
+				GatherSwitch(TEXT("pmx.outline"));
+
+				// Applied from the post-import queue: the texture may be created after this material, and
+				// waiting for it here would stall the game thread (the queue retries the step on later ticks instead)
+				FPmxPostImportQueue::Enqueue(MI->GetName(), Session.IsValid() ? Session->Profiler : nullptr,
+					[WeakMI = TWeakObjectPtr<UMaterialInstanceConstant>(MI), Parameters = MoveTemp(Parameters), FirstAttemptTime = 0.0](double EndTime) mutable
+					{
+						UMaterialInstanceConstant* MaterialInstance = WeakMI.Get();
+						if (!MaterialInstance)
+						{
+							return true;
+						}
+
+						// Set Textures (retried until the texture exists or the timeout passes)
+						if (!Parameters.BaseColorTexture.IsNull())
+						{
+							const double Now = FPlatformTime::Seconds();
+							if (FirstAttemptTime == 0.0)
+							{
+								FirstAttemptTime = Now;
+							}
+
+							UTexture* Texture = Cast<UTexture>(Parameters.BaseColorTexture.TryLoad());
+							if (Texture)
+							{
+								MaterialInstance->SetTextureParameterValueEditorOnly(FName("BaseColorTexture"), Texture);
+								UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Successfully set BaseColorTexture for MI '%s'"),
+									*MaterialInstance->GetName());
+							}
+							else if (Now - FirstAttemptTime < PmxPipelinePrivate::TextureLoadTimeout)
+							{
+								UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxPipeline: Texture '%s' not loaded yet for MI '%s', retrying"),
+									*Parameters.BaseColorTexture.ToString(), *MaterialInstance->GetName());
+								return false;
+							}
+							else
+							{
+								UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Failed to load texture '%s' within %.1f s for MI '%s'"),
+									*Parameters.BaseColorTexture.ToString(), PmxPipelinePrivate::TextureLoadTimeout, *MaterialInstance->GetName());
+							}
+						}
+
+						for (const TPair<FName, float>& Scalar : Parameters.Scalars)
+						{
+							MaterialInstance->SetScalarParameterValueEditorOnly(Scalar.Key, Scalar.Value);
+						}
+						for (const TPair<FName, FLinearColor>& Vector : Parameters.Vectors)
+						{
+							MaterialInstance->SetVectorParameterValueEditorOnly(Vector.Key, Vector.Value);
+						}
+						for (const TPair<FName, bool>& Switch : Parameters.StaticSwitches)
+						{
+							MaterialInstance->SetStaticSwitchParameterValueEditorOnly(Switch.Key, Switch.Value);
+						}
 
-				UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxPipeline: Configured MaterialInstance '%s' from Node '%s'"), *MI->GetName(), *MaterialNode->GetDisplayLabel());
+						UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxPipeline: Configured MaterialInstance '%s' from Node '%s'"), *MaterialInstance->GetName(), *Parameters.NodeLabel);
+						return true;
+					});
 			}
 		}
 
 		return;
 	}
 
+	// Handle SDEF data and PMX rig asset creation (IK chains and append links)
 	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(CreatedAsset))
 	{
-		RenameLRBones(SkeletalMesh);
+		const FString MeshName = SkeletalMesh->GetName();
+		FinalizeSharedSkeleton(SkeletalMesh);
+
+		// Consumed here so the data of this import is applied once
+		TSharedPtr<FPmxSdefDescription> SdefDescription;
+		TSharedPtr<FPmxDisplayDescription> DisplayDescription;
+		TSharedPtr<FPmxRigDescription> RigDescription;
+		if (Session.IsValid())
+		{
+			SdefDescription = MoveTemp(Session->Sdef);
+			DisplayDescription = MoveTemp(Session->Display);
+			RigDescription = MoveTemp(Session->Rig);
+		}
+
+		if (SdefDescription.IsValid())
+		{
+			AttachPmxSdefData(SkeletalMesh, *SdefDescription);
+		}
+		else if (SkeletalMesh->GetAssetUserData<UPmxSdefUserData>())
+		{
+			// Reimported without SDEF: drop stale data
+			SkeletalMesh->RemoveUserDataOfClass(UPmxSdefUserData::StaticClass());
+		}
+
+		if (DisplayDescription.IsValid())
+		{
+			AttachPmxDisplayData(SkeletalMesh, *DisplayDescription);
+		}
+		else if (SkeletalMesh->GetAssetUserData<UPmxDisplayUserData>())
+		{
+			SkeletalMesh->RemoveUserDataOfClass(UPmxDisplayUserData::StaticClass());
+		}
+
+		if (!RigDescription.IsValid())
+		{
+			UE_LOG(LogPMXImporter, Log, TEXT("UPmxPipeline: No PMX rig cache found for '%s'"), *MeshName);
+			return;
+		}
+
+		if (bImportArmature && bCreateRigAsset && !RigDescription->IsEmpty())
+		{
+			CreatePmxRigAsset(SkeletalMesh, *RigDescription);
+		}
 		return;
 	}
 
@@ -772,33 +1452,19 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 
 		// Look for cached PMX physics data
 		const FString MeshName = SkeletalMesh->GetName();
-		TSharedPtr<FPmxPhysicsCache>* FoundCache = UPmxTranslator::PhysicsPayloadCache.Find(MeshName);
+		TSharedPtr<FPmxPhysicsCache> PhysicsCache = Session.IsValid() ? Session->Physics : nullptr;
 
-		if (FoundCache && FoundCache->IsValid())
+		if (PhysicsCache.IsValid())
 		{
 			// Set the preview skeletal mesh BEFORE building physics asset
 			// This is critical for proper bone name resolution
 			PhysicsAsset->SetPreviewMesh(SkeletalMesh, false);
 
-			// Build physics asset from PMX data
-			BuildPmxPhysicsAsset(PhysicsAsset, SkeletalMesh, **FoundCache);
-
-			// Link physics asset to skeletal mesh
-			SkeletalMesh->SetPhysicsAsset(PhysicsAsset);
-
-			// Post-processing: Refresh physics asset to update all dependent components
-			#if WITH_EDITOR
-			PhysicsAsset->RefreshPhysicsAssetChange();
-			#endif
-
-			// Mark assets as dirty so they get saved
-			PhysicsAsset->MarkPackageDirty();
-			SkeletalMesh->MarkPackageDirty();
-
-			// Remove from cache after use
-			UPmxTranslator::PhysicsPayloadCache.Remove(MeshName);
+			// Build physics asset from PMX data (linked to the mesh once the queued build completes)
+			BuildPmxPhysicsAsset(PhysicsAsset, SkeletalMesh, PhysicsCache.ToSharedRef());
 
-			UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Built PhysicsAsset for '%s'"), *MeshName);
+			// Remove from the session after use
+			Session->Physics.Reset();
 		}
 		else
 		{
@@ -806,38 +1472,187 @@ void UPmxPipeline::ExecutePostImportPipeline(const UInterchangeBaseNodeContainer
 		}
 
 
-		if (bRenameLRBones)
+		return;
+	}
+}
+
+void UPmxPipeline::ApplyIncrementalReimport(UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& ContentBasePath) const
+{
+	PMX_IMPORT_SCOPE("Incremental Reimport");
+
+	if (!Session.IsValid() || !Session->Manifest.IsValid())
+	{
+		return;
+	}
+
+	FPmxImportManifest& NewManifest = *Session->Manifest;
+	FPmxManifestBuilder::AddOptionsSections(*this, NewManifest);
+
+	// Sections each factory node is built from; nodes not listed here are always rebuilt
+	Session->ManifestNodeSections.Reset();
+	BaseNodeContainer->IterateNodesOfType<UInterchangeFactoryBaseNode>(
+		[this](const FString& NodeUid, UInterchangeFactoryBaseNode* FactoryNode)
 		{
-			bool bChanged = false;
-			for (USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
+			// Options sections: only the stages that build the node (the mesh post-import also builds the rig and display data)
+			TArray<FString> Sections;
+			FString OwnSection;
+			if (FactoryNode->IsA<UInterchangeSkeletalMeshFactoryNode>() || (FactoryNode->IsA<UInterchangeSkeletonFactoryNode>() && !Session->SharedSkeletonPath.IsValid()))
 			{
-				if (BodySetup->BoneName.ToString().StartsWith(TEXT("左")))
-				{
-					BodySetup->BoneName = FName(BodySetup->BoneName.ToString().RightChop(1) + TEXT("_L"));
-					bChanged = true;
-				}
-				else if (BodySetup->BoneName.ToString().StartsWith(TEXT("右")))
-				{
-					BodySetup->BoneName = FName(BodySetup->BoneName.ToString().RightChop(1) + TEXT("_R"));
-					bChanged = true;
-				}
+				Sections.Append({ FPmxManifestBuilder::OptionsSection(FPmxManifestBuilder::GeometryStage), FPmxManifestBuilder::OptionsSection(FPmxManifestBuilder::SkeletonStage),
+					FPmxManifestBuilder::OptionsSection(FPmxManifestBuilder::MorphStage) });
+				Sections.Append({ FPmxManifestBuilder::VerticesSection, FPmxManifestBuilder::IndicesSection, FPmxManifestBuilder::BonesSection,
+					FPmxManifestBuilder::MaterialSlotsSection, FPmxManifestBuilder::DisplayFramesSection, FPmxManifestBuilder::MorphSectionPrefix });
 			}
+			else if (FactoryNode->IsA<UInterchangePhysicsAssetFactoryNode>())
+			{
+				Sections.Add(FPmxManifestBuilder::OptionsSection(FPmxManifestBuilder::PhysicsStage));
+				Sections.Append({ FPmxManifestBuilder::BonesSection, FPmxManifestBuilder::BodiesSection, FPmxManifestBuilder::JointsSection });
+			}
+			else if (FactoryNode->GetStringAttribute(FPmxManifestBuilder::SectionAttributeKey, OwnSection))
+			{
+				const bool bTexture = OwnSection.StartsWith(FPmxManifestBuilder::TextureSectionPrefix);
+				Sections.Add(FPmxManifestBuilder::OptionsSection(bTexture ? FPmxManifestBuilder::TextureStage : FPmxManifestBuilder::MaterialStage));
+				Sections.Add(OwnSection);
+			}
+			else
+			{
+				return;
+			}
+			Session->ManifestNodeSections.Add(NodeUid, MoveTemp(Sections));
+		});
+
+	if (!bIncrementalReimport)
+	{
+		return;
+	}
+
+	// The mesh of a previous import of the same file; only meshes already in memory are considered
+	// (ExecutePipeline may run off the game thread and must not load packages)
+	FString FolderPath = ContentBasePath;
+	FolderPath.RemoveFromEnd(TEXT("/"));
+	TArray<FAssetData> Assets;
+	IAssetRegistry::GetChecked().GetAssetsByPath(FName(*FolderPath), Assets, false, false);
+	const UPmxImportManifestUserData* OldManifestData = nullptr;
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (AssetData.AssetClassPath != USkeletalMesh::StaticClass()->GetClassPathName())
+		{
+			continue;
+		}
+		USkeletalMesh* ExistingMesh = Cast<USkeletalMesh>(AssetData.FastGetAsset(false));
+		const UPmxImportManifestUserData* ManifestData = ExistingMesh ? ExistingMesh->GetAssetUserData<UPmxImportManifestUserData>() : nullptr;
+		if (ManifestData && ManifestData->Manifest.SourceFile == NewManifest.SourceFile)
+		{
+			OldManifestData = ManifestData;
+			break;
+		}
+	}
+	if (!OldManifestData || OldManifestData->Manifest.IsEmpty())
+	{
+		return;
+	}
+
+	const FPmxImportManifest& OldManifest = OldManifestData->Manifest;
+	const TSet<FString> ChangedSections = FPmxManifestBuilder::DiffManifests(OldManifest, NewManifest);
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	TArray<FString> RebuiltNodes;
+	int32 NumSkipped = 0;
+	for (const TPair<FString, TArray<FString>>& Pair : Session->ManifestNodeSections)
+	{
+		UInterchangeFactoryBaseNode* FactoryNode = BaseNodeContainer->GetFactoryNode(Pair.Key);
+		const FSoftObjectPath* ExistingAsset = OldManifest.NodeAssets.Find(Pair.Key);
+		if (!FactoryNode || !ExistingAsset || !AssetRegistry.GetAssetByObjectPath(*ExistingAsset).IsValid()
+			|| FPmxManifestBuilder::IsAnyChanged(ChangedSections, Pair.Value))
+		{
+			RebuiltNodes.Add(Pair.Key);
+			continue;
+		}
+
+		// Unchanged: keep the existing asset; dependent nodes (mesh material slots, physics mesh) resolve it through the reference
+		FactoryNode->SetSkipNodeImport();
+		FactoryNode->SetCustomReferenceObject(*ExistingAsset);
+		++NumSkipped;
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Incremental reimport of '%s' - %d changed sections, %d assets unchanged, rebuilding %d: %s"),
+		*FPaths::GetCleanFilename(NewManifest.SourceFile), ChangedSections.Num(), NumSkipped, RebuiltNodes.Num(), *FString::Join(RebuiltNodes, TEXT(", ")));
+}
+
+void UPmxPipeline::UpdateImportManifest(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& NodeKey, UObject* CreatedAsset) const
+{
+	PMX_IMPORT_SCOPE("Update Manifest");
 
-			if (bChanged)
+	if (!Session.IsValid() || !Session->Manifest.IsValid())
+	{
+		return;
+	}
+
+	if (USkeletalMesh* SkeletalMesh = Cast<USkeletalMesh>(CreatedAsset))
+	{
+		// Full manifest of this import with the asset every node created or kept
+		UPmxImportManifestUserData* ManifestData = SkeletalMesh->GetAssetUserData<UPmxImportManifestUserData>();
+		if (!ManifestData)
+		{
+			ManifestData = NewObject<UPmxImportManifestUserData>(SkeletalMesh, NAME_None, RF_Transactional);
+			SkeletalMesh->AddAssetUserData(ManifestData);
+		}
+		ManifestData->Manifest = *Session->Manifest;
+		for (const TPair<FString, TArray<FString>>& Pair : Session->ManifestNodeSections)
+		{
+			const UInterchangeFactoryBaseNode* FactoryNode = BaseNodeContainer->GetFactoryNode(Pair.Key);
+			FSoftObjectPath AssetPath;
+			if (FactoryNode && FactoryNode->GetCustomReferenceObject(AssetPath) && AssetPath.IsValid())
 			{
-				// Force the physics asset to re-initialize constraints/bodies
-				PhysicsAsset->UpdateBodySetupIndexMap();
-				PhysicsAsset->UpdateBoundsBodiesArray();
-				PhysicsAsset->MarkPackageDirty();
+				ManifestData->Manifest.NodeAssets.Add(Pair.Key, AssetPath);
 			}
 		}
+		ManifestData->Manifest.NodeAssets.Add(NodeKey, FSoftObjectPath(SkeletalMesh));
+		SkeletalMesh->MarkPackageDirty();
+		return;
+	}
 
+	// Other assets refresh their own sections in the mesh's manifest (the mesh itself may have been skipped)
+	const TArray<FString>* Sections = Session->ManifestNodeSections.Find(NodeKey);
+	if (!Sections)
+	{
 		return;
 	}
+	TArray<FString> MeshNodeUids;
+	BaseNodeContainer->GetNodes(UInterchangeSkeletalMeshFactoryNode::StaticClass(), MeshNodeUids);
+	const UInterchangeFactoryBaseNode* MeshFactoryNode = MeshNodeUids.Num() > 0 ? BaseNodeContainer->GetFactoryNode(MeshNodeUids[0]) : nullptr;
+	FSoftObjectPath MeshPath;
+	USkeletalMesh* SkeletalMesh = MeshFactoryNode && MeshFactoryNode->GetCustomReferenceObject(MeshPath) ? Cast<USkeletalMesh>(MeshPath.ResolveObject()) : nullptr;
+	UPmxImportManifestUserData* ManifestData = SkeletalMesh ? SkeletalMesh->GetAssetUserData<UPmxImportManifestUserData>() : nullptr;
+	if (!ManifestData)
+	{
+		return;
+	}
+
+	FPmxImportManifest& Manifest = ManifestData->Manifest;
+	for (const FString& Section : *Sections)
+	{
+		if (const uint64* Hash = Session->Manifest->SectionHashes.Find(Section))
+		{
+			Manifest.SectionHashes.Add(Section, *Hash);
+		}
+	}
+	Manifest.NodeAssets.Add(NodeKey, FSoftObjectPath(CreatedAsset));
+	SkeletalMesh->MarkPackageDirty();
+}
+
+void UPmxPipeline::WriteImportReport() const
+{
+	if (Session.IsValid() && Session->Profiler.IsValid() && FPmxImportProfiler::IsReportEnabled())
+	{
+		Session->Profiler->WriteReport(Session->Profiler->GetReportPath());
+	}
 }
 
-void UPmxPipeline::BuildPmxPhysicsAsset(UPhysicsAsset* PhysicsAsset, USkeletalMesh* SkeletalMesh, const FPmxPhysicsCache& PhysicsData) const
+void UPmxPipeline::BuildPmxPhysicsAsset(UPhysicsAsset* PhysicsAsset, USkeletalMesh* SkeletalMesh, const TSharedRef<FPmxPhysicsCache>& PhysicsData) const
 {
+	PMX_IMPORT_SCOPE("Physics Asset");
+
 	if (!PhysicsAsset || !SkeletalMesh)
 	{
 		return;
@@ -850,11 +1665,184 @@ void UPmxPipeline::BuildPmxPhysicsAsset(UPhysicsAsset* PhysicsAsset, USkeletalMe
 			*SkeletalMesh->GetName());
 	}
 
-	// Delegate to the physics builder
-	FPmxPhysicsBuilder::BuildPhysicsAsset(PhysicsAsset, SkeletalMesh, PhysicsData);
+	// Shapes, constraint frames and collision pair filtering are planned on a worker from a copy of the
+	// reference skeleton; only the UObject creation is left to the game thread, in budgeted slices
+	const TSharedPtr<FPmxImportProfiler> Profiler = Session.IsValid() ? Session->Profiler : nullptr;
+	const TSharedRef<PmxPipelinePrivate::FPhysicsBuild> Build = MakeShared<PmxPipelinePrivate::FPhysicsBuild>();
+
+	const UE::Tasks::FTask PlanTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Build, RefSkeleton = SkeletalMesh->GetRefSkeleton(), PhysicsData, Profiler]()
+		{
+			PMX_IMPORT_ROOT_SCOPE("Physics Plan", Profiler);
+			Build->bPlanned = FPmxPhysicsBuilder::PlanPhysicsAsset(RefSkeleton, *PhysicsData, Build->Plan);
+		});
+
+	FPmxPostImportQueue::Enqueue(PhysicsAsset->GetName(), Profiler,
+		[Build, WeakPhysicsAsset = TWeakObjectPtr<UPhysicsAsset>(PhysicsAsset), WeakSkeletalMesh = TWeakObjectPtr<USkeletalMesh>(SkeletalMesh)](double EndTime)
+		{
+			UPhysicsAsset* Asset = WeakPhysicsAsset.Get();
+			USkeletalMesh* Mesh = WeakSkeletalMesh.Get();
+			if (!Asset || !Mesh || !Build->bPlanned)
+			{
+				return true;
+			}
+
+			if (!FPmxPhysicsBuilder::ApplyPhysicsPlan(Asset, Build->Plan, Build->NextStep, EndTime))
+			{
+				return false;
+			}
+
+			// Link physics asset to skeletal mesh
+			Mesh->SetPhysicsAsset(Asset);
+
+			// Post-processing: Refresh physics asset to update all dependent components
+#if WITH_EDITOR
+			Asset->RefreshPhysicsAssetChange();
+#endif
+
+			// Mark assets as dirty so they get saved
+			Asset->MarkPackageDirty();
+			Mesh->MarkPackageDirty();
+
+			UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Built PhysicsAsset for '%s'"), *Mesh->GetName());
+			return true;
+		},
+		PlanTask);
+}
+
+void UPmxPipeline::CreatePmxRigAsset(USkeletalMesh* SkeletalMesh, const FPmxRigDescription& RigDescription) const
+{
+	PMX_IMPORT_SCOPE("Rig Asset");
+
+	const FString AssetName = SkeletalMesh->GetName() + TEXT("_Rig");
+	const FString PackageName = FPackageName::GetLongPackagePath(SkeletalMesh->GetOutermost()->GetName()) / AssetName;
+
+	// Reuse the existing rig on reimport so references from animation assets stay valid
+	UPmxRigDefinition* RigAsset = LoadObject<UPmxRigDefinition>(nullptr, *(PackageName + TEXT(".") + AssetName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+	const bool bCreated = RigAsset == nullptr;
+	if (bCreated)
+	{
+		UPackage* Package = CreatePackage(*PackageName);
+		if (!Package)
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Failed to create package '%s'"), *PackageName);
+			return;
+		}
+		RigAsset = NewObject<UPmxRigDefinition>(Package, *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+	}
+
+	RigAsset->Skeleton = SkeletalMesh->GetSkeleton();
+	RigAsset->Description = RigDescription;
+
+	if (bCreated)
+	{
+		FAssetRegistryModule::AssetCreated(RigAsset);
+	}
+	RigAsset->MarkPackageDirty();
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: %s rig asset '%s' (%d IK chains, %d append links)"),
+		bCreated ? TEXT("Created") : TEXT("Updated"), *PackageName, RigDescription.IKChains.Num(), RigDescription.Appends.Num());
 }
 
 #if WITH_EDITOR
+void UPmxPipeline::FinalizeSharedSkeleton(USkeletalMesh* SkeletalMesh) const
+{
+	PMX_IMPORT_SCOPE("Finalize Shared Skeleton");
+
+	USkeleton* Skeleton = SkeletalMesh->GetSkeleton();
+	if (!Skeleton || !Session.IsValid() || Session->SkeletonFingerprint.IsEmpty())
+	{
+		return;
+	}
+
+	// New skeleton: later imports of the same base rig find it through the project index
+	if (Session->SharedSkeletonPath.IsNull())
+	{
+		GetMutableDefault<UPmxSkeletonIndex>()->RegisterSkeleton(Session->SkeletonFingerprint, FSoftObjectPath(Skeleton));
+		return;
+	}
+
+	const FPmxModel* const SessionModel = GetSessionModel();
+	if (!SessionModel)
+	{
+		return;
+	}
+
+	const FPmxSkeletonLayout& Layout = Session->GetSkeletonLayout(*SessionModel);
+	TArray<FString> ExtraBones;
+	FString Reason;
+	if (!FPmxSkeletonMatcher::CheckCompatibility(*SessionModel, Layout, Skeleton->GetReferenceSkeleton(), SkeletonMatchTolerance, ExtraBones, Reason))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: '%s' matched shared skeleton '%s' by fingerprint but is not compatible: %s. Reimport with skeleton sharing disabled."),
+			*SkeletalMesh->GetName(), *Skeleton->GetName(), *Reason);
+		return;
+	}
+
+	if (ExtraBones.Num() > 0)
+	{
+		if (!Skeleton->MergeAllBonesToBoneTree(SkeletalMesh))
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("UPmxPipeline: Failed to merge %d extra bones of '%s' into shared skeleton '%s'"),
+				ExtraBones.Num(), *SkeletalMesh->GetName(), *Skeleton->GetName());
+			return;
+		}
+		Skeleton->MarkPackageDirty();
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: '%s' uses shared skeleton '%s' (%d extra bones merged%s%s)"),
+		*SkeletalMesh->GetName(), *Skeleton->GetName(), ExtraBones.Num(),
+		ExtraBones.Num() > 0 ? TEXT(": ") : TEXT(""), *FString::Join(ExtraBones, TEXT(", ")));
+}
+
+void UPmxPipeline::AttachPmxSdefData(USkeletalMesh* SkeletalMesh, FPmxSdefDescription& SdefDescription) const
+{
+	PMX_IMPORT_SCOPE("Attach SDEF");
+
+	// Kept in PMX vertex order: render vertices carry the same data in the packed UV channels
+	UPmxSdefUserData* SdefData = SkeletalMesh->GetAssetUserData<UPmxSdefUserData>();
+	if (!SdefData)
+	{
+		SdefData = NewObject<UPmxSdefUserData>(SkeletalMesh, NAME_None, RF_Transactional);
+		SkeletalMesh->AddAssetUserData(SdefData);
+	}
+	SdefData->Description = MoveTemp(SdefDescription);
+	SkeletalMesh->MarkPackageDirty();
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Attached %d SDEF vertices of %d to '%s'"),
+		SdefData->Description.Vertices.Num(), SdefData->Description.NumMeshVertices, *SkeletalMesh->GetName());
+}
+
+void UPmxPipeline::AttachPmxDisplayData(USkeletalMesh* SkeletalMesh, FPmxDisplayDescription& DisplayDescription) const
+{
+	PMX_IMPORT_SCOPE("Attach Display");
+
+	// Frames left empty by pruning or by morph types without morph targets only clutter the lists
+	DisplayDescription.Groups.RemoveAll([](const FPmxDisplayGroup& Group)
+	{
+		return Group.Bones.IsEmpty() && Group.Morphs.IsEmpty();
+	});
+
+	UPmxDisplayUserData* DisplayData = SkeletalMesh->GetAssetUserData<UPmxDisplayUserData>();
+	if (!DisplayData)
+	{
+		DisplayData = NewObject<UPmxDisplayUserData>(SkeletalMesh, NAME_None, RF_Transactional);
+		SkeletalMesh->AddAssetUserData(DisplayData);
+	}
+	DisplayData->Description = MoveTemp(DisplayDescription);
+	const int32 NumMissing = DisplayData->BuildLookupTables(*SkeletalMesh);
+	SkeletalMesh->MarkPackageDirty();
+
+	// A shared skeleton belongs to every model of the rig; one model's frames would overwrite the others' profiles
+	int32 NumProfiles = 0;
+	if (bCreateDisplayBlendProfiles && SkeletalMesh->GetSkeleton() && Session->SharedSkeletonPath.IsNull())
+	{
+		NumProfiles = FPmxDisplayBuilder::ApplyBlendProfiles(*SkeletalMesh->GetSkeleton(), DisplayData->Description);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("UPmxPipeline: Attached %d display groups to '%s' (%d blend profiles, %d names not found in the mesh)"),
+		DisplayData->Description.Groups.Num(), *SkeletalMesh->GetName(), NumProfiles, NumMissing);
+}
+
 void UPmxPipeline::FilterPropertiesFromTranslatedData(UInterchangeBaseNodeContainer* InBaseNodeContainer)
 {
 	Super::FilterPropertiesFromTranslatedData(InBaseNodeContainer);
@@ -866,8 +1854,11 @@ void UPmxPipeline::FilterPropertiesFromTranslatedData(UInterchangeBaseNodeContai
 	if (!bImportArmature)
 	{
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bRenameLRBones));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bTranslateBoneNames));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, BoneRenameTable));
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bFixIKLinks));
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bApplyBoneFixedAxis));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bCreateRigAsset));
 	}
 
 	// Hide physics sub-options if not importing physics
@@ -885,6 +1876,13 @@ void UPmxPipeline::FilterPropertiesFromTranslatedData(UInterchangeBaseNodeContai
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bRecomputeNormals));
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bRecomputeTangents));
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bUseMikkTSpace));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, LodCount));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, LodReductionRatio));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, LodMaxInfluences));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, MinInfluenceWeight));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, MaxBonesPerSection));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bGenerateOutline));
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, OutlineThickness));
 	}
 
 	// Hide MikkTSpace option if not recomputing tangents
@@ -893,6 +1891,12 @@ void UPmxPipeline::FilterPropertiesFromTranslatedData(UInterchangeBaseNodeContai
 		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bUseMikkTSpace));
 	}
 
+	// Hide display sub-options if not importing display frames
+	if (!bImportDisplay)
+	{
+		HideProperty(this, this, GET_MEMBER_NAME_CHECKED(UPmxPipeline, bCreateDisplayBlendProfiles));
+	}
+
 	// Hide sharp edge angle if not marking sharp edges
 	if (!bMarkSharpEdges)
 	{
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxPostImportQueue.h"
+#include "PmxImportProfiler.h"
+#include "LogPMXImporter.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+static TAutoConsoleVariable<float> CVarPMXImporterPostImportBudgetMs(
+	TEXT("PMXImporter.PostImportBudgetMs"),
+	8.0f,
+	TEXT("Game thread milliseconds per tick spent applying queued PMX post-import work (physics assets, material parameters). ")
+	TEXT("0 applies everything inline during post-import, as commandlets always do."),
+	ECVF_Default);
+
+TArray<FPmxPostImportQueue::FItem> FPmxPostImportQueue::Items;
+FTSTicker::FDelegateHandle FPmxPostImportQueue::TickerHandle;
+
+bool FPmxPostImportQueue::IsTimeSlicingEnabled()
+{
+	return CVarPMXImporterPostImportBudgetMs.GetValueOnGameThread() > 0.0f && !IsRunningCommandlet();
+}
+
+void FPmxPostImportQueue::Enqueue(const FString& Label, const TSharedPtr<FPmxImportProfiler>& Profiler, FStep&& Step,
+	const UE::Tasks::FTask& Prerequisite)
+{
+	check(IsInGameThread());
+
+	FItem Item;
+	Item.Label = Label;
+	Item.Profiler = Profiler;
+	Item.Step = MoveTemp(Step);
+	Item.Prerequisite = Prerequisite;
+	Item.EnqueueTime = FPlatformTime::Seconds();
+
+	// Without time slicing the step runs right away; it is only queued if it waits on work outside it
+	// (a texture created later in the same import), which the game thread can only do once this returns
+	if (!IsTimeSlicingEnabled() && RunToCompletion(Item))
+	{
+		return;
+	}
+
+	Items.Add(MoveTemp(Item));
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FPmxPostImportQueue::Tick));
+	}
+}
+
+void FPmxPostImportQueue::Flush()
+{
+	check(IsInGameThread());
+
+	while (Items.Num() > 0)
+	{
+		// Removed before running so a step may enqueue more work
+		FItem Item = MoveTemp(Items[0]);
+		Items.RemoveAt(0);
+		while (!RunToCompletion(Item))
+		{
+			// Nothing else runs while flushing; waiting steps give up after their own timeout
+			FPlatformProcess::Sleep(0.01f);
+		}
+	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+int32 FPmxPostImportQueue::GetNumPending()
+{
+	return Items.Num();
+}
+
+bool FPmxPostImportQueue::Tick(float DeltaTime)
+{
+	// Without time slicing only steps waiting on other work are queued; every ready one runs
+	const double EndTime = IsTimeSlicingEnabled()
+		? FPlatformTime::Seconds() + CVarPMXImporterPostImportBudgetMs.GetValueOnGameThread() / 1000.0
+		: TNumericLimits<double>::Max();
+
+	// In order; steps still waiting for their prerequisite are passed over
+	for (int32 Index = 0; Index < Items.Num() && FPlatformTime::Seconds() < EndTime;)
+	{
+		if (Items[Index].Prerequisite.IsValid() && !Items[Index].Prerequisite.IsCompleted())
+		{
+			++Index;
+			continue;
+		}
+
+		FItem Item = MoveTemp(Items[Index]);
+		Items.RemoveAt(Index);
+
+		bool bDone = false;
+		{
+			PMX_IMPORT_ROOT_SCOPE("Post Import Apply", Item.Profiler);
+			bDone = Item.Step(EndTime);
+		}
+
+		if (bDone)
+		{
+			Complete(Item);
+		}
+		else
+		{
+			Items.Insert(MoveTemp(Item), Index);
+			++Index;
+		}
+	}
+
+	if (Items.Num() == 0)
+	{
+		// Returning false removes the ticker
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FPmxPostImportQueue::RunToCompletion(FItem& Item)
+{
+	if (Item.Prerequisite.IsValid())
+	{
+		Item.Prerequisite.Wait();
+	}
+
+	// With an unlimited budget a step only returns false while waiting on something outside it
+	bool bDone = false;
+	{
+		PMX_IMPORT_ROOT_SCOPE("Post Import Apply", Item.Profiler);
+		bDone = Item.Step(TNumericLimits<double>::Max());
+	}
+
+	if (bDone)
+	{
+		Complete(Item);
+	}
+	return bDone;
+}
+
+void FPmxPostImportQueue::Complete(const FItem& Item)
+{
+	UE_LOG(LogPMXImporter, Verbose, TEXT("PMX PostImport: '%s' applied %.1f ms after post-import (%d queued)"),
+		*Item.Label, (FPlatformTime::Seconds() - Item.EnqueueTime) * 1000.0, Items.Num());
+
+	if (Item.Profiler.IsValid() && FPmxImportProfiler::IsReportEnabled())
+	{
+		Item.Profiler->WriteReport(Item.Profiler->GetReportPath());
+	}
+}
@@ -2,32 +2,28 @@
 
 #include "PmxReader.h"
 #include "PmxStructs.h"
+#include "PmxBinaryReader.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/FileHelper.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPmxReader, Log, All);
 
-class FPmxReader
+class FPmxReader : public FPmxBinaryReader
 {
 public:
 	FPmxReader(const TArray<uint8>& InData);
 	
 	bool ReadPmxModel(FPmxModel& OutModel);
+
+	/** Record the byte range of every section read into OutSections */
+	void SetSectionLayout(TArray<FPmxSectionInfo>* OutSections) { SectionLayout = OutSections; }
 	
 private:
-	const TArray<uint8>& Data;
-	int32 Position;
-	
-	// Helper functions for reading binary data
-	template<typename T>
-	bool ReadValue(T& OutValue);
-	
+	// PMX specific helpers (primitive reads live in FPmxBinaryReader)
 	bool ReadString(FString& OutString, bool bUTF8);
 	bool ReadIndex(int32& OutIndex, uint8 IndexSize);
-	bool ReadVector3f(FVector3f& OutVector);
-	bool ReadVector2f(FVector2f& OutVector);
-	bool ReadLinearColor(FLinearColor& OutColor);
-	bool ReadQuatf(FQuat4f& OutQuat);
 	
 	// Section reading functions
 	bool ReadHeader(FPmxHeader& OutHeader);
@@ -42,19 +38,30 @@ private:
 	bool ReadJoints(FPmxModel& Model);
 	bool ReadSoftBodies(FPmxModel& Model);
 	
-	// Validation helpers
-	bool IsValidPosition(int32 Size) const;
-	void LogError(const FString& Message) const;
+	virtual void LogError(const FString& Message) const override;
+
+	/** Record a section that started at Start and ends at the current position */
+	void AddSection(const TCHAR* Name, int32 Start, int32 Count);
+
+	TArray<FPmxSectionInfo>* SectionLayout = nullptr;
+
+	/** Strings read (flushed into the import diagnostics at the end) */
+	int64 NumStrings = 0;
+	int64 NumStringBytes = 0;
+
+	/** Resync scans probe every offset; their parse errors are counted instead of logged */
+	bool bResyncScan = false;
+	mutable int64 NumResyncRejects = 0;
 };
 
 FPmxReader::FPmxReader(const TArray<uint8>& InData)
-	: Data(InData)
-	, Position(0)
+	: FPmxBinaryReader(InData)
 {
 }
 
 bool FPmxReader::ReadPmxModel(FPmxModel& OutModel)
 {
+	PMX_IMPORT_SCOPE("Parse");
 	Position = 0;
 	
 	// Check PMX signature
@@ -73,30 +80,47 @@ bool FPmxReader::ReadPmxModel(FPmxModel& OutModel)
 	Position = 4;
 	
 	// Read sections in order
-	UE_LOG(LogPmxReader, Log, TEXT("Reading PMX header at position 0x%X"), Position);
+	int32 SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading PMX header at position 0x%X"), Position);
 	if (!ReadHeader(OutModel.Header)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading vertices at position 0x%X"), Position);
+	AddSection(TEXT("Header"), SectionStart, 1);
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading vertices at position 0x%X"), Position);
 	if (!ReadVertices(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading indices at position 0x%X"), Position);
+	AddSection(TEXT("Vertices"), SectionStart, OutModel.Vertices.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading indices at position 0x%X"), Position);
 	if (!ReadIndices(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading textures at position 0x%X"), Position);
+	AddSection(TEXT("Indices"), SectionStart, OutModel.Indices.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading textures at position 0x%X"), Position);
 	if (!ReadTextures(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading materials at position 0x%X"), Position);
+	AddSection(TEXT("Textures"), SectionStart, OutModel.Textures.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading materials at position 0x%X"), Position);
 	if (!ReadMaterials(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading bones at position 0x%X"), Position);
+	AddSection(TEXT("Materials"), SectionStart, OutModel.Materials.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading bones at position 0x%X"), Position);
 	if (!ReadBones(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading morphs at position 0x%X"), Position);
+	AddSection(TEXT("Bones"), SectionStart, OutModel.Bones.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading morphs at position 0x%X"), Position);
 	if (!ReadMorphs(OutModel)) return false;
-	UE_LOG(LogPmxReader, Log, TEXT("Reading display frames at position 0x%X"), Position);
+	AddSection(TEXT("Morphs"), SectionStart, OutModel.Morphs.Num());
+	SectionStart = Position;
+	PMX_TRACE(LogPmxReader, TEXT("Reading display frames at position 0x%X"), Position);
 	if (!ReadDisplayFrames(OutModel))
 	{
-		UE_LOG(LogPmxReader, Warning, TEXT("Failed to read DisplayFrames. Continuing to attempt physics sections."));
+		PMX_DIAG_WARNING(LogPmxReader, TEXT("Failed to read DisplayFrames. Continuing to attempt physics sections."));
 	}
-	UE_LOG(LogPmxReader, Log, TEXT("Reading rigid bodies at position 0x%X"), Position);
+	AddSection(TEXT("DisplayFrames"), SectionStart, OutModel.DisplayFrames.Num());
+	PMX_TRACE(LogPmxReader, TEXT("Reading rigid bodies at position 0x%X"), Position);
 	int32 SavedRigidBodiesPos = Position;
 	if (!ReadRigidBodies(OutModel))
 	{
-		UE_LOG(LogPmxReader, Warning, TEXT("Failed to read RigidBodies at 0x%08X. Attempting resync scan to locate physics section..."), SavedRigidBodiesPos);
+		PMX_DIAG_WARNING(LogPmxReader, TEXT("Failed to read RigidBodies at 0x%08X. Attempting resync scan to locate physics section..."), SavedRigidBodiesPos);
+		TGuardValue<bool> ResyncScanGuard(bResyncScan, true);
 		// Heuristic resync: scan forward up to 2MB to find a plausible RigidBody section start
 		const int32 ScanLimit = FMath::Min(SavedRigidBodiesPos + 2 * 1024 * 1024, Data.Num() - 4);
 		bool bResynced = false;
@@ -133,14 +157,16 @@ bool FPmxReader::ReadPmxModel(FPmxModel& OutModel)
 		}
 		if (!bResynced)
 		{
-			UE_LOG(LogPmxReader, Warning, TEXT("RigidBodies resync scan failed. Physics bodies will be unavailable."));
+			PMX_DIAG_WARNING(LogPmxReader, TEXT("RigidBodies resync scan failed. Physics bodies will be unavailable."));
 		}
 	}
-	UE_LOG(LogPmxReader, Log, TEXT("Reading joints at position 0x%X"), Position);
+	AddSection(TEXT("RigidBodies"), SavedRigidBodiesPos, OutModel.RigidBodies.Num());
+	PMX_TRACE(LogPmxReader, TEXT("Reading joints at position 0x%X"), Position);
 	int32 SavedJointsPos = Position;
 	if (!ReadJoints(OutModel))
 	{
-		UE_LOG(LogPmxReader, Warning, TEXT("Failed to read Joints at 0x%08X. Attempting resync scan to locate joints section..."), SavedJointsPos);
+		PMX_DIAG_WARNING(LogPmxReader, TEXT("Failed to read Joints at 0x%08X. Attempting resync scan to locate joints section..."), SavedJointsPos);
+		TGuardValue<bool> ResyncScanGuard(bResyncScan, true);
 		// Heuristic resync for joints: scan forward up to 2MB
 		const int32 ScanLimitJ = FMath::Min(SavedJointsPos + 2 * 1024 * 1024, Data.Num() - 4);
 		bool bResyncedJ = false;
@@ -173,16 +199,27 @@ bool FPmxReader::ReadPmxModel(FPmxModel& OutModel)
 		}
 		if (!bResyncedJ)
 		{
-			UE_LOG(LogPmxReader, Warning, TEXT("Joints resync scan failed. Physics joints will be unavailable."));
+			PMX_DIAG_WARNING(LogPmxReader, TEXT("Joints resync scan failed. Physics joints will be unavailable."));
 		}
 	}
+	AddSection(TEXT("Joints"), SavedJointsPos, OutModel.Joints.Num());
 	
 	// Soft bodies are optional (PMX 2.1 feature)
 	if (Position < Data.Num())
 	{
+		SectionStart = Position;
 		ReadSoftBodies(OutModel);
+		AddSection(TEXT("SoftBodies"), SectionStart, OutModel.SoftBodies.Num());
 	}
 	
+	PMX_DIAG_COUNT("reader.bytes", Data.Num());
+	PMX_DIAG_COUNT("reader.strings", NumStrings);
+	PMX_DIAG_COUNT("reader.string_bytes", NumStringBytes);
+	if (NumResyncRejects > 0)
+	{
+		PMX_DIAG_COUNT("reader.resync_rejects", NumResyncRejects);
+	}
+
 	UE_LOG(LogPmxReader, Log, TEXT("Successfully loaded PMX model: %s"), *OutModel.Header.ModelName);
 	UE_LOG(LogPmxReader, Log, TEXT("Vertices: %d, Indices: %d, Bones: %d, Materials: %d, Morphs: %d"), 
 		OutModel.Vertices.Num(), OutModel.Indices.Num(), OutModel.Bones.Num(), 
@@ -191,33 +228,6 @@ bool FPmxReader::ReadPmxModel(FPmxModel& OutModel)
 	return true;
 }
 
-template<typename T>
-bool FPmxReader::ReadValue(T& OutValue)
-{
-	if (!IsValidPosition(sizeof(T)))
-	{
-		return false;
-	}
-	
-	FMemory::Memcpy(&OutValue, &Data[Position], sizeof(T));
-	
-	// PMX format uses little-endian, convert if needed
-	if constexpr (sizeof(T) == 2)
-	{
-		OutValue = INTEL_ORDER16(OutValue);
-	}
-	else if constexpr (sizeof(T) == 4)
-	{
-		if constexpr (std::is_same_v<T, int32> || std::is_same_v<T, uint32> || std::is_same_v<T, float>)
-		{
-			OutValue = INTEL_ORDER32(OutValue);
-		}
-	}
-	
-	Position += sizeof(T);
-	return true;
-}
-
 bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 {
 	int32 Length;
@@ -226,7 +236,8 @@ bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 		return false;
 	}
 	
-	UE_LOG(LogPmxReader, VeryVerbose, TEXT("ReadString: Length=%d (0x%08X) at position 0x%08X"), Length, Length, Position - 4);
+	PMX_TRACE(LogPmxReader, TEXT("ReadString: Length=%d (0x%08X) at position 0x%08X"), Length, Length, Position - 4);
+	++NumStrings;
 	
 	// Sanity check bounds
 	const int32 MaxStringLength = 1024 * 1024; // 1MB cap
@@ -238,7 +249,7 @@ bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 		const uint32 UnsignedLen = static_cast<uint32>(Length);
 		if (UnsignedLen > 0 && UnsignedLen <= static_cast<uint32>(MaxStringLength) && IsValidPosition(static_cast<int32>(UnsignedLen)))
 		{
-			UE_LOG(LogPmxReader, Warning, TEXT("Negative string length %d encountered; interpreting as unsigned length %u"), Length, UnsignedLen);
+			PMX_DIAG_WARNING(LogPmxReader, TEXT("Negative string length %d encountered; interpreting as unsigned length %u"), Length, UnsignedLen);
 			Length = static_cast<int32>(UnsignedLen);
 		}
 		else
@@ -279,7 +290,8 @@ bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 				FUTF8ToTCHAR TryUtf8(reinterpret_cast<const ANSICHAR*>(&Data[Position]), ByteLength);
 				if (TryUtf8.Length() > 0)
 				{
-					UE_LOG(LogPmxReader, Warning, TEXT("Odd UTF-16 length %d; treating as UTF-8 due to encoding mismatch"), ByteLength);
+					PMX_DIAG_WARNING(LogPmxReader, TEXT("Odd UTF-16 length %d; treating as UTF-8 due to encoding mismatch"), ByteLength);
+					NumStringBytes += ByteLength;
 					OutString = FString(TryUtf8.Length(), TryUtf8.Get());
 					Position += ByteLength;
 					return true;
@@ -292,7 +304,7 @@ bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 			{
 				if (IsValidPosition(static_cast<int32>(TentativeByteLength)))
 				{
-					UE_LOG(LogPmxReader, Warning, TEXT("Odd UTF-16 length %d detected; interpreting as UTF-16 code units -> %d bytes"), ByteLength, static_cast<int32>(TentativeByteLength));
+					PMX_DIAG_WARNING(LogPmxReader, TEXT("Odd UTF-16 length %d detected; interpreting as UTF-16 code units -> %d bytes"), ByteLength, static_cast<int32>(TentativeByteLength));
 					ByteLength = static_cast<int32>(TentativeByteLength);
 				}
 				else
@@ -333,6 +345,7 @@ bool FPmxReader::ReadString(FString& OutString, bool bUTF8)
 		OutString = FString(ByteLength / 2, UTF16Data);
 	}
 	
+	NumStringBytes += ByteLength;
 	Position += ByteLength;
 	return true;
 }
@@ -371,28 +384,9 @@ bool FPmxReader::ReadIndex(int32& OutIndex, uint8 IndexSize)
 	return true;
 }
 
-bool FPmxReader::ReadVector3f(FVector3f& OutVector)
-{
-	return ReadValue(OutVector.X) && ReadValue(OutVector.Y) && ReadValue(OutVector.Z);
-}
-
-bool FPmxReader::ReadVector2f(FVector2f& OutVector)
-{
-	return ReadValue(OutVector.X) && ReadValue(OutVector.Y);
-}
-
-bool FPmxReader::ReadLinearColor(FLinearColor& OutColor)
-{
-	return ReadValue(OutColor.R) && ReadValue(OutColor.G) && ReadValue(OutColor.B) && ReadValue(OutColor.A);
-}
-
-bool FPmxReader::ReadQuatf(FQuat4f& OutQuat)
-{
-	return ReadValue(OutQuat.X) && ReadValue(OutQuat.Y) && ReadValue(OutQuat.Z) && ReadValue(OutQuat.W);
-}
-
 bool FPmxReader::ReadHeader(FPmxHeader& OutHeader)
 {
+	PMX_IMPORT_SCOPE("Read Header");
 	// Read version
 	if (!ReadValue(OutHeader.Version))
 		return false;
@@ -427,6 +421,7 @@ bool FPmxReader::ReadHeader(FPmxHeader& OutHeader)
 
 bool FPmxReader::ReadVertices(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Vertices");
 	int32 VertexCount;
 	if (!ReadValue(VertexCount))
 		return false;
@@ -523,6 +518,7 @@ bool FPmxReader::ReadVertices(FPmxModel& Model)
 
 bool FPmxReader::ReadIndices(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Indices");
 	int32 IndexCount;
 	if (!ReadValue(IndexCount))
 		return false;
@@ -555,6 +551,7 @@ bool FPmxReader::ReadIndices(FPmxModel& Model)
 
 bool FPmxReader::ReadTextures(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Textures");
 	int32 TextureCount;
 	if (!ReadValue(TextureCount))
 		return false;
@@ -583,6 +580,7 @@ bool FPmxReader::ReadTextures(FPmxModel& Model)
 
 bool FPmxReader::ReadMaterials(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Materials");
 	int32 MaterialCount;
 	if (!ReadValue(MaterialCount))
 		return false;
@@ -640,6 +638,7 @@ bool FPmxReader::ReadMaterials(FPmxModel& Model)
 
 bool FPmxReader::ReadBones(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Bones");
 	int32 BoneCount;
 	if (!ReadValue(BoneCount))
 		return false;
@@ -740,6 +739,7 @@ bool FPmxReader::ReadBones(FPmxModel& Model)
 
 bool FPmxReader::ReadMorphs(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Morphs");
 	int32 MorphCount;
 	if (!ReadValue(MorphCount))
 		return false;
@@ -783,7 +783,7 @@ bool FPmxReader::ReadMorphs(FPmxModel& Model)
 			const int64 Needed = (int64)MorphDataCount * (int64)MinBytesPerEntry;
 			if (MorphDataCount > 100000 || Needed > Remaining)
 			{
-				UE_LOG(LogPmxReader, Warning, TEXT("Morph data count %d (type %d) exceeds remaining bytes (%d) with entry size %d. Aborting morphs parsing and continuing without morphs."),
+				PMX_DIAG_WARNING(LogPmxReader, TEXT("Morph data count %d (type %d) exceeds remaining bytes (%d) with entry size %d. Aborting morphs parsing and continuing without morphs."),
 					MorphDataCount, (int32)Morph.MorphType, Remaining, MinBytesPerEntry);
 				return false; // abort morphs parsing safely
 			}
@@ -895,39 +895,54 @@ bool FPmxReader::ReadMorphs(FPmxModel& Model)
 	return true;
 }
 
-// Simplified implementations for remaining sections
 bool FPmxReader::ReadDisplayFrames(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Display Frames");
 	int32 Count;
 	if (!ReadValue(Count)) return false;
 	
-	// Skip display frames for MVP
+	if (Count < 0 || Count > 10000) // Sanity check
+	{
+		LogError(FString::Printf(TEXT("Invalid display frame count: %d"), Count));
+		return false;
+	}
+	
+	Model.DisplayFrames.Reserve(Count);
+	
 	bool bUTF8 = (Model.Header.EncodeType == 1);
 	for (int32 i = 0; i < Count; ++i)
 	{
-		FString Name, NameEng;
-		uint8 SpecialFlag;
+		FPmxDisplayFrame Frame;
 		int32 ElementCount;
 		
-		if (!ReadString(Name, bUTF8)) return false;
-		if (!ReadString(NameEng, bUTF8)) return false;
-		if (!ReadValue(SpecialFlag)) return false;
+		if (!ReadString(Frame.Name, bUTF8)) return false;
+		if (!ReadString(Frame.NameEng, bUTF8)) return false;
+		if (!ReadValue(Frame.SpecialFlag)) return false;
 		if (!ReadValue(ElementCount)) return false;
 		
+		if (ElementCount < 0 || ElementCount > 100000) // Sanity check
+		{
+			LogError(FString::Printf(TEXT("Invalid display frame element count: %d"), ElementCount));
+			return false;
+		}
+		
+		Frame.Elements.Reserve(ElementCount);
 		for (int32 j = 0; j < ElementCount; ++j)
 		{
-			uint8 ElementTarget;
-			int32 ElementIndex;
-			if (!ReadValue(ElementTarget)) return false;
-			if (ElementTarget == 0)
+			FPmxDisplayFrame::FPmxDisplayElement Element;
+			if (!ReadValue(Element.ElementTarget)) return false;
+			if (Element.ElementTarget == 0)
 			{
-				if (!ReadIndex(ElementIndex, Model.Header.BoneIndexSize)) return false;
+				if (!ReadIndex(Element.ElementIndex, Model.Header.BoneIndexSize)) return false;
 			}
 			else
 			{
-				if (!ReadIndex(ElementIndex, Model.Header.MorphIndexSize)) return false;
+				if (!ReadIndex(Element.ElementIndex, Model.Header.MorphIndexSize)) return false;
 			}
+			Frame.Elements.Add(Element);
 		}
+		
+		Model.DisplayFrames.Add(MoveTemp(Frame));
 	}
 	
 	return true;
@@ -935,6 +950,7 @@ bool FPmxReader::ReadDisplayFrames(FPmxModel& Model)
 
 bool FPmxReader::ReadRigidBodies(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Rigid Bodies");
 	int32 RigidBodyCount;
 	if (!ReadValue(RigidBodyCount))
 		return false;
@@ -978,6 +994,7 @@ bool FPmxReader::ReadRigidBodies(FPmxModel& Model)
 
 bool FPmxReader::ReadJoints(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Joints");
 	int32 JointCount;
 	if (!ReadValue(JointCount))
 		return false;
@@ -1020,6 +1037,7 @@ bool FPmxReader::ReadJoints(FPmxModel& Model)
 
 bool FPmxReader::ReadSoftBodies(FPmxModel& Model)
 {
+	PMX_IMPORT_SCOPE("Read Soft Bodies");
 	int32 SoftBodyCount;
 	if (!ReadValue(SoftBodyCount))
 		return false;
@@ -1034,20 +1052,27 @@ bool FPmxReader::ReadSoftBodies(FPmxModel& Model)
 	return true;
 }
 
-bool FPmxReader::IsValidPosition(int32 Size) const
+void FPmxReader::LogError(const FString& Message) const
 {
-	if (Position + Size > Data.Num())
+	if (bResyncScan)
 	{
-		LogError(FString::Printf(TEXT("Attempted to read beyond file end. Position: %d, Size: %d, FileSize: %d"), 
-			Position, Size, Data.Num()));
-		return false;
+		++NumResyncRejects;
+		PMX_TRACE(LogPmxReader, TEXT("Resync candidate rejected: %s (Position: 0x%08X)"), *Message, Position);
+		return;
 	}
-	return true;
+	UE_LOG(LogPmxReader, Error, TEXT("%s (Position: 0x%08X)"), *Message, Position);
 }
 
-void FPmxReader::LogError(const FString& Message) const
+void FPmxReader::AddSection(const TCHAR* Name, int32 Start, int32 Count)
 {
-	UE_LOG(LogPmxReader, Error, TEXT("%s (Position: 0x%08X)"), *Message, Position);
+	if (SectionLayout)
+	{
+		FPmxSectionInfo& Section = SectionLayout->AddDefaulted_GetRef();
+		Section.Name = Name;
+		Section.Offset = Start;
+		Section.Size = FMath::Max(Position - Start, 0);
+		Section.Count = Count;
+	}
 }
 
 // Public interface functions
@@ -1071,4 +1096,12 @@ namespace PMXReader
 		FPmxReader Reader(Data);
 		return Reader.ReadPmxModel(OutModel);
 	}
+
+	bool LoadPmxFromData(const TArray<uint8>& Data, FPmxModel& OutModel, TArray<FPmxSectionInfo>& OutSections)
+	{
+		OutSections.Reset();
+		FPmxReader Reader(Data);
+		Reader.SetSectionLayout(&OutSections);
+		return Reader.ReadPmxModel(OutModel);
+	}
 }
\ No newline at end of file
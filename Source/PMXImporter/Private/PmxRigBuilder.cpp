@@ -0,0 +1,162 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxRigBuilder.h"
+#include "PmxStructs.h"
+#include "PmxNodeBuilder.h"
+#include "PmxRigDefinition.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "Algo/Sort.h"
+
+namespace PmxRigBuilderPrivate
+{
+	static bool IsAncestor(const FPmxSkeletonLayout& Layout, int32 Ancestor, int32 BoneIndex)
+	{
+		for (int32 Current = Layout.Parents[BoneIndex]; Current != INDEX_NONE; Current = Layout.Parents[Current])
+		{
+			if (Current == Ancestor)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void FPmxRigBuilder::ConvertIKLimits(const FVector3f& PmxMin, const FVector3f& PmxMax, FVector3f& OutMin, FVector3f& OutMax)
+{
+	// PMX (x, y, z) -> UE (x, -z, y): rotations about PMX X/Y keep their sign on UE X/Z,
+	// a rotation about PMX Z becomes a rotation about -Y, so that range is negated and swapped
+	OutMin = FVector3f(PmxMin.X, -PmxMax.Z, PmxMin.Y);
+	OutMax = FVector3f(PmxMax.X, -PmxMin.Z, PmxMax.Y);
+}
+
+bool FPmxRigBuilder::BuildRigDescription(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, const TArray<FString>& BoneNames,
+	bool bFixIKLinks, FPmxRigDescription& OutDescription)
+{
+	PMX_IMPORT_SCOPE("Build Rig");
+	OutDescription = FPmxRigDescription();
+
+	const int32 NumBones = PmxModel.Bones.Num();
+	if (NumBones == 0 || Layout.Num() != NumBones || BoneNames.Num() != NumBones)
+	{
+		return false;
+	}
+
+	// 1) Bones
+	OutDescription.Bones.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
+		FPmxRigBone& RigBone = OutDescription.Bones[BoneIndex];
+		RigBone.Name = FName(*BoneNames[BoneIndex]);
+		RigBone.SourceName = Bone.Name;
+		RigBone.ParentIndex = Layout.Parents[BoneIndex];
+		RigBone.RestTranslation = FVector3f(Layout.LocalTransforms[BoneIndex].GetTranslation());
+		RigBone.Layer = Bone.Layer;
+		RigBone.bAfterPhysics = (Bone.BoneFlags & 0x1000) != 0;
+	}
+
+	// 2) Evaluation order (MMD: after-physics flag, then deform layer, then bone index)
+	TArray<int32> EvaluationOrder;
+	EvaluationOrder.SetNumUninitialized(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		EvaluationOrder[BoneIndex] = BoneIndex;
+	}
+	const TArray<FPmxRigBone>& RigBones = OutDescription.Bones;
+	Algo::Sort(EvaluationOrder, [&RigBones](int32 A, int32 B)
+	{
+		if (RigBones[A].bAfterPhysics != RigBones[B].bAfterPhysics)
+		{
+			return !RigBones[A].bAfterPhysics;
+		}
+		if (RigBones[A].Layer != RigBones[B].Layer)
+		{
+			return RigBones[A].Layer < RigBones[B].Layer;
+		}
+		return A < B;
+	});
+
+	// 3) Steps
+	int32 DroppedLinks = 0;
+	for (const int32 BoneIndex : EvaluationOrder)
+	{
+		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
+
+		// Append (additional parent) rotation / translation
+		const bool bAppendRotation = (Bone.BoneFlags & 0x0100) != 0;
+		const bool bAppendTranslation = (Bone.BoneFlags & 0x0200) != 0;
+		if ((bAppendRotation || bAppendTranslation) && Bone.AdditionalRatio != 0.f
+			&& PmxModel.Bones.IsValidIndex(Bone.AdditionalParentIndex) && Bone.AdditionalParentIndex != BoneIndex)
+		{
+			FPmxRigAppend& Append = OutDescription.Appends.AddDefaulted_GetRef();
+			Append.BoneIndex = BoneIndex;
+			Append.SourceBoneIndex = Bone.AdditionalParentIndex;
+			Append.Ratio = Bone.AdditionalRatio;
+			Append.bRotation = bAppendRotation;
+			Append.bTranslation = bAppendTranslation;
+
+			FPmxRigStep& Step = OutDescription.Steps.AddDefaulted_GetRef();
+			Step.Type = EPmxRigStepType::Append;
+			Step.Index = OutDescription.Appends.Num() - 1;
+		}
+
+		// CCD IK chain
+		if ((Bone.BoneFlags & 0x0020) && PmxModel.Bones.IsValidIndex(Bone.IKTargetBoneIndex))
+		{
+			const int32 FirstLink = OutDescription.IKLinks.Num();
+			for (const FPmxBone::FPmxIKLink& PmxLink : Bone.IKLinks)
+			{
+				const bool bValidLink = PmxModel.Bones.IsValidIndex(PmxLink.BoneIndex)
+					&& PmxLink.BoneIndex != Bone.IKTargetBoneIndex && PmxLink.BoneIndex != BoneIndex;
+				if (!bValidLink || (bFixIKLinks && !PmxRigBuilderPrivate::IsAncestor(Layout, PmxLink.BoneIndex, Bone.IKTargetBoneIndex)))
+				{
+					++DroppedLinks;
+					continue;
+				}
+
+				FPmxRigIKLink& Link = OutDescription.IKLinks.AddDefaulted_GetRef();
+				Link.BoneIndex = PmxLink.BoneIndex;
+				Link.bLimitAngle = PmxLink.AngleLimitFlag != 0;
+				if (Link.bLimitAngle)
+				{
+					ConvertIKLimits(PmxLink.LimitMin, PmxLink.LimitMax, Link.LimitMin, Link.LimitMax);
+				}
+			}
+
+			const int32 NumLinks = OutDescription.IKLinks.Num() - FirstLink;
+			if (NumLinks > 0)
+			{
+				FPmxRigIKChain& Chain = OutDescription.IKChains.AddDefaulted_GetRef();
+				Chain.IKBoneIndex = BoneIndex;
+				Chain.TargetBoneIndex = Bone.IKTargetBoneIndex;
+				// Bound the per-frame cost of malformed models
+				Chain.LoopCount = FMath::Clamp(Bone.IKLoopCount, 1, 256);
+				Chain.LimitAngle = Bone.IKLimitAngle;
+				Chain.FirstLink = FirstLink;
+				Chain.NumLinks = NumLinks;
+
+				FPmxRigStep& Step = OutDescription.Steps.AddDefaulted_GetRef();
+				Step.Type = EPmxRigStepType::IK;
+				Step.Index = OutDescription.IKChains.Num() - 1;
+			}
+		}
+
+		if (!RigBones[BoneIndex].bAfterPhysics)
+		{
+			OutDescription.NumBeforePhysicsSteps = OutDescription.Steps.Num();
+		}
+	}
+
+	if (DroppedLinks > 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX RigBuilder: Dropped %d invalid IK links"), DroppedLinks);
+	}
+
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX RigBuilder: %d IK chains (%d links), %d append links, %d steps (%d before physics)"),
+		OutDescription.IKChains.Num(), OutDescription.IKLinks.Num(), OutDescription.Appends.Num(),
+		OutDescription.Steps.Num(), OutDescription.NumBeforePhysicsSteps);
+
+	return !OutDescription.IsEmpty();
+}
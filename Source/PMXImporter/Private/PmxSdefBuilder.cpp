@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSdefBuilder.h"
+#include "PmxSdefDeformer.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+
+namespace PmxSdefBuilderPrivate
+{
+	static void ComputeMeshSpaceCenters(const FPmxVertex& Vertex, const FTransform& PmxToMesh, FVector3f& OutC, FVector3f& OutCR0, FVector3f& OutCR1)
+	{
+		// The transform is affine, so the corrective centers can be computed after converting C / R0 / R1
+		OutC = FVector3f(PmxToMesh.TransformPosition(FVector(Vertex.C)));
+		const FVector3f R0 = FVector3f(PmxToMesh.TransformPosition(FVector(Vertex.R0)));
+		const FVector3f R1 = FVector3f(PmxToMesh.TransformPosition(FVector(Vertex.R1)));
+		FPmxSdefDeformer::ComputeCorrectiveCenters(OutC, R0, R1, Vertex.BoneWeights[0], Vertex.BoneWeights[1], OutCR0, OutCR1);
+	}
+}
+
+FTransform FPmxSdefBuilder::GetPmxToMeshTransform(float ImportScale)
+{
+	return FTransform(FQuat(FVector3d::XAxisVector, FMath::DegreesToRadians(90.0f)), FVector3d::ZeroVector, FVector3d(ImportScale));
+}
+
+bool FPmxSdefBuilder::IsSdefVertex(const FPmxVertex& Vertex, int32 NumBones)
+{
+	if (Vertex.WeightType != 3 || Vertex.BoneIndices.Num() < 2 || Vertex.BoneWeights.Num() < 2)
+	{
+		return false;
+	}
+
+	const int32 Bone0 = Vertex.BoneIndices[0];
+	const int32 Bone1 = Vertex.BoneIndices[1];
+	const float Weight1 = Vertex.BoneWeights[1];
+
+	// Same bone or a single effective bone: SDEF equals linear skinning
+	return Bone0 >= 0 && Bone0 < NumBones && Bone1 >= 0 && Bone1 < NumBones && Bone0 != Bone1
+		&& Weight1 > KINDA_SMALL_NUMBER && Weight1 < 1.f - KINDA_SMALL_NUMBER;
+}
+
+bool FPmxSdefBuilder::BuildSdefDescription(const FPmxModel& PmxModel, const TArray<FString>& BoneNames, const FTransform& PmxToMesh, FPmxSdefDescription& OutDescription)
+{
+	PMX_IMPORT_SCOPE("Build SDEF");
+	using namespace PmxSdefBuilderPrivate;
+
+	OutDescription = FPmxSdefDescription();
+	OutDescription.NumMeshVertices = PmxModel.Vertices.Num();
+
+	const int32 NumBones = FMath::Min(PmxModel.Bones.Num(), BoneNames.Num());
+	TArray<int32> BoneSlots;
+	BoneSlots.Init(INDEX_NONE, NumBones);
+	auto GetBoneSlot = [&BoneSlots, &BoneNames, &OutDescription](int32 BoneIndex)
+	{
+		if (BoneSlots[BoneIndex] == INDEX_NONE)
+		{
+			BoneSlots[BoneIndex] = OutDescription.Bones.Add(FName(*BoneNames[BoneIndex]));
+		}
+		return static_cast<uint16>(BoneSlots[BoneIndex]);
+	};
+
+	for (int32 VertexIndex = 0; VertexIndex < PmxModel.Vertices.Num(); ++VertexIndex)
+	{
+		const FPmxVertex& PmxVertex = PmxModel.Vertices[VertexIndex];
+		if (!IsSdefVertex(PmxVertex, NumBones))
+		{
+			continue;
+		}
+
+		FPmxSdefVertex& Vertex = OutDescription.Vertices.AddDefaulted_GetRef();
+		Vertex.VertexIndex = VertexIndex;
+		Vertex.Bone0 = GetBoneSlot(PmxVertex.BoneIndices[0]);
+		Vertex.Bone1 = GetBoneSlot(PmxVertex.BoneIndices[1]);
+		Vertex.Weight1 = PmxVertex.BoneWeights[1];
+		Vertex.Position = FVector3f(PmxToMesh.TransformPosition(FVector(PmxVertex.Position)));
+		Vertex.Normal = FVector3f(PmxToMesh.TransformVectorNoScale(FVector(PmxVertex.Normal))).GetSafeNormal();
+		ComputeMeshSpaceCenters(PmxVertex, PmxToMesh, Vertex.C, Vertex.CR0, Vertex.CR1);
+	}
+
+	return !OutDescription.IsEmpty();
+}
+
+void FPmxSdefBuilder::PackVertexUVs(const FPmxVertex& Vertex, int32 NumBones, const FTransform& PmxToMesh, FVector2f OutUVs[FPmxSdefDescription::NumPackedUVChannels])
+{
+	using namespace PmxSdefBuilderPrivate;
+
+	if (!IsSdefVertex(Vertex, NumBones))
+	{
+		FPmxSdefDeformer::PackUVs(FVector3f::ZeroVector, FVector3f::ZeroVector, FVector3f::ZeroVector, -1.f, OutUVs);
+		return;
+	}
+
+	FVector3f C, CR0, CR1;
+	ComputeMeshSpaceCenters(Vertex, PmxToMesh, C, CR0, CR1);
+	FPmxSdefDeformer::PackUVs(C, CR0, CR1, Vertex.BoneWeights[1], OutUVs);
+}
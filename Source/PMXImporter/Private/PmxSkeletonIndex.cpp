@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSkeletonIndex.h"
+#include "LogPMXImporter.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxSkeletonIndex)
+
+FSoftObjectPath UPmxSkeletonIndex::FindSkeleton(const FString& Fingerprint) const
+{
+	const FSoftObjectPath* Found = SkeletonsByFingerprint.Find(Fingerprint);
+	if (!Found || Found->IsNull())
+	{
+		return FSoftObjectPath();
+	}
+
+	// Skeletons deleted from the project leave stale entries behind
+	const IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	return AssetRegistry.GetAssetByObjectPath(*Found).IsValid() ? *Found : FSoftObjectPath();
+}
+
+void UPmxSkeletonIndex::RegisterSkeleton(const FString& Fingerprint, const FSoftObjectPath& SkeletonPath)
+{
+	if (Fingerprint.IsEmpty() || SkeletonPath.IsNull() || !FindSkeleton(Fingerprint).IsNull())
+	{
+		return;
+	}
+
+	SkeletonsByFingerprint.Add(Fingerprint, SkeletonPath);
+	TryUpdateDefaultConfigFile();
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX SkeletonIndex: Registered '%s' for fingerprint %s"), *SkeletonPath.ToString(), *Fingerprint);
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSkeletonMatcher.h"
+#include "PmxSkeletonPruner.h"
+#include "PmxStructs.h"
+#include "PmxNodeBuilder.h"
+#include "LogPMXImporter.h"
+#include "ReferenceSkeleton.h"
+#include "PmxImportProfiler.h"
+#include "Hash/CityHash.h"
+
+namespace PmxSkeletonMatcherPrivate
+{
+	/** Fewer standard bones than this: fingerprint every bone instead */
+	static constexpr int32 MinCoreBones = 4;
+
+	/** Name of the synthetic root joint every PMX skeleton starts with */
+	static const TCHAR* RootJointName = TEXT("Root");
+}
+
+FString FPmxSkeletonMatcher::NormalizeBoneName(const FString& BoneName)
+{
+	// FName comparison is case insensitive, so case differences already resolve to the same skeleton bone
+	return BoneName.TrimStartAndEnd().ToLower();
+}
+
+FString FPmxSkeletonMatcher::ComputeFingerprint(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, float Tolerance)
+{
+	PMX_IMPORT_SCOPE("Skeleton Fingerprint");
+	using namespace PmxSkeletonMatcherPrivate;
+
+	const int32 NumBones = FMath::Min(PmxModel.Bones.Num(), Layout.Num());
+	if (NumBones == 0)
+	{
+		return FString();
+	}
+
+	TBitArray<> CoreBones(false, NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		CoreBones[BoneIndex] = FPmxSkeletonPruner::IsStandardBoneName(PmxModel.Bones[BoneIndex].Name);
+	}
+	if (CoreBones.CountSetBits() < MinCoreBones)
+	{
+		CoreBones.Init(true, NumBones);
+	}
+
+	const float Step = FMath::Max(Tolerance, KINDA_SMALL_NUMBER);
+	TArray<FString> Entries;
+	for (TConstSetBitIterator<> It(CoreBones); It; ++It)
+	{
+		const int32 BoneIndex = It.GetIndex();
+
+		// Direct parent, as CheckCompatibility and the skeleton merge require it
+		const int32 Parent = Layout.Parents[BoneIndex];
+
+		// Rounding can put two positions within tolerance into neighbouring cells (a miss, never a false match);
+		// probing neighbour cells would multiply the candidate fingerprints per bone, so it is not attempted
+		const FVector Position = Layout.WorldTransforms[BoneIndex].GetLocation();
+		Entries.Add(FString::Printf(TEXT("%s|%s|%d,%d,%d"),
+			*NormalizeBoneName(PmxModel.Bones[BoneIndex].Name),
+			Parent != INDEX_NONE ? *NormalizeBoneName(PmxModel.Bones[Parent].Name) : RootJointName,
+			FMath::RoundToInt(Position.X / Step), FMath::RoundToInt(Position.Y / Step), FMath::RoundToInt(Position.Z / Step)));
+	}
+
+	// Independent of PMX bone order
+	Entries.Sort();
+	const FTCHARToUTF8 Utf8(*FString::Join(Entries, TEXT("\n")));
+	return FString::Printf(TEXT("%d-%016llx"), Entries.Num(), CityHash64(Utf8.Get(), Utf8.Length()));
+}
+
+bool FPmxSkeletonMatcher::CheckCompatibility(
+	const FPmxModel& PmxModel,
+	const FPmxSkeletonLayout& Layout,
+	const FReferenceSkeleton& RefSkeleton,
+	float Tolerance,
+	TArray<FString>& OutExtraBones,
+	FString& OutReason)
+{
+	using namespace PmxSkeletonMatcherPrivate;
+
+	OutExtraBones.Reset();
+	OutReason.Reset();
+
+	const TArray<FTransform>& RefPose = RefSkeleton.GetRefBonePose();
+	TArray<FTransform> ComponentSpace;
+	ComponentSpace.SetNumUninitialized(RefPose.Num());
+	for (int32 BoneIndex = 0; BoneIndex < RefPose.Num(); ++BoneIndex)
+	{
+		const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+		ComponentSpace[BoneIndex] = ParentIndex != INDEX_NONE ? RefPose[BoneIndex] * ComponentSpace[ParentIndex] : RefPose[BoneIndex];
+	}
+
+	const int32 NumBones = FMath::Min(PmxModel.Bones.Num(), Layout.Num());
+	for (const int32 BoneIndex : Layout.SortedBones)
+	{
+		if (BoneIndex >= NumBones)
+		{
+			continue;
+		}
+
+		const FString& BoneName = PmxModel.Bones[BoneIndex].Name;
+		const int32 SkeletonIndex = RefSkeleton.FindBoneIndex(FName(*BoneName));
+		if (SkeletonIndex == INDEX_NONE)
+		{
+			OutExtraBones.Add(BoneName);
+			continue;
+		}
+
+		const int32 Parent = Layout.Parents[BoneIndex];
+		const FString ParentName = Parent != INDEX_NONE ? PmxModel.Bones[Parent].Name : RootJointName;
+		const int32 SkeletonParent = RefSkeleton.GetParentIndex(SkeletonIndex);
+		const FString SkeletonParentName = SkeletonParent != INDEX_NONE ? RefSkeleton.GetBoneName(SkeletonParent).ToString() : FString();
+		if (NormalizeBoneName(ParentName) != NormalizeBoneName(SkeletonParentName))
+		{
+			OutReason = FString::Printf(TEXT("Bone '%s' has parent '%s' (skeleton: '%s')"), *BoneName, *ParentName, *SkeletonParentName);
+			return false;
+		}
+
+		const double Distance = FVector::Dist(Layout.WorldTransforms[BoneIndex].GetLocation(), ComponentSpace[SkeletonIndex].GetLocation());
+		if (Distance > Tolerance)
+		{
+			OutReason = FString::Printf(TEXT("Bone '%s' is %.3f units away from the skeleton bind pose"), *BoneName, Distance);
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,269 @@
+﻿// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSkeletonPruner.h"
+#include "PmxStructs.h"
+#include "PmxNodeBuilder.h"
+#include "PmxUtils.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+
+namespace PmxSkeletonPrunerPrivate
+{
+	static void MarkBone(const FPmxModel& PmxModel, int32 BoneIndex, TBitArray<>& Required)
+	{
+		if (PmxModel.Bones.IsValidIndex(BoneIndex))
+		{
+			Required[BoneIndex] = true;
+		}
+	}
+
+	/** Nearest kept ancestor (or the bone itself), INDEX_NONE if none */
+	static int32 FindKeptBone(const FPmxSkeletonLayout& Layout, const TArray<int32>& OldToNew, int32 BoneIndex)
+	{
+		for (int32 Current = BoneIndex; Current != INDEX_NONE; Current = Layout.Parents[Current])
+		{
+			if (OldToNew[Current] != INDEX_NONE)
+			{
+				return Current;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+bool FPmxSkeletonPruner::IsStandardBoneName(const FString& BoneName)
+{
+	const TMap<FString, FString>& Table = FPmxUtils::GetStandardBoneRenameTable();
+	static const TSet<FString> TranslatedNames = [&Table]()
+	{
+		TSet<FString> Names;
+		for (const TPair<FString, FString>& Entry : Table)
+		{
+			Names.Add(Entry.Value);
+		}
+		return Names;
+	}();
+
+	FString Core = BoneName.TrimStartAndEnd();
+	if (Core.StartsWith(TEXT("左")) || Core.StartsWith(TEXT("右")))
+	{
+		Core.RightChopInline(1);
+	}
+	else if (Core.EndsWith(TEXT("_L")) || Core.EndsWith(TEXT("_R")))
+	{
+		Core.LeftChopInline(2);
+	}
+
+	return FPmxUtils::FindRenameTableEntry(Table, Core) != nullptr || TranslatedNames.Contains(Core);
+}
+
+void FPmxSkeletonPruner::FindRequiredBones(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, const FPmxBonePruneOptions& Options, TBitArray<>& OutRequired)
+{
+	using namespace PmxSkeletonPrunerPrivate;
+
+	const int32 NumBones = PmxModel.Bones.Num();
+	OutRequired.Init(false, NumBones);
+
+	// 1) Deforming bones
+	for (const FPmxVertex& Vertex : PmxModel.Vertices)
+	{
+		const int32 PairCount = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+		for (int32 Pair = 0; Pair < PairCount; ++Pair)
+		{
+			if (Vertex.BoneWeights[Pair] > Options.MinWeight)
+			{
+				MarkBone(PmxModel, Vertex.BoneIndices[Pair], OutRequired);
+			}
+		}
+	}
+
+	// 2) Rigid bodies
+	for (const FPmxRigidBody& RigidBody : PmxModel.RigidBodies)
+	{
+		MarkBone(PmxModel, RigidBody.RelatedBoneIndex, OutRequired);
+	}
+
+	// 3) Rig: IK chains and append links (evaluated by the PMX rig)
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FPmxBone& Bone = PmxModel.Bones[BoneIndex];
+		if ((Bone.BoneFlags & 0x0020) && PmxModel.Bones.IsValidIndex(Bone.IKTargetBoneIndex) && Bone.IKLinks.Num() > 0)
+		{
+			MarkBone(PmxModel, BoneIndex, OutRequired);
+			MarkBone(PmxModel, Bone.IKTargetBoneIndex, OutRequired);
+			for (const FPmxBone::FPmxIKLink& Link : Bone.IKLinks)
+			{
+				MarkBone(PmxModel, Link.BoneIndex, OutRequired);
+			}
+		}
+		if ((Bone.BoneFlags & (0x0100 | 0x0200)) && Bone.AdditionalRatio != 0.0f && PmxModel.Bones.IsValidIndex(Bone.AdditionalParentIndex))
+		{
+			MarkBone(PmxModel, BoneIndex, OutRequired);
+			MarkBone(PmxModel, Bone.AdditionalParentIndex, OutRequired);
+		}
+
+		// 4) Motion targets
+		if (Options.bKeepStandardBones && IsStandardBoneName(Bone.Name))
+		{
+			MarkBone(PmxModel, BoneIndex, OutRequired);
+		}
+	}
+
+	// 5) Ancestors of required bones move them, so they are required as well
+	for (int32 SortedIndex = Layout.SortedBones.Num() - 1; SortedIndex >= 0; --SortedIndex)
+	{
+		const int32 BoneIndex = Layout.SortedBones[SortedIndex];
+		const int32 Parent = Layout.Parents[BoneIndex];
+		if (OutRequired[BoneIndex] && Parent != INDEX_NONE)
+		{
+			OutRequired[Parent] = true;
+		}
+	}
+}
+
+bool FPmxSkeletonPruner::PruneUnusedBones(FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, const FPmxBonePruneOptions& Options, FPmxBonePruneResult& OutResult)
+{
+	PMX_IMPORT_SCOPE("Prune Bones");
+	using namespace PmxSkeletonPrunerPrivate;
+
+	OutResult = FPmxBonePruneResult();
+	const int32 NumBones = PmxModel.Bones.Num();
+
+	TBitArray<> Required;
+	FindRequiredBones(PmxModel, Layout, Options, Required);
+
+	// Never produce an empty skeleton
+	if (Required.CountSetBits() == 0)
+	{
+		return false;
+	}
+
+	OutResult.OldToNew.Init(INDEX_NONE, NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		if (Required[BoneIndex])
+		{
+			OutResult.OldToNew[BoneIndex] = OutResult.NewToOld.Add(BoneIndex);
+		}
+		else
+		{
+			OutResult.RemovedBones.Add(PmxModel.Bones[BoneIndex].Name);
+		}
+	}
+
+	if (!OutResult.HasPrunedBones())
+	{
+		return false;
+	}
+
+	const TArray<int32>& OldToNew = OutResult.OldToNew;
+	auto Remap = [&OldToNew](int32 BoneIndex)
+	{
+		return OldToNew.IsValidIndex(BoneIndex) ? OldToNew[BoneIndex] : INDEX_NONE;
+	};
+
+	// 1) Bones
+	TArray<FPmxBone> NewBones;
+	NewBones.Reserve(OutResult.NewToOld.Num());
+	for (const int32 OldIndex : OutResult.NewToOld)
+	{
+		FPmxBone Bone = PmxModel.Bones[OldIndex];
+
+		// Parents of required bones are required; use the validated (cycle free) parent
+		Bone.ParentBoneIndex = Remap(Layout.Parents[OldIndex]);
+
+		// Tail bone removed: keep the display direction as an offset
+		if ((Bone.BoneFlags & 0x0001) && PmxModel.Bones.IsValidIndex(Bone.ConnectionIndex) && Remap(Bone.ConnectionIndex) == INDEX_NONE)
+		{
+			Bone.Offset = PmxModel.Bones[Bone.ConnectionIndex].Position - Bone.Position;
+			Bone.BoneFlags &= ~0x0001;
+			Bone.ConnectionIndex = INDEX_NONE;
+		}
+		else if (Bone.BoneFlags & 0x0001)
+		{
+			Bone.ConnectionIndex = Remap(Bone.ConnectionIndex);
+		}
+
+		Bone.AdditionalParentIndex = Remap(Bone.AdditionalParentIndex);
+		Bone.IKTargetBoneIndex = Remap(Bone.IKTargetBoneIndex);
+		for (FPmxBone::FPmxIKLink& Link : Bone.IKLinks)
+		{
+			Link.BoneIndex = Remap(Link.BoneIndex);
+		}
+		NewBones.Add(MoveTemp(Bone));
+	}
+
+	// 2) Skin weights: weights on removed bones collapse into the nearest kept ancestor
+	for (FPmxVertex& Vertex : PmxModel.Vertices)
+	{
+		const int32 PairCount = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+		for (int32 Pair = 0; Pair < PairCount; ++Pair)
+		{
+			const int32 OldIndex = Vertex.BoneIndices[Pair];
+			if (!PmxModel.Bones.IsValidIndex(OldIndex))
+			{
+				continue;
+			}
+
+			const int32 KeptIndex = FindKeptBone(Layout, OldToNew, OldIndex);
+			if (KeptIndex != OldIndex)
+			{
+				++OutResult.NumWeightsMoved;
+			}
+			if (KeptIndex == INDEX_NONE)
+			{
+				Vertex.BoneIndices[Pair] = INDEX_NONE;
+				Vertex.BoneWeights[Pair] = 0.0f;
+			}
+			else
+			{
+				Vertex.BoneIndices[Pair] = OldToNew[KeptIndex];
+			}
+		}
+	}
+
+	// 3) Rigid bodies (their bones are required)
+	for (FPmxRigidBody& RigidBody : PmxModel.RigidBodies)
+	{
+		RigidBody.RelatedBoneIndex = Remap(RigidBody.RelatedBoneIndex);
+	}
+
+	// 4) Bone morphs and display frames drop entries of removed bones
+	for (FPmxMorph& Morph : PmxModel.Morphs)
+	{
+		for (int32 Index = Morph.BoneMorphs.Num() - 1; Index >= 0; --Index)
+		{
+			FPmxBoneMorph& BoneMorph = Morph.BoneMorphs[Index];
+			BoneMorph.BoneIndex = Remap(BoneMorph.BoneIndex);
+			if (BoneMorph.BoneIndex == INDEX_NONE)
+			{
+				Morph.BoneMorphs.RemoveAt(Index);
+			}
+		}
+	}
+	for (FPmxDisplayFrame& Frame : PmxModel.DisplayFrames)
+	{
+		for (int32 Index = Frame.Elements.Num() - 1; Index >= 0; --Index)
+		{
+			FPmxDisplayFrame::FPmxDisplayElement& Element = Frame.Elements[Index];
+			if (Element.ElementTarget != 0)
+			{
+				continue;
+			}
+			Element.ElementIndex = Remap(Element.ElementIndex);
+			if (Element.ElementIndex == INDEX_NONE)
+			{
+				Frame.Elements.RemoveAt(Index);
+			}
+		}
+	}
+
+	PmxModel.Bones = MoveTemp(NewBones);
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX SkeletonPruner: Removed %d of %d bones (%d -> %d, -%.1f%%), %d weights moved to kept ancestors"),
+		OutResult.RemovedBones.Num(), NumBones, NumBones, PmxModel.Bones.Num(),
+		100.0f * OutResult.RemovedBones.Num() / NumBones, OutResult.NumWeightsMoved);
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX SkeletonPruner: Removed bones: %s"), *FString::Join(OutResult.RemovedBones, TEXT(", ")));
+
+	return true;
+}
@@ -0,0 +1,366 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSkinOptimizer.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
+#include "Algo/StableSort.h"
+
+namespace PmxSkinOptimizerPrivate
+{
+	/** PMX weight type of SDEF vertices (both bones are needed by the SDEF deformer) */
+	static constexpr uint8 WeightTypeSdef = 3;
+
+	static bool IsInfluence(const FPmxModel& PmxModel, const FPmxVertex& Vertex, int32 Slot)
+	{
+		return Vertex.BoneWeights[Slot] > 0.0f && PmxModel.Bones.IsValidIndex(Vertex.BoneIndices[Slot]);
+	}
+
+	/** Fold repeated bones of a vertex into their first slot; returns the number of slots folded */
+	static int32 MergeRepeats(FPmxVertex& Vertex, int32 NumSlots)
+	{
+		int32 NumMerged = 0;
+		for (int32 Slot = 1; Slot < NumSlots; ++Slot)
+		{
+			if (Vertex.BoneWeights[Slot] <= 0.0f)
+			{
+				continue;
+			}
+			for (int32 Earlier = 0; Earlier < Slot; ++Earlier)
+			{
+				if (Vertex.BoneIndices[Earlier] == Vertex.BoneIndices[Slot] && Vertex.BoneWeights[Earlier] > 0.0f)
+				{
+					Vertex.BoneWeights[Earlier] += Vertex.BoneWeights[Slot];
+					Vertex.BoneWeights[Slot] = 0.0f;
+					++NumMerged;
+					break;
+				}
+			}
+		}
+		return NumMerged;
+	}
+
+	/** Scale the non-negative weights of a vertex to sum to 1 (unweighted vertices are left alone) */
+	static void Renormalize(FPmxVertex& Vertex, int32 NumSlots)
+	{
+		float Remaining = 0.0f;
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			Remaining += FMath::Max(Vertex.BoneWeights[Slot], 0.0f);
+		}
+		if (Remaining > UE_SMALL_NUMBER)
+		{
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+			{
+				Vertex.BoneWeights[Slot] = FMath::Max(Vertex.BoneWeights[Slot], 0.0f) / Remaining;
+			}
+		}
+	}
+
+	static FString FormatHistogram(const TArray<int32>& Histogram)
+	{
+		FString Result;
+		for (int32 Count = 0; Count < Histogram.Num(); ++Count)
+		{
+			Result += FString::Printf(TEXT("%s%d:%d"), Result.IsEmpty() ? TEXT("") : TEXT(" "), Count, Histogram[Count]);
+		}
+		return Result;
+	}
+}
+
+int32 FPmxSkinOptimizer::PruneInfluences(FPmxModel& PmxModel, float MinWeight, TArray<int32>* OutHistogram)
+{
+	PMX_IMPORT_SCOPE("Prune Influences");
+	using namespace PmxSkinOptimizerPrivate;
+
+	int32 NumMerged = 0;
+	int32 NumPruned = 0;
+	for (FPmxVertex& Vertex : PmxModel.Vertices)
+	{
+		const int32 NumSlots = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+		if (NumSlots <= 1 || Vertex.WeightType == WeightTypeSdef)
+		{
+			continue;
+		}
+
+		// BDEF4 frequently repeats a bone; fold repeats into the first slot
+		const int32 NumVertexMerged = MergeRepeats(Vertex, NumSlots);
+		NumMerged += NumVertexMerged;
+		bool bChanged = NumVertexMerged > 0;
+
+		if (MinWeight > 0.0f)
+		{
+			// The heaviest influence always survives so no vertex loses its skinning
+			int32 Heaviest = 0;
+			for (int32 Slot = 1; Slot < NumSlots; ++Slot)
+			{
+				if (Vertex.BoneWeights[Slot] > Vertex.BoneWeights[Heaviest])
+				{
+					Heaviest = Slot;
+				}
+			}
+			float Total = 0.0f;
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+			{
+				Total += FMath::Max(Vertex.BoneWeights[Slot], 0.0f);
+			}
+			for (int32 Slot = 0; Slot < NumSlots && Total > 0.0f; ++Slot)
+			{
+				if (Slot != Heaviest && Vertex.BoneWeights[Slot] > 0.0f && Vertex.BoneWeights[Slot] < MinWeight * Total)
+				{
+					Vertex.BoneWeights[Slot] = 0.0f;
+					++NumPruned;
+					bChanged = true;
+				}
+			}
+		}
+
+		if (bChanged)
+		{
+			Renormalize(Vertex, NumSlots);
+		}
+	}
+
+	TArray<int32> Histogram;
+	ComputeInfluenceHistogram(PmxModel, Histogram);
+	const FString HistogramText = FormatHistogram(Histogram);
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX SkinOptimizer: %d influences below %.3f pruned, %d repeated bones merged; vertices by influence count %s"),
+		NumPruned, MinWeight, NumMerged, *HistogramText);
+
+	PMX_DIAG_COUNT("skin.influences_pruned", NumPruned);
+	PMX_DIAG_COUNT("skin.influences_merged", NumMerged);
+	if (FPmxImportProfiler* Profiler = FPmxImportProfiler::GetCurrent())
+	{
+		Profiler->SetInfo(TEXT("InfluenceHistogram"), HistogramText);
+	}
+
+	if (OutHistogram)
+	{
+		*OutHistogram = MoveTemp(Histogram);
+	}
+	return NumPruned + NumMerged;
+}
+
+int32 FPmxSkinOptimizer::MergeRepeatedBones(FPmxModel& PmxModel)
+{
+	PMX_IMPORT_SCOPE("Merge Repeated Bones");
+	using namespace PmxSkinOptimizerPrivate;
+
+	int32 NumMerged = 0;
+	for (FPmxVertex& Vertex : PmxModel.Vertices)
+	{
+		const int32 NumSlots = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+		if (NumSlots <= 1 || Vertex.WeightType == WeightTypeSdef)
+		{
+			continue;
+		}
+
+		// Slots whose bone was dropped without a kept ancestor carry no weight, so always renormalize
+		NumMerged += MergeRepeats(Vertex, NumSlots);
+		Renormalize(Vertex, NumSlots);
+	}
+
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX SkinOptimizer: %d repeated bones merged"), NumMerged);
+	PMX_DIAG_COUNT("skin.influences_merged", NumMerged);
+	return NumMerged;
+}
+
+void FPmxSkinOptimizer::ComputeInfluenceHistogram(const FPmxModel& PmxModel, TArray<int32>& OutHistogram)
+{
+	using namespace PmxSkinOptimizerPrivate;
+
+	OutHistogram.Init(0, MaxInfluences + 1);
+	for (const FPmxVertex& Vertex : PmxModel.Vertices)
+	{
+		const int32 NumSlots = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+		int32 NumInfluences = 0;
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+		{
+			NumInfluences += IsInfluence(PmxModel, Vertex, Slot) ? 1 : 0;
+		}
+		++OutHistogram[FMath::Min(NumInfluences, MaxInfluences)];
+	}
+}
+
+int32 FPmxSkinOptimizer::PartitionSections(FPmxModel& PmxModel, int32 MaxBonesPerSection, TArray<FPmxSkinSectionStats>* OutStats)
+{
+	PMX_IMPORT_SCOPE("Partition Sections");
+	using namespace PmxSkinOptimizerPrivate;
+
+	const int32 NumBones = PmxModel.Bones.Num();
+	TBitArray<> MaterialBones(false, NumBones);
+	TArray<int32> MaterialBoneList;
+	TArray<int32> TriangleBoneOffsets;
+	TArray<int32> TriangleBones;
+	TArray<int32> DominantBones;
+	TArray<TBitArray<>> ClusterBones;
+	TArray<int32> ClusterBoneCounts;
+	TArray<int32> TriangleClusters;
+	TArray<int32> Order;
+	TArray<int32> SectionIndices;
+
+	int32 TotalSections = 0;
+	int32 NumSplitMaterials = 0;
+	int32 IndexOffset = 0;
+	for (int32 MatIndex = 0; MatIndex < PmxModel.Materials.Num(); ++MatIndex)
+	{
+		const int32 SurfaceCount = FMath::Max(PmxModel.Materials[MatIndex].SurfaceCount, 0);
+		const int32 NumSectionIndices = FMath::Clamp(PmxModel.Indices.Num() - IndexOffset, 0, SurfaceCount) / 3 * 3;
+		const int32 SectionStart = IndexOffset;
+		IndexOffset += SurfaceCount;
+
+		FPmxSkinSectionStats Stats;
+		Stats.MaterialIndex = MatIndex;
+		Stats.NumTriangles = NumSectionIndices / 3;
+
+		// Bones of every triangle (CSR) and the bone carrying most of its weight
+		TriangleBoneOffsets.Reset(Stats.NumTriangles + 1);
+		TriangleBoneOffsets.Add(0);
+		TriangleBones.Reset();
+		DominantBones.Reset(Stats.NumTriangles);
+		bool bValid = true;
+		for (int32 Tri = 0; Tri < Stats.NumTriangles && bValid; ++Tri)
+		{
+			TArray<TPair<int32, float>, TInlineAllocator<3 * MaxInfluences>> Weights;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 VertexIndex = PmxModel.Indices[SectionStart + Tri * 3 + Corner];
+				if (!PmxModel.Vertices.IsValidIndex(VertexIndex))
+				{
+					bValid = false;
+					break;
+				}
+				const FPmxVertex& Vertex = PmxModel.Vertices[VertexIndex];
+				const int32 NumSlots = FMath::Min(Vertex.BoneIndices.Num(), Vertex.BoneWeights.Num());
+				for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+				{
+					if (!IsInfluence(PmxModel, Vertex, Slot))
+					{
+						continue;
+					}
+					TPair<int32, float>* Entry = Weights.FindByPredicate([Bone = Vertex.BoneIndices[Slot]](const TPair<int32, float>& Pair) { return Pair.Key == Bone; });
+					if (!Entry)
+					{
+						Entry = &Weights.Emplace_GetRef(Vertex.BoneIndices[Slot], 0.0f);
+					}
+					Entry->Value += Vertex.BoneWeights[Slot];
+				}
+			}
+
+			int32 Dominant = INDEX_NONE;
+			float DominantWeight = 0.0f;
+			for (const TPair<int32, float>& Entry : Weights)
+			{
+				TriangleBones.Add(Entry.Key);
+				if (!MaterialBones[Entry.Key])
+				{
+					MaterialBones[Entry.Key] = true;
+					MaterialBoneList.Add(Entry.Key);
+				}
+				if (Entry.Value > DominantWeight)
+				{
+					Dominant = Entry.Key;
+					DominantWeight = Entry.Value;
+				}
+			}
+			TriangleBoneOffsets.Add(TriangleBones.Num());
+			DominantBones.Add(Dominant);
+		}
+
+		Stats.NumBones = MaterialBoneList.Num();
+		for (const int32 Bone : MaterialBoneList)
+		{
+			MaterialBones[Bone] = false;
+		}
+		MaterialBoneList.Reset();
+
+		Stats.NumSections = Stats.NumTriangles > 0 ? 1 : 0;
+		if (bValid && MaxBonesPerSection > 0 && Stats.NumBones > MaxBonesPerSection)
+		{
+			// First fit in dominant bone order: PMX bones are stored roughly parent before child, so neighbouring
+			// bone indices tend to share triangles and fill a section together
+			Order.Reset(Stats.NumTriangles);
+			for (int32 Tri = 0; Tri < Stats.NumTriangles; ++Tri)
+			{
+				Order.Add(Tri);
+			}
+			Algo::StableSortBy(Order, [&DominantBones](int32 Tri) { return DominantBones[Tri]; });
+
+			ClusterBones.Reset();
+			ClusterBoneCounts.Reset();
+			TriangleClusters.SetNumUninitialized(Stats.NumTriangles);
+			for (const int32 Tri : Order)
+			{
+				int32 Cluster = 0;
+				for (; Cluster < ClusterBones.Num(); ++Cluster)
+				{
+					int32 NumNewBones = 0;
+					for (int32 Entry = TriangleBoneOffsets[Tri]; Entry < TriangleBoneOffsets[Tri + 1]; ++Entry)
+					{
+						NumNewBones += ClusterBones[Cluster][TriangleBones[Entry]] ? 0 : 1;
+					}
+					if (ClusterBoneCounts[Cluster] + NumNewBones <= MaxBonesPerSection)
+					{
+						break;
+					}
+				}
+				if (Cluster == ClusterBones.Num())
+				{
+					ClusterBones.Emplace(false, NumBones);
+					ClusterBoneCounts.Add(0);
+				}
+				for (int32 Entry = TriangleBoneOffsets[Tri]; Entry < TriangleBoneOffsets[Tri + 1]; ++Entry)
+				{
+					if (!ClusterBones[Cluster][TriangleBones[Entry]])
+					{
+						ClusterBones[Cluster][TriangleBones[Entry]] = true;
+						++ClusterBoneCounts[Cluster];
+					}
+				}
+				TriangleClusters[Tri] = Cluster;
+			}
+			Stats.NumSections = ClusterBones.Num();
+
+			// Runs in cluster order, keeping the existing (vertex cache) order inside each run
+			Order.Reset(Stats.NumTriangles);
+			for (int32 Tri = 0; Tri < Stats.NumTriangles; ++Tri)
+			{
+				Order.Add(Tri);
+			}
+			Algo::StableSortBy(Order, [&TriangleClusters](int32 Tri) { return TriangleClusters[Tri]; });
+
+			SectionIndices.Reset(NumSectionIndices);
+			for (const int32 Tri : Order)
+			{
+				SectionIndices.Add(PmxModel.Indices[SectionStart + Tri * 3 + 0]);
+				SectionIndices.Add(PmxModel.Indices[SectionStart + Tri * 3 + 1]);
+				SectionIndices.Add(PmxModel.Indices[SectionStart + Tri * 3 + 2]);
+			}
+			FMemory::Memcpy(&PmxModel.Indices[SectionStart], SectionIndices.GetData(), NumSectionIndices * sizeof(int32));
+			++NumSplitMaterials;
+
+			PMX_TRACE(LogPMXImporter, TEXT("PMX SkinOptimizer: Material %d '%s': %d bones over %d triangles, split into %d sections of at most %d bones"),
+				MatIndex, *PmxModel.Materials[MatIndex].Name, Stats.NumBones, Stats.NumTriangles, Stats.NumSections, MaxBonesPerSection);
+		}
+
+		TotalSections += Stats.NumSections;
+		if (OutStats)
+		{
+			OutStats->Add(Stats);
+		}
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX SkinOptimizer: %d render sections for %d materials (%d split, bone limit %s)"),
+		TotalSections, PmxModel.Materials.Num(), NumSplitMaterials,
+		MaxBonesPerSection > 0 ? *FString::FromInt(MaxBonesPerSection) : TEXT("engine default"));
+
+	PMX_DIAG_COUNT("skin.sections", TotalSections);
+	PMX_DIAG_COUNT("skin.materials_split", NumSplitMaterials);
+	if (FPmxImportProfiler* Profiler = FPmxImportProfiler::GetCurrent())
+	{
+		Profiler->SetInfo(TEXT("RenderSections"), FString::FromInt(TotalSections));
+	}
+
+	return TotalSections;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxStructs.h"
+
+FArchive& operator<<(FArchive& Ar, FPmxHeader& Header)
+{
+	Ar << Header.Version << Header.EncodeType << Header.AdditionalUVNum;
+	Ar << Header.VertexIndexSize << Header.TextureIndexSize << Header.MaterialIndexSize;
+	Ar << Header.BoneIndexSize << Header.MorphIndexSize << Header.RigidbodyIndexSize;
+	Ar << Header.ModelName << Header.ModelNameEng << Header.Comment << Header.CommentEng;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxVertex& Vertex)
+{
+	Ar << Vertex.Position << Vertex.Normal << Vertex.UV << Vertex.AdditionalUV;
+	Ar << Vertex.WeightType << Vertex.BoneIndices << Vertex.BoneWeights;
+	Ar << Vertex.C << Vertex.R0 << Vertex.R1 << Vertex.EdgeScale;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxTexture& Texture)
+{
+	return Ar << Texture.TexturePath;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxMaterial& Material)
+{
+	Ar << Material.Name << Material.NameEng;
+	Ar << Material.Diffuse << Material.Specular << Material.SpecularStrength << Material.Ambient;
+	Ar << Material.DrawingFlags << Material.EdgeColor << Material.EdgeSize;
+	Ar << Material.TextureIndex << Material.SphereTextureIndex << Material.SphereMode;
+	Ar << Material.SharedToonFlag << Material.ToonTextureIndex;
+	Ar << Material.Memo << Material.SurfaceCount;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxBone::FPmxIKLink& Link)
+{
+	return Ar << Link.BoneIndex << Link.AngleLimitFlag << Link.LimitMin << Link.LimitMax;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxBone& Bone)
+{
+	Ar << Bone.Name << Bone.NameEng << Bone.Position << Bone.ParentBoneIndex << Bone.Layer << Bone.BoneFlags;
+	Ar << Bone.ConnectionIndex << Bone.Offset << Bone.AdditionalParentIndex << Bone.AdditionalRatio;
+	Ar << Bone.AxisDirection << Bone.XAxisDirection << Bone.ZAxisDirection << Bone.ExternalKey;
+	Ar << Bone.IKTargetBoneIndex << Bone.IKLoopCount << Bone.IKLimitAngle << Bone.IKLinks;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxVertexMorph& Morph)
+{
+	return Ar << Morph.VertexIndex << Morph.Offset;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxUVMorph& Morph)
+{
+	return Ar << Morph.VertexIndex << Morph.Offset;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxBoneMorph& Morph)
+{
+	return Ar << Morph.BoneIndex << Morph.Translation << Morph.Rotation;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxMaterialMorph& Morph)
+{
+	Ar << Morph.MaterialIndex << Morph.OffsetType << Morph.Diffuse << Morph.Specular << Morph.SpecularStrength;
+	Ar << Morph.Ambient << Morph.EdgeColor << Morph.EdgeSize;
+	Ar << Morph.TextureColor << Morph.SphereTextureColor << Morph.ToonTextureColor;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxGroupMorph& Morph)
+{
+	return Ar << Morph.MorphIndex << Morph.MorphRatio;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxMorph& Morph)
+{
+	Ar << Morph.Name << Morph.NameEng << Morph.ControlPanel << Morph.MorphType;
+	Ar << Morph.VertexMorphs << Morph.UVMorphs << Morph.BoneMorphs << Morph.MaterialMorphs << Morph.GroupMorphs;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxDisplayFrame::FPmxDisplayElement& Element)
+{
+	return Ar << Element.ElementTarget << Element.ElementIndex;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxDisplayFrame& Frame)
+{
+	return Ar << Frame.Name << Frame.NameEng << Frame.SpecialFlag << Frame.Elements;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxRigidBody& Body)
+{
+	Ar << Body.Name << Body.NameEng << Body.RelatedBoneIndex << Body.Group << Body.NonCollisionGroup;
+	Ar << Body.Shape << Body.Size << Body.Position << Body.Rotation;
+	Ar << Body.Mass << Body.MoveAttenuation << Body.RotationAttenuation << Body.Repulsion << Body.Friction;
+	Ar << Body.PhysicsType;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxJoint& Joint)
+{
+	Ar << Joint.Name << Joint.NameEng << Joint.JointType << Joint.RigidBodyIndexA << Joint.RigidBodyIndexB;
+	Ar << Joint.Position << Joint.Rotation;
+	Ar << Joint.MoveRestrictionMin << Joint.MoveRestrictionMax << Joint.RotationRestrictionMin << Joint.RotationRestrictionMax;
+	Ar << Joint.SpringMoveCoefficient << Joint.SpringRotationCoefficient;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxSoftBody& Body)
+{
+	Ar << Body.Name << Body.NameEng << Body.Shape << Body.MaterialIndex << Body.Group << Body.NonCollisionGroup << Body.Flags;
+	Ar << Body.BLinkDistance << Body.ClusterCount << Body.TotalMass << Body.CollisionMargin;
+	Ar << Body.AeroModel << Body.VCF << Body.DP << Body.DG << Body.LF << Body.PR << Body.VC << Body.DF << Body.MT;
+	Ar << Body.CHR << Body.KHR << Body.SHR << Body.AHR;
+	Ar << Body.SRHR_CL << Body.SKHR_CL << Body.SSHR_CL << Body.SR_SPLT_CL << Body.SK_SPLT_CL << Body.SS_SPLT_CL;
+	Ar << Body.V_IT << Body.P_IT << Body.D_IT << Body.C_IT;
+	Ar << Body.LST << Body.AST << Body.VST;
+	Ar << Body.AnchorRigidBodies << Body.PinVertexIndices;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FPmxModel& Model)
+{
+	Ar << Model.Header << Model.Vertices << Model.Indices << Model.Textures << Model.Materials << Model.Bones;
+	Ar << Model.Morphs << Model.DisplayFrames << Model.RigidBodies << Model.Joints << Model.SoftBodies;
+	return Ar;
+}
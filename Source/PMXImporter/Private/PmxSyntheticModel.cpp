@@ -0,0 +1,346 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSyntheticModel.h"
+#include "PmxStructs.h"
+#include "PmxWriter.h"
+#include "Math/RandomStream.h"
+
+namespace PmxSyntheticModelPrivate
+{
+	/** Grid width in vertices (rows grow with the vertex count) */
+	static constexpr int32 GridColumns = 256;
+	static constexpr float GridSpacing = 0.05f;
+
+	/** Bones per hair chain below the center bone */
+	static constexpr int32 ChainLength = 8;
+
+	/** Vertices moved by one vertex / UV morph */
+	static constexpr int32 MaxMorphVertices = 2000;
+
+	static constexpr uint16 BoneFlagRotatable = 0x0002;
+	static constexpr uint16 BoneFlagMovable = 0x0004;
+	static constexpr uint16 BoneFlagVisible = 0x0008;
+	static constexpr uint16 BoneFlagEnabled = 0x0010;
+	static constexpr uint16 BoneFlagIK = 0x0020;
+
+	static uint8 GetIndexSize(uint8 Requested, int32 Count)
+	{
+		return FMath::Max(Requested, PMXWriter::GetRequiredIndexSize(Count));
+	}
+
+	static void AddBones(const FPmxSyntheticModelSpec& Spec, FPmxModel& Model)
+	{
+		const int32 NumDeformBones = FMath::Max(Spec.NumBones, 3);
+		Model.Bones.SetNum(NumDeformBones);
+
+		FPmxBone& Root = Model.Bones[0];
+		Root.Name = TEXT("全ての親");
+		Root.NameEng = TEXT("master");
+		Root.Position = FVector3f::ZeroVector;
+
+		FPmxBone& Center = Model.Bones[1];
+		Center.Name = TEXT("センター");
+		Center.NameEng = TEXT("center");
+		Center.Position = FVector3f(0.0f, 8.0f, 0.0f);
+		Center.ParentBoneIndex = 0;
+
+		const int32 NumChains = FMath::DivideAndRoundUp(NumDeformBones - 2, ChainLength);
+		for (int32 BoneIndex = 2; BoneIndex < NumDeformBones; ++BoneIndex)
+		{
+			const int32 Chain = (BoneIndex - 2) / ChainLength;
+			const int32 Link = (BoneIndex - 2) % ChainLength;
+			FPmxBone& Bone = Model.Bones[BoneIndex];
+			Bone.Name = FString::Printf(TEXT("髪_%d_%d"), Chain, Link);
+			Bone.NameEng = FString::Printf(TEXT("hair_%d_%d"), Chain, Link);
+			Bone.Position = FVector3f((Chain - NumChains * 0.5f) * 1.0f, 16.0f - Link * 1.5f, 0.0f);
+			Bone.ParentBoneIndex = Link == 0 ? 1 : BoneIndex - 1;
+		}
+
+		for (FPmxBone& Bone : Model.Bones)
+		{
+			Bone.BoneFlags = BoneFlagRotatable | BoneFlagMovable | BoneFlagVisible | BoneFlagEnabled;
+			Bone.Offset = FVector3f(0.0f, -1.5f, 0.0f);
+		}
+
+		// IK on the first chain so the rig builder has a solver to describe
+		if (NumDeformBones >= 5)
+		{
+			FPmxBone& IKBone = Model.Bones.AddDefaulted_GetRef();
+			IKBone.Name = TEXT("髪IK");
+			IKBone.NameEng = TEXT("hair_IK");
+			IKBone.ParentBoneIndex = 0;
+			IKBone.BoneFlags = BoneFlagRotatable | BoneFlagMovable | BoneFlagVisible | BoneFlagEnabled | BoneFlagIK;
+			IKBone.IKTargetBoneIndex = 4;
+			IKBone.Position = Model.Bones[4].Position;
+			IKBone.IKLoopCount = 40;
+			IKBone.IKLimitAngle = 0.5f;
+			for (const int32 LinkBone : { 3, 2 })
+			{
+				FPmxBone::FPmxIKLink& Link = IKBone.IKLinks.AddDefaulted_GetRef();
+				Link.BoneIndex = LinkBone;
+				Link.AngleLimitFlag = LinkBone == 3 ? 1 : 0;
+				Link.LimitMin = FVector3f(-PI, 0.0f, 0.0f);
+				Link.LimitMax = FVector3f(-0.01f, 0.0f, 0.0f);
+			}
+		}
+	}
+
+	static void AddMesh(const FPmxSyntheticModelSpec& Spec, FRandomStream& Random, FPmxModel& Model)
+	{
+		const int32 NumVertices = FMath::Max(Spec.NumVertices, 4);
+		const int32 Columns = FMath::Min(GridColumns, NumVertices / 2);
+		const int32 Rows = FMath::DivideAndRoundUp(NumVertices, Columns);
+		const int32 NumDeformBones = FMath::Max(Spec.NumBones, 3);
+
+		Model.Vertices.SetNum(NumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			const int32 Row = VertexIndex / Columns;
+			const int32 Column = VertexIndex % Columns;
+			FPmxVertex& Vertex = Model.Vertices[VertexIndex];
+			Vertex.Position = FVector3f((Column - Columns * 0.5f) * GridSpacing, Row * GridSpacing, FMath::Sin(Column * 0.1f) * 0.2f);
+			Vertex.Normal = FVector3f(0.0f, 0.0f, -1.0f);
+			Vertex.UV = FVector2f(Column / float(FMath::Max(Columns - 1, 1)), Row / float(FMath::Max(Rows - 1, 1)));
+			Vertex.EdgeScale = 1.0f;
+
+			// Rows are banded over the deforming bones; every weight type appears in every band
+			const int32 BoneA = 1 + (Row * (NumDeformBones - 1)) / Rows;
+			const auto Neighbour = [&](int32 Offset) { return FMath::Min(BoneA + Offset, NumDeformBones - 1); };
+			Vertex.WeightType = static_cast<uint8>(VertexIndex % 4);
+			switch (Vertex.WeightType)
+			{
+			case 0:
+				Vertex.BoneIndices = { BoneA };
+				Vertex.BoneWeights = { 1.0f };
+				break;
+			case 1:
+			case 3:
+			{
+				const float Weight = Random.FRandRange(0.2f, 0.8f);
+				Vertex.BoneIndices = { BoneA, Neighbour(1) };
+				Vertex.BoneWeights = { Weight, 1.0f - Weight };
+				if (Vertex.WeightType == 3)
+				{
+					Vertex.C = (Model.Bones[BoneA].Position + Model.Bones[Neighbour(1)].Position) * 0.5f;
+					Vertex.R0 = Vertex.C;
+					Vertex.R1 = Vertex.C;
+				}
+				break;
+			}
+			default:
+				Vertex.BoneIndices = { BoneA, Neighbour(1), Neighbour(2), FMath::Max(BoneA - 1, 1) };
+				Vertex.BoneWeights = { 0.4f, 0.3f, 0.2f, 0.1f };
+				break;
+			}
+		}
+
+		// Two triangles per complete grid cell
+		for (int32 Row = 0; Row + 1 < Rows; ++Row)
+		{
+			for (int32 Column = 0; Column + 1 < Columns; ++Column)
+			{
+				const int32 V0 = Row * Columns + Column;
+				const int32 V3 = V0 + Columns + 1;
+				if (V3 >= NumVertices)
+				{
+					break;
+				}
+				Model.Indices.Append({ V0, V0 + Columns, V0 + 1, V0 + 1, V0 + Columns, V3 });
+			}
+		}
+
+		// Contiguous triangle ranges per material
+		const int32 NumTriangles = Model.Indices.Num() / 3;
+		const int32 NumMaterials = FMath::Clamp(Spec.NumMaterials, 1, FMath::Max(NumTriangles, 1));
+		for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+		{
+			const int32 First = NumTriangles * MaterialIndex / NumMaterials;
+			const int32 Last = NumTriangles * (MaterialIndex + 1) / NumMaterials;
+
+			FPmxMaterial& Material = Model.Materials.AddDefaulted_GetRef();
+			Material.Name = FString::Printf(TEXT("材質%d"), MaterialIndex);
+			Material.NameEng = FString::Printf(TEXT("Material%d"), MaterialIndex);
+			Material.Diffuse = FLinearColor(Random.FRand(), Random.FRand(), Random.FRand(), 1.0f);
+			Material.Specular = FVector3f(0.1f);
+			Material.SpecularStrength = 5.0f;
+			Material.Ambient = FVector3f(0.5f);
+			Material.DrawingFlags = MaterialIndex % 2 == 0 ? 0x10 : 0x01;
+			Material.EdgeSize = 1.0f;
+			Material.SharedToonFlag = 1;
+			Material.ToonTextureIndex = MaterialIndex % 10;
+			Material.SurfaceCount = (Last - First) * 3;
+		}
+	}
+
+	static void AddMorphs(const FPmxSyntheticModelSpec& Spec, FRandomStream& Random, FPmxModel& Model)
+	{
+		const int32 NumVertices = Model.Vertices.Num();
+		const int32 MorphVertices = FMath::Min(NumVertices, MaxMorphVertices);
+		for (int32 MorphIndex = 0; MorphIndex < Spec.NumMorphs; ++MorphIndex)
+		{
+			FPmxMorph& Morph = Model.Morphs.AddDefaulted_GetRef();
+			Morph.Name = FString::Printf(TEXT("モーフ%d"), MorphIndex);
+			Morph.NameEng = FString::Printf(TEXT("Morph%d"), MorphIndex);
+			Morph.ControlPanel = static_cast<uint8>(1 + MorphIndex % 3);
+
+			const int32 FirstVertex = Random.RandRange(0, NumVertices - MorphVertices);
+			switch (MorphIndex % 10)
+			{
+			case 0:
+				if (MorphIndex > 0)
+				{
+					Morph.MorphType = 0;
+					for (int32 Child = FMath::Max(MorphIndex - 3, 0); Child < MorphIndex; ++Child)
+					{
+						Morph.GroupMorphs.Add({ Child, 0.5f });
+					}
+					break;
+				}
+				// The first morph has nothing to group
+				[[fallthrough]];
+			default:
+				Morph.MorphType = 1;
+				Morph.VertexMorphs.SetNum(MorphVertices);
+				for (int32 Offset = 0; Offset < MorphVertices; ++Offset)
+				{
+					Morph.VertexMorphs[Offset].VertexIndex = FirstVertex + Offset;
+					Morph.VertexMorphs[Offset].Offset = FVector3f(0.0f, 0.0f, Random.FRandRange(-0.05f, 0.05f));
+				}
+				break;
+			case 1:
+				Morph.MorphType = 2;
+				for (int32 BoneIndex = 2; BoneIndex < FMath::Min(Model.Bones.Num(), 5); ++BoneIndex)
+				{
+					FPmxBoneMorph& BoneMorph = Morph.BoneMorphs.AddDefaulted_GetRef();
+					BoneMorph.BoneIndex = BoneIndex;
+					BoneMorph.Translation = FVector3f(0.0f, 0.1f, 0.0f);
+					BoneMorph.Rotation = FQuat4f(FVector3f::XAxisVector, 0.2f);
+				}
+				break;
+			case 2:
+				Morph.MorphType = 3;
+				Morph.UVMorphs.SetNum(MorphVertices);
+				for (int32 Offset = 0; Offset < MorphVertices; ++Offset)
+				{
+					Morph.UVMorphs[Offset].VertexIndex = FirstVertex + Offset;
+					Morph.UVMorphs[Offset].Offset = FVector4f(0.01f, 0.0f, 0.0f, 0.0f);
+				}
+				break;
+			case 3:
+			{
+				Morph.MorphType = 8;
+				FPmxMaterialMorph& MaterialMorph = Morph.MaterialMorphs.AddDefaulted_GetRef();
+				MaterialMorph.MaterialIndex = MorphIndex % (Model.Materials.Num() + 1) - 1; // -1 = every material
+				MaterialMorph.OffsetType = static_cast<uint8>(MorphIndex % 2);
+				MaterialMorph.Diffuse = FLinearColor(1.0f, 0.5f, 0.5f, 1.0f);
+				MaterialMorph.Specular = FLinearColor::White;
+				MaterialMorph.Ambient = FLinearColor::White;
+				MaterialMorph.EdgeColor = FLinearColor::White;
+				MaterialMorph.TextureColor = FVector4f::One();
+				MaterialMorph.SphereTextureColor = FVector4f::One();
+				MaterialMorph.ToonTextureColor = FVector4f::One();
+				break;
+			}
+			}
+		}
+	}
+
+	static void AddDisplayFrames(FPmxModel& Model)
+	{
+		FPmxDisplayFrame& RootFrame = Model.DisplayFrames.AddDefaulted_GetRef();
+		RootFrame.Name = TEXT("Root");
+		RootFrame.NameEng = TEXT("Root");
+		RootFrame.SpecialFlag = 1;
+		RootFrame.Elements.Add({ 0, 0 });
+
+		FPmxDisplayFrame& MorphFrame = Model.DisplayFrames.AddDefaulted_GetRef();
+		MorphFrame.Name = TEXT("表情");
+		MorphFrame.NameEng = TEXT("Exp");
+		MorphFrame.SpecialFlag = 1;
+		for (int32 MorphIndex = 0; MorphIndex < Model.Morphs.Num(); ++MorphIndex)
+		{
+			MorphFrame.Elements.Add({ 1, MorphIndex });
+		}
+
+		FPmxDisplayFrame& BoneFrame = Model.DisplayFrames.AddDefaulted_GetRef();
+		BoneFrame.Name = TEXT("髪");
+		BoneFrame.NameEng = TEXT("Hair");
+		for (int32 BoneIndex = 1; BoneIndex < Model.Bones.Num(); ++BoneIndex)
+		{
+			BoneFrame.Elements.Add({ 0, BoneIndex });
+		}
+	}
+
+	static void AddPhysics(const FPmxSyntheticModelSpec& Spec, FPmxModel& Model)
+	{
+		// Bodies follow the hair chains (several bodies per bone once there are more bodies than bones)
+		const int32 NumChainBones = FMath::Max(Spec.NumBones, 3) - 2;
+		for (int32 BodyIndex = 0; BodyIndex < Spec.NumBodies; ++BodyIndex)
+		{
+			const int32 BoneIndex = 2 + BodyIndex % NumChainBones;
+			const int32 Link = (BoneIndex - 2) % ChainLength;
+
+			FPmxRigidBody& Body = Model.RigidBodies.AddDefaulted_GetRef();
+			Body.Name = FString::Printf(TEXT("剛体%d"), BodyIndex);
+			Body.NameEng = FString::Printf(TEXT("Body%d"), BodyIndex);
+			Body.RelatedBoneIndex = BoneIndex;
+			Body.Group = static_cast<uint8>(BodyIndex % 16);
+			Body.NonCollisionGroup = static_cast<uint16>(1 << Body.Group);
+			Body.Shape = static_cast<uint8>(BodyIndex % 3);
+			Body.Size = FVector3f(0.3f, 0.6f, 0.3f);
+			Body.Position = Model.Bones[BoneIndex].Position + FVector3f(0.0f, -0.75f, 0.0f);
+			Body.Rotation = FVector3f::ZeroVector;
+			Body.Mass = 1.0f;
+			Body.MoveAttenuation = 0.5f;
+			Body.RotationAttenuation = 0.5f;
+			Body.Friction = 0.5f;
+			Body.PhysicsType = Link == 0 ? 0 : static_cast<uint8>(1 + BodyIndex % 2);
+
+			if (Link > 0 && BodyIndex > 0)
+			{
+				FPmxJoint& Joint = Model.Joints.AddDefaulted_GetRef();
+				Joint.Name = FString::Printf(TEXT("ジョイント%d"), BodyIndex);
+				Joint.NameEng = FString::Printf(TEXT("Joint%d"), BodyIndex);
+				Joint.RigidBodyIndexA = BodyIndex - 1;
+				Joint.RigidBodyIndexB = BodyIndex;
+				Joint.Position = Model.Bones[BoneIndex].Position;
+				Joint.Rotation = FVector3f::ZeroVector;
+				Joint.MoveRestrictionMin = FVector3f::ZeroVector;
+				Joint.MoveRestrictionMax = FVector3f::ZeroVector;
+				Joint.RotationRestrictionMin = FVector3f(-0.5f);
+				Joint.RotationRestrictionMax = FVector3f(0.5f);
+				Joint.SpringMoveCoefficient = FVector3f::ZeroVector;
+				Joint.SpringRotationCoefficient = FVector3f(10.0f);
+			}
+		}
+	}
+}
+
+void FPmxSyntheticModel::Generate(const FPmxSyntheticModelSpec& Spec, FPmxModel& OutModel)
+{
+	using namespace PmxSyntheticModelPrivate;
+
+	OutModel = FPmxModel();
+	FRandomStream Random(Spec.Seed);
+
+	AddBones(Spec, OutModel);
+	AddMesh(Spec, Random, OutModel);
+	AddMorphs(Spec, Random, OutModel);
+	AddDisplayFrames(OutModel);
+	AddPhysics(Spec, OutModel);
+
+	FPmxHeader& Header = OutModel.Header;
+	Header.Version = 2.0f;
+	Header.EncodeType = Spec.EncodeType;
+	Header.AdditionalUVNum = 0;
+	Header.VertexIndexSize = GetIndexSize(Spec.IndexSize, OutModel.Vertices.Num());
+	Header.TextureIndexSize = GetIndexSize(Spec.IndexSize, OutModel.Textures.Num());
+	Header.MaterialIndexSize = GetIndexSize(Spec.IndexSize, OutModel.Materials.Num());
+	Header.BoneIndexSize = GetIndexSize(Spec.IndexSize, OutModel.Bones.Num());
+	Header.MorphIndexSize = GetIndexSize(Spec.IndexSize, OutModel.Morphs.Num());
+	Header.RigidbodyIndexSize = GetIndexSize(Spec.IndexSize, OutModel.RigidBodies.Num());
+	Header.ModelName = Spec.Name.IsEmpty() ? TEXT("合成モデル") : Spec.Name;
+	Header.ModelNameEng = Spec.Name.IsEmpty() ? TEXT("Synthetic") : Spec.Name;
+	Header.Comment = FString::Printf(TEXT("PMXImporter benchmark model (seed %d)"), Spec.Seed);
+	Header.CommentEng = Header.Comment;
+}
@@ -37,12 +37,23 @@
 #include "PmxNodeBuilder.h"
 #include "PmxMaterialMapping.h"
 #include "PmxPhysicsBuilder.h"
+#include "PmxRigBuilder.h"
+#include "PmxRigDefinition.h"
+#include "PmxSdefBuilder.h"
+#include "PmxDisplayBuilder.h"
+#include "PmxImportSession.h"
+#include "PmxModelCache.h"
+#include "PmxCompactModel.h"
+#include "PmxManifestBuilder.h"
+#include "PmxImportManifest.h"
+#include "PmxImportProfiler.h"
+#include "PmxImportDiagnostics.h"
+#include "PmxMeshSimplifier.h"
+#include "PmxSkinOptimizer.h"
+#include "PmxOutlineBuilder.h"
+#include "PmxVertexStreams.h"
 #include "ImageCore.h"
 
-// Static member definitions
-TMap<FString, TSharedPtr<FPmxModel>> UPmxTranslator::MeshPayloadCache;
-TMap<FString, TSharedPtr<FPmxPhysicsCache>> UPmxTranslator::PhysicsPayloadCache;
-
 bool UPmxTranslator::CanImportSourceData(const UInterchangeSourceData* InSourceData) const
 {
     if (!InSourceData)
@@ -58,11 +69,16 @@ bool UPmxTranslator::CanImportSourceData(const UInterchangeSourceData* InSourceD
 bool UPmxTranslator::Translate(UInterchangeBaseNodeContainer& BaseNodeContainer) const
 {
     using ContainerType = EInterchangeNodeContainerType;
-    
-    LogImportStart(TEXT("PMX Import"));
-    
+
     // Get source data
     const UInterchangeSourceData* PMXSourceData = GetSourceData();
+
+    // All per-import state lives in the session so concurrent imports never share it
+    Session = FPmxImportSessionRegistry::CreateSession(PMXSourceData ? PMXSourceData->GetFilename() : FString());
+    UInterchangeSourceNode::FindOrCreateUniqueInstance(&BaseNodeContainer)->AddStringAttribute(FPmxImportSessionRegistry::SessionIdAttributeKey, Session->Id.ToString());
+
+    PMX_IMPORT_ROOT_SCOPE("Translate", Session->Profiler);
+    
     if (!PMXSourceData)
     {
         UE_LOG(LogPMXImporter, Error, TEXT("No source data provided"));
@@ -70,26 +86,18 @@ bool UPmxTranslator::Translate(UInterchangeBaseNodeContainer& BaseNodeContainer)
     }
 
     // Load PMX file data
-    FPmxModel PmxModel;
     TArray<uint8> FileData;
-    
-    if (!FFileHelper::LoadFileToArray(FileData, *PMXSourceData->GetFilename()))
-    {
-        UE_LOG(LogPMXImporter, Error, TEXT("Failed to load PMX file: %s"), *PMXSourceData->GetFilename());
-        return false;
-    }
-
-    if (!PMXReader::LoadPmxFromData(FileData, PmxModel))
     {
-        UE_LOG(LogPMXImporter, Error, TEXT("Failed to parse PMX file: %s"), *PMXSourceData->GetFilename());
-        return false;
+        PMX_IMPORT_SCOPE("Load File");
+        if (!FFileHelper::LoadFileToArray(FileData, *PMXSourceData->GetFilename()))
+        {
+            UE_LOG(LogPMXImporter, Error, TEXT("Failed to load PMX file: %s"), *PMXSourceData->GetFilename());
+            return false;
+        }
     }
+    Session->Profiler->SetCount(TEXT("file_bytes"), FileData.Num());
 
-    UE_LOG(LogPMXImporter, Log, TEXT("Successfully loaded PMX model: %s"), *PmxModel.Header.ModelName);
-
-    // Initialize import options with defaults
-    ImportOptions = FPmxImportOptions();
-
+    // Import options start from defaults (the session is new)
     // Read options from SourceNode (set by UPmxPipeline::ExecutePipeline)
     if (const UInterchangeSourceNode* SourceNode = UInterchangeSourceNode::GetUniqueInstance(&BaseNodeContainer))
     {
@@ -97,103 +105,130 @@ bool UPmxTranslator::Translate(UInterchangeBaseNodeContainer& BaseNodeContainer)
         float ScaleValue;
         if (SourceNode->GetFloatAttribute(TEXT("PMX:Scale"), ScaleValue))
         {
-            ImportOptions.Scale = ScaleValue;
+            Session->Options.Scale = ScaleValue;
         }
 
         // Mesh options
         bool bValue;
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportMesh"), bValue))
         {
-            ImportOptions.bImportMesh = bValue;
+            Session->Options.bImportMesh = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportMorphs"), bValue))
         {
-            ImportOptions.bImportMorphs = bValue;
+            Session->Options.bImportMorphs = bValue;
         }
 
         // Skeleton options
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportArmature"), bValue))
         {
-            ImportOptions.bImportArmature = bValue;
+            Session->Options.bImportArmature = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:RenameLRBones"), bValue))
         {
-            ImportOptions.bRenameLRBones = bValue;
+            Session->Options.bRenameLRBones = bValue;
+        }
+        if (SourceNode->GetBooleanAttribute(TEXT("PMX:TranslateBoneNames"), bValue))
+        {
+            Session->Options.bTranslateBoneNames = bValue;
+        }
+        if (Session->Options.bTranslateBoneNames)
+        {
+            Session->Options.BoneRenameTable = FPmxUtils::GetStandardBoneRenameTable();
+        }
+        int32 NumRenameEntries = 0;
+        if (SourceNode->GetInt32Attribute(TEXT("PMX:BoneRenameTable"), NumRenameEntries))
+        {
+            // "PMX:BoneRenameTable:Source<n>" / "Target<n>" pairs; user entries override the standard table
+            for (int32 EntryIndex = 0; EntryIndex < NumRenameEntries; ++EntryIndex)
+            {
+                FString Source, Target;
+                if (SourceNode->GetStringAttribute(FString::Printf(TEXT("PMX:BoneRenameTable:Source%d"), EntryIndex), Source)
+                    && SourceNode->GetStringAttribute(FString::Printf(TEXT("PMX:BoneRenameTable:Target%d"), EntryIndex), Target))
+                {
+                    Source.TrimStartAndEndInline();
+                    Target.TrimStartAndEndInline();
+                    if (!Source.IsEmpty() && !Target.IsEmpty())
+                    {
+                        Session->Options.BoneRenameTable.Add(Source, Target);
+                    }
+                }
+            }
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:FixIKLinks"), bValue))
         {
-            ImportOptions.bFixIKLinks = bValue;
+            Session->Options.bFixIKLinks = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ApplyBoneFixedAxis"), bValue))
         {
-            ImportOptions.bApplyBoneFixedAxis = bValue;
+            Session->Options.bApplyBoneFixedAxis = bValue;
         }
 
         // Physics options
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportPhysics"), bValue))
         {
-            ImportOptions.bImportPhysics = bValue;
+            Session->Options.bImportPhysics = bValue;
         }
         FString PhysicsType2ModeStr;
         if (SourceNode->GetStringAttribute(TEXT("PMX:PhysicsType2Mode"), PhysicsType2ModeStr))
         {
-            ImportOptions.PhysicsType2Mode = static_cast<EPmxPhysicsType2Handling>(FCString::Atoi(*PhysicsType2ModeStr));
+            Session->Options.PhysicsType2Mode = static_cast<EPmxPhysicsType2Handling>(FCString::Atoi(*PhysicsType2ModeStr));
         }
         float FloatValue;
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsMassScale"), FloatValue))
         {
-            ImportOptions.PhysicsMassScale = FloatValue;
+            Session->Options.PhysicsMassScale = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsDampingScale"), FloatValue))
         {
-            ImportOptions.PhysicsDampingScale = FloatValue;
+            Session->Options.PhysicsDampingScale = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsShapeScale"), FloatValue))
         {
-            ImportOptions.PhysicsShapeScale = FloatValue;
+            Session->Options.PhysicsShapeScale = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsSphereScale"), FloatValue))
         {
-            ImportOptions.PhysicsSphereScale = FloatValue;
+            Session->Options.PhysicsSphereScale = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsBoxScale"), FloatValue))
         {
-            ImportOptions.PhysicsBoxScale = FloatValue;
+            Session->Options.PhysicsBoxScale = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:PhysicsCapsuleScale"), FloatValue))
         {
-            ImportOptions.PhysicsCapsuleScale = FloatValue;
+            Session->Options.PhysicsCapsuleScale = FloatValue;
         }
 
         UE_LOG(LogPMXImporter, Display, TEXT("PmxTranslator: Read options - ShapeScale=%.2f, SphereScale=%.2f, BoxScale=%.2f, CapsuleScale=%.2f"),
-            ImportOptions.PhysicsShapeScale, ImportOptions.PhysicsSphereScale, ImportOptions.PhysicsBoxScale, ImportOptions.PhysicsCapsuleScale);
+            Session->Options.PhysicsShapeScale, Session->Options.PhysicsSphereScale, Session->Options.PhysicsBoxScale, Session->Options.PhysicsCapsuleScale);
 
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ForceStandardBonesKinematic"), bValue))
         {
-            ImportOptions.bForceStandardBonesKinematic = bValue;
+            Session->Options.bForceStandardBonesKinematic = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ForceNonStandardBonesSimulated"), bValue))
         {
-            ImportOptions.bForceNonStandardBonesSimulated = bValue;
+            Session->Options.bForceNonStandardBonesSimulated = bValue;
         }
 
         // Material options
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:UseMipmap"), bValue))
         {
-            ImportOptions.bUseMipmap = bValue;
+            Session->Options.bUseMipmap = bValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:SphBlendFactor"), FloatValue))
         {
-            ImportOptions.SphBlendFactor = FloatValue;
+            Session->Options.SphBlendFactor = FloatValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:SpaBlendFactor"), FloatValue))
         {
-            ImportOptions.SpaBlendFactor = FloatValue;
+            Session->Options.SpaBlendFactor = FloatValue;
         }
         FString StringValue;
         if (SourceNode->GetStringAttribute(TEXT("PMX:ParentMaterial"), StringValue))
         {
-            ImportOptions.ParentMaterialPath = StringValue;
+            Session->Options.ParentMaterialPath = StringValue;
             UE_LOG(LogPMXImporter, Display, TEXT("PmxTranslator: Read ParentMaterial='%s' from SourceNode"), *StringValue);
         }
         else
@@ -204,72 +239,98 @@ bool UPmxTranslator::Translate(UInterchangeBaseNodeContainer& BaseNodeContainer)
         // Advanced options
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:CleanModel"), bValue))
         {
-            ImportOptions.bCleanModel = bValue;
+            Session->Options.bCleanModel = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:RemoveDoubles"), bValue))
         {
-            ImportOptions.bRemoveDoubles = bValue;
+            Session->Options.bRemoveDoubles = bValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:MarkSharpEdges"), bValue))
         {
-            ImportOptions.bMarkSharpEdges = bValue;
+            Session->Options.bMarkSharpEdges = bValue;
         }
         if (SourceNode->GetFloatAttribute(TEXT("PMX:SharpEdgeAngle"), FloatValue))
         {
-            ImportOptions.SharpEdgeAngle = FloatValue;
-        }
-        if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportAddUV2AsVertexColors"), bValue))
-        {
-            ImportOptions.bImportAddUV2AsVertexColors = bValue;
+            Session->Options.SharpEdgeAngle = FloatValue;
         }
         if (SourceNode->GetBooleanAttribute(TEXT("PMX:ImportDisplay"), bValue))
         {
-            ImportOptions.bImportDisplay = bValue;
+            Session->Options.bImportDisplay = bValue;
         }
 
         UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxTranslator: Options loaded from SourceNode (Scale=%.2f, ImportMorphs=%d, ImportPhysics=%d)"),
-            ImportOptions.Scale, ImportOptions.bImportMorphs, ImportOptions.bImportPhysics);
+            Session->Options.Scale, Session->Options.bImportMorphs, Session->Options.bImportPhysics);
     }
     else
     {
         UE_LOG(LogPMXImporter, Verbose, TEXT("UPmxTranslator: No SourceNode found, using default options"));
     }
 
+    // Step 1: Translated model, from the DerivedDataCache when the file and geometry options are unchanged
+    FPmxModel CleanedModel;
+    TMap<int32, int32> VertexMap;
+    const FString CacheKey = FPmxModelCache::IsEnabled() ? FPmxModelCache::BuildCacheKey(FileData, Session->Options) : FString();
+    if (CacheKey.IsEmpty() || !FPmxModelCache::Load(CacheKey, CleanedModel, VertexMap))
+    {
+        const double BuildStartTime = FPlatformTime::Seconds();
+        const bool bCompactEnabled = FPmxCompactModel::IsEnabled();
+        if (!bCompactEnabled || !FPmxCompactModel::LoadForSource(PMXSourceData->GetFilename(), FileData, CleanedModel))
+        {
+            if (!PMXReader::LoadPmxFromData(FileData, CleanedModel))
+            {
+                UE_LOG(LogPMXImporter, Error, TEXT("Failed to parse PMX file: %s"), *PMXSourceData->GetFilename());
+                return false;
+            }
+            if (bCompactEnabled)
+            {
+                FPmxCompactModel::StoreForSource(PMXSourceData->GetFilename(), FileData, CleanedModel);
+            }
+        }
+
+        UE_LOG(LogPMXImporter, Log, TEXT("Successfully loaded PMX model: %s"), *CleanedModel.Header.ModelName);
+
+        BuildTranslatedModel(CleanedModel, VertexMap);
+        if (!CacheKey.IsEmpty())
+        {
+            FPmxModelCache::Store(CacheKey, CleanedModel, VertexMap, FPlatformTime::Seconds() - BuildStartTime);
+        }
+    }
+    FileData.Empty();
+    FPmxModelCache::LogStats();
+
     // Execute main import logic
-    bool bSuccess = ExecutePmxImport(PmxModel, BaseNodeContainer);
+    bool bSuccess = ExecutePmxImport(MoveTemp(CleanedModel), VertexMap, BaseNodeContainer);
     
     if (bSuccess)
     {
-        LogImportSummary(PmxModel);
-        LogImportComplete(TEXT("PMX Import"));
+        LogImportSummary(*Session->Model);
     }
     
     return bSuccess;
 }
 
-bool UPmxTranslator::ExecutePmxImport(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const
+void UPmxTranslator::BuildTranslatedModel(FPmxModel& PmxModel, TMap<int32, int32>& OutVertexMap) const
 {
-    // Step 1: Data cleaning
-    FPmxModel CleanedModel = PmxModel;
-    TMap<int32, int32> VertexMap;
-    
-    if (ImportOptions.bCleanModel)
+    // Only bCleanModel, bRemoveDoubles and bImportMorphs may change the result (see FPmxModelCache::BuildCacheKey);
+    // skin weight cleanup and the GPU order run in UPmxPipeline::OptimizeMesh
+    if (Session->Options.bCleanModel)
     {
-        LogImportStart(TEXT("Data Cleaning"));
-        CleanPmxModel(CleanedModel, !ImportOptions.bImportMorphs);
-        LogImportComplete(TEXT("Data Cleaning"));
+        PMX_IMPORT_SCOPE("Data Cleaning");
+        CleanPmxModel(PmxModel, !Session->Options.bImportMorphs);
     }
-    
-    if (ImportOptions.bRemoveDoubles)
+
+    if (Session->Options.bRemoveDoubles)
     {
-        LogImportStart(TEXT("Remove Doubles"));
-        RemoveDoubles(CleanedModel, !ImportOptions.bImportMorphs, VertexMap);
-        LogImportComplete(TEXT("Remove Doubles"));
+        PMX_IMPORT_SCOPE("Remove Doubles");
+        RemoveDoubles(PmxModel, !Session->Options.bImportMorphs, OutVertexMap);
     }
-    
+
     // Fix repeated morph names
-    FixRepeatedMorphNames(CleanedModel);
+    FixRepeatedMorphNames(PmxModel);
+}
 
+bool UPmxTranslator::ExecutePmxImport(FPmxModel&& CleanedModel, const TMap<int32, int32>& VertexMap, UInterchangeBaseNodeContainer& BaseNodeContainer) const
+{
     // Step 2: Scene root creation
     UInterchangeSceneNode* RootNode = FPmxNodeBuilder::CreateSceneRoot(CleanedModel, BaseNodeContainer);
     if (!RootNode)
@@ -282,43 +343,45 @@ bool UPmxTranslator::ExecutePmxImport(const FPmxModel& PmxModel, UInterchangeBas
     TArray<FString> MaterialUids;
     
     // Step 3: Import sections based on options
-    if (ImportOptions.bImportArmature)
+    if (Session->Options.bImportArmature)
     {
-        LogImportStart(TEXT("Armature"));
+        PMX_IMPORT_SCOPE("Armature");
         ImportArmatureSection(CleanedModel, BaseNodeContainer, RootJointUid, SkeletonUid);
-        LogImportComplete(TEXT("Armature"));
     }
     
-    if (ImportOptions.bImportMesh)
+    if (Session->Options.bImportMesh)
     {
-        LogImportStart(TEXT("Mesh"));
+        PMX_IMPORT_SCOPE("Mesh");
         ImportMeshSection(CleanedModel, BaseNodeContainer, VertexMap, SkeletonUid, MaterialUids, MeshUid, SkeletalMeshUid);
-        LogImportComplete(TEXT("Mesh"));
     }
     
-    if (ImportOptions.bImportPhysics && !RootJointUid.IsEmpty())
+    if (Session->Options.bImportPhysics && !RootJointUid.IsEmpty())
     {
-        LogImportStart(TEXT("Physics"));
+        PMX_IMPORT_SCOPE("Physics");
         ImportPhysicsSection(CleanedModel, BaseNodeContainer, SkeletonUid, SkeletalMeshUid);
-        LogImportComplete(TEXT("Physics"));
     }
     
-    if (ImportOptions.bImportMorphs && !MeshUid.IsEmpty())
+    if (Session->Options.bImportMorphs && !MeshUid.IsEmpty())
     {
-        LogImportStart(TEXT("Morphs"));
+        PMX_IMPORT_SCOPE("Morphs");
         ImportMorphsSection(CleanedModel, BaseNodeContainer, MeshUid);
-        LogImportComplete(TEXT("Morphs"));
     }
     
-    if (ImportOptions.bImportDisplay)
+    if (Session->Options.bImportDisplay)
     {
-        LogImportStart(TEXT("Display"));
+        PMX_IMPORT_SCOPE("Display");
         ImportDisplaySection(CleanedModel, BaseNodeContainer);
-        LogImportComplete(TEXT("Display"));
     }
 
-    // Cache the model for payload processing
-    MeshPayloadCache.Add(TEXT("PMX_GEOMETRY"), MakeShared<FPmxModel>(MoveTemp(CleanedModel)));
+    // Section hashes for incremental reimport (compared by the pipeline against the existing asset's manifest)
+    Session->Manifest = MakeShared<FPmxImportManifest>();
+    {
+        PMX_IMPORT_SCOPE("Build Manifest");
+        FPmxManifestBuilder::BuildManifest(CleanedModel, GetSourceData()->GetFilename(), *Session->Manifest);
+    }
+
+    // Keep the model for payload processing
+    Session->Model = MakeShared<FPmxModel>(MoveTemp(CleanedModel));
     
     return true;
 }
@@ -436,6 +499,13 @@ void UPmxTranslator::RemoveDoubles(FPmxModel& PmxModel, bool bMeshOnly, TMap<int
         FString Key = FString::Printf(TEXT("%.6f_%.6f_%.6f_UV%.6f_%.6f"), 
             Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z,
             Vertex.UV.X, Vertex.UV.Y);
+
+        // Additional UVs may become UV channels or vertex colors, which the pipeline decides after welding,
+        // so any difference is a seam
+        for (const FVector4f& AddUV : Vertex.AdditionalUV)
+        {
+            Key += FString::Printf(TEXT("_A%.6f_%.6f_%.6f_%.6f"), AddUV.X, AddUV.Y, AddUV.Z, AddUV.W);
+        }
         
         // Add morph data to key if not mesh only
         if (!bMeshOnly)
@@ -550,7 +620,7 @@ void UPmxTranslator::ImportMeshSection(const FPmxModel& PmxModel, UInterchangeBa
 
     // Import materials
     TArray<FString> SlotNames;
-    FPmxMaterialMapping::CreateMaterials(PmxModel, TextureUidMap, BaseNodeContainer, OutMaterialUids, SlotNames, ImportOptions.ParentMaterialPath);
+    FPmxMaterialMapping::CreateMaterials(PmxModel, TextureUidMap, BaseNodeContainer, OutMaterialUids, SlotNames, Session->Options.ParentMaterialPath);
     
     // Create SkeletalMesh factory node
     FString ModelName = PmxModel.Header.ModelName.IsEmpty() ? TEXT("PMX_Root") : PmxModel.Header.ModelName;
@@ -558,7 +628,7 @@ void UPmxTranslator::ImportMeshSection(const FPmxModel& PmxModel, UInterchangeBa
     const FString SkeletalMeshUid = TEXT("/PMX/SkeletalMesh");
     OutSkeletalMeshUid = SkeletalMeshUid;
     SkeletalMeshNode->InitializeSkeletalMeshNode(SkeletalMeshUid, *ModelName, USkeletalMesh::StaticClass()->GetName(), &BaseNodeContainer);
-    SkeletalMeshNode->SetCustomImportMorphTarget(ImportOptions.bImportMorphs);
+    SkeletalMeshNode->SetCustomImportMorphTarget(Session->Options.bImportMorphs);
     // Disable auto physics asset creation to avoid engine PostImport path crash; physics is created via our own factory node in ImportPhysicsSection
     SkeletalMeshNode->SetCustomCreatePhysicsAsset(false);
     
@@ -613,9 +683,12 @@ void UPmxTranslator::ImportArmatureSection(const FPmxModel& PmxModel, UInterchan
         return;
     }
     
-    // 2) Create bone/joint hierarchy using SceneNodes specialized as Joints
-    TMap<int32, UInterchangeSceneNode*> BoneIndexToJointNode;
-    OutRootJointUid = FPmxNodeBuilder::CreateBoneHierarchy(PmxModel, BaseNodeContainer, RootNode, BoneIndexToJointNode);
+    // 2) Sort bones parent-before-child and precompute bind transforms (kept on the session for the pipeline)
+    const FPmxSkeletonLayout& Layout = Session->GetSkeletonLayout(PmxModel);
+
+    // 3) Create bone/joint hierarchy using SceneNodes specialized as Joints
+    TArray<UInterchangeSceneNode*> BoneIndexToJointNode;
+    OutRootJointUid = FPmxNodeBuilder::CreateBoneHierarchy(PmxModel, Layout, BaseNodeContainer, RootNode, GetBoneNameOptions(), BoneIndexToJointNode);
     
     if (OutRootJointUid.IsEmpty())
     {
@@ -623,7 +696,7 @@ void UPmxTranslator::ImportArmatureSection(const FPmxModel& PmxModel, UInterchan
         return;
     }
     
-    // 3) Skeleton factory node
+    // 4) Skeleton factory node
     UInterchangeSkeletonFactoryNode* SkeletonNode = NewObject<UInterchangeSkeletonFactoryNode>(&BaseNodeContainer);
     const FString ModelName = PmxModel.Header.ModelName.IsEmpty() ? TEXT("PMX") : PmxModel.Header.ModelName;
     OutSkeletonUid = FString::Printf(TEXT("/PMX/Skeleton_%s"), *ModelName);
@@ -636,14 +709,54 @@ void UPmxTranslator::ImportArmatureSection(const FPmxModel& PmxModel, UInterchan
     
     UE_LOG(LogPMXImporter, Display, TEXT("Pmx Translator: Created %d bone joints with root joint: %s"), PmxModel.Bones.Num(), *OutRootJointUid);
     
-    // Apply IK constraints if enabled
-    if (ImportOptions.bFixIKLinks)
+    // 5) IK chains and append links -> evaluation-ordered rig description
+    ImportRigSection(PmxModel, Layout);
+}
+
+void UPmxTranslator::ImportRigSection(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout) const
+{
+    TSharedPtr<FPmxRigDescription> RigDescription = MakeShared<FPmxRigDescription>();
+    const TArray<FString> BoneNames = FPmxUtils::BuildUniqueBoneNames(PmxModel, GetBoneNameOptions());
+    if (!FPmxRigBuilder::BuildRigDescription(PmxModel, Layout, BoneNames, Session->Options.bFixIKLinks, *RigDescription))
     {
-        ApplyIKConstraints(PmxModel, BoneIndexToJointNode);
+        UE_LOG(LogPMXImporter, Display, TEXT("No IK chains or append links in PMX model, skipping rig generation"));
+        return;
     }
-    
-    // Apply bone transforms
-    ApplyBoneTransforms(PmxModel, BoneIndexToJointNode);
+
+    Session->Rig = RigDescription;
+
+    UE_LOG(LogPMXImporter, Display, TEXT("Cached rig description with %d steps for post-import processing"),
+        RigDescription->Steps.Num());
+}
+
+void UPmxTranslator::ImportDisplaySection(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const
+{
+    const TArray<FString> BoneNames = FPmxUtils::BuildUniqueBoneNames(PmxModel, GetBoneNameOptions());
+
+    // Same morph target names as ImportVertexMorphs(); other morph types have no morph target and are left out
+    TArray<FString> MorphNames;
+    MorphNames.Reserve(PmxModel.Morphs.Num());
+    for (const FPmxMorph& Morph : PmxModel.Morphs)
+    {
+        FString MorphName = Morph.Name.TrimStartAndEnd();
+        if (MorphName.IsEmpty())
+        {
+            MorphName = TEXT("Morph");
+        }
+        MorphNames.Add(Morph.VertexMorphs.Num() > 0 ? SafeObjectName(MorphName, 64) : FString());
+    }
+
+    TSharedPtr<FPmxDisplayDescription> DisplayDescription = MakeShared<FPmxDisplayDescription>();
+    if (!FPmxDisplayBuilder::BuildDisplayDescription(PmxModel, BoneNames, MorphNames, *DisplayDescription))
+    {
+        UE_LOG(LogPMXImporter, Display, TEXT("No display frame elements in PMX model, skipping display groups"));
+        return;
+    }
+
+    Session->Display = DisplayDescription;
+
+    UE_LOG(LogPMXImporter, Display, TEXT("Cached %d display frames for post-import processing"),
+        DisplayDescription->Groups.Num());
 }
 
 void UPmxTranslator::ImportPhysicsSection(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer,
@@ -677,25 +790,23 @@ void UPmxTranslator::ImportPhysicsSection(const FPmxModel& PmxModel, UInterchang
     PhysicsCache->RigidBodies = PmxModel.RigidBodies;
     PhysicsCache->Joints = PmxModel.Joints;
     PhysicsCache->Bones = PmxModel.Bones;
+    PhysicsCache->BoneNames = FPmxUtils::BuildUniqueBoneNames(PmxModel, GetBoneNameOptions());
     PhysicsCache->SourceFilePath = SourceData ? SourceData->GetFilename() : TEXT("");
-    PhysicsCache->Scale = ImportOptions.Scale;
-    PhysicsCache->Type2Mode = ImportOptions.PhysicsType2Mode;
-    PhysicsCache->MassScale = ImportOptions.PhysicsMassScale;
-    PhysicsCache->DampingScale = ImportOptions.PhysicsDampingScale;
-    PhysicsCache->ShapeScale = ImportOptions.PhysicsShapeScale;
-    PhysicsCache->SphereScale = ImportOptions.PhysicsSphereScale;
-    PhysicsCache->BoxScale = ImportOptions.PhysicsBoxScale;
-    PhysicsCache->CapsuleScale = ImportOptions.PhysicsCapsuleScale;
-    PhysicsCache->bForceStandardBonesKinematic = ImportOptions.bForceStandardBonesKinematic;
-    PhysicsCache->bForceNonStandardBonesSimulated = ImportOptions.bForceNonStandardBonesSimulated;
-
-    // Store in static cache using ModelName as key for matching with imported mesh name
-    // Use ModelName (not filename) to ensure consistency with SkeletalMesh->GetName() in pipeline
-    const FString CacheKey = ModelName;
-    PhysicsPayloadCache.Add(CacheKey, PhysicsCache);
-
-    UE_LOG(LogPMXImporter, Display, TEXT("Cached %d rigid bodies and %d joints for post-import processing (key: %s)"),
-        PmxModel.RigidBodies.Num(), PmxModel.Joints.Num(), *CacheKey);
+    PhysicsCache->Scale = Session->Options.Scale;
+    PhysicsCache->Type2Mode = Session->Options.PhysicsType2Mode;
+    PhysicsCache->MassScale = Session->Options.PhysicsMassScale;
+    PhysicsCache->DampingScale = Session->Options.PhysicsDampingScale;
+    PhysicsCache->ShapeScale = Session->Options.PhysicsShapeScale;
+    PhysicsCache->SphereScale = Session->Options.PhysicsSphereScale;
+    PhysicsCache->BoxScale = Session->Options.PhysicsBoxScale;
+    PhysicsCache->CapsuleScale = Session->Options.PhysicsCapsuleScale;
+    PhysicsCache->bForceStandardBonesKinematic = Session->Options.bForceStandardBonesKinematic;
+    PhysicsCache->bForceNonStandardBonesSimulated = Session->Options.bForceNonStandardBonesSimulated;
+
+    Session->Physics = PhysicsCache;
+
+    UE_LOG(LogPMXImporter, Display, TEXT("Cached %d rigid bodies and %d joints for post-import processing"),
+        PmxModel.RigidBodies.Num(), PmxModel.Joints.Num());
 }
 
 void UPmxTranslator::ImportMorphsSection(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, const FString& MeshUid) const
@@ -714,15 +825,15 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
 {
     using namespace UE::Interchange;
 
-    // Build actual mesh payload from cached PMX model
-    const TSharedPtr<FPmxModel>* FoundModel = UPmxTranslator::MeshPayloadCache.Find(TEXT("PMX_GEOMETRY"));
-    if (!FoundModel || !FoundModel->IsValid())
+    // Build actual mesh payload from the session model (final after ExecutePipeline, read-only from here on)
+    if (!Session.IsValid() || !Session->Model.IsValid())
     {
         UE_LOG(LogPMXImporter, Error, TEXT("Pmx Translator: No cached PMX model for payload key '%s'."), *PayLoadKey.UniqueId);
         return TOptional<FMeshPayloadData>();
     }
 
-    const FPmxModel& Model = *FoundModel->Get();
+    PMX_IMPORT_ROOT_SCOPE("Mesh Payload", Session->Profiler);
+    const FPmxModel& Model = *Session->Model;
 
     if (Model.Vertices.IsEmpty())
     {
@@ -730,6 +841,39 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
         return TOptional<FMeshPayloadData>();
     }
 
+    // Generated LOD payloads are prefixed "PMX_LOD<n>:" and only use the vertices their triangles reference
+    const FPmxMeshLod* Lod = nullptr;
+    if (PayLoadKey.UniqueId.StartsWith(TEXT("PMX_LOD")))
+    {
+        const FString& Key = PayLoadKey.UniqueId;
+        const int32 PrefixLen = 7; // "PMX_LOD"
+        int32 LodIdx = INDEX_NONE;
+        const int32 ColonPos = Key.Find(TEXT(":"), ESearchCase::CaseSensitive, ESearchDir::FromStart, PrefixLen);
+        if (ColonPos != INDEX_NONE)
+        {
+            LexTryParseString(LodIdx, *Key.Mid(PrefixLen, ColonPos - PrefixLen));
+        }
+        if (!Session->Lods.IsValidIndex(LodIdx - 1))
+        {
+            PMX_DIAG_WARNING(LogPMXImporter, TEXT("Pmx Translator: Invalid LOD payload key '%s'"), *Key);
+            return TOptional<FMeshPayloadData>();
+        }
+        Lod = &Session->Lods[LodIdx - 1];
+    }
+    const TArray<int32>& Indices = Lod ? Lod->Indices : Model.Indices;
+    TBitArray<> LodVertices;
+    if (Lod)
+    {
+        LodVertices.Init(false, Model.Vertices.Num());
+        for (const int32 VertexIndex : Lod->Indices)
+        {
+            if (Model.Vertices.IsValidIndex(VertexIndex))
+            {
+                LodVertices[VertexIndex] = true;
+            }
+        }
+    }
+
     FMeshPayloadData Data;
     FMeshDescription& MD = Data.MeshDescription;
 
@@ -748,8 +892,21 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
     // Fill JointNames including synthetic Root bone (must match SkeletalMesh bone structure)
     // SkeletalMesh has Root at index 0, then PMX bones at indices 1..N
     // Skin weights must use these adjusted indices
-    // IMPORTANT: Use BuildUniqueBoneNames to ensure consistency with PmxNodeBuilder
-    TArray<FString> UniqueBoneNames = FPmxUtils::BuildUniqueBoneNames(Model);
+    // IMPORTANT: Names must match the joint labels. After UPmxPipeline::UpdateBoneNames the model holds the final
+    // labels, and re-applying the name options would rename chained table entries or suffixed duplicates again.
+    TArray<FString> UniqueBoneNames;
+    if (Session->bBoneNamesResolved)
+    {
+        UniqueBoneNames.Reserve(Model.Bones.Num());
+        for (const FPmxBone& Bone : Model.Bones)
+        {
+            UniqueBoneNames.Add(Bone.Name);
+        }
+    }
+    else
+    {
+        UniqueBoneNames = FPmxUtils::BuildUniqueBoneNames(Model, GetBoneNameOptions());
+    }
 
     Data.JointNames.Reset(UniqueBoneNames.Num() + 1);  // +1 for Root
     Data.JointNames.Reserve(UniqueBoneNames.Num() + 1);
@@ -773,11 +930,47 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
     );
     MeshGlobalTransform = MMDToUE * MeshGlobalTransform;
 
+    // Skin weights are only assigned for the base SKELETAL payload
+    auto SetSkinWeights = [&](const FPmxVertex& V, const FVertexID VId)
+    {
+        if (PayLoadKey.Type == EInterchangeMeshPayLoadType::MORPHTARGET || !VertexSkinWeights.IsValid())
+        {
+            return;
+        }
+
+        UE::AnimationCore::FBoneWeightsSettings Settings;
+        Settings.SetNormalizeType(UE::AnimationCore::EBoneWeightNormalizeType::Always);
+        Settings.SetMaxWeightCount(Lod && Session->Options.LodMaxInfluences > 0 ? Session->Options.LodMaxInfluences : FPmxSkinOptimizer::MaxInfluences);
+        Settings.SetDefaultBoneIndex(0);
+
+        TArray<UE::AnimationCore::FBoneWeight, TInlineAllocator<8>> BWArray;
+        const int32 PairCount = FMath::Min(V.BoneIndices.Num(), V.BoneWeights.Num());
+        BWArray.Reserve(PairCount);
+        for (int32 i = 0; i < PairCount; ++i)
+        {
+            const int32 PmxBoneIndex = V.BoneIndices[i];
+            const float Weight = V.BoneWeights[i];
+            if (PmxBoneIndex >= 0 && PmxBoneIndex < Model.Bones.Num() && Weight > 0.0f && FMath::IsFinite(Weight))
+            {
+                // Offset by +1 because JointNames[0] is synthetic Root, PMX bones start at index 1
+                const int32 AdjustedBoneIndex = PmxBoneIndex + 1;
+                BWArray.Emplace(static_cast<uint16>(AdjustedBoneIndex), Weight);
+            }
+        }
+        VertexSkinWeights.Set(VId, MakeArrayView<const UE::AnimationCore::FBoneWeight>(BWArray.GetData(), BWArray.Num()), Settings);
+    };
+
     auto VertexPositions = FStaticMeshAttributes(MD).GetVertexPositions();
     TArray<FVertexID> VertexIDs;
     VertexIDs.Reserve(Model.Vertices.Num());
     for (int32 vid = 0; vid < Model.Vertices.Num(); ++vid)
     {
+        if (Lod && !LodVertices[vid])
+        {
+            VertexIDs.Add(FVertexID::Invalid);
+            continue;
+        }
+
         const auto& V = Model.Vertices[vid];
         const FVertexID VId = MD.CreateVertex();
         VertexIDs.Add(VId);
@@ -787,32 +980,22 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
         const FVector Xformed = MeshGlobalTransform.TransformPosition(Pos);
         VertexPositions[VId] = FVector3f((float)Xformed.X, (float)Xformed.Y, (float)Xformed.Z);
 
-        // Assign skin weights only for base SKELETAL payload
-        if (PayLoadKey.Type != EInterchangeMeshPayLoadType::MORPHTARGET)
-        {
-            UE::AnimationCore::FBoneWeightsSettings Settings;
-            Settings.SetNormalizeType(UE::AnimationCore::EBoneWeightNormalizeType::Always);
-            Settings.SetMaxWeightCount(4);
-            Settings.SetDefaultBoneIndex(0);
+        SetSkinWeights(V, VId);
+    }
 
-            TArray<UE::AnimationCore::FBoneWeight, TInlineAllocator<8>> BWArray;
-            const int32 PairCount = FMath::Min(V.BoneIndices.Num(), V.BoneWeights.Num());
-            BWArray.Reserve(PairCount);
-            for (int32 i = 0; i < PairCount; ++i)
-            {
-                const int32 PmxBoneIndex = V.BoneIndices[i];
-                const float Weight = V.BoneWeights[i];
-                if (PmxBoneIndex >= 0 && PmxBoneIndex < Model.Bones.Num() && Weight > 0.0f && FMath::IsFinite(Weight))
-                {
-                    // Offset by +1 because JointNames[0] is synthetic Root, PMX bones start at index 1
-                    const int32 AdjustedBoneIndex = PmxBoneIndex + 1;
-                    BWArray.Emplace(static_cast<uint16>(AdjustedBoneIndex), Weight);
-                }
-            }
-            if (VertexSkinWeights.IsValid())
-            {
-                VertexSkinWeights.Set(VId, MakeArrayView<const UE::AnimationCore::FBoneWeight>(BWArray.GetData(), BWArray.Num()), Settings);
-            }
+    // Outline hull vertices follow their source vertex (LOD0 only), after all model vertices in base and morph payloads alike
+    const FPmxOutlineMesh* Outline = !Lod && !Session->Outline.IsEmpty() ? &Session->Outline : nullptr;
+    TArray<FVertexID> OutlineVertexIDs;
+    if (Outline)
+    {
+        OutlineVertexIDs.Reserve(Outline->SourceVertices.Num());
+        for (int32 OutlineVertex = 0; OutlineVertex < Outline->SourceVertices.Num(); ++OutlineVertex)
+        {
+            const FPmxVertex& V = Model.Vertices[Outline->SourceVertices[OutlineVertex]];
+            const FVertexID VId = MD.CreateVertex();
+            OutlineVertexIDs.Add(VId);
+            VertexPositions[VId] = FVector3f(MeshGlobalTransform.TransformPosition(FVector(V.Position + Outline->Offsets[OutlineVertex])));
+            SetSkinWeights(V, VId);
         }
     }
 
@@ -839,7 +1022,7 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
 
         if (!Model.Morphs.IsValidIndex(MorphIndex))
         {
-            UE_LOG(LogPMXImporter, Warning, TEXT("Pmx Translator: Invalid morph payload index parsed from key '%s'"), *PayLoadKey.UniqueId);
+            PMX_DIAG_WARNING(LogPMXImporter, TEXT("Pmx Translator: Invalid morph payload index parsed from key '%s'"), *PayLoadKey.UniqueId);
             return TOptional<FMeshPayloadData>();
         }
 
@@ -852,7 +1035,7 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
         for (const FPmxVertexMorph& VM : Morph.VertexMorphs)
         {
             const int32 VIdx = VM.VertexIndex;
-            if (!Model.Vertices.IsValidIndex(VIdx) || !VertexIDs.IsValidIndex(VIdx))
+            if (!Model.Vertices.IsValidIndex(VIdx) || !VertexIDs.IsValidIndex(VIdx) || VertexIDs[VIdx] == FVertexID::Invalid)
             {
                 continue;
             }
@@ -870,9 +1053,30 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
             VertexPositions[VId] = FVector3f((float)Morphed.X, (float)Morphed.Y, (float)Morphed.Z);
         }
 
+        // The outline hull moves with its source vertices
+        if (Outline && EffectiveChanges > 0)
+        {
+            TMap<int32, FVector3f> MorphOffsets;
+            MorphOffsets.Reserve(Morph.VertexMorphs.Num());
+            for (const FPmxVertexMorph& VM : Morph.VertexMorphs)
+            {
+                MorphOffsets.Add(VM.VertexIndex, VM.Offset);
+            }
+            for (int32 OutlineVertex = 0; OutlineVertex < Outline->SourceVertices.Num(); ++OutlineVertex)
+            {
+                const int32 SourceVertex = Outline->SourceVertices[OutlineVertex];
+                if (const FVector3f* Offset = MorphOffsets.Find(SourceVertex))
+                {
+                    const FVector3f Morphed = Model.Vertices[SourceVertex].Position + *Offset + Outline->Offsets[OutlineVertex];
+                    VertexPositions[OutlineVertexIDs[OutlineVertex]] = FVector3f(MeshGlobalTransform.TransformPosition(FVector(Morphed)));
+                }
+            }
+        }
+
         if (EffectiveChanges == 0)
         {
-            UE_LOG(LogPMXImporter, Verbose, TEXT("Pmx Translator: Dropping empty morph payload '%s' (no effective vertex changes)"), *PayLoadKey.UniqueId);
+            PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: Dropping empty morph payload '%s' (no effective vertex changes)"), *PayLoadKey.UniqueId);
+            PMX_DIAG_COUNT("morphs.empty_dropped", 1);
             return TOptional<FMeshPayloadData>();
         }
 
@@ -897,6 +1101,66 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
         auto VertexInstanceUVs = StaticAttribsForUVs.GetVertexInstanceUVs();
         VertexInstanceUVs.SetNumChannels(1);
 
+        // SDEF parameters are packed into extra UV channels when the pipeline kept the SDEF subset
+        const int32 SdefUVChannel = Session->Sdef.IsValid() ? Session->Sdef->PackedUVChannel : INDEX_NONE;
+        if (SdefUVChannel != INDEX_NONE)
+        {
+            VertexInstanceUVs.SetNumChannels(SdefUVChannel + FPmxSdefDescription::NumPackedUVChannels);
+        }
+        TArray<FVector2f> SdefUVs;
+        if (SdefUVChannel != INDEX_NONE)
+        {
+            SdefUVs.SetNumUninitialized(Model.Vertices.Num() * FPmxSdefDescription::NumPackedUVChannels);
+            for (int32 VertexIndex = 0; VertexIndex < Model.Vertices.Num(); ++VertexIndex)
+            {
+                FPmxSdefBuilder::PackVertexUVs(Model.Vertices[VertexIndex], Model.Bones.Num(), MeshGlobalTransform,
+                    &SdefUVs[VertexIndex * FPmxSdefDescription::NumPackedUVChannels]);
+            }
+        }
+        auto WriteSdefUVs = [&](int32 SrcVertIndex, const FVertexInstanceID& InstanceId)
+        {
+            if (SdefUVChannel == INDEX_NONE) return;
+            for (int32 Channel = 0; Channel < FPmxSdefDescription::NumPackedUVChannels; ++Channel)
+            {
+                VertexInstanceUVs.Set(InstanceId, SdefUVChannel + Channel, SdefUVs[SrcVertIndex * FPmxSdefDescription::NumPackedUVChannels + Channel]);
+            }
+        };
+
+        // Selected additional UVs follow UV0 and the SDEF channels
+        TArray<FPmxAddUVStream> AddUVStreams;
+        if (Session->Options.AddUVChannels != 0)
+        {
+            const int32 FirstAddUVChannel = SdefUVChannel != INDEX_NONE ? SdefUVChannel + FPmxSdefDescription::NumPackedUVChannels : 1;
+            VertexInstanceUVs.SetNumChannels(FPmxVertexStreams::BuildAddUVLayout(Model, Session->Options.AddUVChannels, FirstAddUVChannel, AddUVStreams));
+        }
+
+        // AddUV2 as RGBA8 vertex colors, stored as the sRGB decode of the bytes so the mesh build re-encodes them exactly
+        TArray<FColor> AddUVColors;
+        auto VertexInstanceColors = StaticAttribsForUVs.GetVertexInstanceColors();
+        if (Session->Options.bImportAddUV2AsVertexColors && Model.Header.AdditionalUVNum > FPmxVertexStreams::ColorAddUVIndex)
+        {
+            FPmxVertexStreams::BuildVertexColors(Model, FPmxVertexStreams::ColorAddUVIndex, AddUVColors);
+        }
+
+        auto WriteVertexStreams = [&](int32 SrcVertIndex, const FVertexInstanceID& InstanceId)
+        {
+            WriteSdefUVs(SrcVertIndex, InstanceId);
+            const TArray<FVector4f>& AdditionalUV = Model.Vertices[SrcVertIndex].AdditionalUV;
+            for (const FPmxAddUVStream& Stream : AddUVStreams)
+            {
+                const FVector4f Value = AdditionalUV.IsValidIndex(Stream.AddUVIndex) ? AdditionalUV[Stream.AddUVIndex] : FVector4f::Zero();
+                VertexInstanceUVs.Set(InstanceId, Stream.Channel, FVector2f(Value.X, Value.Y));
+                if (Stream.ZWChannel != INDEX_NONE)
+                {
+                    VertexInstanceUVs.Set(InstanceId, Stream.ZWChannel, FVector2f(Value.Z, Value.W));
+                }
+            }
+            if (AddUVColors.Num() > 0)
+            {
+                VertexInstanceColors.Set(InstanceId, FVector4f(FLinearColor::FromSRGBColor(AddUVColors[SrcVertIndex])));
+            }
+        };
+
         // Build unique slot labels
         TMap<FString, int32> UsedLabels;
         TArray<FString> SlotNames;
@@ -936,13 +1200,13 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
         for (int32 MatIdx = 0; MatIdx < Model.Materials.Num(); ++MatIdx)
         {
             const FPmxMaterial& Mat = Model.Materials[MatIdx];
-            const int32 IndicesForMat = FMath::Max(0, Mat.SurfaceCount);
+            const int32 IndicesForMat = FMath::Max(0, Lod && Lod->SurfaceCounts.IsValidIndex(MatIdx) ? Lod->SurfaceCounts[MatIdx] : Mat.SurfaceCount);
             const int32 TriCountForMat = IndicesForMat / 3;
             for (int32 t = 0; t < TriCountForMat; ++t)
             {
-                const int32 i0 = Model.Indices.IsValidIndex(IndexCursor + 0) ? Model.Indices[IndexCursor + 0] : -1;
-                const int32 i1 = Model.Indices.IsValidIndex(IndexCursor + 1) ? Model.Indices[IndexCursor + 1] : -1;
-                const int32 i2 = Model.Indices.IsValidIndex(IndexCursor + 2) ? Model.Indices[IndexCursor + 2] : -1;
+                const int32 i0 = Indices.IsValidIndex(IndexCursor + 0) ? Indices[IndexCursor + 0] : -1;
+                const int32 i1 = Indices.IsValidIndex(IndexCursor + 1) ? Indices[IndexCursor + 1] : -1;
+                const int32 i2 = Indices.IsValidIndex(IndexCursor + 2) ? Indices[IndexCursor + 2] : -1;
                 IndexCursor += 3;
                 if (!VertexIDs.IsValidIndex(i0) || !VertexIDs.IsValidIndex(i1) || !VertexIDs.IsValidIndex(i2))
                 {
@@ -961,6 +1225,7 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
                     const float U = UV.X;
                     const float V = UV.Y;
                     VertexInstanceUVs.Set(InstanceId, 0, FVector2f(U, V));
+                    WriteVertexStreams(SrcVertIndex, InstanceId);
                 };
                 WriteUV(i0, CornerIDs[0]);
                 WriteUV(i2, CornerIDs[1]);
@@ -970,12 +1235,12 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
             }
         }
         // Append remaining triangles if material counts do not cover all indices (parity with original translator)
-        const int32 RemainingTriCount = (Model.Indices.Num() - IndexCursor) / 3;
+        const int32 RemainingTriCount = (Indices.Num() - IndexCursor) / 3;
         for (int32 t = 0; t < RemainingTriCount; ++t)
         {
-            const int32 i0 = Model.Indices[IndexCursor + 0];
-            const int32 i1 = Model.Indices[IndexCursor + 1];
-            const int32 i2 = Model.Indices[IndexCursor + 2];
+            const int32 i0 = Indices[IndexCursor + 0];
+            const int32 i1 = Indices[IndexCursor + 1];
+            const int32 i2 = Indices[IndexCursor + 2];
             IndexCursor += 3;
             if (!VertexIDs.IsValidIndex(i0) || !VertexIDs.IsValidIndex(i1) || !VertexIDs.IsValidIndex(i2))
             {
@@ -992,6 +1257,7 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
                 const float U = UV.X;
                 const float V = UV.Y;
                 VertexInstanceUVs.Set(InstanceId, 0, FVector2f(U, V));
+                WriteVertexStreams(SrcVertIndex, InstanceId);
             };
             WriteUV(i0, CornerIDs[0]);
             WriteUV(i2, CornerIDs[1]);
@@ -1000,6 +1266,37 @@ TOptional<UE::Interchange::FMeshPayloadData> UPmxTranslator::GetMeshPayloadData(
             const FPolygonGroupID FallbackGroup = PolyGroupIds.Num() > 0 ? PolyGroupIds[0] : MD.CreatePolygonGroup();
             MD.CreatePolygon(FallbackGroup, CornerIDs);
         }
+
+        // Outline sections (slot names match FPmxMaterialMapping::CreateOutlineMaterials)
+        if (Outline)
+        {
+            for (int32 SectionIdx = 0; SectionIdx < Outline->Sections.Num(); ++SectionIdx)
+            {
+                const FPolygonGroupID PG = MD.CreatePolygonGroup();
+                MaterialSlotNames[PG] = FName(*FPmxOutlineBuilder::GetSlotName(SectionIdx));
+
+                const TArray<int32>& OutlineIndices = Outline->Sections[SectionIdx].Indices;
+                for (int32 Corner = 0; Corner + 2 < OutlineIndices.Num(); Corner += 3)
+                {
+                    // Same corner swap as the model triangles; the outline indices are already wound in reverse
+                    const int32 o0 = OutlineIndices[Corner + 0];
+                    const int32 o1 = OutlineIndices[Corner + 1];
+                    const int32 o2 = OutlineIndices[Corner + 2];
+                    CornerIDs[0] = MD.CreateVertexInstance(OutlineVertexIDs[o0]);
+                    CornerIDs[1] = MD.CreateVertexInstance(OutlineVertexIDs[o2]);
+                    CornerIDs[2] = MD.CreateVertexInstance(OutlineVertexIDs[o1]);
+
+                    const int32 Sources[3] = { Outline->SourceVertices[o0], Outline->SourceVertices[o2], Outline->SourceVertices[o1] };
+                    for (int32 i = 0; i < 3; ++i)
+                    {
+                        VertexInstanceUVs.Set(CornerIDs[i], 0, Model.Vertices[Sources[i]].UV);
+                        WriteVertexStreams(Sources[i], CornerIDs[i]);
+                    }
+
+                    MD.CreatePolygon(PG, CornerIDs);
+                }
+            }
+        }
     }
 
     // Set additional payload fields
@@ -1019,6 +1316,8 @@ TOptional<UE::Interchange::FImportImage> UPmxTranslator::GetTexturePayloadData(c
         return TOptional<UE::Interchange::FImportImage>();
     }
 
+    PMX_IMPORT_ROOT_SCOPE("Texture Payload", Session.IsValid() ? Session->Profiler : nullptr);
+
     // Helper to try loading via Interchange texture translators
     auto TryLoadImage = [&](const FString& InPath, TOptional<FString>& InOutAltPath) -> TOptional<UE::Interchange::FImportImage>
     {
@@ -1055,7 +1354,8 @@ TOptional<UE::Interchange::FImportImage> UPmxTranslator::GetTexturePayloadData(c
                 if (AltImg.IsSet())
                 {
                     AlternateTexturePath = Alt; // update with the resolved path
-                    UE_LOG(LogPMXImporter, Display, TEXT("Pmx Translator: Substituted unsupported texture '%s' -> '%s'"), *PayloadKey, **AlternateTexturePath);
+                    PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: Substituted unsupported texture '%s' -> '%s'"), *PayloadKey, **AlternateTexturePath);
+                    PMX_DIAG_COUNT("textures.substituted", 1);
                     return AltImg;
                 }
             }
@@ -1063,7 +1363,8 @@ TOptional<UE::Interchange::FImportImage> UPmxTranslator::GetTexturePayloadData(c
     }
 
     // 3) Fallback: create a small dummy image to avoid factory error and keep import stable
-    UE_LOG(LogPMXImporter, Log, TEXT("Pmx Translator: No texture translator for '%s'. Using 4x4 BGRA8 dummy texture."), *PayloadKey);
+    PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: No texture translator for '%s'. Using 4x4 BGRA8 dummy texture."), *PayloadKey);
+    PMX_DIAG_COUNT("textures.dummy", 1);
     UE::Interchange::FImportImage Dummy;
     // Use BGRA8 (uncompressed 4 channels) so downstream factories can build mips without warnings
     Dummy.Init2DWithParams(4, 4, TSF_BGRA8, /*bSRGB*/ true, /*bUseGamma*/ true);
@@ -1084,7 +1385,7 @@ TOptional<UE::Interchange::FImportImage> UPmxTranslator::GetTexturePayloadData(c
 // Coordinate transformation 
 FVector3f UPmxTranslator::ConvertVectorPmxToUE(const FVector3f& PmxVector) const
 {
-    return FVector3f(PmxVector.X, PmxVector.Z, PmxVector.Y) * ImportOptions.Scale;
+    return FVector3f(PmxVector.X, PmxVector.Z, PmxVector.Y) * Session->Options.Scale;
 }
 
 FVector3f UPmxTranslator::ConvertRotationPmxToUE(const FVector3f& PmxRotation) const
@@ -1153,25 +1454,44 @@ void UPmxTranslator::FixRepeatedMorphNames(FPmxModel& PmxModel) const
     }
 }
 
-// Logging methods
-void UPmxTranslator::LogImportStart(const FString& SectionName) const
+FPmxBoneNameOptions UPmxTranslator::GetBoneNameOptions() const
 {
-    ImportStartTime = FPlatformTime::Seconds();
-    UE_LOG(LogPMXImporter, Log, TEXT("Pmx Translator: Starting %s import..."), *SectionName);
+    FPmxBoneNameOptions Options;
+    Options.bRenameLRBones = Session->Options.bRenameLRBones;
+    Options.RenameTable = Session->Options.BoneRenameTable.IsEmpty() ? nullptr : &Session->Options.BoneRenameTable;
+    return Options;
 }
 
-void UPmxTranslator::LogImportComplete(const FString& SectionName) const
+void UPmxTranslator::ReleaseSource()
 {
-    const double ElapsedTime = FPlatformTime::Seconds() - ImportStartTime;
-    UE_LOG(LogPMXImporter, Log, TEXT("Pmx Translator: Completed %s import in %.3f seconds"), *SectionName, ElapsedTime);
+    if (Session.IsValid())
+    {
+        FPmxImportSessionRegistry::ReleaseSession(Session->Id);
+        Session.Reset();
+    }
+    Super::ReleaseSource();
 }
 
+// Logging methods
 void UPmxTranslator::LogImportSummary(const FPmxModel& PmxModel) const
 {
     UE_LOG(LogPMXImporter, Display, 
         TEXT("Pmx Translator Summary - Vertices: %d, Indices: %d, Bones: %d, Materials: %d, Morphs: %d, RigidBodies: %d, Joints: %d"), 
         PmxModel.Vertices.Num(), PmxModel.Indices.Num(), PmxModel.Bones.Num(), 
         PmxModel.Materials.Num(), PmxModel.Morphs.Num(), PmxModel.RigidBodies.Num(), PmxModel.Joints.Num());
+
+    // Element counts for the import report
+    FPmxImportProfiler& Profiler = *Session->Profiler;
+    Profiler.SetInfo(TEXT("model_name"), PmxModel.Header.ModelName);
+    Profiler.SetCount(TEXT("vertices"), PmxModel.Vertices.Num());
+    Profiler.SetCount(TEXT("indices"), PmxModel.Indices.Num());
+    Profiler.SetCount(TEXT("bones"), PmxModel.Bones.Num());
+    Profiler.SetCount(TEXT("materials"), PmxModel.Materials.Num());
+    Profiler.SetCount(TEXT("textures"), PmxModel.Textures.Num());
+    Profiler.SetCount(TEXT("morphs"), PmxModel.Morphs.Num());
+    Profiler.SetCount(TEXT("display_frames"), PmxModel.DisplayFrames.Num());
+    Profiler.SetCount(TEXT("rigid_bodies"), PmxModel.RigidBodies.Num());
+    Profiler.SetCount(TEXT("joints"), PmxModel.Joints.Num());
 }
 
 // Helper function to convert long path with Unicode characters to Windows 8.3 short path
@@ -1184,11 +1504,11 @@ static FString GetWindowsShortPath(const FString& LongPath)
     IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
     const bool bFileExists = PlatformFile.FileExists(*LongPath);
 
-    UE_LOG(LogPMXImporter, Verbose, TEXT("GetWindowsShortPath: Checking path '%s' (exists=%d)"), *LongPath, bFileExists);
+    PMX_TRACE(LogPMXImporter, TEXT("GetWindowsShortPath: Checking path '%s' (exists=%d)"), *LongPath, bFileExists);
 
     if (!bFileExists)
     {
-        UE_LOG(LogPMXImporter, Warning, TEXT("GetWindowsShortPath: File does not exist: %s"), *LongPath);
+        PMX_DIAG_WARNING(LogPMXImporter, TEXT("GetWindowsShortPath: File does not exist: %s"), *LongPath);
         return LongPath;
     }
 
@@ -1200,12 +1520,12 @@ static FString GetWindowsShortPath(const FString& LongPath)
     if (Result > 0 && Result < MAX_PATH)
     {
         const FString ShortPath(ShortPathBuffer);
-        UE_LOG(LogPMXImporter, Display, TEXT("GetWindowsShortPath: Success - %s -> %s"), *LongPath, *ShortPath);
+        PMX_TRACE(LogPMXImporter, TEXT("GetWindowsShortPath: Success - %s -> %s"), *LongPath, *ShortPath);
         return ShortPath;
     }
     else
     {
-        UE_LOG(LogPMXImporter, Warning, TEXT("GetWindowsShortPath: GetShortPathName failed with result=%d, error=%d"), Result, ErrorCode);
+        PMX_DIAG_WARNING(LogPMXImporter, TEXT("GetWindowsShortPath: GetShortPathName failed with result=%d, error=%d"), Result, ErrorCode);
     }
     return LongPath;
 }
@@ -1283,6 +1603,7 @@ void UPmxTranslator::ImportTextures(const FPmxModel& PmxModel, const FString& Pm
                 ? FString::Printf(TEXT("%s/%s"), *TexDir, *TexBaseName)
                 : TexBaseName;
             Texture2DNode->SetDisplayLabel(DisplayLabel);
+            Texture2DNode->AddStringAttribute(FPmxManifestBuilder::SectionAttributeKey, FPmxManifestBuilder::TextureSection(TexIdx));
             // Resolve texture path
             FString AbsPath = FPaths::IsRelative(PmxTex.TexturePath)
                 ? FPaths::ConvertRelativePathToFull(FPaths::Combine(PmxBaseDir, PmxTex.TexturePath))
@@ -1301,7 +1622,7 @@ void UPmxTranslator::ImportTextures(const FPmxModel& PmxModel, const FString& Pm
                 // Convert /IP/path to \\IP\path
                 AbsPath = TEXT("\\\\") + AbsPath.Mid(1);
                 AbsPath.ReplaceInline(TEXT("/"), TEXT("\\"));
-                UE_LOG(LogPMXImporter, Verbose, TEXT("Converted Unix-style network path to UNC: %s"), *AbsPath);
+                PMX_TRACE(LogPMXImporter, TEXT("Converted Unix-style network path to UNC: %s"), *AbsPath);
             }
 
             // Only apply MakeStandardFilename for non-network paths
@@ -1314,26 +1635,26 @@ void UPmxTranslator::ImportTextures(const FPmxModel& PmxModel, const FString& Pm
             // Advise user if using network path
             if (bIsNetworkPath)
             {
-                UE_LOG(LogPMXImporter, Display, TEXT("Pmx Translator: Texture path '%s' is a network (UNC) path."), *AbsPath);
+                PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: Texture path '%s' is a network (UNC) path."), *AbsPath);
             }
 
             // Convert to short path if contains non-ASCII characters (for better Unicode compatibility)
             FString PayloadPath = AbsPath;
             const bool bHasNonASCII = ContainsNonASCII(AbsPath);
 
-            UE_LOG(LogPMXImporter, Display, TEXT("Pmx Translator: Processing texture path: %s (HasNonASCII=%d)"), *AbsPath, bHasNonASCII);
+            PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: Processing texture path: %s (HasNonASCII=%d)"), *AbsPath, bHasNonASCII);
 
             if (bHasNonASCII)
             {
                 const FString ShortPath = GetWindowsShortPath(AbsPath);
                 if (ShortPath != AbsPath)
                 {
-                    UE_LOG(LogPMXImporter, Display, TEXT("Pmx Translator: Converted Unicode texture path to short path: %s -> %s"), *AbsPath, *ShortPath);
+                    PMX_TRACE(LogPMXImporter, TEXT("Pmx Translator: Converted Unicode texture path to short path: %s -> %s"), *AbsPath, *ShortPath);
                     PayloadPath = ShortPath;
                 }
                 else
                 {
-                    UE_LOG(LogPMXImporter, Warning, TEXT("Pmx Translator: Failed to convert Unicode texture path to short path: %s (file exists: %d)"),
+                    PMX_DIAG_WARNING(LogPMXImporter, TEXT("Pmx Translator: Failed to convert Unicode texture path to short path: %s (file exists: %d)"),
                         *AbsPath, FPaths::FileExists(AbsPath));
                 }
             }
@@ -1349,10 +1670,11 @@ void UPmxTranslator::ImportTextures(const FPmxModel& PmxModel, const FString& Pm
 }
 
 void UPmxTranslator::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer,
-    UInterchangeSceneNode* RootNode, TMap<int32, UInterchangeSceneNode*>& OutBoneNodes, FString& OutRootJointUid) const
+    UInterchangeSceneNode* RootNode, TArray<UInterchangeSceneNode*>& OutBoneNodes, FString& OutRootJointUid) const
 {
     // Delegate to existing implementation with modifications
-    OutRootJointUid = FPmxNodeBuilder::CreateBoneHierarchy(PmxModel, BaseNodeContainer, RootNode, OutBoneNodes);
+    const FPmxSkeletonLayout& Layout = Session->GetSkeletonLayout(PmxModel);
+    OutRootJointUid = FPmxNodeBuilder::CreateBoneHierarchy(PmxModel, Layout, BaseNodeContainer, RootNode, GetBoneNameOptions(), OutBoneNodes);
     
     // Validate the result
     if (OutRootJointUid.IsEmpty())
@@ -1368,17 +1690,14 @@ void UPmxTranslator::CreateBoneHierarchy(const FPmxModel& PmxModel, UInterchange
 }
 
 // Additional method stubs
-void UPmxTranslator::ImportDisplaySection(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const {}
 void UPmxTranslator::ImportVertices(const FPmxModel& PmxModel, const TMap<int32, int32>& VertexMap) const {}
 void UPmxTranslator::ImportFaces(const FPmxModel& PmxModel, const TMap<int32, int32>& VertexMap) const {}
 void UPmxTranslator::ImportMaterials(const FPmxModel& PmxModel, const TMap<int32, FString>& TextureUidMap, UInterchangeBaseNodeContainer& BaseNodeContainer, TArray<FString>& OutMaterialUids, TArray<FString>& OutSlotNames) const {}
-void UPmxTranslator::ApplyIKConstraints(const FPmxModel& PmxModel, const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const {}
-void UPmxTranslator::ApplyBoneTransforms(const FPmxModel& PmxModel, const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const {}
-void UPmxTranslator::ImportRigidBodies(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const {}
+void UPmxTranslator::ImportRigidBodies(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, const TArray<UInterchangeSceneNode*>& BoneNodes) const {}
 void UPmxTranslator::ImportJoints(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const {}
 void UPmxTranslator::ImportVertexMorphs(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, const FString& MeshUid) const
 {
-    if (!ImportOptions.bImportMorphs)
+    if (!Session->Options.bImportMorphs)
     {
         return;
     }
@@ -3,6 +3,23 @@
 #include "PmxUtils.h"
 #include "LogPMXImporter.h"
 
+namespace PmxUtilsPrivate
+{
+	/** Fold full-width ASCII (U+FF01-U+FF5E, e.g. "３", "ＩＫ") to half-width; MMD models use both forms */
+	FString ToHalfWidth(const FString& InName)
+	{
+		FString Out = InName;
+		for (TCHAR& C : Out)
+		{
+			if (C >= 0xFF01 && C <= 0xFF5E)
+			{
+				C = static_cast<TCHAR>(C - 0xFF01 + TEXT('!'));
+			}
+		}
+		return Out;
+	}
+}
+
 FString FPmxUtils::SanitizeMorphName(const FString& InName, int32 FallbackIndex)
 {
 	FString Out;
@@ -165,7 +182,7 @@ FString FPmxUtils::SanitizePackagePath(const FString& InPath, const TCHAR Replac
 	return Out;
 }
 
-TArray<FString> FPmxUtils::BuildUniqueBoneNames(const FPmxModel& Model)
+TArray<FString> FPmxUtils::BuildUniqueBoneNames(const FPmxModel& Model, const FPmxBoneNameOptions& Options)
 {
 	TArray<FString> UniqueBoneNames;
 	UniqueBoneNames.Reserve(Model.Bones.Num());
@@ -186,6 +203,10 @@ TArray<FString> FPmxUtils::BuildUniqueBoneNames(const FPmxModel& Model)
 		{
 			BaseName = FString::Printf(TEXT("Bone_%d"), BoneIndex);
 		}
+		else
+		{
+			BaseName = ApplyBoneNameTransforms(BaseName, Options);
+		}
 
 		DuplicateMap.FindOrAdd(BaseName).Add(BoneIndex);
 	}
@@ -211,6 +232,10 @@ TArray<FString> FPmxUtils::BuildUniqueBoneNames(const FPmxModel& Model)
 		{
 			BaseName = FString::Printf(TEXT("Bone_%d"), BoneIndex);
 		}
+		else
+		{
+			BaseName = ApplyBoneNameTransforms(BaseName, Options);
+		}
 
 		// Check if this name has been used before
 		int32& UseCount = NameUseCount.FindOrAdd(BaseName, 0);
@@ -236,4 +261,109 @@ TArray<FString> FPmxUtils::BuildUniqueBoneNames(const FPmxModel& Model)
 	}
 
 	return UniqueBoneNames;
+}
+
+FString FPmxUtils::ApplyBoneNameTransforms(const FString& InName, const FPmxBoneNameOptions& Options)
+{
+	FString Name = InName;
+
+	// Split off the MMD side prefix (左 = left, 右 = right)
+	const bool bLeft = Name.StartsWith(TEXT("左"));
+	const bool bRight = !bLeft && Name.StartsWith(TEXT("右"));
+	const TCHAR* SideSuffix = bLeft ? TEXT("_L") : TEXT("_R");
+
+	if (Options.RenameTable)
+	{
+		if (const FString* FullMatch = FindRenameTableEntry(*Options.RenameTable, Name))
+		{
+			return *FullMatch;
+		}
+		if (bLeft || bRight)
+		{
+			if (const FString* CoreMatch = FindRenameTableEntry(*Options.RenameTable, Name.RightChop(1)))
+			{
+				// Translated names always use the suffix convention
+				return *CoreMatch + SideSuffix;
+			}
+		}
+	}
+
+	if (Options.bRenameLRBones && (bLeft || bRight) && Name.Len() > 1)
+	{
+		Name = Name.RightChop(1) + SideSuffix;
+	}
+
+	return Name;
+}
+
+const FString* FPmxUtils::FindRenameTableEntry(const TMap<FString, FString>& RenameTable, const FString& Name)
+{
+	if (const FString* Match = RenameTable.Find(Name))
+	{
+		return Match;
+	}
+	const FString HalfWidthName = PmxUtilsPrivate::ToHalfWidth(Name);
+	return HalfWidthName != Name ? RenameTable.Find(HalfWidthName) : nullptr;
+}
+
+const TMap<FString, FString>& FPmxUtils::GetStandardBoneRenameTable()
+{
+	static const TMap<FString, FString> Table = []()
+	{
+		TMap<FString, FString> T;
+		// Trunk
+		T.Add(TEXT("全ての親"), TEXT("ParentNode"));
+		T.Add(TEXT("センター"), TEXT("Center"));
+		T.Add(TEXT("グルーブ"), TEXT("Groove"));
+		T.Add(TEXT("腰"), TEXT("Waist"));
+		T.Add(TEXT("上半身"), TEXT("UpperBody"));
+		T.Add(TEXT("上半身2"), TEXT("UpperBody2"));
+		T.Add(TEXT("上半身3"), TEXT("UpperBody3"));
+		T.Add(TEXT("下半身"), TEXT("LowerBody"));
+		T.Add(TEXT("首"), TEXT("Neck"));
+		T.Add(TEXT("頭"), TEXT("Head"));
+		T.Add(TEXT("両目"), TEXT("Eyes"));
+		T.Add(TEXT("目"), TEXT("Eye"));
+		// Arms
+		T.Add(TEXT("肩P"), TEXT("ShoulderP"));
+		T.Add(TEXT("肩"), TEXT("Shoulder"));
+		T.Add(TEXT("肩C"), TEXT("ShoulderC"));
+		T.Add(TEXT("腕"), TEXT("Arm"));
+		T.Add(TEXT("腕捩"), TEXT("ArmTwist"));
+		T.Add(TEXT("ひじ"), TEXT("Elbow"));
+		T.Add(TEXT("手捩"), TEXT("WristTwist"));
+		T.Add(TEXT("手首"), TEXT("Wrist"));
+		T.Add(TEXT("ダミー"), TEXT("Dummy"));
+		// Fingers (MMD uses full-width digits, matched through their half-width form)
+		const TCHAR* Digits[] = { TEXT("0"), TEXT("1"), TEXT("2"), TEXT("3") };
+		const TPair<const TCHAR*, const TCHAR*> Fingers[] = {
+			{ TEXT("親指"), TEXT("Thumb") },
+			{ TEXT("人指"), TEXT("Index") },
+			{ TEXT("中指"), TEXT("Middle") },
+			{ TEXT("薬指"), TEXT("Ring") },
+			{ TEXT("小指"), TEXT("Little") },
+		};
+		for (const TPair<const TCHAR*, const TCHAR*>& Finger : Fingers)
+		{
+			for (int32 D = 0; D < UE_ARRAY_COUNT(Digits); ++D)
+			{
+				T.Add(FString(Finger.Key) + Digits[D], FString::Printf(TEXT("%s%d"), Finger.Value, D));
+			}
+		}
+		// Legs
+		T.Add(TEXT("足"), TEXT("Leg"));
+		T.Add(TEXT("ひざ"), TEXT("Knee"));
+		T.Add(TEXT("足首"), TEXT("Ankle"));
+		T.Add(TEXT("つま先"), TEXT("Toe"));
+		T.Add(TEXT("足D"), TEXT("LegD"));
+		T.Add(TEXT("ひざD"), TEXT("KneeD"));
+		T.Add(TEXT("足首D"), TEXT("AnkleD"));
+		T.Add(TEXT("足先EX"), TEXT("ToeEX"));
+		T.Add(TEXT("腰キャンセル"), TEXT("WaistCancel"));
+		T.Add(TEXT("足IK"), TEXT("LegIK"));
+		T.Add(TEXT("つま先IK"), TEXT("ToeIK"));
+		T.Add(TEXT("足IK親"), TEXT("LegIKParent"));
+		return T;
+	}();
+	return Table;
 }
\ No newline at end of file
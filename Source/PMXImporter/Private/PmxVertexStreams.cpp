@@ -0,0 +1,84 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxVertexStreams.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "PmxImportDiagnostics.h"
+#include "MeshTypes.h"
+
+int32 FPmxVertexStreams::BuildAddUVLayout(const FPmxModel& PmxModel, int32 ChannelMask, int32 FirstChannel, TArray<FPmxAddUVStream>& OutStreams)
+{
+	OutStreams.Reset();
+	int32 NextChannel = FirstChannel;
+	const int32 NumAddUV = FMath::Min<int32>(PmxModel.Header.AdditionalUVNum, MaxAddUV);
+
+	for (int32 AddUVIndex = 0; AddUVIndex < NumAddUV; ++AddUVIndex)
+	{
+		if ((ChannelMask & (1 << AddUVIndex)) == 0)
+		{
+			continue;
+		}
+
+		bool bUsesZW = false;
+		for (const FPmxVertex& Vertex : PmxModel.Vertices)
+		{
+			if (Vertex.AdditionalUV.IsValidIndex(AddUVIndex) && (Vertex.AdditionalUV[AddUVIndex].Z != 0.0f || Vertex.AdditionalUV[AddUVIndex].W != 0.0f))
+			{
+				bUsesZW = true;
+				break;
+			}
+		}
+
+		const int32 NumChannels = bUsesZW ? 2 : 1;
+		if (NextChannel + NumChannels > MAX_MESH_TEXTURE_COORDS_MD)
+		{
+			PMX_DIAG_WARNING(LogPMXImporter, TEXT("PMX VertexStreams: No UV channel left for AddUV%d (%d of %d in use), skipped"),
+				AddUVIndex + 1, NextChannel, MAX_MESH_TEXTURE_COORDS_MD);
+			continue;
+		}
+
+		FPmxAddUVStream& Stream = OutStreams.AddDefaulted_GetRef();
+		Stream.AddUVIndex = AddUVIndex;
+		Stream.Channel = NextChannel++;
+		Stream.ZWChannel = bUsesZW ? NextChannel++ : INDEX_NONE;
+	}
+
+	if (OutStreams.Num() > 0)
+	{
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX VertexStreams: %d additional UVs in UV channels %d-%d"),
+			OutStreams.Num(), FirstChannel, NextChannel - 1);
+	}
+	return NextChannel;
+}
+
+void FPmxVertexStreams::ConvertToColors(TConstArrayView<FVector4f> Values, TArrayView<FColor> OutColors)
+{
+	check(OutColors.Num() >= Values.Num());
+
+	const VectorRegister4Float Scale = VectorSetFloat1(255.0f);
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	for (int32 Index = 0; Index < Values.Num(); ++Index)
+	{
+		VectorRegister4Float Value = VectorLoad(&Values[Index].X);
+		// Max first: a NaN component becomes 0
+		Value = VectorMin(VectorMax(Value, VectorZeroFloat()), VectorOneFloat());
+		Value = VectorMultiplyAdd(Value, Scale, Half);
+		// FColor is laid out B, G, R, A
+		Value = VectorSwizzle(Value, 2, 1, 0, 3);
+		VectorStoreByte4(Value, &OutColors[Index]);
+	}
+}
+
+void FPmxVertexStreams::BuildVertexColors(const FPmxModel& PmxModel, int32 AddUVIndex, TArray<FColor>& OutColors)
+{
+	TArray<FVector4f> Values;
+	Values.SetNumUninitialized(PmxModel.Vertices.Num());
+	for (int32 VertexIndex = 0; VertexIndex < PmxModel.Vertices.Num(); ++VertexIndex)
+	{
+		const FPmxVertex& Vertex = PmxModel.Vertices[VertexIndex];
+		Values[VertexIndex] = Vertex.AdditionalUV.IsValidIndex(AddUVIndex) ? Vertex.AdditionalUV[AddUVIndex] : FVector4f(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	OutColors.SetNumUninitialized(Values.Num());
+	ConvertToColors(Values, OutColors);
+}
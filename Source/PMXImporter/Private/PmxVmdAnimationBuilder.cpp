@@ -0,0 +1,626 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxVmdAnimationBuilder.h"
+#include "PmxVmdStructs.h"
+#include "PmxRigDefinition.h"
+#include "PmxRigEvaluator.h"
+#include "PmxUtils.h"
+#include "LogPMXImporter.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Animation/AnimData/CurveIdentifier.h"
+#include "Animation/Skeleton.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Misc/PackageName.h"
+
+#define LOCTEXT_NAMESPACE "PmxVmdAnimationBuilder"
+
+namespace PmxVmdAnimationBuilderPrivate
+{
+	/** VMD frames are 1/30 s */
+	static constexpr double VmdFrameRate = 30.0;
+
+	static FVector3f ConvertPosition(const FVector3f& PmxPosition, float Scale)
+	{
+		return FVector3f(PmxPosition.X, -PmxPosition.Z, PmxPosition.Y) * Scale;
+	}
+
+	static FQuat4f ConvertRotation(const FQuat4f& PmxRotation)
+	{
+		FQuat4f Rotation(PmxRotation.X, -PmxRotation.Z, PmxRotation.Y, PmxRotation.W);
+		Rotation.Normalize();
+		return Rotation;
+	}
+
+	/**
+	 * Remove keys reproduced by interpolating their neighbours
+	 * Linear keys are dropped when the segment from the last kept key to the next key stays within Tolerance
+	 * of every skipped key; constant (stepped) keys are dropped when they repeat the previous value.
+	 */
+	static int32 ReduceKeys(TArray<FRichCurveKey>& Keys, float Tolerance)
+	{
+		const int32 NumKeys = Keys.Num();
+		if (NumKeys <= 1)
+		{
+			return 0;
+		}
+
+		TArray<FRichCurveKey> Reduced;
+		Reduced.Reserve(NumKeys);
+		Reduced.Add(Keys[0]);
+		int32 LastKept = 0;
+
+		for (int32 Index = 1; Index < NumKeys - 1; ++Index)
+		{
+			bool bRedundant = false;
+			if (Keys[LastKept].InterpMode == RCIM_Constant)
+			{
+				bRedundant = FMath::IsNearlyEqual(Keys[Index].Value, Keys[LastKept].Value, Tolerance);
+			}
+			else
+			{
+				const FRichCurveKey& Start = Keys[LastKept];
+				const FRichCurveKey& End = Keys[Index + 1];
+				const float Span = End.Time - Start.Time;
+				bRedundant = Span > UE_KINDA_SMALL_NUMBER;
+				for (int32 Skipped = LastKept + 1; bRedundant && Skipped <= Index; ++Skipped)
+				{
+					const float Alpha = (Keys[Skipped].Time - Start.Time) / Span;
+					bRedundant = FMath::Abs(FMath::Lerp(Start.Value, End.Value, Alpha) - Keys[Skipped].Value) <= Tolerance;
+				}
+			}
+
+			if (!bRedundant)
+			{
+				Reduced.Add(Keys[Index]);
+				LastKept = Index;
+			}
+		}
+
+		// The last key is only needed if it changes the value (curves hold their last key)
+		if (!FMath::IsNearlyEqual(Keys.Last().Value, Reduced.Last().Value, Tolerance))
+		{
+			Reduced.Add(Keys.Last());
+		}
+
+		const int32 NumRemoved = NumKeys - Reduced.Num();
+		Keys = MoveTemp(Reduced);
+		return NumRemoved;
+	}
+
+	static bool MatchesRestPose(const FPmxVmdBakedBoneTrack& Track, const FTransform& RestPose, const FPmxVmdBakeSettings& Settings)
+	{
+		const FVector3f RestTranslation = FVector3f(RestPose.GetTranslation());
+		const FQuat4f RestRotation = FQuat4f(RestPose.GetRotation());
+		for (int32 KeyIndex = 0; KeyIndex < Track.Positions.Num(); ++KeyIndex)
+		{
+			if (!Track.Positions[KeyIndex].Equals(RestTranslation, Settings.PositionTolerance)
+				|| FMath::Abs(Track.Rotations[KeyIndex] | RestRotation) < 1.0f - Settings.RotationTolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Value of a stepped curve at Time (keys sorted by time) */
+	static float EvaluateSteppedKeys(const TArray<FRichCurveKey>& Keys, float Time)
+	{
+		float Value = Keys.Num() > 0 ? Keys[0].Value : 0.0f;
+		for (const FRichCurveKey& Key : Keys)
+		{
+			if (Key.Time > Time + UE_KINDA_SMALL_NUMBER)
+			{
+				break;
+			}
+			Value = Key.Value;
+		}
+		return Value;
+	}
+
+	static bool BakeBoneTrack(const FPmxVmdBoneTrack& Track, const FTransform& RestPose, const FPmxVmdBakeSettings& Settings,
+		int32 NumKeys, FPmxVmdBakedBoneTrack& OutTrack)
+	{
+		const TArray<FPmxVmdBoneKey>& Keys = Track.Keys;
+		if (Keys.Num() == 0)
+		{
+			return false;
+		}
+
+		const FVector3f RestTranslation = FVector3f(RestPose.GetTranslation());
+		const FQuat4f RestRotation = FQuat4f(RestPose.GetRotation());
+
+		OutTrack.Positions.SetNumUninitialized(NumKeys);
+		OutTrack.Rotations.SetNumUninitialized(NumKeys);
+
+		const double FrameStep = VmdFrameRate / Settings.FrameRate;
+		int32 Segment = 0;
+
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+		{
+			const double Frame = KeyIndex * FrameStep;
+
+			// Sample times increase monotonically; advance to the last key at or before Frame
+			while (Segment + 1 < Keys.Num() && Keys[Segment + 1].Frame <= Frame)
+			{
+				++Segment;
+			}
+
+			FVector3f Position;
+			FQuat4f Rotation;
+			if (Segment + 1 >= Keys.Num() || Frame <= Keys[Segment].Frame)
+			{
+				Position = Keys[Segment].Position;
+				Rotation = Keys[Segment].Rotation;
+			}
+			else
+			{
+				// MMD: the interpolation stored on the next key shapes the segment leading to it
+				const FPmxVmdBoneKey& From = Keys[Segment];
+				const FPmxVmdBoneKey& To = Keys[Segment + 1];
+				const float T = static_cast<float>((Frame - From.Frame) / static_cast<double>(To.Frame - From.Frame));
+
+				Position.X = FMath::Lerp(From.Position.X, To.Position.X, FPmxVmdAnimationBuilder::EvaluateBezier(To.Interpolation[0], T));
+				Position.Y = FMath::Lerp(From.Position.Y, To.Position.Y, FPmxVmdAnimationBuilder::EvaluateBezier(To.Interpolation[1], T));
+				Position.Z = FMath::Lerp(From.Position.Z, To.Position.Z, FPmxVmdAnimationBuilder::EvaluateBezier(To.Interpolation[2], T));
+				Rotation = FQuat4f::Slerp(From.Rotation, To.Rotation, FPmxVmdAnimationBuilder::EvaluateBezier(To.Interpolation[3], T));
+			}
+
+			const FVector3f Translation = RestTranslation + ConvertPosition(Position, Settings.ImportScale);
+			const FQuat4f LocalRotation = RestRotation * ConvertRotation(Rotation);
+
+			OutTrack.Positions[KeyIndex] = Translation;
+			OutTrack.Rotations[KeyIndex] = LocalRotation;
+		}
+
+		// Constant rest pose tracks add nothing over the reference pose
+		return !MatchesRestPose(OutTrack, RestPose, Settings);
+	}
+}
+
+void FPmxVmdBoneNameIndex::Build(const FReferenceSkeleton& RefSkeleton, const UPmxRigDefinition* RigDefinition)
+{
+	BoneIndexByName.Reset();
+
+	const int32 NumBones = RefSkeleton.GetRawBoneNum();
+	BoneIndexByName.Reserve(NumBones * 2);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		BoneIndexByName.Add(RefSkeleton.GetBoneName(BoneIndex).ToString(), BoneIndex);
+	}
+
+	// Motions reference the original PMX names; the rig remembers them even after renaming/uniquifying
+	if (RigDefinition)
+	{
+		for (const FPmxRigBone& RigBone : RigDefinition->Description.Bones)
+		{
+			const int32 BoneIndex = RefSkeleton.FindBoneIndex(RigBone.Name);
+			if (!RigBone.SourceName.IsEmpty() && BoneIndex != INDEX_NONE)
+			{
+				BoneIndexByName.FindOrAdd(RigBone.SourceName.TrimStartAndEnd(), BoneIndex);
+			}
+		}
+	}
+}
+
+int32 FPmxVmdBoneNameIndex::FindBoneIndex(const FString& VmdName) const
+{
+	const FString Name = VmdName.TrimStartAndEnd();
+	if (const int32* Found = BoneIndexByName.Find(Name))
+	{
+		return *Found;
+	}
+
+	// Skeletons imported without a rig: replay the importer's standard renames
+	FPmxBoneNameOptions Options;
+	Options.RenameTable = &FPmxUtils::GetStandardBoneRenameTable();
+	for (const bool bRenameLR : { true, false })
+	{
+		Options.bRenameLRBones = bRenameLR;
+		if (const int32* Found = BoneIndexByName.Find(FPmxUtils::ApplyBoneNameTransforms(Name, Options)))
+		{
+			return *Found;
+		}
+	}
+
+	Options.RenameTable = nullptr;
+	Options.bRenameLRBones = true;
+	if (const int32* Found = BoneIndexByName.Find(FPmxUtils::ApplyBoneNameTransforms(Name, Options)))
+	{
+		return *Found;
+	}
+	return INDEX_NONE;
+}
+
+UPmxRigDefinition* FPmxVmdBoneNameIndex::FindRigForSkeleton(const USkeleton* Skeleton)
+{
+	if (!Skeleton)
+	{
+		return nullptr;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FAssetData> RigAssets;
+	AssetRegistry.GetAssetsByClass(UPmxRigDefinition::StaticClass()->GetClassPathName(), RigAssets);
+
+	const FSoftObjectPath SkeletonPath(Skeleton);
+	for (const FAssetData& RigAsset : RigAssets)
+	{
+		FString SkeletonTag;
+		if (RigAsset.GetTagValue(GET_MEMBER_NAME_CHECKED(UPmxRigDefinition, Skeleton), SkeletonTag)
+			&& FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(SkeletonTag)) == SkeletonPath)
+		{
+			return Cast<UPmxRigDefinition>(RigAsset.GetAsset());
+		}
+	}
+	return nullptr;
+}
+
+float FPmxVmdAnimationBuilder::EvaluateBezier(const uint8 ControlPoints[4], float T)
+{
+	const float X1 = ControlPoints[0] / 127.0f;
+	const float Y1 = ControlPoints[1] / 127.0f;
+	const float X2 = ControlPoints[2] / 127.0f;
+	const float Y2 = ControlPoints[3] / 127.0f;
+
+	// Default MMD curve (20, 20, 107, 107) is linear
+	if (X1 == Y1 && X2 == Y2)
+	{
+		return T;
+	}
+
+	// x(s) is monotonic for control points in [0, 1]: bisect for s, then evaluate y(s)
+	float Low = 0.0f;
+	float High = 1.0f;
+	float S = T;
+	for (int32 Iteration = 0; Iteration < 16; ++Iteration)
+	{
+		S = 0.5f * (Low + High);
+		const float InvS = 1.0f - S;
+		const float X = 3.0f * InvS * InvS * S * X1 + 3.0f * InvS * S * S * X2 + S * S * S;
+		if (X < T)
+		{
+			Low = S;
+		}
+		else
+		{
+			High = S;
+		}
+	}
+
+	const float InvS = 1.0f - S;
+	return 3.0f * InvS * InvS * S * Y1 + 3.0f * InvS * S * S * Y2 + S * S * S;
+}
+
+bool FPmxVmdAnimationBuilder::BakeMotion(const FPmxVmdMotion& Motion, const FReferenceSkeleton& RefSkeleton,
+	const FPmxVmdBoneNameIndex& NameIndex, const FPmxVmdBakeSettings& Settings, FPmxVmdBakedAnimation& OutBaked)
+{
+	using namespace PmxVmdAnimationBuilderPrivate;
+
+	OutBaked = FPmxVmdBakedAnimation();
+	OutBaked.FrameRate = FMath::Max(Settings.FrameRate, 1);
+	const double FrameScale = OutBaked.FrameRate / VmdFrameRate;
+	OutBaked.NumKeys = FMath::Max(FMath::FloorToInt32(Motion.MaxFrame * FrameScale) + 1, 2);
+
+	FPmxVmdBakeSettings TrackSettings = Settings;
+	TrackSettings.FrameRate = OutBaked.FrameRate;
+
+	// 1) Resolve bone tracks (first track wins when several names map to one bone)
+	TArray<int32> TrackBoneIndices;
+	TrackBoneIndices.Init(INDEX_NONE, Motion.BoneTracks.Num());
+	TBitArray<> BoundBones(false, RefSkeleton.GetRawBoneNum());
+	for (int32 TrackIndex = 0; TrackIndex < Motion.BoneTracks.Num(); ++TrackIndex)
+	{
+		const int32 BoneIndex = NameIndex.FindBoneIndex(Motion.BoneTracks[TrackIndex].Name);
+		if (BoneIndex == INDEX_NONE)
+		{
+			OutBaked.UnmappedBones.Add(Motion.BoneTracks[TrackIndex].Name);
+		}
+		else if (!BoundBones[BoneIndex])
+		{
+			BoundBones[BoneIndex] = true;
+			TrackBoneIndices[TrackIndex] = BoneIndex;
+		}
+	}
+
+	// 2) Resample bone tracks in parallel (tracks are independent)
+	TArray<FPmxVmdBakedBoneTrack> BakedTracks;
+	BakedTracks.SetNum(Motion.BoneTracks.Num());
+	TArray<uint8> KeepTrack;
+	KeepTrack.SetNumZeroed(Motion.BoneTracks.Num());
+
+	const TArray<FTransform>& RefPose = RefSkeleton.GetRawRefBonePose();
+	ParallelFor(Motion.BoneTracks.Num(), [&](int32 TrackIndex)
+	{
+		const int32 BoneIndex = TrackBoneIndices[TrackIndex];
+		if (BoneIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		FPmxVmdBakedBoneTrack& Baked = BakedTracks[TrackIndex];
+		Baked.BoneName = RefSkeleton.GetBoneName(BoneIndex);
+		KeepTrack[TrackIndex] = BakeBoneTrack(Motion.BoneTracks[TrackIndex], RefPose[BoneIndex], TrackSettings, OutBaked.NumKeys, Baked);
+	});
+
+	for (int32 TrackIndex = 0; TrackIndex < BakedTracks.Num(); ++TrackIndex)
+	{
+		if (KeepTrack[TrackIndex])
+		{
+			OutBaked.BoneTracks.Add(MoveTemp(BakedTracks[TrackIndex]));
+		}
+		else if (TrackBoneIndices[TrackIndex] != INDEX_NONE)
+		{
+			++OutBaked.NumConstantTracks;
+		}
+	}
+
+	// 3) Morph curves (MMD interpolates morphs linearly), reduced in parallel per curve
+	if (Settings.bImportMorphCurves)
+	{
+		TArray<FPmxVmdBakedCurve> MorphCurves;
+		MorphCurves.SetNum(Motion.MorphTracks.Num());
+		TArray<int32> RemovedKeys;
+		RemovedKeys.SetNumZeroed(Motion.MorphTracks.Num());
+
+		ParallelFor(Motion.MorphTracks.Num(), [&](int32 TrackIndex)
+		{
+			const FPmxVmdMorphTrack& Track = Motion.MorphTracks[TrackIndex];
+			FPmxVmdBakedCurve& Curve = MorphCurves[TrackIndex];
+			Curve.Name = FName(*Track.Name);
+			Curve.bMorphTarget = true;
+
+			bool bAnyWeight = false;
+			for (const FPmxVmdMorphKey& Key : Track.Keys)
+			{
+				const float Time = static_cast<float>(Key.Frame / VmdFrameRate);
+				// Duplicate frames: the later key wins
+				if (Curve.Keys.Num() > 0 && FMath::IsNearlyEqual(Curve.Keys.Last().Time, Time))
+				{
+					Curve.Keys.Last().Value = Key.Weight;
+				}
+				else
+				{
+					FRichCurveKey& NewKey = Curve.Keys.Emplace_GetRef(Time, Key.Weight);
+					NewKey.InterpMode = RCIM_Linear;
+				}
+				bAnyWeight |= !FMath::IsNearlyZero(Key.Weight, Settings.CurveTolerance);
+			}
+
+			if (!bAnyWeight)
+			{
+				RemovedKeys[TrackIndex] = Curve.Keys.Num();
+				Curve.Keys.Reset();
+				return;
+			}
+			RemovedKeys[TrackIndex] = ReduceKeys(Curve.Keys, Settings.CurveTolerance);
+		});
+
+		for (int32 TrackIndex = 0; TrackIndex < MorphCurves.Num(); ++TrackIndex)
+		{
+			OutBaked.NumRemovedCurveKeys += RemovedKeys[TrackIndex];
+			if (MorphCurves[TrackIndex].Keys.Num() > 0)
+			{
+				OutBaked.Curves.Add(MoveTemp(MorphCurves[TrackIndex]));
+			}
+		}
+	}
+
+	// 4) IK toggles as stepped curves (1 = IK chain disabled); chains that are never disabled get no curve
+	if (Settings.bImportIKToggleCurves)
+	{
+		TMap<FName, int32> CurveByIKBone;
+		TArray<FPmxVmdBakedCurve> IKCurves;
+		for (const FPmxVmdPropertyKey& PropertyKey : Motion.PropertyKeys)
+		{
+			const float Time = static_cast<float>(PropertyKey.Frame / VmdFrameRate);
+			for (const FPmxVmdIKState& State : PropertyKey.IKStates)
+			{
+				const int32 BoneIndex = NameIndex.FindBoneIndex(State.Name);
+				const FName IKBoneName = BoneIndex != INDEX_NONE ? RefSkeleton.GetBoneName(BoneIndex) : FName(*State.Name);
+
+				int32* CurveIndex = CurveByIKBone.Find(IKBoneName);
+				if (!CurveIndex)
+				{
+					FPmxVmdBakedCurve& NewCurve = IKCurves.AddDefaulted_GetRef();
+					NewCurve.Name = FPmxRigDescription::GetIKDisabledCurveName(IKBoneName);
+					CurveIndex = &CurveByIKBone.Add(IKBoneName, IKCurves.Num() - 1);
+				}
+
+				FRichCurveKey& NewKey = IKCurves[*CurveIndex].Keys.Emplace_GetRef(Time, State.bEnabled ? 0.0f : 1.0f);
+				NewKey.InterpMode = RCIM_Constant;
+			}
+		}
+
+		for (FPmxVmdBakedCurve& Curve : IKCurves)
+		{
+			const bool bEverDisabled = Curve.Keys.ContainsByPredicate([](const FRichCurveKey& Key) { return Key.Value > 0.5f; });
+			if (!bEverDisabled)
+			{
+				OutBaked.NumRemovedCurveKeys += Curve.Keys.Num();
+				continue;
+			}
+			OutBaked.NumRemovedCurveKeys += ReduceKeys(Curve.Keys, Settings.CurveTolerance);
+			OutBaked.Curves.Add(MoveTemp(Curve));
+		}
+	}
+
+	if (Motion.CameraKeys.Num() > 0 || Motion.LightKeys.Num() > 0 || Motion.SelfShadowKeys.Num() > 0)
+	{
+		UE_LOG(LogPMXImporter, Log, TEXT("PMX VMD: Camera (%d), light (%d) and self-shadow (%d) keys are not converted to the animation sequence"),
+			Motion.CameraKeys.Num(), Motion.LightKeys.Num(), Motion.SelfShadowKeys.Num());
+	}
+
+	if (OutBaked.UnmappedBones.Num() > 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX VMD: %d bone tracks do not match the skeleton: %s"),
+			OutBaked.UnmappedBones.Num(), *FString::Join(OutBaked.UnmappedBones, TEXT(", ")));
+	}
+
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX VMD: Baked %d keys at %d fps - %d bone tracks (%d rest pose tracks dropped), %d curves (%d redundant keys removed)"),
+		OutBaked.NumKeys, OutBaked.FrameRate, OutBaked.BoneTracks.Num(), OutBaked.NumConstantTracks, OutBaked.Curves.Num(), OutBaked.NumRemovedCurveKeys);
+
+	const int32 NumMappedTracks = Motion.BoneTracks.Num() - OutBaked.UnmappedBones.Num();
+	return NumMappedTracks > 0 || OutBaked.Curves.Num() > 0;
+}
+
+bool FPmxVmdAnimationBuilder::BakeRig(const FPmxRigDescription& RigDescription, const FReferenceSkeleton& RefSkeleton,
+	const FPmxVmdBakeSettings& Settings, FPmxVmdBakedAnimation& InOutBaked)
+{
+	using namespace PmxVmdAnimationBuilderPrivate;
+
+	FPmxRigEvaluator Evaluator;
+	if (InOutBaked.NumKeys < 1 || !Evaluator.Initialize(RigDescription, RefSkeleton))
+	{
+		return false;
+	}
+
+	const TArray<FTransform>& RefPose = RefSkeleton.GetRawRefBonePose();
+	const int32 NumKeys = InOutBaked.NumKeys;
+
+	TArray<int32> TrackOfBone;
+	TrackOfBone.Init(INDEX_NONE, RefPose.Num());
+	for (int32 TrackIndex = 0; TrackIndex < InOutBaked.BoneTracks.Num(); ++TrackIndex)
+	{
+		const int32 BoneIndex = RefSkeleton.FindBoneIndex(InOutBaked.BoneTracks[TrackIndex].BoneName);
+		if (BoneIndex != INDEX_NONE)
+		{
+			TrackOfBone[BoneIndex] = TrackIndex;
+		}
+	}
+
+	// Bones the rig writes (append targets and IK links) need a track even if the motion never keys them
+	auto AddOutputBone = [&](int32 RigBoneIndex)
+	{
+		if (!RigDescription.Bones.IsValidIndex(RigBoneIndex))
+		{
+			return;
+		}
+		const int32 BoneIndex = RefSkeleton.FindBoneIndex(RigDescription.Bones[RigBoneIndex].Name);
+		if (BoneIndex != INDEX_NONE && TrackOfBone[BoneIndex] == INDEX_NONE)
+		{
+			FPmxVmdBakedBoneTrack& NewTrack = InOutBaked.BoneTracks.AddDefaulted_GetRef();
+			NewTrack.BoneName = RefSkeleton.GetBoneName(BoneIndex);
+			NewTrack.Positions.Init(FVector3f(RefPose[BoneIndex].GetTranslation()), NumKeys);
+			NewTrack.Rotations.Init(FQuat4f(RefPose[BoneIndex].GetRotation()), NumKeys);
+			TrackOfBone[BoneIndex] = InOutBaked.BoneTracks.Num() - 1;
+		}
+	};
+	for (const FPmxRigAppend& Append : RigDescription.Appends)
+	{
+		AddOutputBone(Append.BoneIndex);
+	}
+	for (const FPmxRigIKLink& Link : RigDescription.IKLinks)
+	{
+		AddOutputBone(Link.BoneIndex);
+	}
+
+	// IK toggle curves switch chains per frame; they are consumed by the bake
+	TArray<TPair<int32, const FPmxVmdBakedCurve*>> ChainToggles;
+	TSet<FName> ToggleCurveNames;
+	for (const FPmxRigIKChain& Chain : RigDescription.IKChains)
+	{
+		if (!RigDescription.Bones.IsValidIndex(Chain.IKBoneIndex))
+		{
+			continue;
+		}
+		const FName IKBoneName = RigDescription.Bones[Chain.IKBoneIndex].Name;
+		const FName CurveName = FPmxRigDescription::GetIKDisabledCurveName(IKBoneName);
+		const FPmxVmdBakedCurve* Curve = InOutBaked.Curves.FindByPredicate([&CurveName](const FPmxVmdBakedCurve& Candidate) { return Candidate.Name == CurveName; });
+		const int32 ChainIndex = Evaluator.FindIKChainByBoneName(IKBoneName);
+		if (Curve && ChainIndex != INDEX_NONE)
+		{
+			ChainToggles.Emplace(ChainIndex, Curve);
+			ToggleCurveNames.Add(CurveName);
+		}
+	}
+
+	TArray<FTransform> Pose;
+	for (int32 KeyIndex = 0; KeyIndex < NumKeys; ++KeyIndex)
+	{
+		Pose = RefPose;
+		for (int32 BoneIndex = 0; BoneIndex < Pose.Num(); ++BoneIndex)
+		{
+			if (TrackOfBone[BoneIndex] != INDEX_NONE)
+			{
+				const FPmxVmdBakedBoneTrack& Track = InOutBaked.BoneTracks[TrackOfBone[BoneIndex]];
+				Pose[BoneIndex].SetRotation(FQuat(Track.Rotations[KeyIndex]));
+				Pose[BoneIndex].SetTranslation(FVector(Track.Positions[KeyIndex]));
+			}
+		}
+
+		const float Time = static_cast<float>(KeyIndex) / InOutBaked.FrameRate;
+		for (const TPair<int32, const FPmxVmdBakedCurve*>& Toggle : ChainToggles)
+		{
+			Evaluator.SetIKChainEnabled(Toggle.Key, EvaluateSteppedKeys(Toggle.Value->Keys, Time) <= 0.5f);
+		}
+		Evaluator.Evaluate(Pose);
+
+		for (int32 BoneIndex = 0; BoneIndex < Pose.Num(); ++BoneIndex)
+		{
+			if (TrackOfBone[BoneIndex] != INDEX_NONE)
+			{
+				FPmxVmdBakedBoneTrack& Track = InOutBaked.BoneTracks[TrackOfBone[BoneIndex]];
+				Track.Rotations[KeyIndex] = FQuat4f(Pose[BoneIndex].GetRotation());
+				Track.Positions[KeyIndex] = FVector3f(Pose[BoneIndex].GetTranslation());
+			}
+		}
+	}
+
+	InOutBaked.Curves.RemoveAll([&ToggleCurveNames](const FPmxVmdBakedCurve& Curve) { return ToggleCurveNames.Contains(Curve.Name); });
+	InOutBaked.NumConstantTracks += InOutBaked.BoneTracks.RemoveAll([&](const FPmxVmdBakedBoneTrack& Track)
+	{
+		const int32 BoneIndex = RefSkeleton.FindBoneIndex(Track.BoneName);
+		return BoneIndex != INDEX_NONE && MatchesRestPose(Track, RefPose[BoneIndex], Settings);
+	});
+
+	UE_LOG(LogPMXImporter, Log, TEXT("PMX VMD: Baked rig into %d bone tracks (%d IK toggle curves consumed)"),
+		InOutBaked.BoneTracks.Num(), ToggleCurveNames.Num());
+	return true;
+}
+
+bool FPmxVmdAnimationBuilder::ApplyToSequence(UAnimSequence* Sequence, const FPmxVmdBakedAnimation& Baked)
+{
+	if (!Sequence || !Sequence->GetSkeleton() || Baked.NumKeys < 2)
+	{
+		return false;
+	}
+
+	USkeleton* Skeleton = Sequence->GetSkeleton();
+	IAnimationDataController& Controller = Sequence->GetController();
+	constexpr bool bShouldTransact = false;
+
+	Controller.OpenBracket(LOCTEXT("ImportVmd", "Import VMD motion"), bShouldTransact);
+	Controller.InitializeModel();
+	Controller.SetFrameRate(FFrameRate(Baked.FrameRate, 1), bShouldTransact);
+	Controller.SetNumberOfFrames(FFrameNumber(Baked.NumKeys - 1), bShouldTransact);
+
+	TArray<FVector3f> ScaleKeys;
+	ScaleKeys.Init(FVector3f::OneVector, Baked.NumKeys);
+	for (const FPmxVmdBakedBoneTrack& Track : Baked.BoneTracks)
+	{
+		Controller.AddBoneCurve(Track.BoneName, bShouldTransact);
+		Controller.SetBoneTrackKeys(Track.BoneName, Track.Positions, Track.Rotations, ScaleKeys, bShouldTransact);
+	}
+
+	for (const FPmxVmdBakedCurve& Curve : Baked.Curves)
+	{
+		const FAnimationCurveIdentifier CurveId(Curve.Name, ERawCurveTrackTypes::RCT_Float);
+		Controller.AddCurve(CurveId, AACF_Editable, bShouldTransact);
+		Controller.SetCurveKeys(CurveId, Curve.Keys, bShouldTransact);
+		if (Curve.bMorphTarget)
+		{
+			Skeleton->AccumulateCurveMetaData(Curve.Name, false, true);
+		}
+	}
+
+	Controller.NotifyPopulated();
+	Controller.CloseBracket(bShouldTransact);
+
+	Sequence->PostEditChange();
+	Sequence->MarkPackageDirty();
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,314 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxVmdBatchCommandlet.h"
+#include "PmxVmdReader.h"
+#include "PmxVmdStructs.h"
+#include "PmxVmdAnimationBuilder.h"
+#include "PmxRigDefinition.h"
+#include "PmxUtils.h"
+#include "LogPMXImporter.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMesh.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "UObject/UObjectGlobals.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxVmdBatchCommandlet)
+
+namespace PmxVmdBatchPrivate
+{
+	/** Sequences are garbage collected after this many saves to keep memory flat */
+	static constexpr int32 GarbageCollectInterval = 32;
+
+	/** Worker side of one motion: everything up to (not including) UObject creation */
+	struct FJob
+	{
+		FString SourceFile;
+		FString AssetName;
+		int64 SourceBytes = 0;
+
+		bool bBaked = false;
+		FString Error;
+		FPmxVmdBakedAnimation Baked;
+
+		double ParseSeconds = 0.0;
+		double BakeSeconds = 0.0;
+	};
+
+	static void RunJob(FJob& Job, const FReferenceSkeleton& RefSkeleton, const FPmxVmdBoneNameIndex& NameIndex,
+		const FPmxRigDescription* RigToBake, const FPmxVmdBakeSettings& Settings)
+	{
+		double StartTime = FPlatformTime::Seconds();
+		FPmxVmdMotion Motion;
+		if (!PMXVmdReader::LoadVmdFromFile(Job.SourceFile, Motion))
+		{
+			Job.Error = TEXT("Failed to parse VMD");
+			return;
+		}
+		if (Motion.IsCameraMotion())
+		{
+			Job.Error = TEXT("Camera motion (not supported)");
+			return;
+		}
+		Job.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		if (!FPmxVmdAnimationBuilder::BakeMotion(Motion, RefSkeleton, NameIndex, Settings, Job.Baked))
+		{
+			Job.Error = TEXT("No bone or morph matches the skeleton");
+			return;
+		}
+		if (RigToBake && !FPmxVmdAnimationBuilder::BakeRig(*RigToBake, RefSkeleton, Settings, Job.Baked))
+		{
+			Job.Error = TEXT("Failed to bake the PMX rig");
+			return;
+		}
+		Job.BakeSeconds = FPlatformTime::Seconds() - StartTime;
+		Job.bBaked = true;
+	}
+
+	static int64 GetBakedBytes(const FPmxVmdBakedAnimation& Baked)
+	{
+		int64 Bytes = 0;
+		for (const FPmxVmdBakedBoneTrack& Track : Baked.BoneTracks)
+		{
+			Bytes += Track.Positions.GetAllocatedSize() + Track.Rotations.GetAllocatedSize();
+		}
+		for (const FPmxVmdBakedCurve& Curve : Baked.Curves)
+		{
+			Bytes += Curve.Keys.GetAllocatedSize();
+		}
+		return Bytes;
+	}
+
+	static FString CsvEscape(const FString& Value)
+	{
+		if (Value.Contains(TEXT(",")) || Value.Contains(TEXT("\"")) || Value.Contains(TEXT("\n")))
+		{
+			return TEXT("\"") + Value.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+		}
+		return Value;
+	}
+
+	static UAnimSequence* SaveSequence(const FJob& Job, const FString& DestPath, USkeleton* Skeleton, USkeletalMesh* PreviewMesh, FString& OutError)
+	{
+		const FString PackageName = DestPath / Job.AssetName;
+
+		// Reconvert into the existing asset so references to it stay valid
+		UPackage* Package = FPackageName::DoesPackageExist(PackageName) ? LoadPackage(nullptr, *PackageName, LOAD_None) : CreatePackage(*PackageName);
+		if (!Package)
+		{
+			OutError = TEXT("Failed to create package");
+			return nullptr;
+		}
+
+		UAnimSequence* Sequence = FindObject<UAnimSequence>(Package, *Job.AssetName);
+		const bool bCreated = Sequence == nullptr;
+		if (bCreated)
+		{
+			Sequence = NewObject<UAnimSequence>(Package, *Job.AssetName, RF_Public | RF_Standalone);
+		}
+		Sequence->SetSkeleton(Skeleton);
+		Sequence->SetPreviewMesh(PreviewMesh);
+
+		if (!FPmxVmdAnimationBuilder::ApplyToSequence(Sequence, Job.Baked))
+		{
+			OutError = TEXT("Failed to build animation data");
+			return nullptr;
+		}
+		if (bCreated)
+		{
+			FAssetRegistryModule::AssetCreated(Sequence);
+		}
+
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.Error = GWarn;
+		if (!UPackage::SavePackage(Package, Sequence, *PackageFilename, SaveArgs))
+		{
+			OutError = TEXT("Failed to save package");
+			return nullptr;
+		}
+		return Sequence;
+	}
+}
+
+UPmxVmdBatchCommandlet::UPmxVmdBatchCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPmxVmdBatchCommandlet::Main(const FString& Params)
+{
+	using namespace PmxVmdBatchPrivate;
+
+	FString MeshPath;
+	FString SourceDir;
+	FString DestPath;
+	if (!FParse::Value(*Params, TEXT("Mesh="), MeshPath) || !FParse::Value(*Params, TEXT("Source="), SourceDir)
+		|| !FParse::Value(*Params, TEXT("Dest="), DestPath))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PmxVmdBatch: Usage: -run=PmxVmdBatch -Mesh=<SkeletalMesh> -Source=<VMD directory> -Dest=<Content path> [-Workers=N] [-FrameRate=30] [-BakeIK] [-NoMorphs] [-Report=<Csv path>]"));
+		return 1;
+	}
+
+	int32 NumWorkers = FMath::Max(FPlatformMisc::NumberOfWorkerThreadsToSpawn(), 1);
+	FParse::Value(*Params, TEXT("Workers="), NumWorkers);
+	NumWorkers = FMath::Max(NumWorkers, 1);
+
+	FPmxVmdBakeSettings Settings;
+	FParse::Value(*Params, TEXT("FrameRate="), Settings.FrameRate);
+	Settings.bImportMorphCurves = !FParse::Param(*Params, TEXT("NoMorphs"));
+	const bool bBakeIK = FParse::Param(*Params, TEXT("BakeIK"));
+
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("PmxVmdBatch") / (FDateTime::Now().ToString() + TEXT(".csv"));
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+
+	// 1) Target mesh, skeleton and rig
+	const FString MeshObjectPath = MeshPath.Contains(TEXT(".")) ? MeshPath : MeshPath + TEXT(".") + FPackageName::GetShortName(MeshPath);
+	USkeletalMesh* Mesh = LoadObject<USkeletalMesh>(nullptr, *MeshObjectPath);
+	USkeleton* Skeleton = Mesh ? Mesh->GetSkeleton() : nullptr;
+	if (!Skeleton)
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PmxVmdBatch: Could not load skeletal mesh (or its skeleton) '%s'"), *MeshObjectPath);
+		return 1;
+	}
+	Mesh->AddToRoot();
+
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().SearchAllAssets(true);
+	UPmxRigDefinition* Rig = FPmxVmdBoneNameIndex::FindRigForSkeleton(Skeleton);
+	if (Rig)
+	{
+		Rig->AddToRoot();
+	}
+	else if (bBakeIK)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxVmdBatch: -BakeIK requested but skeleton '%s' has no PMX rig; motions are converted without IK"), *Skeleton->GetName());
+	}
+
+	// Built once and shared read-only by every worker
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	FPmxVmdBoneNameIndex NameIndex;
+	NameIndex.Build(RefSkeleton, Rig);
+	const FPmxRigDescription* RigToBake = (bBakeIK && Rig && !Rig->Description.IsEmpty()) ? &Rig->Description : nullptr;
+
+	// 2) Motions
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(SourceDir / TEXT("*.vmd")), true, false);
+	Files.Sort();
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxVmdBatch: No .vmd files in '%s'"), *SourceDir);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxVmdBatch: %d motions -> %s (skeleton '%s', rig %s, %d workers%s)"),
+		Files.Num(), *DestPath, *Skeleton->GetName(), Rig ? *Rig->GetName() : TEXT("none"), NumWorkers, RigToBake ? TEXT(", IK baked") : TEXT(""));
+
+	FString Csv = TEXT("File,Asset,Status,Error,SourceKB,Keys,BoneTracks,RestTracksDropped,Curves,CurveKeysRemoved,UnmappedBones,ParseMs,BakeMs,SaveMs,BakedKB,UsedPhysicalMB\n");
+	TSet<FString> UsedAssetNames;
+	int32 NumSucceeded = 0;
+	const double BatchStartTime = FPlatformTime::Seconds();
+
+	// 3) Bounded pipeline: workers parse and bake ahead, the main thread saves in file order
+	struct FInFlight
+	{
+		TSharedPtr<FJob> Job;
+		UE::Tasks::FTask Task;
+	};
+	TArray<FInFlight> InFlight;
+	int32 NextFile = 0;
+	int32 NumFinished = 0;
+
+	while (NextFile < Files.Num() || InFlight.Num() > 0)
+	{
+		while (NextFile < Files.Num() && InFlight.Num() < NumWorkers)
+		{
+			TSharedPtr<FJob> Job = MakeShared<FJob>();
+			Job->SourceFile = SourceDir / Files[NextFile++];
+			Job->SourceBytes = IFileManager::Get().FileSize(*Job->SourceFile);
+
+			FString AssetName = TEXT("A_") + FPmxUtils::SanitizePackagePath(FPaths::GetBaseFilename(Job->SourceFile));
+			for (int32 Suffix = 1; UsedAssetNames.Contains(AssetName); ++Suffix)
+			{
+				AssetName = FString::Printf(TEXT("A_%s_%d"), *FPmxUtils::SanitizePackagePath(FPaths::GetBaseFilename(Job->SourceFile)), Suffix);
+			}
+			UsedAssetNames.Add(AssetName);
+			Job->AssetName = AssetName;
+
+			FJob* JobPtr = Job.Get();
+			UE::Tasks::FTask Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [JobPtr, &RefSkeleton, &NameIndex, RigToBake, &Settings]()
+			{
+				RunJob(*JobPtr, RefSkeleton, NameIndex, RigToBake, Settings);
+			});
+			InFlight.Add({ MoveTemp(Job), MoveTemp(Task) });
+		}
+
+		FInFlight Current = MoveTemp(InFlight[0]);
+		InFlight.RemoveAt(0);
+		Current.Task.Wait();
+		FJob& Job = *Current.Job;
+
+		FString Error = Job.Error;
+		double SaveSeconds = 0.0;
+		if (Job.bBaked)
+		{
+			const double SaveStartTime = FPlatformTime::Seconds();
+			if (UAnimSequence* Sequence = SaveSequence(Job, DestPath, Skeleton, Mesh, Error))
+			{
+				// Saved; let the next collection reclaim it
+				Sequence->ClearFlags(RF_Standalone);
+				++NumSucceeded;
+			}
+			SaveSeconds = FPlatformTime::Seconds() - SaveStartTime;
+		}
+
+		const bool bSucceeded = Job.bBaked && Error.IsEmpty();
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		Csv += FString::Printf(TEXT("%s,%s,%s,%s,%lld,%d,%d,%d,%d,%d,%s,%.2f,%.2f,%.2f,%lld,%llu\n"),
+			*CsvEscape(FPaths::GetCleanFilename(Job.SourceFile)), *CsvEscape(Job.AssetName),
+			bSucceeded ? TEXT("OK") : TEXT("FAILED"), *CsvEscape(Error),
+			Job.SourceBytes / 1024, Job.Baked.NumKeys, Job.Baked.BoneTracks.Num(), Job.Baked.NumConstantTracks,
+			Job.Baked.Curves.Num(), Job.Baked.NumRemovedCurveKeys, *CsvEscape(FString::Join(Job.Baked.UnmappedBones, TEXT(";"))),
+			Job.ParseSeconds * 1000.0, Job.BakeSeconds * 1000.0, SaveSeconds * 1000.0,
+			GetBakedBytes(Job.Baked) / 1024, static_cast<uint64>(MemoryStats.UsedPhysical / (1024 * 1024)));
+
+		if (!bSucceeded)
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PmxVmdBatch: %s failed: %s"), *Job.SourceFile, *Error);
+		}
+
+		if (++NumFinished % GarbageCollectInterval == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	const double BatchSeconds = FPlatformTime::Seconds() - BatchStartTime;
+	if (!FFileHelper::SaveStringToFile(Csv, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8))
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PmxVmdBatch: Failed to write report '%s'"), *ReportPath);
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PmxVmdBatch: %d/%d motions converted in %.1f s (%.2f motions/s). Report: %s"),
+		NumSucceeded, Files.Num(), BatchSeconds, BatchSeconds > 0.0 ? Files.Num() / BatchSeconds : 0.0, *ReportPath);
+
+	if (Rig)
+	{
+		Rig->RemoveFromRoot();
+	}
+	Mesh->RemoveFromRoot();
+
+	return NumSucceeded == Files.Num() ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxVmdFactory.h"
+#include "PmxVmdReader.h"
+#include "PmxVmdStructs.h"
+#include "PmxVmdAnimationBuilder.h"
+#include "PmxRigDefinition.h"
+#include "LogPMXImporter.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "ContentBrowserModule.h"
+#include "IContentBrowserSingleton.h"
+#include "Editor.h"
+#include "Subsystems/ImportSubsystem.h"
+#include "Widgets/SWindow.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Styling/AppStyle.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxVmdFactory)
+
+#define LOCTEXT_NAMESPACE "PmxVmdFactory"
+
+UPmxVmdFactory::UPmxVmdFactory(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SupportedClass = UAnimSequence::StaticClass();
+	bCreateNew = false;
+	bEditorImport = true;
+	bText = false;
+	Formats.Add(TEXT("vmd;MikuMikuDance Motion"));
+}
+
+bool UPmxVmdFactory::FactoryCanImport(const FString& Filename)
+{
+	return FPaths::GetExtension(Filename).Equals(TEXT("vmd"), ESearchCase::IgnoreCase);
+}
+
+UObject* UPmxVmdFactory::FactoryCreateFile(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags,
+	const FString& Filename, const TCHAR* Parms, FFeedbackContext* Warn, bool& bOutOperationCanceled)
+{
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPreImport(this, InClass, InParent, InName, TEXT("vmd"));
+
+	// 1) Target skeleton (asked once per multi-file import)
+	USkeleton* Skeleton = TargetSkeleton ? TargetSkeleton.Get() : SessionSkeleton.Get();
+	if (!Skeleton)
+	{
+		if (IsAutomatedImport())
+		{
+			UE_LOG(LogPMXImporter, Error, TEXT("PMX VMD: No target skeleton set for automated import of '%s'"), *Filename);
+			return nullptr;
+		}
+
+		Skeleton = PickSkeleton();
+		if (!Skeleton)
+		{
+			bOutOperationCanceled = true;
+			return nullptr;
+		}
+		SessionSkeleton = Skeleton;
+	}
+
+	// 2) Decode
+	FPmxVmdMotion Motion;
+	if (!PMXVmdReader::LoadVmdFromFile(Filename, Motion))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PMX VMD: Failed to read '%s'"), *Filename);
+		return nullptr;
+	}
+	if (Motion.IsCameraMotion())
+	{
+		UE_LOG(LogPMXImporter, Warning, TEXT("PMX VMD: '%s' is a camera motion; camera import is not supported"), *Filename);
+		return nullptr;
+	}
+
+	// 3) Bake against the skeleton
+	const UPmxRigDefinition* Rig = RigDefinition ? RigDefinition.Get() : FPmxVmdBoneNameIndex::FindRigForSkeleton(Skeleton);
+	FPmxVmdBoneNameIndex NameIndex;
+	NameIndex.Build(Skeleton->GetReferenceSkeleton(), Rig);
+
+	FPmxVmdBakeSettings Settings;
+	Settings.FrameRate = FrameRate;
+	Settings.bImportMorphCurves = bImportMorphCurves;
+	Settings.bImportIKToggleCurves = bImportIKToggleCurves;
+
+	FPmxVmdBakedAnimation Baked;
+	if (!FPmxVmdAnimationBuilder::BakeMotion(Motion, Skeleton->GetReferenceSkeleton(), NameIndex, Settings, Baked))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PMX VMD: Nothing in '%s' (model '%s') matches skeleton '%s'"),
+			*Filename, *Motion.ModelName, *Skeleton->GetName());
+		return nullptr;
+	}
+
+	// 4) Write the sequence
+	UAnimSequence* Sequence = NewObject<UAnimSequence>(InParent, InClass, InName, Flags);
+	Sequence->SetSkeleton(Skeleton);
+	Sequence->SetPreviewMesh(Skeleton->GetPreviewMesh());
+	if (!FPmxVmdAnimationBuilder::ApplyToSequence(Sequence, Baked))
+	{
+		UE_LOG(LogPMXImporter, Error, TEXT("PMX VMD: Failed to build animation '%s'"), *InName.ToString());
+		return nullptr;
+	}
+
+	UE_LOG(LogPMXImporter, Display, TEXT("PMX VMD: Imported '%s' onto '%s' (rig: %s)"),
+		*InName.ToString(), *Skeleton->GetName(), Rig ? *Rig->GetName() : TEXT("none"));
+
+	GEditor->GetEditorSubsystem<UImportSubsystem>()->BroadcastAssetPostImport(this, Sequence);
+	return Sequence;
+}
+
+void UPmxVmdFactory::CleanUp()
+{
+	Super::CleanUp();
+	SessionSkeleton.Reset();
+}
+
+USkeleton* UPmxVmdFactory::PickSkeleton() const
+{
+	IContentBrowserSingleton& ContentBrowser = FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser")).Get();
+
+	FAssetData PickedAsset;
+	TSharedPtr<SWindow> PickerWindow;
+
+	FAssetPickerConfig PickerConfig;
+	PickerConfig.Filter.ClassPaths.Add(USkeleton::StaticClass()->GetClassPathName());
+	PickerConfig.Filter.bRecursiveClasses = true;
+	PickerConfig.InitialAssetViewType = EAssetViewType::List;
+	PickerConfig.bAllowNullSelection = false;
+	PickerConfig.OnAssetSelected = FOnAssetSelected::CreateLambda([&PickedAsset, &PickerWindow](const FAssetData& AssetData)
+	{
+		PickedAsset = AssetData;
+		if (PickerWindow.IsValid())
+		{
+			PickerWindow->RequestDestroyWindow();
+		}
+	});
+
+	PickerWindow = SNew(SWindow)
+		.Title(LOCTEXT("PickSkeletonTitle", "Pick Skeleton for VMD Import"))
+		.ClientSize(FVector2D(500, 600))
+		.SupportsMinimize(false)
+		.SupportsMaximize(false)
+		[
+			SNew(SBorder)
+			.BorderImage(FAppStyle::GetBrush("Menu.Background"))
+			[
+				ContentBrowser.CreateAssetPicker(PickerConfig)
+			]
+		];
+
+	GEditor->EditorAddModalWindow(PickerWindow.ToSharedRef());
+	return Cast<USkeleton>(PickedAsset.GetAsset());
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,466 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxVmdReader.h"
+#include "PmxVmdStructs.h"
+#include "PmxBinaryReader.h"
+#include "Misc/FileHelper.h"
+#include "Algo/Sort.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsHWrapper.h"
+#elif PLATFORM_MAC
+#include <CoreFoundation/CoreFoundation.h>
+#elif UE_ENABLE_ICU
+THIRD_PARTY_INCLUDES_START
+#include <unicode/ucnv.h>
+THIRD_PARTY_INCLUDES_END
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogPmxVmdReader, Log, All);
+
+namespace PmxVmdReaderPrivate
+{
+	static constexpr int32 SignatureSize = 30;
+	static constexpr int32 BoneNameSize = 15;
+	static constexpr int32 IKNameSize = 20;
+
+	/** Guard against corrupt counts before reserving (bytes per record) */
+	static constexpr int32 BoneKeySize = 111;
+	static constexpr int32 MorphKeySize = 23;
+	static constexpr int32 CameraKeySize = 61;
+	static constexpr int32 LightKeySize = 28;
+	static constexpr int32 SelfShadowKeySize = 9;
+
+	/**
+	 * Raw (undecoded) name bytes widened one byte per character
+	 * Used to group keys into tracks so each distinct name is Shift-JIS decoded only once.
+	 */
+	static FString MakeRawKey(const uint8* Bytes, int32 MaxBytes)
+	{
+		FString Key;
+		Key.Reserve(MaxBytes);
+		for (int32 Index = 0; Index < MaxBytes && Bytes[Index] != 0; ++Index)
+		{
+			Key.AppendChar(static_cast<TCHAR>(Bytes[Index]));
+		}
+		return Key;
+	}
+}
+
+class FPmxVmdReader : public FPmxBinaryReader
+{
+public:
+	explicit FPmxVmdReader(TArrayView<const uint8> InData);
+
+	bool ReadMotion(FPmxVmdMotion& OutMotion);
+
+private:
+	bool ReadName(FString& OutName, int32 NameSize);
+	bool ReadCount(int32& OutCount, int32 RecordSize);
+
+	// Section reading functions
+	bool ReadHeader(FPmxVmdMotion& Motion, int32& OutModelNameSize);
+	bool ReadBoneKeys(FPmxVmdMotion& Motion);
+	bool ReadMorphKeys(FPmxVmdMotion& Motion);
+	bool ReadCameraKeys(FPmxVmdMotion& Motion);
+	bool ReadLightKeys(FPmxVmdMotion& Motion);
+	bool ReadSelfShadowKeys(FPmxVmdMotion& Motion);
+	bool ReadPropertyKeys(FPmxVmdMotion& Motion);
+
+	virtual void LogError(const FString& Message) const override;
+};
+
+FPmxVmdReader::FPmxVmdReader(TArrayView<const uint8> InData)
+	: FPmxBinaryReader(InData)
+{
+}
+
+bool FPmxVmdReader::ReadMotion(FPmxVmdMotion& OutMotion)
+{
+	Position = 0;
+	OutMotion = FPmxVmdMotion();
+
+	int32 ModelNameSize = 0;
+	if (!ReadHeader(OutMotion, ModelNameSize)) return false;
+	if (!ReadBoneKeys(OutMotion)) return false;
+
+	// Every section after the bone keys is optional (older tools stop writing early)
+	if (!IsAtEnd() && !ReadMorphKeys(OutMotion)) return false;
+	if (!IsAtEnd() && !ReadCameraKeys(OutMotion)) return false;
+	if (!IsAtEnd() && !ReadLightKeys(OutMotion)) return false;
+	if (!IsAtEnd() && !ReadSelfShadowKeys(OutMotion)) return false;
+	if (!IsAtEnd() && !ReadPropertyKeys(OutMotion)) return false;
+
+	UE_LOG(LogPmxVmdReader, Log, TEXT("VMD '%s': %d bone keys (%d tracks), %d morph keys (%d tracks), %d camera, %d light, %d self-shadow, %d property keys, last frame %u"),
+		*OutMotion.ModelName, OutMotion.NumBoneKeys, OutMotion.BoneTracks.Num(), OutMotion.NumMorphKeys, OutMotion.MorphTracks.Num(),
+		OutMotion.CameraKeys.Num(), OutMotion.LightKeys.Num(), OutMotion.SelfShadowKeys.Num(), OutMotion.PropertyKeys.Num(), OutMotion.MaxFrame);
+
+	return true;
+}
+
+bool FPmxVmdReader::ReadName(FString& OutName, int32 NameSize)
+{
+	if (!IsValidPosition(NameSize))
+	{
+		return false;
+	}
+	if (!PMXVmdReader::DecodeShiftJis(&Data[Position], NameSize, OutName))
+	{
+		LogError(FString::Printf(TEXT("Cannot decode Shift-JIS name '%s'"), *OutName));
+		return false;
+	}
+	Position += NameSize;
+	return true;
+}
+
+bool FPmxVmdReader::ReadCount(int32& OutCount, int32 RecordSize)
+{
+	uint32 Count = 0;
+	if (!ReadValue(Count))
+	{
+		return false;
+	}
+	if (static_cast<int64>(Count) * RecordSize > GetRemaining())
+	{
+		LogError(FString::Printf(TEXT("Invalid record count %u"), Count));
+		return false;
+	}
+	OutCount = static_cast<int32>(Count);
+	return true;
+}
+
+bool FPmxVmdReader::ReadHeader(FPmxVmdMotion& Motion, int32& OutModelNameSize)
+{
+	if (!IsValidPosition(PmxVmdReaderPrivate::SignatureSize))
+	{
+		LogError(TEXT("File too small to contain VMD signature"));
+		return false;
+	}
+
+	const ANSICHAR* Signature = reinterpret_cast<const ANSICHAR*>(&Data[Position]);
+	if (FCStringAnsi::Strncmp(Signature, "Vocaloid Motion Data 0002", 25) == 0)
+	{
+		OutModelNameSize = 20;
+	}
+	else if (FCStringAnsi::Strncmp(Signature, "Vocaloid Motion Data file", 25) == 0)
+	{
+		OutModelNameSize = 10;
+	}
+	else
+	{
+		LogError(TEXT("Invalid VMD signature"));
+		return false;
+	}
+	Position += PmxVmdReaderPrivate::SignatureSize;
+
+	return ReadName(Motion.ModelName, OutModelNameSize);
+}
+
+bool FPmxVmdReader::ReadBoneKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	if (!ReadCount(Count, PmxVmdReaderPrivate::BoneKeySize))
+	{
+		return false;
+	}
+
+	// Keys of one bone are scattered through the file; group them while streaming
+	TMap<FString, int32> TrackByRawName;
+	for (int32 KeyIndex = 0; KeyIndex < Count; ++KeyIndex)
+	{
+		const FString RawName = PmxVmdReaderPrivate::MakeRawKey(&Data[Position], PmxVmdReaderPrivate::BoneNameSize);
+		int32* TrackIndex = TrackByRawName.Find(RawName);
+		if (!TrackIndex)
+		{
+			FPmxVmdBoneTrack& NewTrack = Motion.BoneTracks.AddDefaulted_GetRef();
+			if (!PMXVmdReader::DecodeShiftJis(&Data[Position], PmxVmdReaderPrivate::BoneNameSize, NewTrack.Name))
+			{
+				LogError(FString::Printf(TEXT("Cannot decode Shift-JIS bone name '%s'"), *NewTrack.Name));
+				return false;
+			}
+			TrackIndex = &TrackByRawName.Add(RawName, Motion.BoneTracks.Num() - 1);
+		}
+		Position += PmxVmdReaderPrivate::BoneNameSize;
+
+		FPmxVmdBoneKey& Key = Motion.BoneTracks[*TrackIndex].Keys.AddDefaulted_GetRef();
+		uint8 Interpolation[64];
+		if (!ReadValue(Key.Frame) || !ReadVector3f(Key.Position) || !ReadQuatf(Key.Rotation) || !ReadBytes(Interpolation, 64))
+		{
+			return false;
+		}
+
+		// First row holds x1[X,Y,Z,R], y1[X,Y,Z,R], x2[X,Y,Z,R], y2[X,Y,Z,R]; the other rows are shifted copies
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			Key.Interpolation[Channel][0] = Interpolation[Channel];
+			Key.Interpolation[Channel][1] = Interpolation[4 + Channel];
+			Key.Interpolation[Channel][2] = Interpolation[8 + Channel];
+			Key.Interpolation[Channel][3] = Interpolation[12 + Channel];
+		}
+
+		Motion.MaxFrame = FMath::Max(Motion.MaxFrame, Key.Frame);
+	}
+	Motion.NumBoneKeys = Count;
+
+	for (FPmxVmdBoneTrack& Track : Motion.BoneTracks)
+	{
+		Algo::StableSortBy(Track.Keys, &FPmxVmdBoneKey::Frame);
+	}
+	return true;
+}
+
+bool FPmxVmdReader::ReadMorphKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	if (!ReadCount(Count, PmxVmdReaderPrivate::MorphKeySize))
+	{
+		return false;
+	}
+
+	TMap<FString, int32> TrackByRawName;
+	for (int32 KeyIndex = 0; KeyIndex < Count; ++KeyIndex)
+	{
+		const FString RawName = PmxVmdReaderPrivate::MakeRawKey(&Data[Position], PmxVmdReaderPrivate::BoneNameSize);
+		int32* TrackIndex = TrackByRawName.Find(RawName);
+		if (!TrackIndex)
+		{
+			FPmxVmdMorphTrack& NewTrack = Motion.MorphTracks.AddDefaulted_GetRef();
+			if (!PMXVmdReader::DecodeShiftJis(&Data[Position], PmxVmdReaderPrivate::BoneNameSize, NewTrack.Name))
+			{
+				LogError(FString::Printf(TEXT("Cannot decode Shift-JIS morph name '%s'"), *NewTrack.Name));
+				return false;
+			}
+			TrackIndex = &TrackByRawName.Add(RawName, Motion.MorphTracks.Num() - 1);
+		}
+		Position += PmxVmdReaderPrivate::BoneNameSize;
+
+		FPmxVmdMorphKey& Key = Motion.MorphTracks[*TrackIndex].Keys.AddDefaulted_GetRef();
+		if (!ReadValue(Key.Frame) || !ReadValue(Key.Weight))
+		{
+			return false;
+		}
+		Motion.MaxFrame = FMath::Max(Motion.MaxFrame, Key.Frame);
+	}
+	Motion.NumMorphKeys = Count;
+
+	for (FPmxVmdMorphTrack& Track : Motion.MorphTracks)
+	{
+		Algo::StableSortBy(Track.Keys, &FPmxVmdMorphKey::Frame);
+	}
+	return true;
+}
+
+bool FPmxVmdReader::ReadCameraKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	if (!ReadCount(Count, PmxVmdReaderPrivate::CameraKeySize))
+	{
+		return false;
+	}
+
+	Motion.CameraKeys.SetNum(Count);
+	for (FPmxVmdCameraKey& Key : Motion.CameraKeys)
+	{
+		uint8 Perspective = 0;
+		if (!ReadValue(Key.Frame) || !ReadValue(Key.Distance) || !ReadVector3f(Key.Position) || !ReadVector3f(Key.Rotation)
+			|| !ReadBytes(Key.Interpolation, 24) || !ReadValue(Key.FieldOfView) || !ReadValue(Perspective))
+		{
+			return false;
+		}
+		// 0 = perspective on
+		Key.bOrthographic = Perspective != 0;
+	}
+	Algo::StableSortBy(Motion.CameraKeys, &FPmxVmdCameraKey::Frame);
+	return true;
+}
+
+bool FPmxVmdReader::ReadLightKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	if (!ReadCount(Count, PmxVmdReaderPrivate::LightKeySize))
+	{
+		return false;
+	}
+
+	Motion.LightKeys.SetNum(Count);
+	for (FPmxVmdLightKey& Key : Motion.LightKeys)
+	{
+		if (!ReadValue(Key.Frame) || !ReadValue(Key.Color.R) || !ReadValue(Key.Color.G) || !ReadValue(Key.Color.B)
+			|| !ReadVector3f(Key.Direction))
+		{
+			return false;
+		}
+		Key.Color.A = 1.0f;
+	}
+	Algo::StableSortBy(Motion.LightKeys, &FPmxVmdLightKey::Frame);
+	return true;
+}
+
+bool FPmxVmdReader::ReadSelfShadowKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	if (!ReadCount(Count, PmxVmdReaderPrivate::SelfShadowKeySize))
+	{
+		return false;
+	}
+
+	Motion.SelfShadowKeys.SetNum(Count);
+	for (FPmxVmdSelfShadowKey& Key : Motion.SelfShadowKeys)
+	{
+		if (!ReadValue(Key.Frame) || !ReadValue(Key.Mode) || !ReadValue(Key.Distance))
+		{
+			return false;
+		}
+	}
+	Algo::StableSortBy(Motion.SelfShadowKeys, &FPmxVmdSelfShadowKey::Frame);
+	return true;
+}
+
+bool FPmxVmdReader::ReadPropertyKeys(FPmxVmdMotion& Motion)
+{
+	int32 Count = 0;
+	// Frame + visibility + IK count
+	if (!ReadCount(Count, 9))
+	{
+		return false;
+	}
+
+	Motion.PropertyKeys.SetNum(Count);
+	for (FPmxVmdPropertyKey& Key : Motion.PropertyKeys)
+	{
+		uint8 Visible = 1;
+		int32 NumIK = 0;
+		if (!ReadValue(Key.Frame) || !ReadValue(Visible) || !ReadCount(NumIK, PmxVmdReaderPrivate::IKNameSize + 1))
+		{
+			return false;
+		}
+		Key.bVisible = Visible != 0;
+
+		Key.IKStates.SetNum(NumIK);
+		for (FPmxVmdIKState& State : Key.IKStates)
+		{
+			uint8 Enabled = 1;
+			if (!ReadName(State.Name, PmxVmdReaderPrivate::IKNameSize) || !ReadValue(Enabled))
+			{
+				return false;
+			}
+			State.bEnabled = Enabled != 0;
+		}
+		Motion.MaxFrame = FMath::Max(Motion.MaxFrame, Key.Frame);
+	}
+	Algo::StableSortBy(Motion.PropertyKeys, &FPmxVmdPropertyKey::Frame);
+	return true;
+}
+
+void FPmxVmdReader::LogError(const FString& Message) const
+{
+	UE_LOG(LogPmxVmdReader, Error, TEXT("%s (Position: 0x%08X)"), *Message, Position);
+}
+
+namespace PMXVmdReader
+{
+	bool LoadVmdFromFile(const FString& FilePath, FPmxVmdMotion& OutMotion)
+	{
+		TArray<uint8> FileData;
+		if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+		{
+			UE_LOG(LogPmxVmdReader, Error, TEXT("Failed to load VMD file: %s"), *FilePath);
+			return false;
+		}
+
+		FPmxVmdReader Reader(FileData);
+		return Reader.ReadMotion(OutMotion);
+	}
+
+	bool LoadVmdFromData(TArrayView<const uint8> Data, FPmxVmdMotion& OutMotion)
+	{
+		FPmxVmdReader Reader(Data);
+		return Reader.ReadMotion(OutMotion);
+	}
+
+	bool DecodeShiftJis(const uint8* Bytes, int32 MaxBytes, FString& OutName)
+	{
+		int32 Length = 0;
+		bool bAscii = true;
+		while (Length < MaxBytes && Bytes[Length] != 0)
+		{
+			bAscii &= Bytes[Length] < 0x80;
+			++Length;
+		}
+
+		if (Length == 0)
+		{
+			OutName.Reset();
+			return true;
+		}
+
+		if (!bAscii)
+		{
+#if PLATFORM_WINDOWS
+			constexpr uint32 ShiftJisCodePage = 932;
+			WIDECHAR Buffer[64];
+			const int32 NumChars = ::MultiByteToWideChar(ShiftJisCodePage, 0, reinterpret_cast<const char*>(Bytes), Length, Buffer, UE_ARRAY_COUNT(Buffer));
+			if (NumChars > 0)
+			{
+				OutName = FString::ConstructFromPtrSize(Buffer, NumChars);
+				return true;
+			}
+#elif PLATFORM_MAC
+			// Fixed-size fields may cut a double-byte character in half; retry without the trailing byte
+			for (int32 TryLength = Length; TryLength >= Length - 1 && TryLength > 0; --TryLength)
+			{
+				CFStringRef String = CFStringCreateWithBytes(kCFAllocatorDefault, Bytes, TryLength, kCFStringEncodingShiftJIS, false);
+				if (String)
+				{
+					const CFIndex NumChars = CFStringGetLength(String);
+					TArray<UniChar> Buffer;
+					Buffer.SetNumUninitialized(NumChars);
+					CFStringGetCharacters(String, CFRangeMake(0, NumChars), Buffer.GetData());
+					CFRelease(String);
+
+					OutName.Reset(NumChars);
+					for (const UniChar Char : Buffer)
+					{
+						OutName.AppendChar(static_cast<TCHAR>(Char));
+					}
+					return true;
+				}
+			}
+#elif UE_ENABLE_ICU
+			UErrorCode Status = U_ZERO_ERROR;
+			UConverter* Converter = ucnv_open("Shift_JIS", &Status);
+			if (U_SUCCESS(Status))
+			{
+				// Stop on invalid input rather than substituting, so a cut trailing character is retried without its byte
+				ucnv_setToUCallBack(Converter, UCNV_TO_U_CALLBACK_STOP, nullptr, nullptr, nullptr, &Status);
+				UChar Buffer[64];
+				for (int32 TryLength = Length; U_SUCCESS(Status) && TryLength >= Length - 1 && TryLength > 0; --TryLength)
+				{
+					UErrorCode ConvertStatus = U_ZERO_ERROR;
+					ucnv_reset(Converter);
+					const int32 NumChars = ucnv_toUChars(Converter, Buffer, UE_ARRAY_COUNT(Buffer), reinterpret_cast<const char*>(Bytes), TryLength, &ConvertStatus);
+					if (U_SUCCESS(ConvertStatus) && NumChars > 0)
+					{
+						ucnv_close(Converter);
+						OutName.Reset(NumChars);
+						for (int32 Index = 0; Index < NumChars; ++Index)
+						{
+							OutName.AppendChar(static_cast<TCHAR>(Buffer[Index]));
+						}
+						return true;
+					}
+				}
+				ucnv_close(Converter);
+			}
+#endif
+		}
+
+		// ASCII names need no decoder; otherwise keep a '?' placeholder for the error message
+		OutName.Reset(Length);
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			OutName.AppendChar(Bytes[Index] < 0x80 ? static_cast<TCHAR>(Bytes[Index]) : TCHAR('?'));
+		}
+		return bAscii;
+	}
+}
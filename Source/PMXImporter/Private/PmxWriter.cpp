@@ -0,0 +1,521 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxWriter.h"
+#include "PmxStructs.h"
+#include "LogPMXImporter.h"
+#include "Misc/FileHelper.h"
+
+namespace PmxWriterPrivate
+{
+	/** Little-endian PMX writer (the mirror of FPmxReader) */
+	class FPmxWriter
+	{
+	public:
+		FPmxWriter(const FPmxHeader& InHeader, TArray<uint8>& InOut)
+			: Header(InHeader)
+			, Out(InOut)
+			, bUTF8(InHeader.EncodeType == 1)
+		{
+		}
+
+		bool WriteModel(const FPmxModel& Model);
+
+	private:
+		template<typename T>
+		void WriteValue(const T& Value)
+		{
+			static_assert(std::is_arithmetic_v<T>, "PMX values are plain numbers");
+			const int32 Offset = Out.AddUninitialized(sizeof(T));
+			FMemory::Memcpy(&Out[Offset], &Value, sizeof(T));
+		}
+
+		void WriteVector3f(const FVector3f& Value) { WriteValue(Value.X); WriteValue(Value.Y); WriteValue(Value.Z); }
+		void WriteVector2f(const FVector2f& Value) { WriteValue(Value.X); WriteValue(Value.Y); }
+		void WriteVector4f(const FVector4f& Value) { WriteValue(Value.X); WriteValue(Value.Y); WriteValue(Value.Z); WriteValue(Value.W); }
+		void WriteColor3(const FLinearColor& Value) { WriteValue(Value.R); WriteValue(Value.G); WriteValue(Value.B); }
+		void WriteLinearColor(const FLinearColor& Value) { WriteColor3(Value); WriteValue(Value.A); }
+
+		void WriteString(const FString& Value);
+		bool WriteIndex(int32 Index, uint8 IndexSize, const TCHAR* What);
+
+		bool WriteVertices(const FPmxModel& Model);
+		bool WriteMaterials(const FPmxModel& Model);
+		bool WriteBones(const FPmxModel& Model);
+		bool WriteMorphs(const FPmxModel& Model);
+		bool WriteDisplayFrames(const FPmxModel& Model);
+		bool WriteRigidBodies(const FPmxModel& Model);
+		bool WriteJoints(const FPmxModel& Model);
+
+		const FPmxHeader& Header;
+		TArray<uint8>& Out;
+		bool bUTF8;
+	};
+
+	void FPmxWriter::WriteString(const FString& Value)
+	{
+		if (bUTF8)
+		{
+			const FTCHARToUTF8 Converter(*Value, Value.Len());
+			WriteValue<int32>(Converter.Length());
+			Out.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+		}
+		else
+		{
+			const FTCHARToUTF16 Converter(*Value, Value.Len());
+			const int32 NumBytes = Converter.Length() * sizeof(UTF16CHAR);
+			WriteValue<int32>(NumBytes);
+			Out.Append(reinterpret_cast<const uint8*>(Converter.Get()), NumBytes);
+		}
+	}
+
+	bool FPmxWriter::WriteIndex(int32 Index, uint8 IndexSize, const TCHAR* What)
+	{
+		// -1 (none) is stored as all bits set at every width
+		switch (IndexSize)
+		{
+		case 1:
+			if (Index < -1 || Index >= 0xFF)
+			{
+				break;
+			}
+			WriteValue<uint8>(Index < 0 ? 0xFF : static_cast<uint8>(Index));
+			return true;
+		case 2:
+			if (Index < -1 || Index >= 0xFFFF)
+			{
+				break;
+			}
+			WriteValue<uint16>(Index < 0 ? 0xFFFF : static_cast<uint16>(Index));
+			return true;
+		case 4:
+			WriteValue<int32>(Index);
+			return true;
+		default:
+			UE_LOG(LogPMXImporter, Error, TEXT("PMXWriter: Invalid %s index size %d"), What, IndexSize);
+			return false;
+		}
+
+		UE_LOG(LogPMXImporter, Error, TEXT("PMXWriter: %s index %d does not fit in %d bytes"), What, Index, IndexSize);
+		return false;
+	}
+
+	bool FPmxWriter::WriteModel(const FPmxModel& Model)
+	{
+		Out.Append(reinterpret_cast<const uint8*>("PMX "), 4);
+		WriteValue(Header.Version);
+		WriteValue<uint8>(8);
+		WriteValue(Header.EncodeType);
+		WriteValue(Header.AdditionalUVNum);
+		WriteValue(Header.VertexIndexSize);
+		WriteValue(Header.TextureIndexSize);
+		WriteValue(Header.MaterialIndexSize);
+		WriteValue(Header.BoneIndexSize);
+		WriteValue(Header.MorphIndexSize);
+		WriteValue(Header.RigidbodyIndexSize);
+		WriteString(Header.ModelName);
+		WriteString(Header.ModelNameEng);
+		WriteString(Header.Comment);
+		WriteString(Header.CommentEng);
+
+		if (!WriteVertices(Model))
+		{
+			return false;
+		}
+
+		WriteValue<int32>(Model.Indices.Num());
+		for (const int32 Index : Model.Indices)
+		{
+			if (!WriteIndex(Index, Header.VertexIndexSize, TEXT("Vertex")))
+			{
+				return false;
+			}
+		}
+
+		WriteValue<int32>(Model.Textures.Num());
+		for (const FPmxTexture& Texture : Model.Textures)
+		{
+			WriteString(Texture.TexturePath);
+		}
+
+		if (!WriteMaterials(Model) || !WriteBones(Model) || !WriteMorphs(Model) || !WriteDisplayFrames(Model)
+			|| !WriteRigidBodies(Model) || !WriteJoints(Model))
+		{
+			return false;
+		}
+
+		if (Model.SoftBodies.Num() > 0)
+		{
+			UE_LOG(LogPMXImporter, Warning, TEXT("PMXWriter: %d soft bodies are not written"), Model.SoftBodies.Num());
+		}
+		if (Header.Version > 2.0f)
+		{
+			WriteValue<int32>(0);
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteVertices(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.Vertices.Num());
+		for (const FPmxVertex& Vertex : Model.Vertices)
+		{
+			WriteVector3f(Vertex.Position);
+			WriteVector3f(Vertex.Normal);
+			WriteVector2f(Vertex.UV);
+			for (int32 UVIndex = 0; UVIndex < Header.AdditionalUVNum; ++UVIndex)
+			{
+				WriteVector4f(Vertex.AdditionalUV.IsValidIndex(UVIndex) ? Vertex.AdditionalUV[UVIndex] : FVector4f::Zero());
+			}
+
+			// BDEF1 / BDEF2 / BDEF4 / SDEF / QDEF influence counts
+			static constexpr int32 NumInfluences[] = { 1, 2, 4, 2, 4 };
+			if (Vertex.WeightType >= UE_ARRAY_COUNT(NumInfluences))
+			{
+				UE_LOG(LogPMXImporter, Error, TEXT("PMXWriter: Unsupported weight type %d"), Vertex.WeightType);
+				return false;
+			}
+			const int32 Count = NumInfluences[Vertex.WeightType];
+
+			WriteValue(Vertex.WeightType);
+			for (int32 Influence = 0; Influence < Count; ++Influence)
+			{
+				if (!WriteIndex(Vertex.BoneIndices.IsValidIndex(Influence) ? Vertex.BoneIndices[Influence] : -1, Header.BoneIndexSize, TEXT("Bone")))
+				{
+					return false;
+				}
+			}
+			if (Count == 4)
+			{
+				for (int32 Influence = 0; Influence < 4; ++Influence)
+				{
+					WriteValue(Vertex.BoneWeights.IsValidIndex(Influence) ? Vertex.BoneWeights[Influence] : 0.0f);
+				}
+			}
+			else if (Count == 2)
+			{
+				WriteValue(Vertex.BoneWeights.IsValidIndex(0) ? Vertex.BoneWeights[0] : 1.0f);
+			}
+			if (Vertex.WeightType == 3)
+			{
+				WriteVector3f(Vertex.C);
+				WriteVector3f(Vertex.R0);
+				WriteVector3f(Vertex.R1);
+			}
+
+			WriteValue(Vertex.EdgeScale);
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteMaterials(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.Materials.Num());
+		for (const FPmxMaterial& Material : Model.Materials)
+		{
+			WriteString(Material.Name);
+			WriteString(Material.NameEng);
+			WriteLinearColor(Material.Diffuse);
+			WriteVector3f(Material.Specular);
+			WriteValue(Material.SpecularStrength);
+			WriteVector3f(Material.Ambient);
+			WriteValue(Material.DrawingFlags);
+			WriteLinearColor(Material.EdgeColor);
+			WriteValue(Material.EdgeSize);
+			if (!WriteIndex(Material.TextureIndex, Header.TextureIndexSize, TEXT("Texture"))
+				|| !WriteIndex(Material.SphereTextureIndex, Header.TextureIndexSize, TEXT("Texture")))
+			{
+				return false;
+			}
+			WriteValue(Material.SphereMode);
+			WriteValue(Material.SharedToonFlag);
+			if (Material.SharedToonFlag)
+			{
+				WriteValue<uint8>(static_cast<uint8>(FMath::Clamp(Material.ToonTextureIndex, 0, 255)));
+			}
+			else if (!WriteIndex(Material.ToonTextureIndex, Header.TextureIndexSize, TEXT("Texture")))
+			{
+				return false;
+			}
+			WriteString(Material.Memo);
+			WriteValue(Material.SurfaceCount);
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteBones(const FPmxModel& Model)
+	{
+		const uint8 Size = Header.BoneIndexSize;
+		WriteValue<int32>(Model.Bones.Num());
+		for (const FPmxBone& Bone : Model.Bones)
+		{
+			WriteString(Bone.Name);
+			WriteString(Bone.NameEng);
+			WriteVector3f(Bone.Position);
+			if (!WriteIndex(Bone.ParentBoneIndex, Size, TEXT("Bone")))
+			{
+				return false;
+			}
+			WriteValue(Bone.Layer);
+			WriteValue(Bone.BoneFlags);
+
+			if (Bone.BoneFlags & 0x0001)
+			{
+				if (!WriteIndex(Bone.ConnectionIndex, Size, TEXT("Bone")))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				WriteVector3f(Bone.Offset);
+			}
+			if (Bone.BoneFlags & (0x0100 | 0x0200))
+			{
+				if (!WriteIndex(Bone.AdditionalParentIndex, Size, TEXT("Bone")))
+				{
+					return false;
+				}
+				WriteValue(Bone.AdditionalRatio);
+			}
+			if (Bone.BoneFlags & 0x0400)
+			{
+				WriteVector3f(Bone.AxisDirection);
+			}
+			if (Bone.BoneFlags & 0x0800)
+			{
+				WriteVector3f(Bone.XAxisDirection);
+				WriteVector3f(Bone.ZAxisDirection);
+			}
+			if (Bone.BoneFlags & 0x2000)
+			{
+				WriteValue(Bone.ExternalKey);
+			}
+			if (Bone.BoneFlags & 0x0020)
+			{
+				if (!WriteIndex(Bone.IKTargetBoneIndex, Size, TEXT("Bone")))
+				{
+					return false;
+				}
+				WriteValue(Bone.IKLoopCount);
+				WriteValue(Bone.IKLimitAngle);
+				WriteValue<int32>(Bone.IKLinks.Num());
+				for (const FPmxBone::FPmxIKLink& Link : Bone.IKLinks)
+				{
+					if (!WriteIndex(Link.BoneIndex, Size, TEXT("Bone")))
+					{
+						return false;
+					}
+					WriteValue(Link.AngleLimitFlag);
+					if (Link.AngleLimitFlag)
+					{
+						WriteVector3f(Link.LimitMin);
+						WriteVector3f(Link.LimitMax);
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteMorphs(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.Morphs.Num());
+		for (const FPmxMorph& Morph : Model.Morphs)
+		{
+			WriteString(Morph.Name);
+			WriteString(Morph.NameEng);
+			WriteValue(Morph.ControlPanel);
+			WriteValue(Morph.MorphType);
+
+			switch (Morph.MorphType)
+			{
+			case 0:
+				WriteValue<int32>(Morph.GroupMorphs.Num());
+				for (const FPmxGroupMorph& Offset : Morph.GroupMorphs)
+				{
+					if (!WriteIndex(Offset.MorphIndex, Header.MorphIndexSize, TEXT("Morph")))
+					{
+						return false;
+					}
+					WriteValue(Offset.MorphRatio);
+				}
+				break;
+			case 1:
+				WriteValue<int32>(Morph.VertexMorphs.Num());
+				for (const FPmxVertexMorph& Offset : Morph.VertexMorphs)
+				{
+					if (!WriteIndex(Offset.VertexIndex, Header.VertexIndexSize, TEXT("Vertex")))
+					{
+						return false;
+					}
+					WriteVector3f(Offset.Offset);
+				}
+				break;
+			case 2:
+				WriteValue<int32>(Morph.BoneMorphs.Num());
+				for (const FPmxBoneMorph& Offset : Morph.BoneMorphs)
+				{
+					if (!WriteIndex(Offset.BoneIndex, Header.BoneIndexSize, TEXT("Bone")))
+					{
+						return false;
+					}
+					WriteVector3f(Offset.Translation);
+					WriteValue(Offset.Rotation.X);
+					WriteValue(Offset.Rotation.Y);
+					WriteValue(Offset.Rotation.Z);
+					WriteValue(Offset.Rotation.W);
+				}
+				break;
+			case 3: case 4: case 5: case 6: case 7:
+				WriteValue<int32>(Morph.UVMorphs.Num());
+				for (const FPmxUVMorph& Offset : Morph.UVMorphs)
+				{
+					if (!WriteIndex(Offset.VertexIndex, Header.VertexIndexSize, TEXT("Vertex")))
+					{
+						return false;
+					}
+					WriteVector4f(Offset.Offset);
+				}
+				break;
+			case 8:
+				WriteValue<int32>(Morph.MaterialMorphs.Num());
+				for (const FPmxMaterialMorph& Offset : Morph.MaterialMorphs)
+				{
+					if (!WriteIndex(Offset.MaterialIndex, Header.MaterialIndexSize, TEXT("Material")))
+					{
+						return false;
+					}
+					WriteValue(Offset.OffsetType);
+					WriteLinearColor(Offset.Diffuse);
+					WriteColor3(Offset.Specular);
+					WriteValue(Offset.SpecularStrength);
+					WriteColor3(Offset.Ambient);
+					WriteLinearColor(Offset.EdgeColor);
+					WriteValue(Offset.EdgeSize);
+					WriteVector4f(Offset.TextureColor);
+					WriteVector4f(Offset.SphereTextureColor);
+					WriteVector4f(Offset.ToonTextureColor);
+				}
+				break;
+			default:
+				UE_LOG(LogPMXImporter, Error, TEXT("PMXWriter: Unsupported morph type %d"), Morph.MorphType);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteDisplayFrames(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.DisplayFrames.Num());
+		for (const FPmxDisplayFrame& Frame : Model.DisplayFrames)
+		{
+			WriteString(Frame.Name);
+			WriteString(Frame.NameEng);
+			WriteValue(Frame.SpecialFlag);
+			WriteValue<int32>(Frame.Elements.Num());
+			for (const FPmxDisplayFrame::FPmxDisplayElement& Element : Frame.Elements)
+			{
+				WriteValue(Element.ElementTarget);
+				const bool bBone = Element.ElementTarget == 0;
+				if (!WriteIndex(Element.ElementIndex, bBone ? Header.BoneIndexSize : Header.MorphIndexSize, bBone ? TEXT("Bone") : TEXT("Morph")))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteRigidBodies(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.RigidBodies.Num());
+		for (const FPmxRigidBody& Body : Model.RigidBodies)
+		{
+			WriteString(Body.Name);
+			WriteString(Body.NameEng);
+			if (!WriteIndex(Body.RelatedBoneIndex, Header.BoneIndexSize, TEXT("Bone")))
+			{
+				return false;
+			}
+			WriteValue(Body.Group);
+			WriteValue(Body.NonCollisionGroup);
+			WriteValue(Body.Shape);
+			WriteVector3f(Body.Size);
+			WriteVector3f(Body.Position);
+			WriteVector3f(Body.Rotation);
+			WriteValue(Body.Mass);
+			WriteValue(Body.MoveAttenuation);
+			WriteValue(Body.RotationAttenuation);
+			WriteValue(Body.Repulsion);
+			WriteValue(Body.Friction);
+			WriteValue(Body.PhysicsType);
+		}
+		return true;
+	}
+
+	bool FPmxWriter::WriteJoints(const FPmxModel& Model)
+	{
+		WriteValue<int32>(Model.Joints.Num());
+		for (const FPmxJoint& Joint : Model.Joints)
+		{
+			WriteString(Joint.Name);
+			WriteString(Joint.NameEng);
+			WriteValue(Joint.JointType);
+			if (!WriteIndex(Joint.RigidBodyIndexA, Header.RigidbodyIndexSize, TEXT("Rigid body"))
+				|| !WriteIndex(Joint.RigidBodyIndexB, Header.RigidbodyIndexSize, TEXT("Rigid body")))
+			{
+				return false;
+			}
+			WriteVector3f(Joint.Position);
+			WriteVector3f(Joint.Rotation);
+			WriteVector3f(Joint.MoveRestrictionMin);
+			WriteVector3f(Joint.MoveRestrictionMax);
+			WriteVector3f(Joint.RotationRestrictionMin);
+			WriteVector3f(Joint.RotationRestrictionMax);
+			WriteVector3f(Joint.SpringMoveCoefficient);
+			WriteVector3f(Joint.SpringRotationCoefficient);
+		}
+		return true;
+	}
+}
+
+namespace PMXWriter
+{
+	bool SavePmxToData(const FPmxModel& Model, TArray<uint8>& OutData)
+	{
+		OutData.Reset();
+		PmxWriterPrivate::FPmxWriter Writer(Model.Header, OutData);
+		if (!Writer.WriteModel(Model))
+		{
+			OutData.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	bool SavePmxToFile(const FPmxModel& Model, const FString& FilePath)
+	{
+		TArray<uint8> Data;
+		if (!SavePmxToData(Model, Data))
+		{
+			return false;
+		}
+		if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+		{
+			UE_LOG(LogPMXImporter, Error, TEXT("PMXWriter: Failed to write %s"), *FilePath);
+			return false;
+		}
+		return true;
+	}
+
+	uint8 GetRequiredIndexSize(int32 Count)
+	{
+		// The reader treats an all-bits-set index as "none" at every width (vertex indices included)
+		if (Count < 0xFF)
+		{
+			return 1;
+		}
+		return Count < 0xFFFF ? 2 : 4;
+	}
+}
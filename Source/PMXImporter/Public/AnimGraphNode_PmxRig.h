@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_Base.h"
+#include "AnimNode_PmxRig.h"
+#include "AnimGraphNode_PmxRig.generated.h"
+
+/**
+ * Anim graph node for FAnimNode_PmxRig (PMX append links and CCD IK)
+ */
+UCLASS()
+class PMXIMPORTER_API UAnimGraphNode_PmxRig : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = Settings)
+	FAnimNode_PmxRig Node;
+
+public:
+	//~ Begin UEdGraphNode interface
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FLinearColor GetNodeTitleColor() const override;
+	//~ End UEdGraphNode interface
+
+	//~ Begin UAnimGraphNode_Base interface
+	virtual FString GetNodeCategory() const override;
+	virtual void ValidateAnimNodeDuringCompilation(USkeleton* ForSkeleton, FCompilerResultsLog& MessageLog) override;
+	//~ End UAnimGraphNode_Base interface
+};
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Little-endian binary reader shared by the PMX and VMD readers
+ * All reads are bounds checked and return false past the end of the data.
+ */
+class PMXIMPORTER_API FPmxBinaryReader
+{
+public:
+	explicit FPmxBinaryReader(TArrayView<const uint8> InData)
+		: Data(InData)
+		, Position(0)
+	{
+	}
+
+	virtual ~FPmxBinaryReader() = default;
+
+	int32 Tell() const { return Position; }
+	int32 GetRemaining() const { return Data.Num() - Position; }
+	bool IsAtEnd() const { return Position >= Data.Num(); }
+
+	template<typename T>
+	bool ReadValue(T& OutValue);
+
+	bool ReadBytes(void* OutBytes, int32 NumBytes);
+	bool Skip(int32 NumBytes);
+
+	bool ReadVector3f(FVector3f& OutVector);
+	bool ReadVector2f(FVector2f& OutVector);
+	bool ReadLinearColor(FLinearColor& OutColor);
+	bool ReadQuatf(FQuat4f& OutQuat);
+
+protected:
+	bool IsValidPosition(int32 Size) const;
+	virtual void LogError(const FString& Message) const;
+
+	TArrayView<const uint8> Data;
+	int32 Position;
+};
+
+template<typename T>
+bool FPmxBinaryReader::ReadValue(T& OutValue)
+{
+	if (!IsValidPosition(sizeof(T)))
+	{
+		return false;
+	}
+	
+	FMemory::Memcpy(&OutValue, &Data[Position], sizeof(T));
+	
+	// PMX/VMD formats use little-endian, convert if needed
+	if constexpr (sizeof(T) == 2)
+	{
+		OutValue = INTEL_ORDER16(OutValue);
+	}
+	else if constexpr (sizeof(T) == 4)
+	{
+		if constexpr (std::is_same_v<T, int32> || std::is_same_v<T, uint32> || std::is_same_v<T, float>)
+		{
+			OutValue = INTEL_ORDER32(OutValue);
+		}
+	}
+	
+	Position += sizeof(T);
+	return true;
+}
@@ -0,0 +1,372 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * .pmxc layout (little-endian, version FPmxCompactModel::FormatVersion)
+ *   FPmxcFileHeader
+ *   FPmxcSectionEntry[NumSections]
+ *   Sections, each starting on a SectionAlignment boundary: fixed-stride arrays, one per FPmxModel field (SoA)
+ * Strings live in one UTF-16 blob and are referenced by index into the StringTable section.
+ * Per-element variable data (IK links, morph offsets, display elements) is stored in its own array and referenced by FPmxcRange.
+ * Element structs only use 4-byte fields so their layout is identical on every supported compiler.
+ */
+enum class EPmxcSection : uint32
+{
+	ModelInfo,
+	StringTable,
+	StringData,
+	VertexPositions,
+	VertexNormals,
+	VertexUVs,
+	VertexAdditionalUVs,
+	VertexSkin,
+	VertexBoneIndices,
+	VertexBoneWeights,
+	VertexSdef,
+	VertexEdgeScales,
+	Indices,
+	Textures,
+	Materials,
+	Bones,
+	IKLinks,
+	Morphs,
+	VertexMorphOffsets,
+	UVMorphOffsets,
+	BoneMorphOffsets,
+	MaterialMorphOffsets,
+	GroupMorphOffsets,
+	DisplayFrames,
+	DisplayElements,
+	RigidBodies,
+	Joints,
+
+	Count
+};
+
+struct FPmxcFileHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 HeaderSize = 0;
+	uint32 NumSections = 0;
+	uint64 SectionTableOffset = 0;
+	uint64 FileSize = 0;
+
+	/** Source PMX the file was built from (size and xxHash128) */
+	uint64 SourceSize = 0;
+	uint64 SourceHashHigh = 0;
+	uint64 SourceHashLow = 0;
+	uint64 Reserved = 0;
+};
+
+struct FPmxcSectionEntry
+{
+	uint32 Id = 0;
+	uint32 ElementSize = 0;
+	uint64 Offset = 0;
+	uint64 Count = 0;
+};
+
+/** Slice of a child array (IK links of a bone, offsets of a morph, ...) */
+struct FPmxcRange
+{
+	uint32 First = 0;
+	uint32 Num = 0;
+};
+
+/** Offset and length (in UTF-16 code units) of one string in StringData */
+struct FPmxcString
+{
+	uint32 Offset = 0;
+	uint32 Length = 0;
+};
+
+/** Header fields; string fields are StringTable indices */
+struct FPmxcModelInfo
+{
+	float Version;
+	uint32 EncodeType;
+	uint32 AdditionalUVNum;
+	uint32 VertexIndexSize;
+	uint32 TextureIndexSize;
+	uint32 MaterialIndexSize;
+	uint32 BoneIndexSize;
+	uint32 MorphIndexSize;
+	uint32 RigidbodyIndexSize;
+	uint32 ModelName;
+	uint32 ModelNameEng;
+	uint32 Comment;
+	uint32 CommentEng;
+};
+
+/** Weight type in the low byte, number of used bone slots (0-4) in the next */
+using FPmxcVertexSkin = uint32;
+
+struct FPmxcVertexSdef
+{
+	FVector3f C;
+	FVector3f R0;
+	FVector3f R1;
+};
+
+struct FPmxcMaterial
+{
+	uint32 Name;
+	uint32 NameEng;
+	uint32 Memo;
+	float Diffuse[4];
+	FVector3f Specular;
+	float SpecularStrength;
+	FVector3f Ambient;
+	uint32 DrawingFlags;
+	float EdgeColor[4];
+	float EdgeSize;
+	int32 TextureIndex;
+	int32 SphereTextureIndex;
+	uint32 SphereMode;
+	uint32 SharedToonFlag;
+	int32 ToonTextureIndex;
+	int32 SurfaceCount;
+};
+
+struct FPmxcBone
+{
+	uint32 Name;
+	uint32 NameEng;
+	FVector3f Position;
+	int32 ParentBoneIndex;
+	int32 Layer;
+	uint32 BoneFlags;
+	int32 ConnectionIndex;
+	FVector3f Offset;
+	int32 AdditionalParentIndex;
+	float AdditionalRatio;
+	FVector3f AxisDirection;
+	FVector3f XAxisDirection;
+	FVector3f ZAxisDirection;
+	int32 ExternalKey;
+	int32 IKTargetBoneIndex;
+	int32 IKLoopCount;
+	float IKLimitAngle;
+	FPmxcRange IKLinks;
+};
+
+struct FPmxcIKLink
+{
+	int32 BoneIndex;
+	uint32 AngleLimitFlag;
+	FVector3f LimitMin;
+	FVector3f LimitMax;
+};
+
+struct FPmxcMorph
+{
+	uint32 Name;
+	uint32 NameEng;
+	uint32 ControlPanel;
+	uint32 MorphType;
+	FPmxcRange VertexOffsets;
+	FPmxcRange UVOffsets;
+	FPmxcRange BoneOffsets;
+	FPmxcRange MaterialOffsets;
+	FPmxcRange GroupOffsets;
+};
+
+struct FPmxcVertexMorph
+{
+	int32 VertexIndex;
+	FVector3f Offset;
+};
+
+struct FPmxcUVMorph
+{
+	int32 VertexIndex;
+	float Offset[4];
+};
+
+struct FPmxcBoneMorph
+{
+	int32 BoneIndex;
+	FVector3f Translation;
+	float Rotation[4];
+};
+
+struct FPmxcMaterialMorph
+{
+	int32 MaterialIndex;
+	uint32 OffsetType;
+	float Diffuse[4];
+	float Specular[4];
+	float SpecularStrength;
+	float Ambient[4];
+	float EdgeColor[4];
+	float EdgeSize;
+	float TextureColor[4];
+	float SphereTextureColor[4];
+	float ToonTextureColor[4];
+};
+
+struct FPmxcGroupMorph
+{
+	int32 MorphIndex;
+	float MorphRatio;
+};
+
+struct FPmxcDisplayFrame
+{
+	uint32 Name;
+	uint32 NameEng;
+	uint32 SpecialFlag;
+	FPmxcRange Elements;
+};
+
+struct FPmxcDisplayElement
+{
+	uint32 ElementTarget;
+	int32 ElementIndex;
+};
+
+struct FPmxcRigidBody
+{
+	uint32 Name;
+	uint32 NameEng;
+	int32 RelatedBoneIndex;
+	uint32 Group;
+	uint32 NonCollisionGroup;
+	uint32 Shape;
+	FVector3f Size;
+	FVector3f Position;
+	FVector3f Rotation;
+	float Mass;
+	float MoveAttenuation;
+	float RotationAttenuation;
+	float Repulsion;
+	float Friction;
+	uint32 PhysicsType;
+};
+
+struct FPmxcJoint
+{
+	uint32 Name;
+	uint32 NameEng;
+	uint32 JointType;
+	int32 RigidBodyIndexA;
+	int32 RigidBodyIndexB;
+	FVector3f Position;
+	FVector3f Rotation;
+	FVector3f MoveRestrictionMin;
+	FVector3f MoveRestrictionMax;
+	FVector3f RotationRestrictionMin;
+	FVector3f RotationRestrictionMax;
+	FVector3f SpringMoveCoefficient;
+	FVector3f SpringRotationCoefficient;
+};
+
+/**
+ * Read-only view of .pmxc data (a mapped file or a buffer that outlives the view)
+ * Initialize() validates the header and the section table once; sections are then plain typed arrays.
+ */
+class PMXIMPORTER_API FPmxCompactModelView
+{
+public:
+	/** Bind Data; false if it is not a complete .pmxc of the current format version */
+	bool Initialize(TConstArrayView<uint8> InData);
+
+	const FPmxcFileHeader& GetHeader() const { return *reinterpret_cast<const FPmxcFileHeader*>(Data.GetData()); }
+
+	/** Elements of a section; empty if the section is absent or ElementType does not match its stride */
+	template <typename ElementType>
+	TConstArrayView<ElementType> GetSection(EPmxcSection Section) const
+	{
+		const FPmxcSectionEntry* Entry = Sections[static_cast<uint32>(Section)];
+		if (!Entry || Entry->ElementSize != sizeof(ElementType))
+		{
+			return TConstArrayView<ElementType>();
+		}
+		return TConstArrayView<ElementType>(reinterpret_cast<const ElementType*>(Data.GetData() + Entry->Offset), static_cast<int32>(Entry->Count));
+	}
+
+	/** String by StringTable index (empty if out of range) */
+	FString GetString(uint32 StringIndex) const;
+
+	/** Whether the view was built from this source PMX (size and content hash) */
+	bool MatchesSource(TConstArrayView<uint8> SourceData) const;
+
+	/**
+	 * Expand into an FPmxModel
+	 * @return False if a range or string reference points outside its section
+	 */
+	bool ToModel(FPmxModel& OutModel) const;
+
+private:
+	TConstArrayView<uint8> Data;
+	const FPmxcSectionEntry* Sections[static_cast<uint32>(EPmxcSection::Count)] = {};
+};
+
+/** An opened .pmxc file: memory-mapped where the platform supports it, read into memory otherwise */
+class PMXIMPORTER_API FPmxCompactModelFile
+{
+public:
+	~FPmxCompactModelFile();
+
+	/** Open and validate a .pmxc file; null if it is missing or invalid */
+	static TUniquePtr<FPmxCompactModelFile> Open(const FString& FilePath);
+
+	const FPmxCompactModelView& GetView() const { return View; }
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+private:
+	FPmxCompactModelFile() = default;
+
+	/** Declared before the region so the region is unmapped first */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> Buffer;
+	FPmxCompactModelView View;
+};
+
+/**
+ * PMX Compact Model - Pre-parsed PMX files (.pmxc) that load without sequential PMX parsing
+ * Written after the first parse of a source file, either to Saved/PmxCompactCache/<content hash>.pmxc
+ * or next to the source (PMXImporter.CompactCache). A .pmxc next to the source is always used when it
+ * matches the source content, so pipelines can pre-process uploads with the PmxInspect commandlet.
+ */
+class PMXIMPORTER_API FPmxCompactModel
+{
+public:
+	/** Bump when the layout or the content of FPmxModel changes */
+	static constexpr uint32 FormatVersion = 1;
+
+	static constexpr uint32 SectionAlignment = 16;
+
+	/** ".pmxc" */
+	static const TCHAR* FileExtension;
+
+	/** Whether imports read and write compact files (PMXImporter.CompactCache != 0) */
+	static bool IsEnabled();
+
+	/** Serialize a parsed model; SourceData identifies the PMX it came from */
+	static void Write(const FPmxModel& Model, TConstArrayView<uint8> SourceData, TArray<uint8>& OutData);
+
+	/** Write a .pmxc file; false if the file could not be written */
+	static bool SaveToFile(const FString& FilePath, const FPmxModel& Model, TConstArrayView<uint8> SourceData);
+
+	/**
+	 * Read a .pmxc file into a model
+	 * @param SourceData If not empty, the file must have been built from this source
+	 */
+	static bool LoadFromFile(const FString& FilePath, FPmxModel& OutModel, TConstArrayView<uint8> SourceData = TConstArrayView<uint8>());
+
+	/** Load the compact file of a source PMX (next to it or in the cache directory) */
+	static bool LoadForSource(const FString& SourceFile, TConstArrayView<uint8> SourceData, FPmxModel& OutModel);
+
+	/** Write the compact file of a freshly parsed source PMX where PMXImporter.CompactCache points */
+	static void StoreForSource(const FString& SourceFile, TConstArrayView<uint8> SourceData, const FPmxModel& Model);
+};
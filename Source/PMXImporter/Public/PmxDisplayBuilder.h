@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PmxDisplayData.h"
+
+struct FPmxModel;
+class USkeleton;
+
+/**
+ * PMX Display Builder - Converts PMX display frames into bone / morph groups
+ * Groups use final bone names and are stored as mesh user data; frames can also become skeleton blend profiles.
+ */
+class PMXIMPORTER_API FPmxDisplayBuilder
+{
+public:
+	/** Prefix of the skeleton blend profiles created from display frames */
+	static const TCHAR* BlendProfilePrefix;
+
+	/**
+	 * Build one group per display frame (parallel to PmxModel.DisplayFrames, empty frames included)
+	 * Out of range and repeated elements are skipped.
+	 *
+	 * @param BoneNames		Skeleton bone names (parallel to PmxModel.Bones)
+	 * @param MorphNames	Morph target names (parallel to PmxModel.Morphs)
+	 * @return False if no frame references any bone or morph
+	 */
+	static bool BuildDisplayDescription(
+		const FPmxModel& PmxModel,
+		const TArray<FString>& BoneNames,
+		const TArray<FString>& MorphNames,
+		FPmxDisplayDescription& OutDescription
+	);
+
+	/** Rebuild the bone lists after bones were renamed or pruned; morph lists are kept */
+	static void UpdateBoneGroups(const FPmxModel& PmxModel, const TArray<FString>& BoneNames, FPmxDisplayDescription& InOutDescription);
+
+	/**
+	 * Add one blend profile per frame with bones to the skeleton ("PMX_<Frame>", bone scale 1)
+	 * Bones are only added, so a shared skeleton keeps the bones of other models.
+	 * @return Number of profiles created or updated
+	 */
+	static int32 ApplyBlendProfiles(USkeleton& Skeleton, const FPmxDisplayDescription& Description);
+};
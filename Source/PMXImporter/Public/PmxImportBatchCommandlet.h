@@ -0,0 +1,29 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PmxImportBatchCommandlet.generated.h"
+
+/**
+ * Imports a directory of PMX models with up to N concurrent Interchange imports
+ * Every import runs on the Interchange async path with its own import session; the main thread only ticks and saves.
+ * -Soak imports every model twice (serially, then concurrently) and fails if any output differs.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=PmxImportBatch -Source=D:/Models -Dest=/Game/Models
+ *       [-Concurrency=N] [-Soak] [-Report=<Csv path>]
+ */
+UCLASS()
+class UPmxImportBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPmxImportBatchCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PmxImportBenchmarkCommandlet.generated.h"
+
+/**
+ * Import performance regression suite over a generated PMX corpus
+ * Generates synthetic models (10k-2M vertices, 0-1000 morphs, 0-1000 rigid bodies, every index width, UTF-8 and UTF-16),
+ * checks that they read back unchanged, then times the parse and the full Interchange import
+ * (translate, mesh payload, physics asset) with the model cache disabled.
+ * Results are compared to a baseline file; any case slower or larger than the tolerance fails the run.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=PmxImportBenchmark [-Dest=/Game/PmxBenchmark] [-Iterations=3] [-Quick]
+ *       [-Cases=<Name filter>] [-Baseline=<Json path>] [-UpdateBaseline] [-Tolerance=0.25] [-MemoryTolerance=0.25] [-Report=<Json path>]
+ */
+UCLASS()
+class UPmxImportBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPmxImportBenchmarkCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
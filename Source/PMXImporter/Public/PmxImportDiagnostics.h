@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LogPMXImporter.h"
+
+/** Per-element trace logs are compiled out of shipping and test builds */
+#ifndef PMX_IMPORT_TRACE_ENABLED
+#define PMX_IMPORT_TRACE_ENABLED !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+/** One warning kept by the diagnostics ring */
+struct FPmxImportWarning
+{
+	/** Log category the warning would have been written to */
+	FString Category;
+	FString Message;
+};
+
+/**
+ * PMX Import Diagnostics - Counters and warnings of one import, summarized once instead of logged per element
+ * Counters accumulate per category ("physics.bodies", "reader.strings", ...). Warnings are kept in a bounded
+ * ring (the most recent PMXImporter.MaxImportWarnings) while every warning is counted. The summary is one
+ * log line per import plus the retained warnings, and both are written into the JSON import report.
+ * Owned by the import profiler; code running inside an import scope reaches it through GetCurrent().
+ */
+class PMXIMPORTER_API FPmxImportDiagnostics
+{
+public:
+	FPmxImportDiagnostics();
+
+	/** Add Value to a counter */
+	void AddCount(FName Counter, int64 Value = 1);
+
+	/** Count a warning and keep it in the ring (dropping the oldest when full) */
+	void AddWarning(const TCHAR* Category, FString&& Message);
+
+	TMap<FName, int64> GetCounts() const;
+
+	/** Retained warnings, oldest first */
+	TArray<FPmxImportWarning> GetWarnings() const;
+
+	/** Number of warnings raised (retained or not) */
+	int64 GetNumWarnings() const;
+
+	/** Log one summary line and the retained warnings */
+	void LogSummary(const FString& SourceFile) const;
+
+	/** Diagnostics of the import profiler active on this thread, or null outside an import */
+	static FPmxImportDiagnostics* GetCurrent();
+
+	/** Whether per-element trace logs are written (PMXImporter.Trace; always false when compiled out) */
+	static bool IsTraceEnabled();
+
+private:
+	mutable FCriticalSection Lock;
+	TMap<FName, int64> Counts;
+	TArray<FPmxImportWarning> Warnings;
+	int32 MaxWarnings = 0;
+	int32 NextWarning = 0;
+	int64 NumWarnings = 0;
+};
+
+/** Add Value to a counter of the active import (no-op outside an import); Counter must be a string literal */
+#define PMX_DIAG_COUNT(Counter, Value) \
+	do \
+	{ \
+		if (FPmxImportDiagnostics* PmxDiagnostics_ = FPmxImportDiagnostics::GetCurrent()) \
+		{ \
+			PmxDiagnostics_->AddCount(FName(TEXT(Counter)), Value); \
+		} \
+	} while (0)
+
+/** Warning collected into the active import's summary; logged directly outside an import */
+#define PMX_DIAG_WARNING(CategoryName, Format, ...) \
+	do \
+	{ \
+		if (FPmxImportDiagnostics* PmxDiagnostics_ = FPmxImportDiagnostics::GetCurrent()) \
+		{ \
+			PmxDiagnostics_->AddWarning(TEXT(#CategoryName), FString::Printf(Format, ##__VA_ARGS__)); \
+		} \
+		else \
+		{ \
+			UE_LOG(CategoryName, Warning, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+/** Per-element log line, written only with PMXImporter.Trace enabled; arguments are not evaluated otherwise */
+#if PMX_IMPORT_TRACE_ENABLED
+#define PMX_TRACE(CategoryName, Format, ...) \
+	do \
+	{ \
+		if (FPmxImportDiagnostics::IsTraceEnabled()) \
+		{ \
+			UE_LOG(CategoryName, Log, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+#else
+#define PMX_TRACE(CategoryName, Format, ...) do { } while (0)
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PmxImportDiagnostics.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/** One timed import stage */
+struct FPmxImportStage
+{
+	FString Name;
+
+	/** Parent stage names joined with '/' (stages nest per thread) */
+	FString Path;
+	int32 Depth = 0;
+	uint32 ThreadId = 0;
+
+	/** Start relative to the profiler creation */
+	double StartSeconds = 0.0;
+	double Seconds = 0.0;
+
+	/**
+	 * Process used physical memory at the end minus at the start; not what the stage allocated, since other threads,
+	 * concurrent imports and garbage collection during the stage count too
+	 */
+	int64 ProcessMemoryDeltaBytes = 0;
+
+	/** Process peak used physical memory at the end of the stage */
+	uint64 PeakUsedPhysicalBytes = 0;
+};
+
+/**
+ * PMX Import Profiler - Hierarchical wall time and memory of one import, written as a JSON report
+ * Stages are recorded with PMX_IMPORT_SCOPE, which also emits a CPU profiler (Unreal Insights) event.
+ * A scope records into the profiler active on its thread: PMX_IMPORT_ROOT_SCOPE activates one for the
+ * duration of its scope, so nested helpers (reader, builders) need no profiler parameter and
+ * parallel sections (payload requests on worker threads) nest correctly.
+ * The profiler also owns the import's diagnostics, whose summary is logged once when the profiler is released.
+ */
+class PMXIMPORTER_API FPmxImportProfiler
+{
+public:
+	explicit FPmxImportProfiler(const FString& InSourceFile);
+	~FPmxImportProfiler();
+
+	/** RAII stage */
+	class PMXIMPORTER_API FScope
+	{
+	public:
+		/** Stage of the profiler active on this thread (no-op if none) */
+		explicit FScope(const TCHAR* InName);
+
+		/** Stage that activates Profiler on this thread until it ends */
+		FScope(const TCHAR* InName, const TSharedPtr<FPmxImportProfiler>& InProfiler);
+
+		~FScope();
+
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+		TSharedPtr<FPmxImportProfiler> OwnedProfiler;
+		FPmxImportProfiler* Profiler = nullptr;
+		FPmxImportProfiler* PreviousProfiler = nullptr;
+		FScope* ParentScope = nullptr;
+
+		const TCHAR* Name = nullptr;
+		FString Path;
+		int32 Depth = 0;
+		double StartTime = 0.0;
+		uint64 StartUsedPhysical = 0;
+	};
+
+	/** Element count for the report (vertices, bones, ...) */
+	void SetCount(const FString& CountName, int64 Value);
+
+	/** Free-form report field (model name, options, ...) */
+	void SetInfo(const FString& Key, const FString& Value);
+
+	TArray<FPmxImportStage> GetStages() const;
+
+	/** Write the JSON report; returns false if the file could not be written */
+	bool WriteReport(const FString& FilePath) const;
+
+	/** Saved/PmxImportReports/<Model>_<Time>.json (stable for the lifetime of the profiler) */
+	const FString& GetReportPath() const { return ReportPath; }
+
+	/** Counters and warnings of this import */
+	FPmxImportDiagnostics& GetDiagnostics() { return Diagnostics; }
+	const FPmxImportDiagnostics& GetDiagnostics() const { return Diagnostics; }
+
+	/** Whether imports write reports (PMXImporter.ImportReport) */
+	static bool IsReportEnabled();
+
+	/** Profiler active on this thread, or null outside an import */
+	static FPmxImportProfiler* GetCurrent();
+
+private:
+	void AddStage(FPmxImportStage&& Stage);
+
+	mutable FCriticalSection Lock;
+	FString SourceFile;
+	FString ReportPath;
+	FDateTime CreationDate;
+	double CreationTime = 0.0;
+	TArray<FPmxImportStage> Stages;
+	TMap<FString, int64> Counts;
+	TMap<FString, FString> Info;
+	FPmxImportDiagnostics Diagnostics;
+};
+
+/** Timed import stage recorded into the profiler active on this thread; Name must be a string literal */
+#define PMX_IMPORT_SCOPE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("PMX " Name); \
+	FPmxImportProfiler::FScope ANONYMOUS_VARIABLE(PmxImportScope_)(TEXT(Name))
+
+/** Timed import stage that activates Profiler (TSharedPtr<FPmxImportProfiler>) on this thread */
+#define PMX_IMPORT_ROOT_SCOPE(Name, Profiler) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("PMX " Name); \
+	FPmxImportProfiler::FScope ANONYMOUS_VARIABLE(PmxImportScope_)(TEXT(Name), Profiler)
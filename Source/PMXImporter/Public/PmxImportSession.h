@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+#include "UObject/SoftObjectPath.h"
+#include "PmxTranslator.h"
+#include "PmxMeshSimplifier.h"
+#include "PmxOutlineBuilder.h"
+#include "PmxNodeBuilder.h"
+
+struct FPmxModel;
+struct FPmxRigDescription;
+struct FPmxSdefDescription;
+struct FPmxDisplayDescription;
+struct FPmxImportManifest;
+class FPmxImportProfiler;
+
+/**
+ * Per-import state shared by one UPmxTranslator / UPmxPipeline pair
+ * Created by Translate(); the pipeline finds it through the session id stored on the source node.
+ * Fields are owned by import phase rather than locked: Translate() fills them, ExecutePipeline() finalizes them,
+ * payload requests only read them and post-import consumes them on the game thread.
+ */
+struct PMXIMPORTER_API FPmxImportSession
+{
+	FGuid Id;
+	FString SourceFilePath;
+
+	/** Options read from the source node by Translate() */
+	FPmxImportOptions Options;
+
+	/** Stage timings and element counts of this import (written as the import report) */
+	TSharedPtr<FPmxImportProfiler> Profiler;
+
+	/** Cleaned model the mesh payloads are built from (final bone names after ExecutePipeline) */
+	TSharedPtr<FPmxModel> Model;
+
+	/** Set by the pipeline once Model's bone names are the final joint labels (used as-is from then on) */
+	bool bBoneNamesResolved = false;
+
+	/** Sorted bone layout of Model, built on first use; reset when the bones change (bone pruning) */
+	TSharedPtr<FPmxSkeletonLayout> SkeletonLayout;
+
+	/** Cached layout of BoneModel's bones (the translator's model before it moves into Model, or Model itself) */
+	const FPmxSkeletonLayout& GetSkeletonLayout(const FPmxModel& BoneModel);
+
+	/** Translated bone index (joint node UIDs) -> Model bone index after bone pruning; empty while they are equal */
+	TArray<int32> PrunedBoneRemap;
+
+	/** Model bone index of a joint node, INDEX_NONE if the node is not a bone joint or its bone was pruned */
+	int32 GetJointBoneIndex(const FString& JointUid) const;
+
+	/** LODs generated after LOD0 by UPmxPipeline::GenerateMeshLods, indexing Model's vertices */
+	TArray<FPmxMeshLod> Lods;
+
+	/** Inverted hull outline added to LOD0 by UPmxPipeline::GenerateOutline, indexing Model's vertices */
+	FPmxOutlineMesh Outline;
+
+	/** Post-import data; each is consumed by the asset it belongs to */
+	TSharedPtr<FPmxPhysicsCache> Physics;
+	TSharedPtr<FPmxRigDescription> Rig;
+	TSharedPtr<FPmxSdefDescription> Sdef;
+	TSharedPtr<FPmxDisplayDescription> Display;
+
+	/** Section hashes of this import; the pipeline adds the options hash */
+	TSharedPtr<FPmxImportManifest> Manifest;
+
+	/** Factory node UID -> manifest sections the node was built from (for updating the manifest after post-import) */
+	TMap<FString, TArray<FString>> ManifestNodeSections;
+
+	/** Skeleton fingerprint of the model and the shared skeleton it was matched to (if any) */
+	FString SkeletonFingerprint;
+	FSoftObjectPath SharedSkeletonPath;
+};
+
+/**
+ * Thread-safe registry of live import sessions
+ * Holds weak references only: a session lives as long as its translator or pipeline keeps it.
+ */
+class PMXIMPORTER_API FPmxImportSessionRegistry
+{
+public:
+	/** Source node attribute holding the session id */
+	static const TCHAR* SessionIdAttributeKey;
+
+	/** Create and register a session for one source file */
+	static TSharedRef<FPmxImportSession> CreateSession(const FString& SourceFilePath);
+
+	/** Live session by id, or null */
+	static TSharedPtr<FPmxImportSession> FindSession(const FGuid& SessionId);
+
+	/** Unregister a session (it stays valid for the objects still holding it) */
+	static void ReleaseSession(const FGuid& SessionId);
+
+	/** Number of live sessions */
+	static int32 GetNumSessions();
+
+	/** Drop every registration (module shutdown) */
+	static void Reset();
+
+private:
+	static FCriticalSection SessionsLock;
+	static TMap<FGuid, TWeakPtr<FPmxImportSession, ESPMode::ThreadSafe>> Sessions;
+};
@@ -0,0 +1,31 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PmxInspectCommandlet.generated.h"
+
+/**
+ * Headless PMX inspection, validation and conversion for triage and CI
+ * Parses PMX files on a bounded worker pool without creating assets and prints per-file statistics: section offsets and sizes,
+ * index widths, weight type and morph type histograms, duplicate names and vertices no face references.
+ * Files with out of range references (indices, bones, materials, morph targets, rigid bodies) fail validation.
+ * With -Convert each valid file is also written as a pre-parsed model file (.pmxc) that loads without PMX parsing.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=PmxInspect -Source=<File or directory> [-Convert=<Output directory>]
+ *       [-Report=<Json path>] [-Details] [-Workers=N]
+ */
+UCLASS()
+class UPmxInspectCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPmxInspectCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
@@ -0,0 +1,63 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxImportManifest;
+
+/**
+ * PMX Manifest Builder - Per-section content hashes of a translated model for incremental reimport
+ * Sections: Vertices, Indices, Bones, MaterialSlots, DisplayFrames, Material/<i>, Texture/<i> (file content), Morph/<i>,
+ * Bodies, Joints and Options/<Stage> (pipeline settings per import stage). Each factory node depends on a list of sections;
+ * a reimport rebuilds a node only if one of them changed.
+ * Options name the stages they affect with the PmxStages property metadata ("Skeleton,Physics"); untagged options affect every stage.
+ */
+class PMXIMPORTER_API FPmxManifestBuilder
+{
+public:
+	/** Translated / factory node attribute naming the node's own section (textures and materials) */
+	static const TCHAR* SectionAttributeKey;
+
+	static const TCHAR* VerticesSection;
+	static const TCHAR* IndicesSection;
+	static const TCHAR* BonesSection;
+	static const TCHAR* MaterialSlotsSection;
+	static const TCHAR* DisplayFramesSection;
+	static const TCHAR* BodiesSection;
+	static const TCHAR* JointsSection;
+
+	/** Prefix of the per-morph sections (a dependency ending in '/' matches every section under it) */
+	static const TCHAR* MorphSectionPrefix;
+	static const TCHAR* TextureSectionPrefix;
+
+	/** Import stages options are tagged with (PmxStages metadata) */
+	static const TCHAR* StageMetaDataKey;
+	static const TCHAR* GeometryStage;
+	static const TCHAR* SkeletonStage;
+	static const TCHAR* MorphStage;
+	static const TCHAR* MaterialStage;
+	static const TCHAR* TextureStage;
+	static const TCHAR* PhysicsStage;
+
+	static FString MaterialSection(int32 MaterialIndex);
+	static FString TextureSection(int32 TextureIndex);
+	static FString MorphSection(int32 MorphIndex);
+	static FString OptionsSection(const TCHAR* Stage);
+
+	/** Hash every model section; texture files are read relative to the PMX file */
+	static void BuildManifest(const FPmxModel& PmxModel, const FString& PmxFilePath, FPmxImportManifest& OutManifest);
+
+	/** Hash of the editable properties declared by an object's class (import options) that affect Stage */
+	static uint64 HashOptions(const UObject& Options, const TCHAR* Stage);
+
+	/** Add one Options/<Stage> section per import stage */
+	static void AddOptionsSections(const UObject& Options, FPmxImportManifest& OutManifest);
+
+	/** Sections added, removed or changed between two manifests */
+	static TSet<FString> DiffManifests(const FPmxImportManifest& OldManifest, const FPmxImportManifest& NewManifest);
+
+	/** Whether any dependency is in the changed set */
+	static bool IsAnyChanged(const TSet<FString>& ChangedSections, const TArray<FString>& Dependencies);
+};
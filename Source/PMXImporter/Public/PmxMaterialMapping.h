@@ -6,6 +6,7 @@
 #include "PmxStructs.h"
 
 class UInterchangeBaseNodeContainer;
+struct FPmxOutlineMesh;
 
 /**
  * PMX Material Mapping - Handles creation of material instances with PMX material properties
@@ -32,5 +33,21 @@ public:
 		const FString& InParentMaterialPath = FString()
 	);
 
+	/**
+	 * Create one material instance node per outline section (edge color)
+	 * @param Outline - Generated outline hull
+	 * @param BaseNodeContainer - The node container to add material nodes to
+	 * @param OutMaterialUids - Output array of material node UIDs, one per section
+	 * @param OutSlotNames - Output array of material slot names, one per section
+	 * @param InParentMaterialPath - Parent used when the PMXImporter.OutlineMaterial CVar is empty
+	 */
+	static void CreateOutlineMaterials(
+		const FPmxOutlineMesh& Outline,
+		UInterchangeBaseNodeContainer& BaseNodeContainer,
+		TArray<FString>& OutMaterialUids,
+		TArray<FString>& OutSlotNames,
+		const FString& InParentMaterialPath = FString()
+	);
+
 	// Helper functions moved to FPmxUtils class
 };
\ No newline at end of file
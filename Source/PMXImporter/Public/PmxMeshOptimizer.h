@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+/** Post-transform vertex cache efficiency of one material section */
+struct FPmxMeshSectionStats
+{
+	int32 MaterialIndex = INDEX_NONE;
+	int32 NumTriangles = 0;
+
+	/** Average cache misses per triangle (simulated FIFO cache) of the PMX order and the optimized order */
+	float AcmrBefore = 0.0f;
+	float AcmrAfter = 0.0f;
+
+	/** Number of overdraw clusters the optimized triangles were sorted in */
+	int32 NumClusters = 0;
+
+	/** False if the section was left in PMX order (invalid indices, or no improvement) */
+	bool bOptimized = false;
+};
+
+/**
+ * PMX Mesh Optimizer - Reorders index and vertex buffers for the GPU before the mesh payload is built
+ * Triangles are reordered within each material range (so sections stay intact) with Tipsify, a linear-time
+ * post-transform vertex cache optimization, then split into clusters at cache flushes and sorted outside-in so
+ * front-facing geometry tends to draw first (less overdraw). Finally vertices are renumbered in first-use order
+ * for fetch locality, and every vertex reference (morph offsets, soft body pins, the weld vertex map) follows.
+ */
+class PMXIMPORTER_API FPmxMeshOptimizer
+{
+public:
+	/** Entries of the simulated FIFO post-transform cache (Tipsify's cache size parameter) */
+	static constexpr int32 CacheSize = 16;
+
+	/** A cluster may be closed once its running ACMR is within this factor of the section's */
+	static constexpr float OverdrawClusterThreshold = 1.05f;
+
+	/**
+	 * Optimize triangle and vertex order of the model in place
+	 * @param InOutVertexMap	Original -> model vertex index map (RemoveDoubles); filled if empty and vertices moved
+	 * @param OutStats			Per material section statistics (optional)
+	 * @return False if nothing was reordered
+	 */
+	static bool OptimizeModel(FPmxModel& PmxModel, TMap<int32, int32>& InOutVertexMap, TArray<FPmxMeshSectionStats>* OutStats = nullptr);
+
+	/** Average cache misses per triangle of a triangle list for a FIFO cache of CacheSize entries */
+	static float ComputeAcmr(TConstArrayView<int32> Indices, int32 NumVertices, int32 InCacheSize = CacheSize);
+
+	/**
+	 * Tipsify triangle order of one triangle list (indices must be in [0, NumVertices))
+	 * @param OutHardBoundaries	Triangle positions (in the output) where the cache was flushed
+	 */
+	static void OptimizeVertexCache(TConstArrayView<int32> Indices, int32 NumVertices, TArray<int32>& OutIndices, TArray<int32>& OutHardBoundaries);
+
+	/**
+	 * Split a cache-optimized triangle list into clusters and sort them outside-in
+	 * @return Number of clusters
+	 */
+	static int32 OptimizeOverdraw(TArray<int32>& InOutIndices, const TArray<int32>& HardBoundaries, TConstArrayView<FVector3f> Positions);
+};
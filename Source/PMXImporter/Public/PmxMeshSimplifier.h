@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+struct FPmxLodSettings
+{
+	/** Number of LODs generated after LOD0 */
+	int32 NumLods = 0;
+
+	/** Triangle count of each LOD relative to the previous one */
+	float ReductionRatio = 0.5f;
+
+	/** Largest skin weight difference (sum of per-bone absolute differences, 0-2) a collapse may bridge */
+	float MaxWeightDifference = 0.5f;
+};
+
+/**
+ * One generated LOD, laid out like the PMX index buffer: material ranges of SurfaceCounts[Material] indices in
+ * material order, followed by the triangles no material covers. Indices reference model vertices.
+ */
+struct FPmxMeshLod
+{
+	TArray<int32> Indices;
+	TArray<int32> SurfaceCounts;
+};
+
+/**
+ * PMX Mesh Simplifier - Import-time LOD chain of the cleaned model
+ * Every LOD is simplified from the previous one with quadric error metric half-edge collapses, so simplified
+ * vertices are original model vertices and keep their skin weights, SDEF parameters and morph deltas exactly.
+ * Material sections are simplified independently and in parallel. Vertices shared between materials and
+ * vertices on open or non-manifold edges (mesh borders, UV / normal / skin weight seams, which PMX splits into
+ * separate vertices) are locked. A collapse must stay within FPmxLodSettings::MaxWeightDifference of skin weight,
+ * may only join vertices moved by the same set of morphs (its cost includes the morph delta difference) and
+ * must not flip a triangle.
+ */
+class PMXIMPORTER_API FPmxMeshSimplifier
+{
+public:
+	/**
+	 * Generate Settings.NumLods LODs
+	 * @return False if no LOD was generated (nothing to simplify)
+	 */
+	static bool BuildLodChain(const FPmxModel& PmxModel, const FPmxLodSettings& Settings, TArray<FPmxMeshLod>& OutLods);
+
+	/** Number of triangles of a LOD */
+	static int32 GetNumTriangles(const FPmxMeshLod& Lod) { return Lod.Indices.Num() / 3; }
+};
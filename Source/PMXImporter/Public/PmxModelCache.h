@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxImportOptions;
+
+/**
+ * PMX Model Cache - Stores translated (cleaned, welded, morph-deduplicated) models in the DerivedDataCache
+ * Keyed by the PMX file content hash, the plugin version, the cache format version and every option
+ * that changes the translated geometry, so repeat imports and reimports of unchanged files skip parsing,
+ * cleaning and vertex welding. Disable with PMXImporter.ModelCache 0.
+ */
+class PMXIMPORTER_API FPmxModelCache
+{
+public:
+	/** Whether the cache is enabled (PMXImporter.ModelCache) */
+	static bool IsEnabled();
+
+	/** DDC key of a PMX file's translated model under the given options */
+	static FString BuildCacheKey(const TArray<uint8>& FileData, const FPmxImportOptions& Options);
+
+	/**
+	 * Fetch a translated model
+	 * @return False on a miss or a corrupt entry
+	 */
+	static bool Load(const FString& CacheKey, FPmxModel& OutModel, TMap<int32, int32>& OutVertexMap);
+
+	/**
+	 * Store a translated model
+	 * @param BuildSeconds	Time spent parsing and cleaning; reported as time saved on later hits
+	 */
+	static void Store(const FString& CacheKey, const FPmxModel& Model, const TMap<int32, int32>& VertexMap, double BuildSeconds);
+
+	/** Log hit/miss counts and total time saved in this editor session */
+	static void LogStats();
+};
@@ -7,6 +7,36 @@
 
 class UInterchangeBaseNodeContainer;
 class UInterchangeSceneNode;
+struct FPmxBoneNameOptions;
+
+/**
+ * Preprocessed PMX skeleton (UE space) built by FPmxNodeBuilder::BuildSkeletonLayout
+ * Imports share one layout per bone set through FPmxImportSession::GetSkeletonLayout.
+ * All per-bone arrays are dense and indexed by PMX bone index.
+ */
+struct FPmxSkeletonLayout
+{
+	/** PMX bone indices in parent-before-child order */
+	TArray<int32> SortedBones;
+
+	/** Parent PMX bone index after validation and cycle breaking (INDEX_NONE = parented to the synthetic Root joint) */
+	TArray<int32> Parents;
+
+	/**
+	 * Bind pose world transform (translation only, matches the imported skeleton)
+	 * PMX local axis frames (XAxisDirection / ZAxisDirection, flag 0x0800) are not applied: MMD only uses them as
+	 * the axes of manual posing, while VMD keys and the rig evaluator rotate joints from an identity bind rotation.
+	 */
+	TArray<FTransform> WorldTransforms;
+
+	/** Bind pose local transform relative to Parents[i] (translation only) */
+	TArray<FTransform> LocalTransforms;
+
+	/** Number of parent links removed to break cycles */
+	int32 NumBrokenCycles = 0;
+
+	int32 Num() const { return Parents.Num(); }
+};
 
 /**
  * PMX Node Builder - Handles creation of scene nodes and bone hierarchy
@@ -23,13 +53,35 @@ public:
 		UInterchangeBaseNodeContainer& BaseNodeContainer
 	);
 
+	/**
+	 * Sort bones parent-before-child (breaking parent cycles) and compute bind world/local transforms
+	 * in a single pass over the sorted order.
+	 */
+	static void BuildSkeletonLayout(
+		const FPmxModel& PmxModel,
+		FPmxSkeletonLayout& OutLayout
+	);
+
 	/**
 	 * Create bone hierarchy using SceneNodes specialized as Joints
+	 * Joints are added in Layout.SortedBones order, so parents always exist before their children.
+	 * Joint names come from FPmxUtils::BuildUniqueBoneNames with NameOptions, so they are final at translate time.
+	 *
+	 * @param OutBoneJointNodes Joint node per PMX bone index (dense)
 	 */
 	static FString CreateBoneHierarchy(
 		const FPmxModel& PmxModel,
+		const FPmxSkeletonLayout& Layout,
 		UInterchangeBaseNodeContainer& BaseNodeContainer,
 		UInterchangeSceneNode* RootNode,
-		TMap<int32, UInterchangeSceneNode*>& OutBoneIndexToJointNode
+		const FPmxBoneNameOptions& NameOptions,
+		TArray<UInterchangeSceneNode*>& OutBoneJointNodes
 	);
+
+	/**
+	 * PMX bone index encoded in a joint node UID ("<JointsPrefix>/Bone_<Index>"), INDEX_NONE for other nodes
+	 * This is the index of the translated model. Once the pipeline has pruned bones, use
+	 * FPmxImportSession::GetJointBoneIndex to get the index into the session model.
+	 */
+	static int32 ParseJointBoneIndex(const FString& JointUid);
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxMaterial;
+
+/** One outline draw: the edge-enabled materials sharing an edge color */
+struct FPmxOutlineSection
+{
+	FLinearColor Color = FLinearColor::Black;
+	TArray<int32> MaterialIndices;
+
+	/** Outline vertex indices; each triangle is wound opposite to its source triangle */
+	TArray<int32> Indices;
+};
+
+/** Inverted hull generated from the PMX edge (toon outline) settings */
+struct FPmxOutlineMesh
+{
+	/** Model vertex each outline vertex follows (skin weights, UVs and morph offsets) */
+	TArray<int32> SourceVertices;
+
+	/** Model space extrusion of each outline vertex */
+	TArray<FVector3f> Offsets;
+
+	TArray<FPmxOutlineSection> Sections;
+
+	bool IsEmpty() const { return Sections.Num() == 0; }
+	int32 GetNumTriangles() const;
+};
+
+/**
+ * PMX Outline Builder - Inverted hull outline mesh for MMD's toon edge
+ * Every material with the edge flag (drawing flag 0x10) and a non-zero edge size contributes a copy of its triangles
+ * with reversed winding, extruded along the normal by EdgeSize * vertex EdgeScale * thickness. The extrusion uses
+ * the normal averaged over all vertices at the same position so the hull stays closed across UV and normal seams.
+ * Materials with the same edge color share one section, so the outline costs one extra draw per edge color.
+ */
+class PMXIMPORTER_API FPmxOutlineBuilder
+{
+public:
+	/** PMX material drawing flag enabling the edge (outline) */
+	static constexpr uint8 DrawEdgeFlag = 0x10;
+
+	/** Whether MMD draws an edge for the material */
+	static bool HasOutline(const FPmxMaterial& Material);
+
+	/**
+	 * Build the outline hull of the edge-enabled materials
+	 * @param Thickness		Model space extrusion per unit of EdgeSize * EdgeScale
+	 * @return False if no material has an edge
+	 */
+	static bool BuildOutline(const FPmxModel& PmxModel, float Thickness, FPmxOutlineMesh& OutOutline);
+
+	/** Material slot name of an outline section */
+	static FString GetSlotName(int32 SectionIndex);
+};
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PhysicsEngine/AggregateGeom.h"
+#include "PhysicsEngine/BodySetupEnums.h"
+#include "PhysicsEngine/ConstraintInstance.h"
 
 class UPhysicsAsset;
 class USkeletalMesh;
@@ -12,9 +15,48 @@ struct FPmxPhysicsCache;
 struct FPmxRigidBody;
 struct FPmxJoint;
 struct FPmxBone;
-struct FKAggregateGeom;
 struct FReferenceSkeleton;
 
+/** One body of a planned PhysicsAsset */
+struct FPmxPhysicsBodyPlan
+{
+	/** Exact skeleton bone name */
+	FName BoneName;
+	TEnumAsByte<EPhysicsType> PhysicsType = EPhysicsType::PhysType_Kinematic;
+	float Mass = 0.0f;
+	float LinearDamping = 0.0f;
+	float AngularDamping = 0.0f;
+	FKAggregateGeom AggGeom;
+};
+
+/** One constraint of a planned PhysicsAsset; frames are bone-local */
+struct FPmxPhysicsConstraintPlan
+{
+	FName BoneNameA;
+	FName BoneNameB;
+	FConstraintProfileProperties Profile;
+	FVector PositionA = FVector::ZeroVector;
+	FVector PositionB = FVector::ZeroVector;
+	FVector PrimaryAxis = FVector::XAxisVector;
+	FVector SecondaryAxis = FVector::YAxisVector;
+};
+
+/**
+ * PhysicsAsset content as plain data
+ * Planned from the physics cache and a reference skeleton on any thread (shapes, constraint frames and the
+ * O(N^2) collision pair filtering), then applied to the UPhysicsAsset on the game thread.
+ */
+struct FPmxPhysicsPlan
+{
+	/** In creation order; the applied asset's body indices match */
+	TArray<FPmxPhysicsBodyPlan> Bodies;
+	TArray<FPmxPhysicsConstraintPlan> Constraints;
+
+	/** Body index pairs whose collision is disabled, then pairs re-enabled afterwards */
+	TArray<TPair<int32, int32>> DisabledCollisionPairs;
+	TArray<TPair<int32, int32>> EnabledCollisionPairs;
+};
+
 /**
  * Builder class for creating PhysicsAsset from PMX rigid body and joint data.
  *
@@ -39,45 +81,85 @@ public:
 		const FPmxPhysicsCache& PhysicsData
 	);
 
+	/**
+	 * Plan a PhysicsAsset without touching UObjects (safe on worker threads).
+	 *
+	 * @param RefSkel		The reference skeleton of the SkeletalMesh (a copy when planning off the game thread)
+	 * @param PhysicsData	The cached PMX physics data
+	 * @param OutPlan		Bodies, constraints and collision pairs to apply
+	 * @return True if at least one body was planned
+	 */
+	static bool PlanPhysicsAsset(
+		const FReferenceSkeleton& RefSkel,
+		const FPmxPhysicsCache& PhysicsData,
+		FPmxPhysicsPlan& OutPlan
+	);
+
+	/**
+	 * Apply a plan to a PhysicsAsset on the game thread, stopping after the body or constraint that passes EndTime.
+	 *
+	 * @param PhysicsAsset	The PhysicsAsset to populate (emptied on the first call)
+	 * @param Plan			The planned content
+	 * @param InOutNextStep	Resume position; 0 on the first call
+	 * @param EndTime		FPlatformTime::Seconds() deadline of this call
+	 * @return True once the whole plan is applied
+	 */
+	static bool ApplyPhysicsPlan(
+		UPhysicsAsset* PhysicsAsset,
+		const FPmxPhysicsPlan& Plan,
+		int32& InOutNextStep,
+		double EndTime
+	);
+
 private:
 	/**
-	 * Create a BodySetup from a PMX RigidBody.
+	 * Plan a body from a PMX RigidBody.
 	 *
-	 * @param Asset			The parent PhysicsAsset
+	 * @param Plan			The plan so far (bodies already planned for the same bone win)
 	 * @param RB			The PMX rigid body data
 	 * @param RBIndex		Index of this rigid body in the RigidBodies array
 	 * @param Bone			The associated PMX bone
 	 * @param RefSkel		The reference skeleton for bone lookup
 	 * @param PhysicsData	The full physics cache (for options)
-	 * @return The created BodySetup, or nullptr on failure
+	 * @param OutBody		The planned body
+	 * @return False if the body is skipped
 	 */
-	static USkeletalBodySetup* CreateBodySetup(
-		UPhysicsAsset* Asset,
+	static bool PlanBody(
+		const FPmxPhysicsPlan& Plan,
 		const FPmxRigidBody& RB,
 		int32 RBIndex,
 		const FPmxBone& Bone,
 		const FReferenceSkeleton& RefSkel,
-		const FPmxPhysicsCache& PhysicsData
+		const FPmxPhysicsCache& PhysicsData,
+		FPmxPhysicsBodyPlan& OutBody
 	);
 
 	/**
-	 * Create a Constraint from a PMX Joint.
+	 * Plan a constraint from a PMX Joint.
 	 *
-	 * @param Asset			The parent PhysicsAsset
+	 * @param Plan			The plan with all bodies
 	 * @param Joint			The PMX joint data
 	 * @param RigidBodies	Array of all rigid bodies (for index lookup)
 	 * @param Bones			Array of all bones (for bone name lookup)
 	 * @param PhysicsData	The full physics cache (for options)
-	 * @return The created Constraint, or nullptr on failure
+	 * @param OutConstraint	The planned constraint
+	 * @return False if the joint is skipped
 	 */
-	static UPhysicsConstraintTemplate* CreateConstraint(
-		UPhysicsAsset* Asset,
+	static bool PlanConstraint(
+		const FPmxPhysicsPlan& Plan,
 		const FPmxJoint& Joint,
 		const TArray<FPmxRigidBody>& RigidBodies,
 		const TArray<FPmxBone>& Bones,
-		const FPmxPhysicsCache& PhysicsData
+		const FPmxPhysicsCache& PhysicsData,
+		FPmxPhysicsConstraintPlan& OutConstraint
 	);
 
+	/** Create the BodySetup of a planned body */
+	static USkeletalBodySetup* CreateBodySetup(UPhysicsAsset* Asset, const FPmxPhysicsBodyPlan& Body);
+
+	/** Create the constraint template of a planned constraint */
+	static UPhysicsConstraintTemplate* CreateConstraint(UPhysicsAsset* Asset, const FPmxPhysicsConstraintPlan& Constraint);
+
 	// Shape creation methods
 	static void SetupSphereShape(FKAggregateGeom& Geom, const FPmxRigidBody& RB, float Scale, const FVector& LocalPos);
 	static void SetupBoxShape(FKAggregateGeom& Geom, const FPmxRigidBody& RB, float Scale, const FVector& LocalPos, const FRotator& LocalRot);
@@ -95,6 +177,12 @@ private:
 	 */
 	static FRotator GetBodyLocalRotation(const FPmxRigidBody& RB);
 
+	/**
+	 * Resolve the skeleton bone name for a PMX bone index.
+	 * Uses the translate-time final names (L/R suffix, rename table) when cached, otherwise the raw PMX name.
+	 */
+	static const FString& GetSkeletonBoneName(const FPmxPhysicsCache& PhysicsData, int32 BoneIndex);
+
 	// Coordinate transformation helpers
 	static FVector ConvertVectorPmxToUE(const FVector3f& PmxVector, float Scale);
 	static FRotator ConvertRotationPmxToUE(const FVector3f& PmxRotation);
@@ -115,9 +203,9 @@ private:
 	static bool IsStandardBone(const FString& BoneName);
 
 	/**
-	 * Setup collision filtering for a body based on PMX group data.
+	 * Setup collision filtering for a body.
 	 */
-	static void SetupCollisionFiltering(USkeletalBodySetup* Body, const FPmxRigidBody& RB);
+	static void SetupCollisionFiltering(USkeletalBodySetup* Body);
 
 	/**
 	 * Check if a rigid body is connected to any constraint (joint).
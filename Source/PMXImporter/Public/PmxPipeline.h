@@ -1,4 +1,4 @@
-// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+﻿// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
 
 #pragma once
 
@@ -15,12 +15,19 @@ class UInterchangeSourceData;
 class UPhysicsAsset;
 class USkeletalMesh;
 struct FPmxPhysicsCache;
+struct FPmxRigDescription;
+struct FPmxSdefDescription;
+struct FPmxDisplayDescription;
+struct FPmxImportSession;
+struct FPmxModel;
 
 /**
  * PMX Import Pipeline
  *
  * Custom pipeline for importing MikuMikuDance PMX models.
  * Replaces GenericAssetsPipeline with PMX-specific options and logic.
+ * Options name the import stages they affect with PmxStages metadata (see FPmxManifestBuilder);
+ * an incremental reimport rebuilds only the assets of stages whose options changed.
  */
 UCLASS(BlueprintType, editinlinenew)
 class PMXIMPORTER_API UPmxPipeline : public UInterchangePipelineBase
@@ -40,11 +47,11 @@ public:
 	// =============================================
 
 	/** Pipeline display name shown in import dialog. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common", meta = (StandAlonePipelineProperty = "True", PipelineInternalEditionData = "True", ToolTip = "Pipeline display name shown in import dialog"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common", meta = (PmxStages = "None", StandAlonePipelineProperty = "True", PipelineInternalEditionData = "True", ToolTip = "Pipeline display name shown in import dialog"))
 	FString PipelineDisplayName = TEXT("PMX Pipeline");
 
 	/** Scale factor for imported model. PMX uses centimeters, UE uses centimeters but MMD scale is typically smaller. Default 8.0 adjusts MMD scale to UE. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common", meta = (ClampMin = "0.01", ClampMax = "1000.0", ToolTip = "Scale factor for imported model (default: 8.0)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Common", meta = (PmxStages = "Geometry,Skeleton,Morph,Physics", ClampMin = "0.01", ClampMax = "1000.0", ToolTip = "Scale factor for imported model (default: 8.0)"))
 	float Scale = 8.0f;
 
 	/** Use the source file name for the imported asset name. */
@@ -60,71 +67,142 @@ public:
 	bool bImportMesh = true;
 
 	/** Import morph targets (shape keys/blend shapes). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh", meta = (EditCondition = "bImportMesh", ToolTip = "Import morph targets (shape keys)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh", ToolTip = "Import morph targets (shape keys)"))
 	bool bImportMorphs = true;
 
+	/**
+	 * Keep SDEF (spherical deform) skinning data: packed into extra UV channels and stored as mesh user data.
+	 * Off by default: the plugin has no SDEF skinning path of its own, and the data costs five full precision UV channels.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh", meta = (PmxStages = "Geometry", EditCondition = "bImportMesh", ToolTip = "Keep SDEF skinning parameters (packed UV channels 1-5, full precision UVs and PmxSdefUserData on the mesh) for your own SDEF deformer. Rendering always uses linear skinning. Leaves UV channels 6-7 for AddUV Channels"))
+	bool bImportSdef = false;
+
 	// =============================================
 	// Mesh|Build Category (NEW)
 	// =============================================
 
 	/** Recompute normals from mesh geometry. Enable for better shading on deformed meshes. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (EditCondition = "bImportMesh", ToolTip = "Recompute normals from mesh geometry"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (PmxStages = "Geometry", EditCondition = "bImportMesh", ToolTip = "Recompute normals from mesh geometry"))
 	bool bRecomputeNormals = true;
 
 	/** Recompute tangents from mesh geometry. Enable for better normal mapping. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (EditCondition = "bImportMesh", ToolTip = "Recompute tangents from mesh geometry"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (PmxStages = "Geometry", EditCondition = "bImportMesh", ToolTip = "Recompute tangents from mesh geometry"))
 	bool bRecomputeTangents = true;
 
 	/** Use MikkTSpace for tangent generation. Standard method for better compatibility across tools. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (EditCondition = "bImportMesh && bRecomputeTangents", ToolTip = "Use MikkTSpace for tangent generation"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Build", meta = (PmxStages = "Geometry", EditCondition = "bImportMesh && bRecomputeTangents", ToolTip = "Use MikkTSpace for tangent generation"))
 	bool bUseMikkTSpace = true;
 
+	// =============================================
+	// Mesh|LOD Category
+	// =============================================
+
+	/** Number of LODs generated after LOD0 by simplifying the imported mesh (0 = LOD0 only). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|LOD", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh", ClampMin = "0", ClampMax = "7", ToolTip = "Number of LODs generated after LOD0. Material boundaries, UV/normal seams, skin weight seams and morph regions are preserved; morph targets are transferred to every LOD"))
+	int32 LodCount = 0;
+
+	/** Triangle count of each generated LOD relative to the previous LOD. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|LOD", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh && LodCount > 0", ClampMin = "0.1", ClampMax = "0.9", ToolTip = "Triangle count of each generated LOD relative to the previous LOD"))
+	float LodReductionRatio = 0.5f;
+
+	/** Most influences per vertex on the generated LODs (0 = keep all, up to 4). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|LOD", meta = (PmxStages = "Geometry", EditCondition = "bImportMesh && LodCount > 0", ClampMin = "0", ClampMax = "4", ToolTip = "Most bone influences per vertex on the generated LODs (0 = keep all). 1 or 2 makes distant LODs cheaper to skin"))
+	int32 LodMaxInfluences = 0;
+
+	// =============================================
+	// Mesh|Skinning Category
+	// =============================================
+
+	/** Skin influences lighter than this fraction of the vertex's total weight are dropped and the rest renormalized. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Skinning", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh", ClampMin = "0.0", ClampMax = "0.25", ToolTip = "Drop skin influences lighter than this fraction of the vertex weight and renormalize (0 = keep all). Repeated bones of a vertex are always merged; SDEF vertices are kept as is"))
+	float MinInfluenceWeight = 0.01f;
+
+	/** Bone limit of one render section; materials referencing more bones are laid out to split into as few sections as possible. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Skinning", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh", ClampMin = "0", ClampMax = "65536", ToolTip = "Bones per render section to plan for (0 = engine default). Triangles of materials referencing more bones are grouped into bone-bounded runs so the mesh build splits them into the fewest sections"))
+	int32 MaxBonesPerSection = 0;
+
+	// =============================================
+	// Mesh|Outline Category
+	// =============================================
+
+	/** Add an inverted hull outline section built from the PMX edge settings of edge-enabled materials. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Outline", meta = (PmxStages = "Geometry,Morph,Material", EditCondition = "bImportMesh", ToolTip = "Add an inverted hull outline to LOD0: edge-enabled materials are copied with reversed winding and extruded by EdgeSize * EdgeScale, one section per edge color (parent material: PMXImporter.OutlineMaterial)"))
+	bool bGenerateOutline = false;
+
+	/** Outline extrusion in PMX units per unit of EdgeSize * EdgeScale. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh|Outline", meta = (PmxStages = "Geometry,Morph", EditCondition = "bImportMesh && bGenerateOutline", ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Outline extrusion in PMX units per unit of EdgeSize * EdgeScale (scaled with the import scale)"))
+	float OutlineThickness = 0.03f;
+
 	// =============================================
 	// Skeleton Category
 	// =============================================
 
 	/** Import bone hierarchy (armature). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (ToolTip = "Import bone hierarchy (armature)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton,Physics", ToolTip = "Import bone hierarchy (armature)"))
 	bool bImportArmature = true;
 
-	/** Rename left/right bones to UE convention (_L/_R suffix). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (EditCondition = "bImportArmature", ToolTip = "Rename left/right bones to UE convention (_L/_R suffix)"))
+	/** Rename left/right bones to UE convention (_L/_R suffix). Applied when bone names are resolved, before the skeleton is built. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton,Physics", EditCondition = "bImportArmature", ToolTip = "Rename left/right bones to UE convention (_L/_R suffix)"))
 	bool bRenameLRBones = false;
 
+	/** Translate MMD standard bone names (センター, 腕, ひじ, ...) to English. Left/right bones get the _L/_R suffix. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton,Physics", EditCondition = "bImportArmature", ToolTip = "Translate MMD standard bone names (Japanese) to English"))
+	bool bTranslateBoneNames = false;
+
+	/** Custom bone rename entries (PMX name -> skeleton name). Overrides the built-in standard table. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton,Physics", EditCondition = "bImportArmature", ToolTip = "Custom bone rename entries (PMX name -> skeleton name)"))
+	TMap<FString, FString> BoneRenameTable;
+
 	/** Apply IK link fixes for better compatibility. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (EditCondition = "bImportArmature", ToolTip = "Apply IK link fixes for better compatibility"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Skeleton", EditCondition = "bImportArmature", ToolTip = "Apply IK link fixes for better compatibility"))
 	bool bFixIKLinks = false;
 
 	/** Apply bone fixed axis constraints. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (EditCondition = "bImportArmature", ToolTip = "Apply bone fixed axis constraints"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Skeleton", EditCondition = "bImportArmature", ToolTip = "Apply bone fixed axis constraints"))
 	bool bApplyBoneFixedAxis = false;
 
+	/** Create a PMX rig asset (IK chains and append links) next to the skeletal mesh. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Skeleton", EditCondition = "bImportArmature", ToolTip = "Create a rig asset (<Mesh>_Rig) with the PMX IK chains and append (additional parent) links"))
+	bool bCreateRigAsset = true;
+
+	/** Remove bones that carry no skin weight and drive nothing (no IK, append link or rigid body). MMD standard bones are always kept. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton,Morph,Physics", EditCondition = "bImportArmature", ToolTip = "Remove unweighted helper/tip bones that no IK chain, append link or rigid body uses (standard bones are kept)"))
+	bool bPruneUnusedBones = false;
+
+	/** Reuse the project skeleton of a previously imported model with the same standard bone hierarchy; extra bones are merged into it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton", EditCondition = "bImportArmature", ToolTip = "Share one skeleton between models of the same base rig (matched by skeleton fingerprint, extra bones are merged)"))
+	bool bShareCompatibleSkeletons = false;
+
+	/** Bind position tolerance for skeleton sharing (UE units). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skeleton", meta = (PmxStages = "Geometry,Skeleton", EditCondition = "bImportArmature && bShareCompatibleSkeletons", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Bind position tolerance for skeleton sharing (UE units)"))
+	float SkeletonMatchTolerance = 0.5f;
+
 	// =============================================
 	// Physics Category (Basic Options)
 	// =============================================
 
 	/** Import physics asset (rigid bodies and constraints). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (ToolTip = "Import physics asset (rigid bodies and constraints)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", ToolTip = "Import physics asset (rigid bodies and constraints)"))
 	bool bImportPhysics = true;
 
 	/** How to handle Physics Type 2 (physics + bone follow) rigid bodies. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (EditCondition = "bImportPhysics", ToolTip = "How to handle Physics Type 2 (physics + bone follow) rigid bodies"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "How to handle Physics Type 2 (physics + bone follow) rigid bodies"))
 	EPmxPhysicsType2Handling PhysicsType2Mode = EPmxPhysicsType2Handling::ConvertToKinematic;
 
 	/** Scale factor for physics mass (lower = lighter, more fluid movement). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "100.0", ToolTip = "Scale factor for physics mass (lower = lighter, more fluid movement)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "100.0", ToolTip = "Scale factor for physics mass (lower = lighter, more fluid movement)"))
 	float PhysicsMassScale = 0.2f;
 
 	/** Scale factor for physics damping (lower = more bouncy/swaying, slower settling). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (EditCondition = "bImportPhysics", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Scale factor for physics damping (lower = more bouncy/swaying)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Scale factor for physics damping (lower = more bouncy/swaying)"))
 	float PhysicsDampingScale = 0.5f;
 
 	/** Force standard skeletal bones (core body/limbs) to kinematic, ignoring PMX physics type. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (EditCondition = "bImportPhysics", ToolTip = "Force standard skeletal bones to kinematic"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Force standard skeletal bones to kinematic"))
 	bool bForceStandardBonesKinematic = true;
 
 	/** Force non-standard bones (cloth/hair/accessories) to simulated, ignoring PMX physics type. Only applies to bodies connected to constraints. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (EditCondition = "bImportPhysics", ToolTip = "Force non-standard bones to simulated"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Force non-standard bones to simulated"))
 	bool bForceNonStandardBonesSimulated = false;
 
 	// =============================================
@@ -132,91 +210,91 @@ public:
 	// =============================================
 
 	/** Scale factor for physics body shapes (sphere, box, capsule radius/size). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Scale factor for physics body shapes"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Scale factor for physics body shapes"))
 	float PhysicsShapeScale = 1.0f;
 
 	/** Additional scale factor for sphere shapes only (multiplied with PhysicsShapeScale). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for sphere shapes"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for sphere shapes"))
 	float PhysicsSphereScale = 1.0f;
 
 	/** Additional scale factor for box shapes only (multiplied with PhysicsShapeScale). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for box shapes"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for box shapes"))
 	float PhysicsBoxScale = 1.0f;
 
 	/** Additional scale factor for capsule shapes only (multiplied with PhysicsShapeScale). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for capsule shapes"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Additional scale for capsule shapes"))
 	float PhysicsCapsuleScale = 1.0f;
 
 	/** Disable collision between bodies connected by constraints (prevents stiff behavior from overlapping bodies). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Disable collision between constrained bodies"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Disable collision between constrained bodies"))
 	bool bDisableConstraintBodyCollision = true;
 
 	/** Use PMX collision group/mask settings for filtering. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Use PMX collision group/mask settings"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Use PMX collision group/mask settings"))
 	bool bUsePmxCollisionGroups = true;
 
 	/** Enable collision between standard bones (body/limbs) and non-standard bones (cloth/hair/accessories). Warning: Once penetrated, cloth may stay inverted. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Enable collision between standard and non-standard bones"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Enable collision between standard and non-standard bones"))
 	bool bEnableStandardNonStandardCollision = false;
 
 	/** Constraint configuration mode - Use PMX settings or override all. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Constraint configuration mode"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Constraint configuration mode"))
 	EPmxConstraintMode ConstraintMode = EPmxConstraintMode::UsePmxSettings;
 
 	/** Scale factor for constraint spring stiffness (lower = softer, more flowing). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Scale for constraint spring stiffness"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.01", ClampMax = "10.0", ToolTip = "Scale for constraint spring stiffness"))
 	float ConstraintStiffnessScale = 0.2f;
 
 	/** Scale factor for constraint spring damping (lower = slower settling). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Scale for constraint spring damping"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Scale for constraint spring damping"))
 	float ConstraintDampingScale = 0.3f;
 
 	/** Maximum angular limit for constraints in degrees. Higher values = more flexible movement. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings", ClampMin = "0.1", ClampMax = "180.0", ToolTip = "Maximum angular limit in degrees"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings", ClampMin = "0.1", ClampMax = "180.0", ToolTip = "Maximum angular limit in degrees"))
 	float MaxAngularLimit = 15.0f;
 
 	/** Force all linear motion to Locked regardless of PMX settings. Prevents spring-like stretching. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings", ToolTip = "Force all linear motion to Locked"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings", ToolTip = "Force all linear motion to Locked"))
 	bool bForceAllLinearMotionLocked = true;
 
 	/** Disable linear spring drive (prevents spring-like stretching). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Disable linear spring drive"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Disable linear spring drive"))
 	bool bDisableLinearSpringDrive = true;
 
 	/** Linear motion tolerance (cm). Values below this are treated as Locked. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings && !bForceAllLinearMotionLocked", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Linear motion tolerance in cm"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::UsePmxSettings && !bForceAllLinearMotionLocked", ClampMin = "0.0", ClampMax = "10.0", ToolTip = "Linear motion tolerance in cm"))
 	float LinearMotionTolerance = 1.0f;
 
 	/** [Override Mode] Lock all linear motion (translation). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ToolTip = "[Override] Lock all linear motion"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ToolTip = "[Override] Lock all linear motion"))
 	bool bLockAllLinearMotion = true;
 
 	/** [Override Mode] Angular motion type for all constraints. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ToolTip = "[Override] Angular motion type"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ToolTip = "[Override] Angular motion type"))
 	TEnumAsByte<EAngularConstraintMotion> OverrideAngularMotion = EAngularConstraintMotion::ACM_Limited;
 
 	/** [Override Mode] Swing1 limit in degrees. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Swing1 limit in degrees"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Swing1 limit in degrees"))
 	float OverrideSwing1Limit = 5.0f;
 
 	/** [Override Mode] Swing2 limit in degrees. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Swing2 limit in degrees"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Swing2 limit in degrees"))
 	float OverrideSwing2Limit = 5.0f;
 
 	/** [Override Mode] Twist limit in degrees. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Twist limit in degrees"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && ConstraintMode == EPmxConstraintMode::OverrideAll", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "[Override] Twist limit in degrees"))
 	float OverrideTwistLimit = 5.0f;
 
 	/** Use soft constraint (smoother limits with stiffness/damping). May cause stretching at high velocities. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics", ToolTip = "Use soft constraint"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics", ToolTip = "Use soft constraint"))
 	bool bUseSoftConstraint = false;
 
 	/** Soft constraint stiffness (spring strength). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && bUseSoftConstraint", ClampMin = "0.0", ClampMax = "10000.0", ToolTip = "Soft constraint stiffness"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && bUseSoftConstraint", ClampMin = "0.0", ClampMax = "10000.0", ToolTip = "Soft constraint stiffness"))
 	float SoftConstraintStiffness = 50.0f;
 
 	/** Soft constraint damping (resistance). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (EditCondition = "bImportPhysics && bUseSoftConstraint", ClampMin = "0.0", ClampMax = "100.0", ToolTip = "Soft constraint damping"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Physics|Advanced", meta = (PmxStages = "Physics", EditCondition = "bImportPhysics && bUseSoftConstraint", ClampMin = "0.0", ClampMax = "100.0", ToolTip = "Soft constraint damping"))
 	float SoftConstraintDamping = 5.0f;
 
 
@@ -225,19 +303,19 @@ public:
 	// =============================================
 
 	/** Parent material for material instances. Uses the PMX base material from plugin content. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Material", meta = (ToolTip = "Parent material for material instances (read-only)"))
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Material", meta = (PmxStages = "Material", ToolTip = "Parent material for material instances (read-only)"))
 	FSoftObjectPath ParentMaterial = FSoftObjectPath(TEXT("/PMXImporter/M_PMX_Base.M_PMX_Base"));
 
 	/** Generate mipmaps for imported textures. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (ToolTip = "Generate mipmaps for imported textures"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (PmxStages = "Texture", ToolTip = "Generate mipmaps for imported textures"))
 	bool bUseMipmap = true;
 
 	/** Blend factor for sphere map textures (.sph). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Blend factor for sphere map textures (.sph)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (PmxStages = "Material", ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Blend factor for sphere map textures (.sph)"))
 	float SphBlendFactor = 1.0f;
 
 	/** Blend factor for sphere add textures (.spa). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Blend factor for sphere add textures (.spa)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Material", meta = (PmxStages = "Material", ClampMin = "0.0", ClampMax = "1.0", ToolTip = "Blend factor for sphere add textures (.spa)"))
 	float SpaBlendFactor = 1.0f;
 
 	// =============================================
@@ -245,28 +323,48 @@ public:
 	// =============================================
 
 	/** Clean model by removing unused vertices. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (ToolTip = "Clean model by removing unused vertices"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry,Morph", ToolTip = "Clean model by removing unused vertices"))
 	bool bCleanModel = true;
 
 	/** Remove duplicate vertices (weld vertices). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (ToolTip = "Remove duplicate vertices (weld vertices)"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry,Morph", ToolTip = "Remove duplicate vertices (weld vertices)"))
 	bool bRemoveDoubles = true;
 
+	/** Reorder triangles and vertices for the GPU vertex cache and less overdraw. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry,Morph", ToolTip = "Reorder triangles within each material for the post-transform vertex cache (Tipsify) and less overdraw, then vertices for fetch locality"))
+	bool bOptimizeVertexCache = true;
+
 	/** Mark sharp edges based on angle threshold. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (ToolTip = "Mark sharp edges based on angle threshold"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", ToolTip = "Mark sharp edges based on angle threshold"))
 	bool bMarkSharpEdges = true;
 
 	/** Angle threshold for marking sharp edges (degrees). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (EditCondition = "bMarkSharpEdges", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "Angle threshold for marking sharp edges in degrees"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", EditCondition = "bMarkSharpEdges", ClampMin = "0.0", ClampMax = "180.0", ToolTip = "Angle threshold for marking sharp edges in degrees"))
 	float SharpEdgeAngle = 179.0f;
 
 	/** Import additional UV set as vertex colors. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (ToolTip = "Import additional UV set as vertex colors"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", ToolTip = "Import additional UV set as vertex colors"))
 	bool bImportAddUV2AsVertexColors = false;
 
-	/** Import display frame data (less useful for UE). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (ToolTip = "Import display frame data (less useful for UE)"))
-	bool bImportDisplay = false;
+	/** Additional UV channels (PMX AddUV1-4) written to the mesh as extra UV channels. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", Bitmask, BitmaskEnum = "/Script/PMXImporter.EPmxAddUVChannel", ToolTip = "PMX additional UV channels written as mesh UV channels after UV0 and the SDEF channels (xy, plus zw when used). Leave unused channels off to keep the vertex buffer small. With Import SDEF only two channels remain, so at most two AddUVs (one if it uses zw) are imported"))
+	int32 AddUVChannels = 0;
+
+	/** Store UVs at half precision when additional UVs are imported (ignored when SDEF data needs full precision). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", ToolTip = "Store mesh UVs at half precision when additional UVs are imported (half the UV stream size; SDEF forces full precision)"))
+	bool bAddUVHalfPrecision = false;
+
+	/** Import display frames as bone / morph groups (PmxDisplayUserData on the mesh). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Geometry", ToolTip = "Import PMX display frames as bone / morph groups with precomputed lookup tables"))
+	bool bImportDisplay = true;
+
+	/** Add one skeleton blend profile per display frame (PMX_<Frame>) so the skeleton tree can be filtered by frame. Skipped for shared skeletons. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "Skeleton", EditCondition = "bImportDisplay", ToolTip = "Add a skeleton blend profile (PMX_<Frame>) per display frame as a bone group (not added to a shared skeleton)"))
+	bool bCreateDisplayBlendProfiles = true;
+
+	/** On reimport, rebuild only the assets whose PMX sections (geometry, bones, morphs, materials, textures, bodies, joints) changed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced", meta = (PmxStages = "None", ToolTip = "On reimport, compare per-section content hashes with the existing import and rebuild only the assets whose sections changed"))
+	bool bIncrementalReimport = true;
 
 protected:
 	//~ Begin UInterchangePipelineBase overrides
@@ -282,6 +380,39 @@ private:
 	/** Store PMX options into SourceNode for Translator to read */
 	void StoreOptionsToSourceNode(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
 
+	/** Resolve final bone names with current pipeline options and push them into joint nodes and translator caches */
+	void UpdateBoneNames(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
+
+	/** Skin weight cleanup, GPU triangle/vertex order and bone-bounded sections on the cached model (before bone pruning and SDEF) */
+	void OptimizeMesh() const;
+
+	/** Prune unused bones from the cached model, joint nodes and physics/rig caches (before the skeleton is built) */
+	void PruneUnusedBones(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
+
+	/** Build the LOD chain on the final model and add its LOD data, mesh and morph target nodes */
+	void GenerateMeshLods(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
+
+	/** Build the LOD0 outline hull on the final model and add its material slots to the LOD0 mesh node */
+	void GenerateOutline(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
+
+	/** Rebuild cached rig descriptions with final bone names and current pipeline options */
+	void UpdateRigCache() const;
+
+	/** Look up a project skeleton by fingerprint, check it against the model and redirect the skeleton/mesh factory nodes to it */
+	void MatchSharedSkeleton(UInterchangeBaseNodeContainer* BaseNodeContainer);
+
+	/** Merge extra bones into a shared skeleton, or register a newly created skeleton in the project index */
+	void FinalizeSharedSkeleton(USkeletalMesh* SkeletalMesh) const;
+
+	/** Rebuild the cached SDEF subset from the final model (or drop it when SDEF import is disabled) */
+	void UpdateSdefCache() const;
+
+	/** Hand the AddUV channel options to the mesh payload, warning when SDEF leaves too few UV channels for them */
+	void UpdateAddUVOptions() const;
+
+	/** Refresh cached display groups with final (and pruned) bone names, or drop them when display import is disabled */
+	void UpdateDisplayCache() const;
+
 	/** Update physics cache with current pipeline options (called after Translator has created cache) */
 	void UpdatePhysicsCacheOptions() const;
 
@@ -294,13 +425,30 @@ private:
 	/** Configure factory nodes with import options */
 	void ConfigureFactoryNodes(UInterchangeBaseNodeContainer* BaseNodeContainer) const;
 
-	/** Build physics asset from PMX physics data */
-	void BuildPmxPhysicsAsset(UPhysicsAsset* PhysicsAsset, USkeletalMesh* SkeletalMesh, const FPmxPhysicsCache& PhysicsData) const;
+	/** Compare this import's manifest with the existing asset's and skip the factory nodes whose sections are unchanged */
+	void ApplyIncrementalReimport(UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& ContentBasePath) const;
+
+	/** Attach the manifest to the imported mesh, or update the sections of one rebuilt asset in the existing mesh's manifest */
+	void UpdateImportManifest(const UInterchangeBaseNodeContainer* BaseNodeContainer, const FString& NodeKey, UObject* CreatedAsset) const;
+
+	/** Rewrite the session's import report (PMXImporter.ImportReport) */
+	void WriteImportReport() const;
+
+	/** Build physics asset from PMX physics data (planned on a worker task, applied and linked to the mesh by the post-import queue) */
+	void BuildPmxPhysicsAsset(UPhysicsAsset* PhysicsAsset, USkeletalMesh* SkeletalMesh, const TSharedRef<FPmxPhysicsCache>& PhysicsData) const;
+
+	/** Create or update the <MeshName>_Rig asset in the skeletal mesh folder */
+	void CreatePmxRigAsset(USkeletalMesh* SkeletalMesh, const FPmxRigDescription& RigDescription) const;
+
+	/** Attach the SDEF subset (remapped to render vertices) to the imported mesh */
+	void AttachPmxSdefData(USkeletalMesh* SkeletalMesh, FPmxSdefDescription& SdefDescription) const;
+
+	/** Attach display groups with resolved lookup tables to the imported mesh and add skeleton blend profiles */
+	void AttachPmxDisplayData(USkeletalMesh* SkeletalMesh, FPmxDisplayDescription& DisplayDescription) const;
 
-	/** Rename chiral bones with _L _R Suffix */
-	void RenameLRBones(USkeletalMesh* SkeletalMesh) const;
+	/** Model of the import session (final bone names after UpdateBoneNames), or null */
+	FPmxModel* GetSessionModel() const;
 
-	/** Cached base node container for post-import access */
-	UPROPERTY(Transient)
-	TObjectPtr<const UInterchangeBaseNodeContainer> CachedBaseNodeContainer;
+	/** Import session of the translator that produced the node container (found in ExecutePipeline, kept until post-import) */
+	TSharedPtr<FPmxImportSession> Session;
 };
@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+
+class FPmxImportProfiler;
+
+/**
+ * PMX Post Import Queue - Game thread post-import work applied in frame-budgeted slices
+ * Post-import steps (physics asset creation, material parameters) are queued instead of run inline, so
+ * the editor keeps ticking while a large model finishes importing. Every tick runs queued steps in order
+ * until PMXImporter.PostImportBudgetMs is spent; a step returns false to be called again in a later tick
+ * (more work left, or a dependency not loaded yet). A step may wait for a prerequisite task, typically
+ * the worker task preparing its data, and is not run before that task completes.
+ * Commandlets and a budget of 0 run every step to completion when it is enqueued, except a step waiting on
+ * other game thread work (a texture created later in the same import): it stays queued and is retried on
+ * later ticks, which commandlets pump while they wait for the import.
+ * Game thread only.
+ */
+class PMXIMPORTER_API FPmxPostImportQueue
+{
+public:
+	/** One slice of work; returns true when done. EndTime is the FPlatformTime::Seconds() budget deadline. */
+	using FStep = TUniqueFunction<bool(double EndTime)>;
+
+	/**
+	 * Queue a step (or run it to completion if time slicing is off)
+	 * @param Label			Name for logs
+	 * @param Profiler		Import profiler the step records into (its report is rewritten when the step completes)
+	 * @param Step			The work
+	 * @param Prerequisite	Task that must complete before the step first runs
+	 */
+	static void Enqueue(const FString& Label, const TSharedPtr<FPmxImportProfiler>& Profiler, FStep&& Step,
+		const UE::Tasks::FTask& Prerequisite = UE::Tasks::FTask());
+
+	/** Run every queued step to completion (module shutdown, or before work that needs the results) */
+	static void Flush();
+
+	/** Number of queued steps */
+	static int32 GetNumPending();
+
+	/** Whether steps are spread over ticks (PMXImporter.PostImportBudgetMs > 0 and not running a commandlet) */
+	static bool IsTimeSlicingEnabled();
+
+private:
+	struct FItem
+	{
+		FString Label;
+		TSharedPtr<FPmxImportProfiler> Profiler;
+		FStep Step;
+		UE::Tasks::FTask Prerequisite;
+		double EnqueueTime = 0.0;
+	};
+
+	static bool Tick(float DeltaTime);
+
+	/** Run one step with an unlimited budget; false if it is still waiting on other work */
+	static bool RunToCompletion(FItem& Item);
+
+	/** Log and report a finished step */
+	static void Complete(const FItem& Item);
+
+	static TArray<FItem> Items;
+	static FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -6,6 +6,17 @@
 
 struct FPmxModel;
 
+/** Byte range of one PMX section in the source data */
+struct FPmxSectionInfo
+{
+	FString Name;
+	int32 Offset = 0;
+	int32 Size = 0;
+
+	/** Elements in the section (1 for the header) */
+	int32 Count = 0;
+};
+
 /**
  * PMX file reader utility functions
  */
@@ -26,4 +37,13 @@ namespace PMXReader
 	 * @return true if successful, false otherwise
 	 */
 	bool LoadPmxFromData(const TArray<uint8>& Data, FPmxModel& OutModel);
+
+	/**
+	 * Load PMX model from binary data and record where each section starts and ends
+	 * @param Data Binary PMX data
+	 * @param OutModel Output model structure
+	 * @param OutSections Sections read, in file order (partial if the read fails)
+	 * @return true if successful, false otherwise
+	 */
+	bool LoadPmxFromData(const TArray<uint8>& Data, FPmxModel& OutModel, TArray<FPmxSectionInfo>& OutSections);
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxSkeletonLayout;
+struct FPmxRigDescription;
+
+/**
+ * PMX Rig Builder - Converts PMX IK and append (additional parent) data into an evaluation-ordered rig description
+ * The description is saved in the <Mesh>_Rig asset and evaluated at runtime by the PMX Rig anim node.
+ */
+class PMXIMPORTER_API FPmxRigBuilder
+{
+public:
+	/**
+	 * Build the rig description of a model
+	 * Steps are ordered by (after-physics flag, Layer, bone index); per bone the append step runs before its IK step.
+	 * IK angle limits are converted to UE axes.
+	 *
+	 * @param BoneNames		Final skeleton bone names (parallel to PmxModel.Bones)
+	 * @param bFixIKLinks	Drop IK links that are not ancestors of the IK target
+	 * @return False if the model has neither IK chains nor append links
+	 */
+	static bool BuildRigDescription(
+		const FPmxModel& PmxModel,
+		const FPmxSkeletonLayout& Layout,
+		const TArray<FString>& BoneNames,
+		bool bFixIKLinks,
+		FPmxRigDescription& OutDescription
+	);
+
+	/** Convert PMX IK angle limits (radians, PMX axes) to rotation limits about UE axes */
+	static void ConvertIKLimits(const FVector3f& PmxMin, const FVector3f& PmxMax, FVector3f& OutMin, FVector3f& OutMax);
+};
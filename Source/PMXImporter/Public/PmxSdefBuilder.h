@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PmxSdefData.h"
+
+struct FPmxModel;
+struct FPmxVertex;
+
+/**
+ * PMX SDEF Builder - Precomputes the SDEF vertex subset and the packed SDEF UV stream at import
+ * The subset is rebuilt from the final model in the pipeline and keeps PMX vertex indices.
+ */
+class PMXIMPORTER_API FPmxSdefBuilder
+{
+public:
+	/** PMX to mesh space transform of the mesh payload (Y-up to Z-up, scaled) */
+	static FTransform GetPmxToMeshTransform(float ImportScale = 8.f);
+
+	/** True for an SDEF vertex that actually blends two different valid bones */
+	static bool IsSdefVertex(const FPmxVertex& Vertex, int32 NumBones);
+
+	/**
+	 * Collect the SDEF vertices of a model with their corrective centers in mesh space
+	 *
+	 * @param BoneNames		Final skeleton bone names (parallel to PmxModel.Bones)
+	 * @return False if the model has no SDEF vertex
+	 */
+	static bool BuildSdefDescription(
+		const FPmxModel& PmxModel,
+		const TArray<FString>& BoneNames,
+		const FTransform& PmxToMesh,
+		FPmxSdefDescription& OutDescription
+	);
+
+	/** Packed SDEF UVs of one vertex (non-SDEF vertices get the empty marker) */
+	static void PackVertexUVs(const FPmxVertex& Vertex, int32 NumBones, const FTransform& PmxToMesh, FVector2f OutUVs[FPmxSdefDescription::NumPackedUVChannels]);
+};
@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "PmxSkeletonIndex.generated.h"
+
+/**
+ * Project-wide index of skeletons created by PMX imports, keyed by skeleton fingerprint
+ * Stored in DefaultEditor.ini so every import of the project (and every user) shares the same skeletons.
+ * See FPmxSkeletonMatcher for how fingerprints are computed.
+ */
+UCLASS(config = Editor, defaultconfig, meta = (DisplayName = "PMX Skeleton Index"))
+class PMXIMPORTER_API UPmxSkeletonIndex : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Skeleton created for a fingerprint (first import wins) */
+	UPROPERTY(config, VisibleAnywhere, Category = "Skeleton Sharing")
+	TMap<FString, FSoftObjectPath> SkeletonsByFingerprint;
+
+	/** Registered skeleton for a fingerprint, or an empty path (stale entries whose asset is gone are ignored) */
+	FSoftObjectPath FindSkeleton(const FString& Fingerprint) const;
+
+	/** Register a skeleton for a fingerprint and save the index; existing entries are kept unless stale */
+	void RegisterSkeleton(const FString& Fingerprint, const FSoftObjectPath& SkeletonPath);
+
+	//~ Begin UDeveloperSettings Interface
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+	//~ End UDeveloperSettings Interface
+};
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxSkeletonLayout;
+struct FReferenceSkeleton;
+
+/**
+ * PMX Skeleton Matcher - Fingerprints PMX bone hierarchies so compatible models can share one skeleton
+ * The fingerprint covers the MMD standard bones (all bones if the model has too few): normalized names,
+ * direct parent and bind positions quantized to the match tolerance. Extra leaf bones (hair, skirt, accessories)
+ * do not change it, so models of the same base rig map to the same skeleton and their extra bones are merged into it.
+ * Extra bones inserted between standard bones reparent them and give a different fingerprint, because the
+ * skeleton cannot be shared in that case (CheckCompatibility compares the same direct parent relation).
+ */
+class PMXIMPORTER_API FPmxSkeletonMatcher
+{
+public:
+	/** Bone name as the skeleton compares it (trimmed, case folded) */
+	static FString NormalizeBoneName(const FString& BoneName);
+
+	/**
+	 * Fingerprint of a model with final bone names
+	 * Positions are rounded to the nearest multiple of Tolerance, so a bone within tolerance of the shared skeleton
+	 * but on the other side of a cell boundary gives a different fingerprint. That only costs a separate skeleton:
+	 * a fingerprint match is never trusted without CheckCompatibility.
+	 * @param Tolerance	Bind position quantization step (UE units)
+	 * @return Empty if the model has no bones
+	 */
+	static FString ComputeFingerprint(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, float Tolerance);
+
+	/**
+	 * Full check of a model against an existing skeleton
+	 * Every bone that exists in both must have the same parent and a bind position within tolerance.
+	 *
+	 * @param OutExtraBones	Model bones missing from the skeleton (to be merged)
+	 * @param OutReason		First incompatibility found
+	 */
+	static bool CheckCompatibility(
+		const FPmxModel& PmxModel,
+		const FPmxSkeletonLayout& Layout,
+		const FReferenceSkeleton& RefSkeleton,
+		float Tolerance,
+		TArray<FString>& OutExtraBones,
+		FString& OutReason
+	);
+};
@@ -0,0 +1,55 @@
+﻿// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+struct FPmxSkeletonLayout;
+
+struct FPmxBonePruneOptions
+{
+	/** Keep MMD standard bones (センター, 腕, ...) even when unused, so motions keep their targets */
+	bool bKeepStandardBones = true;
+
+	/** Skin weights at or below this value do not keep a bone alive (they are moved to the nearest kept ancestor) */
+	float MinWeight = 0.0f;
+};
+
+struct FPmxBonePruneResult
+{
+	/** New bone index per original bone index (INDEX_NONE = removed) */
+	TArray<int32> OldToNew;
+
+	/** Original bone index per kept bone */
+	TArray<int32> NewToOld;
+
+	TArray<FString> RemovedBones;
+	int32 NumWeightsMoved = 0;
+
+	bool HasPrunedBones() const { return RemovedBones.Num() > 0; }
+};
+
+/**
+ * PMX Skeleton Pruner - Removes bones that are never needed at runtime before the skeleton is built
+ * A bone is required when it carries skin weight, drives a rigid body, takes part in an IK chain or append link,
+ * or is an MMD standard bone; every ancestor of a required bone is required too. Removed bones therefore form
+ * whole leaf subtrees (tip bones, display-only and helper bones) and their weights collapse into kept ancestors.
+ */
+class PMXIMPORTER_API FPmxSkeletonPruner
+{
+public:
+	/** Mark required bones (dense, indexed by bone index); Layout is the model's skeleton layout */
+	static void FindRequiredBones(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, const FPmxBonePruneOptions& Options, TBitArray<>& OutRequired);
+
+	/**
+	 * Remove unrequired bones from the model and remap every bone reference
+	 * (vertex weights, parents, tails, append/IK links, rigid bodies, bone morphs, display frames).
+	 * @param Layout	Skeleton layout of the unpruned model; stale once bones were removed
+	 * @return False if nothing was removed (the model is unchanged)
+	 */
+	static bool PruneUnusedBones(FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout, const FPmxBonePruneOptions& Options, FPmxBonePruneResult& OutResult);
+
+	/** True if the name (original or translated, with or without side prefix/suffix) is an MMD standard bone */
+	static bool IsStandardBoneName(const FString& BoneName);
+};
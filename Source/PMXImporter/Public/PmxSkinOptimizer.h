@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+/** Bone partitioning of one material section */
+struct FPmxSkinSectionStats
+{
+	int32 MaterialIndex = INDEX_NONE;
+	int32 NumTriangles = 0;
+
+	/** Distinct bones the material's triangles are weighted to */
+	int32 NumBones = 0;
+
+	/** Bone-bounded triangle groups the material was ordered into (1 = not split) */
+	int32 NumSections = 0;
+};
+
+/**
+ * PMX Skin Optimizer - Skin weight cleanup and bone-count-aware section layout before the mesh payload is built
+ * PruneInfluences merges repeated bones of a vertex and drops influences below a weight threshold, renormalizing
+ * the rest (SDEF vertices keep both bones for the SDEF deformer). MergeRepeatedBones repeats the merge after bone
+ * pruning has collapsed weights into kept ancestors. PartitionSections groups the triangles of a
+ * material that references more bones than a render section allows into bone-bounded runs, so the engine's
+ * first-fit bone chunking produces as few sections (draw calls) as possible; triangle order within a run is kept.
+ */
+class PMXIMPORTER_API FPmxSkinOptimizer
+{
+public:
+	/** Influences per vertex in PMX (BDEF4 / QDEF) */
+	static constexpr int32 MaxInfluences = 4;
+
+	/**
+	 * Drop influences lighter than MinWeight and renormalize, then log the influence histogram
+	 * @param OutHistogram	Vertices by number of influences, index 0 = unweighted (optional)
+	 * @return Number of influences removed
+	 */
+	static int32 PruneInfluences(FPmxModel& PmxModel, float MinWeight, TArray<int32>* OutHistogram = nullptr);
+
+	/**
+	 * Fold repeated bones of every vertex into one slot and renormalize (after weights were moved between bones)
+	 * @return Number of slots folded
+	 */
+	static int32 MergeRepeatedBones(FPmxModel& PmxModel);
+
+	/** Vertices by number of non-zero influences (MaxInfluences + 1 entries, index 0 = unweighted) */
+	static void ComputeInfluenceHistogram(const FPmxModel& PmxModel, TArray<int32>& OutHistogram);
+
+	/**
+	 * Order the triangles of every material referencing more than MaxBonesPerSection bones into bone-bounded runs
+	 * @param MaxBonesPerSection	Bone limit of a render section; 0 only reports the section count
+	 * @param OutStats				Per material statistics (optional)
+	 * @return Estimated number of render sections of the model
+	 */
+	static int32 PartitionSections(FPmxModel& PmxModel, int32 MaxBonesPerSection, TArray<FPmxSkinSectionStats>* OutStats = nullptr);
+};
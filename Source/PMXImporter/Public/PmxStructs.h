@@ -294,3 +294,24 @@ struct FPmxModel
 	TArray<FPmxJoint> Joints;
 	TArray<FPmxSoftBody> SoftBodies; // PMX 2.1 feature
 };
+
+// Binary serialization of the translated model (model cache, import manifest hashes)
+// Any layout change must bump FPmxModelCache's CacheFormatVersion
+FArchive& operator<<(FArchive& Ar, FPmxHeader& Value);
+FArchive& operator<<(FArchive& Ar, FPmxVertex& Value);
+FArchive& operator<<(FArchive& Ar, FPmxTexture& Value);
+FArchive& operator<<(FArchive& Ar, FPmxMaterial& Value);
+FArchive& operator<<(FArchive& Ar, FPmxBone::FPmxIKLink& Value);
+FArchive& operator<<(FArchive& Ar, FPmxBone& Value);
+FArchive& operator<<(FArchive& Ar, FPmxVertexMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxUVMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxBoneMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxMaterialMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxGroupMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxMorph& Value);
+FArchive& operator<<(FArchive& Ar, FPmxDisplayFrame::FPmxDisplayElement& Value);
+FArchive& operator<<(FArchive& Ar, FPmxDisplayFrame& Value);
+FArchive& operator<<(FArchive& Ar, FPmxRigidBody& Value);
+FArchive& operator<<(FArchive& Ar, FPmxJoint& Value);
+FArchive& operator<<(FArchive& Ar, FPmxSoftBody& Value);
+FArchive& operator<<(FArchive& Ar, FPmxModel& Value);
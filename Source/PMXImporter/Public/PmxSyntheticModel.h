@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+/** Size and format of one synthetic PMX model */
+struct FPmxSyntheticModelSpec
+{
+	FString Name;
+
+	int32 NumVertices = 10000;
+	int32 NumMorphs = 0;
+	int32 NumBodies = 0;
+	int32 NumBones = 64;
+	int32 NumMaterials = 8;
+
+	/** Requested index width (1, 2 or 4); sections whose counts do not fit use the next width that does */
+	uint8 IndexSize = 4;
+
+	/** 0 = UTF-16, 1 = UTF-8 */
+	uint8 EncodeType = 0;
+
+	int32 Seed = 0x504D58;
+};
+
+/**
+ * PMX Synthetic Model - Deterministic scaled PMX models for the import benchmark
+ * A vertex grid skinned to bone chains with every weight type (BDEF1/2/4, SDEF), every morph type,
+ * display frames, an IK chain, rigid bodies on the chains and joints between them. Names use
+ * Japanese text so both string encodings are exercised. No textures are referenced.
+ */
+class PMXIMPORTER_API FPmxSyntheticModel
+{
+public:
+	static void Generate(const FPmxSyntheticModelSpec& Spec, FPmxModel& OutModel);
+};
@@ -18,6 +18,12 @@ struct FPmxModel;
 struct FPmxRigidBody;
 struct FPmxJoint;
 struct FPmxBone;
+struct FPmxBoneNameOptions;
+struct FPmxSkeletonLayout;
+struct FPmxRigDescription;
+struct FPmxSdefDescription;
+struct FPmxDisplayDescription;
+struct FPmxImportSession;
 
 // Physics Type 2 handling mode for PMX rigid bodies
 UENUM()
@@ -28,6 +34,18 @@ enum class EPmxPhysicsType2Handling : uint8
 	Skip                 // Skip Type 2 bodies entirely
 };
 
+// PMX additional UV channels kept as mesh UV channels (bit flags)
+UENUM(meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EPmxAddUVChannel : uint8
+{
+	None = 0 UMETA(Hidden),
+	AddUV1 = 1 << 0 UMETA(DisplayName = "AddUV1"),
+	AddUV2 = 1 << 1 UMETA(DisplayName = "AddUV2"),
+	AddUV3 = 1 << 2 UMETA(DisplayName = "AddUV3"),
+	AddUV4 = 1 << 3 UMETA(DisplayName = "AddUV4")
+};
+ENUM_CLASS_FLAGS(EPmxAddUVChannel);
+
 // Constraint configuration mode
 UENUM(BlueprintType)
 enum class EPmxConstraintMode : uint8
@@ -58,7 +76,7 @@ struct FPmxImportOptions
     bool bImportMorphs = true;
     
     UPROPERTY()
-    bool bImportDisplay = false; // Less critical for UE
+    bool bImportDisplay = true;
     
     // Data cleaning options
     UPROPERTY()
@@ -66,7 +84,11 @@ struct FPmxImportOptions
     
     UPROPERTY()
     bool bRemoveDoubles = true;
-    
+
+    // Influence cap of the generated LOD payloads (set by UPmxPipeline::GenerateMeshLods)
+    UPROPERTY()
+    int32 LodMaxInfluences = 0;
+
     // Scale and coordinate options
     UPROPERTY()
     float Scale = 8.0f;
@@ -78,9 +100,13 @@ struct FPmxImportOptions
     UPROPERTY()
     float SharpEdgeAngle = 179.0f; // degrees
     
-    // Additional UV options
+    // Additional UV options (set by UPmxPipeline::UpdateAddUVOptions)
     UPROPERTY()
     bool bImportAddUV2AsVertexColors = false;
+
+    // EPmxAddUVChannel mask (FPmxVertexStreams)
+    UPROPERTY()
+    int32 AddUVChannels = 0;
     
     // Material options
     UPROPERTY()
@@ -106,6 +132,14 @@ struct FPmxImportOptions
     UPROPERTY()
     bool bRenameLRBones = false;
 
+    // Translate MMD standard bone names (Japanese -> English) at translate time
+    UPROPERTY()
+    bool bTranslateBoneNames = false;
+
+    // Effective rename table (standard table when bTranslateBoneNames, then user overrides)
+    UPROPERTY()
+    TMap<FString, FString> BoneRenameTable;
+
     // Physics options
     UPROPERTY()
     EPmxPhysicsType2Handling PhysicsType2Mode = EPmxPhysicsType2Handling::ConvertToKinematic;
@@ -158,6 +192,8 @@ struct FPmxPhysicsCache
     TArray<FPmxRigidBody> RigidBodies;
     TArray<FPmxJoint> Joints;
     TArray<FPmxBone> Bones;
+    // Final skeleton bone names (parallel to Bones), resolved once at translate time
+    TArray<FString> BoneNames;
     FString SourceFilePath;
     float Scale = 8.0f;
     EPmxPhysicsType2Handling Type2Mode = EPmxPhysicsType2Handling::ConvertToKinematic;
@@ -235,18 +271,18 @@ public:
     virtual TOptional<UE::Interchange::FMeshPayloadData> GetMeshPayloadData(const FInterchangeMeshPayLoadKey& PayLoadKey, const UE::Interchange::FAttributeStorage& PayloadAttributes) const override;
     virtual TOptional<UE::Interchange::FImportImage> GetTexturePayloadData(const FString& PayloadKey, TOptional<FString>& AlternateTexturePath) const override;
 
-    // Static cache for PMX geometry per import session
-    static TMap<FString, TSharedPtr<FPmxModel>> MeshPayloadCache;
-
-    // Static cache for PMX physics data (used in post-import callback)
-    static TMap<FString, TSharedPtr<FPmxPhysicsCache>> PhysicsPayloadCache;
+    // Unregisters the import session; the pipeline keeps its own reference until post-import is done
+    virtual void ReleaseSource() override;
 
 private:
-    // Import options
-    mutable FPmxImportOptions ImportOptions;
+    // Per-import state (options, cleaned model and post-import caches), created by Translate() and shared with the pipeline
+    mutable TSharedPtr<FPmxImportSession> Session;
     
     // Core execution method
-    bool ExecutePmxImport(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const;
+    bool ExecutePmxImport(FPmxModel&& CleanedModel, const TMap<int32, int32>& VertexMap, UInterchangeBaseNodeContainer& BaseNodeContainer) const;
+    
+    // Cleaning, welding and morph name fixes (the form stored in the model cache)
+    void BuildTranslatedModel(FPmxModel& PmxModel, TMap<int32, int32>& OutVertexMap) const;
     
     // Data cleaning methods
     void CleanPmxModel(FPmxModel& PmxModel, bool bMeshOnly) const;
@@ -273,13 +309,12 @@ private:
     
     // Helper methods for armature import  
     void CreateBoneHierarchy(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer,
-                           UInterchangeSceneNode* RootNode, TMap<int32, UInterchangeSceneNode*>& OutBoneNodes, FString& OutRootJointUid) const;
-    void ApplyIKConstraints(const FPmxModel& PmxModel, const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const;
-    void ApplyBoneTransforms(const FPmxModel& PmxModel, const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const;
+                           UInterchangeSceneNode* RootNode, TArray<UInterchangeSceneNode*>& OutBoneNodes, FString& OutRootJointUid) const;
+    void ImportRigSection(const FPmxModel& PmxModel, const FPmxSkeletonLayout& Layout) const;
     
     // Helper methods for physics import
     void ImportRigidBodies(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer, 
-                          const TMap<int32, UInterchangeSceneNode*>& BoneNodes) const;
+                          const TArray<UInterchangeSceneNode*>& BoneNodes) const;
     void ImportJoints(const FPmxModel& PmxModel, UInterchangeBaseNodeContainer& BaseNodeContainer) const;
     
     // Helper methods for morph import
@@ -298,10 +333,8 @@ private:
     FString GetMorphCategoryName(uint8 ControlPanel) const;
     FString SafeObjectName(const FString& Name, int32 MaxLength = 59) const;
     void FixRepeatedMorphNames(FPmxModel& PmxModel) const;
+    FPmxBoneNameOptions GetBoneNameOptions() const;
     
-    // Logging and timing
-    mutable double ImportStartTime = 0.0;
-    void LogImportStart(const FString& SectionName) const;
-    void LogImportComplete(const FString& SectionName) const;
+    // Logging
     void LogImportSummary(const FPmxModel& PmxModel) const;
 };
\ No newline at end of file
@@ -5,6 +5,18 @@
 #include "CoreMinimal.h"
 #include "PmxStructs.h"
 
+/**
+ * Bone name transforms applied once at translate time by FPmxUtils::BuildUniqueBoneNames
+ */
+struct FPmxBoneNameOptions
+{
+	/** Rename 左/右 prefixed bones to the UE _L/_R suffix convention */
+	bool bRenameLRBones = false;
+
+	/** Optional rename table (source name -> final name), e.g. Japanese standard bone names to English. Not owned. */
+	const TMap<FString, FString>* RenameTable = nullptr;
+};
+
 /**
  * PMX Utility Functions - Static helper functions used across PMX importer
  * Separated for better code organization and reusability
@@ -69,6 +81,25 @@ public:
 	 * Examples:
 	 *   Input bones: ["左腕", "右腕", "左腕", "センター"]
 	 *   Output: ["左腕", "右腕", "左腕_1", "センター"]
+	 *   Output (bRenameLRBones): ["腕_L", "腕_R", "腕_L_1", "センター"]
+	 *
+	 * @param Options Optional name transforms (L/R suffixing, rename table) applied before uniquifying
+	 */
+	static TArray<FString> BuildUniqueBoneNames(const FPmxModel& Model, const FPmxBoneNameOptions& Options = FPmxBoneNameOptions());
+
+	/**
+	 * Apply the L/R and rename table transforms to a single (trimmed) bone name
+	 * Full-name table entries win; otherwise a 左/右 prefix is split off, the remainder translated and re-suffixed.
+	 */
+	static FString ApplyBoneNameTransforms(const FString& InName, const FPmxBoneNameOptions& Options);
+
+	/** Rename table entry for a bone name: exact spelling first, then with full-width digits and letters folded to half-width */
+	static const FString* FindRenameTableEntry(const TMap<FString, FString>& RenameTable, const FString& Name);
+
+	/**
+	 * Built-in rename table for MMD standard bone names (Japanese -> English)
+	 * Entries are side-less; 左/右 prefixed bones are translated through their remainder.
+	 * Keys use half-width digits and letters; names spelled with full-width ones ("上半身３", "足ＩＫ") match as well.
 	 */
-	static TArray<FString> BuildUniqueBoneNames(const FPmxModel& Model);
+	static const TMap<FString, FString>& GetStandardBoneRenameTable();
 };
\ No newline at end of file
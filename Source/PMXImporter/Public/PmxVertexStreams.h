@@ -0,0 +1,48 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+/** Placement of one kept PMX additional UV (float4) in the mesh UV channels */
+struct FPmxAddUVStream
+{
+	int32 AddUVIndex = INDEX_NONE;
+
+	/** UV channel receiving xy */
+	int32 Channel = INDEX_NONE;
+
+	/** UV channel receiving zw, or INDEX_NONE if zw is zero on every vertex */
+	int32 ZWChannel = INDEX_NONE;
+};
+
+/**
+ * PMX Vertex Streams - Additional UV and vertex color layout of the mesh payload
+ * Each selected AddUV channel becomes one UV channel (xy), plus a second one (zw) only if any vertex uses zw, so
+ * unused data does not widen the vertex buffer. Channels are assigned after UV0 and the packed SDEF channels and
+ * stop at the engine's UV channel limit. AddUV2 can also be quantized to RGBA8 vertex colors.
+ */
+class PMXIMPORTER_API FPmxVertexStreams
+{
+public:
+	/** Additional UV channels a PMX file can carry */
+	static constexpr int32 MaxAddUV = 4;
+
+	/** Additional UV imported as vertex colors (AddUV2) */
+	static constexpr int32 ColorAddUVIndex = 1;
+
+	/**
+	 * Assign UV channels to the additional UVs selected by ChannelMask (bit n = AddUV n+1)
+	 * @param FirstChannel	First free UV channel
+	 * @return Number of UV channels the payload needs (at least FirstChannel)
+	 */
+	static int32 BuildAddUVLayout(const FPmxModel& PmxModel, int32 ChannelMask, int32 FirstChannel, TArray<FPmxAddUVStream>& OutStreams);
+
+	/** Quantize float4 values (clamped to [0, 1]) to RGBA8 with one SIMD register per value */
+	static void ConvertToColors(TConstArrayView<FVector4f> Values, TArrayView<FColor> OutColors);
+
+	/** Additional UV AddUVIndex of every vertex as RGBA8 (opaque black where the vertex has none) */
+	static void BuildVertexColors(const FPmxModel& PmxModel, int32 AddUVIndex, TArray<FColor>& OutColors);
+};
@@ -0,0 +1,127 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+struct FPmxVmdMotion;
+struct FReferenceSkeleton;
+class USkeleton;
+class UAnimSequence;
+class UPmxRigDefinition;
+struct FPmxRigDescription;
+
+/**
+ * Maps VMD bone/IK names onto a skeleton
+ * Lookup order: exact skeleton bone name, original PMX name recorded in the rig, then the importer's
+ * standard rename table (with and without L/R suffixing). Build once per skeleton and reuse across motions.
+ */
+class PMXIMPORTER_API FPmxVmdBoneNameIndex
+{
+public:
+	void Build(const FReferenceSkeleton& RefSkeleton, const UPmxRigDefinition* RigDefinition);
+
+	/** Skeleton bone index for a VMD bone name, or INDEX_NONE */
+	int32 FindBoneIndex(const FString& VmdName) const;
+
+	bool IsEmpty() const { return BoneIndexByName.Num() == 0; }
+
+	/** Rig generated at import for a skeleton (asset registry lookup), or null */
+	static UPmxRigDefinition* FindRigForSkeleton(const USkeleton* Skeleton);
+
+private:
+	TMap<FString, int32> BoneIndexByName;
+};
+
+struct FPmxVmdBakeSettings
+{
+	/** PMX unit to UE unit scale (must match the mesh import) */
+	float ImportScale = 8.0f;
+
+	/** Resample rate; MMD motions are authored at 30 fps */
+	int32 FrameRate = 30;
+
+	/** Import morph keys as (morph target) float curves */
+	bool bImportMorphCurves = true;
+
+	/** Import IK toggles as stepped PMX_IKDisabled_<Bone> curves (1 = disabled) */
+	bool bImportIKToggleCurves = true;
+
+	/** Tracks within these tolerances of the reference pose are dropped */
+	float PositionTolerance = 0.01f;
+	float RotationTolerance = 1.e-4f;
+
+	/** Curve keys reproducible by their neighbours within this tolerance are removed */
+	float CurveTolerance = 1.e-3f;
+};
+
+struct FPmxVmdBakedBoneTrack
+{
+	FName BoneName;
+	TArray<FVector3f> Positions;
+	TArray<FQuat4f> Rotations;
+};
+
+struct FPmxVmdBakedCurve
+{
+	FName Name;
+	TArray<FRichCurveKey> Keys;
+	bool bMorphTarget = false;
+};
+
+/** Resampled motion ready to be written into an animation sequence */
+struct FPmxVmdBakedAnimation
+{
+	int32 NumKeys = 0;
+	int32 FrameRate = 30;
+
+	TArray<FPmxVmdBakedBoneTrack> BoneTracks;
+	TArray<FPmxVmdBakedCurve> Curves;
+
+	// Statistics
+	int32 NumConstantTracks = 0;
+	int32 NumRemovedCurveKeys = 0;
+	TArray<FString> UnmappedBones;
+};
+
+/**
+ * VMD Animation Builder - Resamples VMD motions onto a skeleton and writes them into animation sequences
+ * Separated from the factory so batch tools can bake off the game thread.
+ */
+class PMXIMPORTER_API FPmxVmdAnimationBuilder
+{
+public:
+	/**
+	 * Resample bone tracks (Bezier interpolated, in parallel per track) and reduce morph / IK curves
+	 * Thread safe; touches no UObjects.
+	 *
+	 * @param RefSkeleton	Target skeleton (rest pose the VMD offsets are relative to)
+	 * @param NameIndex		Name index built for the same skeleton
+	 * @return False if nothing in the motion maps onto the skeleton
+	 */
+	static bool BakeMotion(
+		const FPmxVmdMotion& Motion,
+		const FReferenceSkeleton& RefSkeleton,
+		const FPmxVmdBoneNameIndex& NameIndex,
+		const FPmxVmdBakeSettings& Settings,
+		FPmxVmdBakedAnimation& OutBaked
+	);
+
+	/**
+	 * Evaluate the PMX rig (append links and IK) on every baked frame and write the result back as FK tracks
+	 * IK toggle curves are applied per frame and removed. Thread safe; the sequence then plays without the PMX Rig node.
+	 */
+	static bool BakeRig(
+		const FPmxRigDescription& RigDescription,
+		const FReferenceSkeleton& RefSkeleton,
+		const FPmxVmdBakeSettings& Settings,
+		FPmxVmdBakedAnimation& InOutBaked
+	);
+
+	/** Replace the data model of a sequence with the baked motion (game thread) */
+	static bool ApplyToSequence(UAnimSequence* Sequence, const FPmxVmdBakedAnimation& Baked);
+
+	/** Evaluate an MMD interpolation curve (control points in 0..127) at T in [0, 1] */
+	static float EvaluateBezier(const uint8 ControlPoints[4], float T);
+};
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "PmxVmdBatchCommandlet.generated.h"
+
+/**
+ * Converts a directory of VMD motions into animation sequences of one PMX skeletal mesh
+ * Parsing, rig baking and key reduction run on a bounded worker pool; packages are created and saved on the main thread.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe <Project> -run=PmxVmdBatch -Mesh=/Game/Models/Miku -Source=D:/Motions -Dest=/Game/Motions
+ *       [-Workers=N] [-FrameRate=30] [-BakeIK] [-NoMorphs] [-Report=<Csv path>]
+ */
+UCLASS()
+class UPmxVmdBatchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPmxVmdBatchCommandlet();
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
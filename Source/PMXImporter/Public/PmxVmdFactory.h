@@ -0,0 +1,57 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Factories/Factory.h"
+#include "PmxVmdFactory.generated.h"
+
+class USkeleton;
+class UPmxRigDefinition;
+
+/**
+ * Imports VMD (MikuMikuDance motion) files as animation sequences of a PMX skeleton
+ * Bone names are retargeted through the PMX rig of the skeleton when one exists.
+ */
+UCLASS(hidecategories = Object)
+class PMXIMPORTER_API UPmxVmdFactory : public UFactory
+{
+	GENERATED_BODY()
+
+public:
+	UPmxVmdFactory(const FObjectInitializer& ObjectInitializer);
+
+	/** Skeleton to import onto (asked for interactively when unset) */
+	UPROPERTY(EditAnywhere, Category = "VMD")
+	TObjectPtr<USkeleton> TargetSkeleton;
+
+	/** Rig used to resolve original PMX bone names (found from the skeleton when unset) */
+	UPROPERTY(EditAnywhere, Category = "VMD")
+	TObjectPtr<UPmxRigDefinition> RigDefinition;
+
+	/** Import morph keys as morph target curves */
+	UPROPERTY(EditAnywhere, Category = "VMD")
+	bool bImportMorphCurves = true;
+
+	/** Import IK toggles as PMX_IKDisabled_<Bone> curves (read by the PMX Rig anim node) */
+	UPROPERTY(EditAnywhere, Category = "VMD")
+	bool bImportIKToggleCurves = true;
+
+	/** Resample rate of the imported sequence */
+	UPROPERTY(EditAnywhere, Category = "VMD", meta = (ClampMin = "1", ClampMax = "120"))
+	int32 FrameRate = 30;
+
+	//~ Begin UFactory Interface
+	virtual bool FactoryCanImport(const FString& Filename) override;
+	virtual UObject* FactoryCreateFile(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags,
+		const FString& Filename, const TCHAR* Parms, FFeedbackContext* Warn, bool& bOutOperationCanceled) override;
+	virtual void CleanUp() override;
+	//~ End UFactory Interface
+
+private:
+	/** Modal skeleton picker; null if cancelled */
+	USkeleton* PickSkeleton() const;
+
+	/** Skeleton chosen for the current multi-file import (asked once) */
+	TWeakObjectPtr<USkeleton> SessionSkeleton;
+};
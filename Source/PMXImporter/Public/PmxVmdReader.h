@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxVmdMotion;
+
+/**
+ * VMD (MikuMikuDance motion) reader utility functions
+ */
+namespace PMXVmdReader
+{
+	/**
+	 * Load VMD motion from file
+	 * @param FilePath Path to the VMD file
+	 * @param OutMotion Output motion (keys grouped per bone/morph track, sorted by frame)
+	 * @return true if successful, false otherwise
+	 */
+	PMXIMPORTER_API bool LoadVmdFromFile(const FString& FilePath, FPmxVmdMotion& OutMotion);
+
+	/**
+	 * Load VMD motion from binary data
+	 * @param Data Binary VMD data
+	 * @param OutMotion Output motion
+	 * @return true if successful, false otherwise
+	 */
+	PMXIMPORTER_API bool LoadVmdFromData(TArrayView<const uint8> Data, FPmxVmdMotion& OutMotion);
+
+	/**
+	 * Decode a fixed-size, NUL padded Shift-JIS name field
+	 * Uses the OS code page converter on Windows and Mac and ICU elsewhere.
+	 * @return False if the name is not ASCII and could not be decoded (OutName then has '?' for every non-ASCII byte)
+	 */
+	PMXIMPORTER_API bool DecodeShiftJis(const uint8* Bytes, int32 MaxBytes, FString& OutName);
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * VMD (MikuMikuDance motion) data structures
+ * Keys are grouped into one track per bone/morph name while the file is streamed, sorted by frame.
+ */
+
+/** Bone key: local offset from the rest pose and rotation, in PMX space */
+struct FPmxVmdBoneKey
+{
+	uint32 Frame = 0;
+	FVector3f Position = FVector3f::ZeroVector;
+	FQuat4f Rotation = FQuat4f::Identity;
+
+	/** Bezier control points (x1, y1, x2, y2 in 0..127) for the X, Y, Z and rotation channels */
+	uint8 Interpolation[4][4] = {};
+};
+
+struct FPmxVmdBoneTrack
+{
+	FString Name;
+	TArray<FPmxVmdBoneKey> Keys;
+};
+
+struct FPmxVmdMorphKey
+{
+	uint32 Frame = 0;
+	float Weight = 0.0f;
+};
+
+struct FPmxVmdMorphTrack
+{
+	FString Name;
+	TArray<FPmxVmdMorphKey> Keys;
+};
+
+struct FPmxVmdCameraKey
+{
+	uint32 Frame = 0;
+	float Distance = 0.0f;
+	FVector3f Position = FVector3f::ZeroVector;
+	FVector3f Rotation = FVector3f::ZeroVector;
+
+	/** Raw Bezier control points for X, Y, Z, rotation, distance and FOV */
+	uint8 Interpolation[24] = {};
+
+	uint32 FieldOfView = 30;
+	bool bOrthographic = false;
+};
+
+struct FPmxVmdLightKey
+{
+	uint32 Frame = 0;
+	FLinearColor Color = FLinearColor::White;
+	FVector3f Direction = FVector3f::ZeroVector;
+};
+
+struct FPmxVmdSelfShadowKey
+{
+	uint32 Frame = 0;
+	uint8 Mode = 0;
+	float Distance = 0.0f;
+};
+
+/** IK enable state of one IK bone at a property key */
+struct FPmxVmdIKState
+{
+	FString Name;
+	bool bEnabled = true;
+};
+
+/** Property key: model visibility and IK toggles */
+struct FPmxVmdPropertyKey
+{
+	uint32 Frame = 0;
+	bool bVisible = true;
+	TArray<FPmxVmdIKState> IKStates;
+};
+
+struct FPmxVmdMotion
+{
+	/** Model the motion was recorded against */
+	FString ModelName;
+
+	TArray<FPmxVmdBoneTrack> BoneTracks;
+	TArray<FPmxVmdMorphTrack> MorphTracks;
+	TArray<FPmxVmdCameraKey> CameraKeys;
+	TArray<FPmxVmdLightKey> LightKeys;
+	TArray<FPmxVmdSelfShadowKey> SelfShadowKeys;
+	TArray<FPmxVmdPropertyKey> PropertyKeys;
+
+	int32 NumBoneKeys = 0;
+	int32 NumMorphKeys = 0;
+
+	/** Last keyed frame over bone, morph and property keys */
+	uint32 MaxFrame = 0;
+
+	bool IsCameraMotion() const { return BoneTracks.Num() == 0 && MorphTracks.Num() == 0 && CameraKeys.Num() > 0; }
+};
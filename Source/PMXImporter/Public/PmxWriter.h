@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPmxModel;
+
+/**
+ * PMX file writer utility functions
+ * Writes the layout PMXReader reads: string encoding and index widths come from the model header.
+ * Used by the benchmark corpus generator and for round-trip checks; soft bodies are not written.
+ */
+namespace PMXWriter
+{
+	/**
+	 * Save PMX model to binary data
+	 * @param Model Model to write (header index sizes must fit every index in the model)
+	 * @param OutData Output PMX data
+	 * @return true if successful, false if an index does not fit its header width
+	 */
+	PMXIMPORTER_API bool SavePmxToData(const FPmxModel& Model, TArray<uint8>& OutData);
+
+	/**
+	 * Save PMX model to file
+	 * @param Model Model to write
+	 * @param FilePath Path of the PMX file to write
+	 * @return true if successful, false otherwise
+	 */
+	PMXIMPORTER_API bool SavePmxToFile(const FPmxModel& Model, const FString& FilePath);
+
+	/** Smallest PMX index width (1, 2 or 4 bytes) that holds Count elements */
+	PMXIMPORTER_API uint8 GetRequiredIndexSize(int32 Count);
+}
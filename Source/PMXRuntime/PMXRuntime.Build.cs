@@ -0,0 +1,18 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class PMXRuntime : ModuleRules
+{
+    public PMXRuntime(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(new string[]
+        {
+            "Core",
+            "CoreUObject",
+            "Engine",
+        });
+    }
+}
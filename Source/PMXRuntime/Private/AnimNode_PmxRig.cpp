@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "AnimNode_PmxRig.h"
+#include "PmxRigDefinition.h"
+#include "Animation/AnimInstanceProxy.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_PmxRig)
+
+void FAnimNode_PmxRig::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	FAnimNode_Base::Initialize_AnyThread(Context);
+	Source.Initialize(Context);
+}
+
+void FAnimNode_PmxRig::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	Source.CacheBones(Context);
+
+	// Required bones changed (LOD, mesh): rebind the flat solver arrays to the new compact pose
+	BindRig(Context.AnimInstanceProxy->GetRequiredBones());
+}
+
+void FAnimNode_PmxRig::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	GetEvaluateGraphExposedInputs().Execute(Context);
+	Source.Update(Context);
+
+	if (BoundRig.Get() != RigDefinition)
+	{
+		BindRig(Context.AnimInstanceProxy->GetRequiredBones());
+	}
+
+	ApplyIKToggles();
+}
+
+void FAnimNode_PmxRig::Evaluate_AnyThread(FPoseContext& Output)
+{
+	Source.Evaluate(Output);
+
+	if (!Evaluator.IsInitialized())
+	{
+		return;
+	}
+
+	int32 FirstStep = 0;
+	int32 LastStep = Evaluator.GetNumSteps();
+	if (Phase == EPmxRigEvaluationPhase::BeforePhysics)
+	{
+		LastStep = Evaluator.GetNumBeforePhysicsSteps();
+	}
+	else if (Phase == EPmxRigEvaluationPhase::AfterPhysics)
+	{
+		FirstStep = Evaluator.GetNumBeforePhysicsSteps();
+	}
+
+	// IK toggles keyed in the incoming motion disable chains for this evaluation only
+	TArray<int32, TInlineAllocator<16>> CurveDisabledChains;
+	if (bEnableIK)
+	{
+		for (const TPair<int32, FName>& IKCurve : IKCurves)
+		{
+			if (Evaluator.IsIKChainEnabled(IKCurve.Key) && Output.Curve.Get(IKCurve.Value) > 0.5f)
+			{
+				Evaluator.SetIKChainEnabled(IKCurve.Key, false);
+				CurveDisabledChains.Add(IKCurve.Key);
+			}
+		}
+	}
+
+	TArrayView<FTransform> LocalPose = Output.Pose.GetMutableBones();
+	Evaluator.Evaluate(LocalPose, FirstStep, LastStep);
+
+	for (const int32 ChainIndex : CurveDisabledChains)
+	{
+		Evaluator.SetIKChainEnabled(ChainIndex, true);
+	}
+}
+
+void FAnimNode_PmxRig::GatherDebugData(FNodeDebugData& DebugData)
+{
+	FString DebugLine = DebugData.GetNodeName(this);
+	DebugLine += FString::Printf(TEXT("(Rig: %s, Steps: %d)"), RigDefinition ? *RigDefinition->GetName() : TEXT("None"), Evaluator.GetNumSteps());
+	DebugData.AddDebugItem(DebugLine);
+
+	Source.GatherDebugData(DebugData);
+}
+
+void FAnimNode_PmxRig::ApplyIKToggles()
+{
+	if (!RigDefinition)
+	{
+		return;
+	}
+
+	const int32 NumChains = RigDefinition->Description.IKChains.Num();
+	for (int32 ChainIndex = 0; ChainIndex < NumChains; ++ChainIndex)
+	{
+		Evaluator.SetIKChainEnabled(ChainIndex, bEnableIK);
+	}
+	for (const FName& BoneName : DisabledIKBones)
+	{
+		Evaluator.SetIKChainEnabled(Evaluator.FindIKChainByBoneName(BoneName), false);
+	}
+}
+
+void FAnimNode_PmxRig::BindRig(const FBoneContainer& RequiredBones)
+{
+	Evaluator.Reset();
+	IKCurves.Reset();
+	BoundRig = RigDefinition;
+	if (!RigDefinition || RigDefinition->Description.IsEmpty())
+	{
+		return;
+	}
+
+	const FPmxRigDescription& Description = RigDefinition->Description;
+	if (!Evaluator.Initialize(Description, RequiredBones))
+	{
+		return;
+	}
+
+	for (const FPmxRigIKChain& Chain : Description.IKChains)
+	{
+		// Chains with a bad bone index (stale or edited rig asset) are already disabled by the evaluator
+		if (!Description.Bones.IsValidIndex(Chain.IKBoneIndex))
+		{
+			continue;
+		}
+		const FName IKBoneName = Description.Bones[Chain.IKBoneIndex].Name;
+		const int32 ChainIndex = Evaluator.FindIKChainByBoneName(IKBoneName);
+		if (ChainIndex != INDEX_NONE)
+		{
+			IKCurves.Emplace(ChainIndex, FPmxRigDescription::GetIKDisabledCurveName(IKBoneName));
+		}
+	}
+}
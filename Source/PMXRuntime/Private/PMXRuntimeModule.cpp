@@ -0,0 +1,8 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+#include "LogPMXRuntime.h"
+
+DEFINE_LOG_CATEGORY(LogPMXRuntime);
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, PMXRuntime);
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxDisplayData.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/MorphTarget.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxDisplayData)
+
+int32 UPmxDisplayUserData::BuildLookupTables(const USkeletalMesh& SkeletalMesh)
+{
+	const FReferenceSkeleton& RefSkeleton = SkeletalMesh.GetRefSkeleton();
+	const TArray<TObjectPtr<UMorphTarget>>& MorphTargets = SkeletalMesh.GetMorphTargets();
+
+	TMap<FName, int32> MorphIndexByName;
+	MorphIndexByName.Reserve(MorphTargets.Num());
+	for (int32 MorphIndex = 0; MorphIndex < MorphTargets.Num(); ++MorphIndex)
+	{
+		if (MorphTargets[MorphIndex])
+		{
+			MorphIndexByName.Add(MorphTargets[MorphIndex]->GetFName(), MorphIndex);
+		}
+	}
+
+	GroupByBone.Init(INDEX_NONE, RefSkeleton.GetNum());
+	GroupByMorph.Init(INDEX_NONE, MorphTargets.Num());
+
+	int32 NumMissing = 0;
+	for (int32 GroupIndex = 0; GroupIndex < Description.Groups.Num(); ++GroupIndex)
+	{
+		FPmxDisplayGroup& Group = Description.Groups[GroupIndex];
+
+		Group.BoneIndices.Reset(Group.Bones.Num());
+		for (const FName BoneName : Group.Bones)
+		{
+			const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+			if (BoneIndex == INDEX_NONE)
+			{
+				++NumMissing;
+				continue;
+			}
+			Group.BoneIndices.Add(BoneIndex);
+			if (GroupByBone[BoneIndex] == INDEX_NONE)
+			{
+				GroupByBone[BoneIndex] = GroupIndex;
+			}
+		}
+
+		Group.MorphIndices.Reset(Group.Morphs.Num());
+		for (const FName MorphName : Group.Morphs)
+		{
+			const int32* MorphIndex = MorphIndexByName.Find(MorphName);
+			if (!MorphIndex)
+			{
+				++NumMissing;
+				continue;
+			}
+			Group.MorphIndices.Add(*MorphIndex);
+			if (GroupByMorph[*MorphIndex] == INDEX_NONE)
+			{
+				GroupByMorph[*MorphIndex] = GroupIndex;
+			}
+		}
+	}
+
+	return NumMissing;
+}
+
+int32 UPmxDisplayUserData::FindGroup(const FString& GroupName) const
+{
+	return Description.Groups.IndexOfByPredicate([&GroupName](const FPmxDisplayGroup& Group)
+	{
+		return Group.Name == GroupName || (!Group.NameEng.IsEmpty() && Group.NameEng.Equals(GroupName, ESearchCase::IgnoreCase));
+	});
+}
@@ -0,0 +1,5 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxImportManifest.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PmxImportManifest)
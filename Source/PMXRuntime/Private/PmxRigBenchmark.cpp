@@ -0,0 +1,110 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Animation/Skeleton.h"
+#include "Math/RandomStream.h"
+#include "LogPMXRuntime.h"
+#include "PmxRigDefinition.h"
+#include "PmxRigEvaluator.h"
+
+namespace PmxRigBenchmark
+{
+	/**
+	 * PMX.Rig.Benchmark <RigAssetPath> [Characters=20] [Frames=300]
+	 * Evaluates the rig on every character each frame with moving IK goals and reports the solver cost
+	 * in microseconds per character per frame. Pose setup is excluded from the timing.
+	 */
+	static void Run(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogPMXRuntime, Display, TEXT("Usage: PMX.Rig.Benchmark <RigAssetPath> [Characters=20] [Frames=300]"));
+			return;
+		}
+
+		UPmxRigDefinition* Rig = LoadObject<UPmxRigDefinition>(nullptr, *Args[0]);
+		USkeleton* Skeleton = Rig ? Rig->Skeleton.LoadSynchronous() : nullptr;
+		if (!Rig || !Skeleton)
+		{
+			UE_LOG(LogPMXRuntime, Warning, TEXT("PMX.Rig.Benchmark: Failed to load rig '%s' or its skeleton"), *Args[0]);
+			return;
+		}
+
+		const int32 NumCharacters = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+		const int32 NumFrames = Args.IsValidIndex(2) ? FMath::Max(1, FCString::Atoi(*Args[2])) : 300;
+		const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+		const TArray<FTransform>& RefPose = RefSkeleton.GetRefBonePose();
+
+		// IK goal bones that get animated
+		TArray<int32> GoalBones;
+		for (const FPmxRigIKChain& Chain : Rig->Description.IKChains)
+		{
+			if (Rig->Description.Bones.IsValidIndex(Chain.IKBoneIndex))
+			{
+				const int32 SkeletonIndex = RefSkeleton.FindBoneIndex(Rig->Description.Bones[Chain.IKBoneIndex].Name);
+				if (SkeletonIndex != INDEX_NONE)
+				{
+					GoalBones.AddUnique(SkeletonIndex);
+				}
+			}
+		}
+
+		TArray<FPmxRigEvaluator> Evaluators;
+		TArray<TArray<FTransform>> Poses;
+		TArray<float> Phases;
+		Evaluators.SetNum(NumCharacters);
+		Poses.SetNum(NumCharacters);
+		Phases.SetNumUninitialized(NumCharacters);
+		FRandomStream Random(0x504D58);
+		for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+		{
+			if (!Evaluators[CharacterIndex].Initialize(Rig->Description, RefSkeleton))
+			{
+				UE_LOG(LogPMXRuntime, Warning, TEXT("PMX.Rig.Benchmark: Rig '%s' does not match skeleton '%s'"), *Rig->GetName(), *Skeleton->GetName());
+				return;
+			}
+			Poses[CharacterIndex] = RefPose;
+			Phases[CharacterIndex] = Random.FRandRange(0.f, UE_TWO_PI);
+		}
+
+		uint64 TotalCycles = 0;
+		uint64 MinFrameCycles = MAX_uint64;
+		uint64 MaxFrameCycles = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+			{
+				TArray<FTransform>& Pose = Poses[CharacterIndex];
+				FMemory::Memcpy(Pose.GetData(), RefPose.GetData(), RefPose.Num() * sizeof(FTransform));
+
+				const float Time = Phases[CharacterIndex] + Frame / 30.f;
+				for (const int32 GoalBone : GoalBones)
+				{
+					Pose[GoalBone].AddToTranslation(FVector(FMath::Sin(Time) * 4.0, FMath::Cos(Time * 0.7f) * 4.0, FMath::Sin(Time * 1.3f) * 6.0));
+				}
+			}
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 CharacterIndex = 0; CharacterIndex < NumCharacters; ++CharacterIndex)
+			{
+				Evaluators[CharacterIndex].Evaluate(Poses[CharacterIndex]);
+			}
+			const uint64 FrameCycles = FPlatformTime::Cycles64() - StartCycles;
+
+			TotalCycles += FrameCycles;
+			MinFrameCycles = FMath::Min(MinFrameCycles, FrameCycles);
+			MaxFrameCycles = FMath::Max(MaxFrameCycles, FrameCycles);
+		}
+
+		const double CyclesToMicroseconds = FPlatformTime::GetSecondsPerCycle64() * 1.0e6 / NumCharacters;
+		UE_LOG(LogPMXRuntime, Display, TEXT("PMX.Rig.Benchmark: %s (%d IK chains, %d append links), %d characters x %d frames: %.2f us per character per frame (min %.2f, max %.2f)"),
+			*Rig->GetName(), Rig->Description.IKChains.Num(), Rig->Description.Appends.Num(), NumCharacters, NumFrames,
+			TotalCycles * CyclesToMicroseconds / NumFrames, MinFrameCycles * CyclesToMicroseconds, MaxFrameCycles * CyclesToMicroseconds);
+	}
+
+	static FAutoConsoleCommand BenchmarkCommand(
+		TEXT("PMX.Rig.Benchmark"),
+		TEXT("Benchmark the native PMX rig solver. Usage: PMX.Rig.Benchmark <RigAssetPath> [Characters=20] [Frames=300]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
@@ -0,0 +1,490 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxRigEvaluator.h"
+#include "LogPMXRuntime.h"
+#include "ReferenceSkeleton.h"
+#include "BoneContainer.h"
+
+namespace PmxRigEvaluatorPrivate
+{
+	enum EAppendFlags : uint8
+	{
+		AppendRotation = 1 << 0,
+		AppendTranslation = 1 << 1,
+	};
+
+	static const VectorRegister IdentityRotation = MakeVectorRegisterDouble(0.0, 0.0, 0.0, 1.0);
+	static const VectorRegister ZeroVector = MakeVectorRegisterDouble(0.0, 0.0, 0.0, 0.0);
+	static const VectorRegister UnitScale = MakeVectorRegisterDouble(1.0, 1.0, 1.0, 0.0);
+
+	FORCEINLINE void LoadTransform(const FTransform& Transform, VectorRegister& OutRotation, VectorRegister& OutTranslation, VectorRegister& OutScale)
+	{
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Translation = Transform.GetTranslation();
+		const FVector Scale = Transform.GetScale3D();
+		OutRotation = VectorLoad(&Rotation.X);
+		OutTranslation = VectorLoadFloat3_W0(&Translation.X);
+		OutScale = VectorLoadFloat3_W0(&Scale.X);
+	}
+
+	/** Child local * parent component (same composition as FTransform::operator*) */
+	FORCEINLINE void Compose(
+		const VectorRegister& ParentRotation, const VectorRegister& ParentTranslation, const VectorRegister& ParentScale,
+		const VectorRegister& LocalRotation, const VectorRegister& LocalTranslation, const VectorRegister& LocalScale,
+		VectorRegister& OutRotation, VectorRegister& OutTranslation, VectorRegister& OutScale)
+	{
+		OutRotation = VectorQuaternionMultiply2(ParentRotation, LocalRotation);
+		OutTranslation = VectorAdd(VectorQuaternionRotateVector(ParentRotation, VectorMultiply(LocalTranslation, ParentScale)), ParentTranslation);
+		OutScale = VectorMultiply(ParentScale, LocalScale);
+	}
+
+	/**
+	 * Clamp a local rotation to per-axis limits (radians, rotation angles about UE X/Y/Z)
+	 * FRotator rotates by -Roll about X and -Pitch about Y, hence the sign flips.
+	 */
+	static FQuat ClampRotation(const FQuat& Rotation, const FVector3f& LimitMin, const FVector3f& LimitMax)
+	{
+		const FRotator Euler = Rotation.Rotator();
+		const double AngleX = FMath::Clamp(-FMath::DegreesToRadians(Euler.Roll), (double)LimitMin.X, (double)LimitMax.X);
+		const double AngleY = FMath::Clamp(-FMath::DegreesToRadians(Euler.Pitch), (double)LimitMin.Y, (double)LimitMax.Y);
+		const double AngleZ = FMath::Clamp(FMath::DegreesToRadians(Euler.Yaw), (double)LimitMin.Z, (double)LimitMax.Z);
+		return FRotator(-FMath::RadiansToDegrees(AngleY), FMath::RadiansToDegrees(AngleZ), -FMath::RadiansToDegrees(AngleX)).Quaternion();
+	}
+}
+
+bool FPmxRigEvaluator::Initialize(const FPmxRigDescription& Description, const FReferenceSkeleton& RefSkeleton)
+{
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(RefSkeleton.GetNum());
+	for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+	{
+		Parents[BoneIndex] = RefSkeleton.GetParentIndex(BoneIndex);
+	}
+
+	return Bind(Description, [&RefSkeleton](FName BoneName)
+	{
+		return RefSkeleton.FindBoneIndex(BoneName);
+	}, MoveTemp(Parents));
+}
+
+bool FPmxRigEvaluator::Initialize(const FPmxRigDescription& Description, const FBoneContainer& RequiredBones)
+{
+	const int32 NumCompactBones = RequiredBones.GetCompactPoseNumBones();
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(NumCompactBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumCompactBones; ++BoneIndex)
+	{
+		Parents[BoneIndex] = RequiredBones.GetParentBoneIndex(FCompactPoseBoneIndex(BoneIndex)).GetInt();
+	}
+
+	const FReferenceSkeleton& RefSkeleton = RequiredBones.GetReferenceSkeleton();
+	return Bind(Description, [&RefSkeleton, &RequiredBones](FName BoneName)
+	{
+		const int32 MeshBoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+		return MeshBoneIndex != INDEX_NONE ? RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex)).GetInt() : INDEX_NONE;
+	}, MoveTemp(Parents));
+}
+
+void FPmxRigEvaluator::Reset()
+{
+	*this = FPmxRigEvaluator();
+}
+
+bool FPmxRigEvaluator::Bind(const FPmxRigDescription& Description, TFunctionRef<int32(FName)> FindPoseIndex, TArray<int32>&& InPoseParents)
+{
+	using namespace PmxRigEvaluatorPrivate;
+
+	NumPoseBones = 0;
+	PoseParents = MoveTemp(InPoseParents);
+
+	// Bones
+	const int32 NumBones = Description.Bones.Num();
+	BoneNames.SetNumUninitialized(NumBones);
+	BonePoseIndices.SetNumUninitialized(NumBones);
+	BoneParents.SetNumUninitialized(NumBones);
+	RootPoseParents.Init(INDEX_NONE, NumBones);
+	BoneRestTranslations.SetNumUninitialized(NumBones);
+
+	int32 MatchedBones = 0;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FPmxRigBone& Bone = Description.Bones[BoneIndex];
+		BoneNames[BoneIndex] = Bone.Name;
+		BonePoseIndices[BoneIndex] = FindPoseIndex(Bone.Name);
+		BoneParents[BoneIndex] = Description.Bones.IsValidIndex(Bone.ParentIndex) ? Bone.ParentIndex : INDEX_NONE;
+		BoneRestTranslations[BoneIndex] = FVector(Bone.RestTranslation);
+
+		const int32 PoseIndex = BonePoseIndices[BoneIndex];
+		if (PoseParents.IsValidIndex(PoseIndex))
+		{
+			++MatchedBones;
+			if (BoneParents[BoneIndex] == INDEX_NONE)
+			{
+				RootPoseParents[BoneIndex] = PoseParents[PoseIndex];
+			}
+		}
+		else
+		{
+			BonePoseIndices[BoneIndex] = INDEX_NONE;
+		}
+	}
+
+	if (MatchedBones == 0)
+	{
+		UE_LOG(LogPMXRuntime, Warning, TEXT("FPmxRigEvaluator: No rig bone matches the target skeleton (%d rig bones)"), NumBones);
+		return false;
+	}
+
+	// Depth-first preorder so every subtree is a contiguous range
+	TArray<TArray<int32>> Children;
+	Children.SetNum(NumBones);
+	TArray<int32> Stack;
+	for (int32 BoneIndex = NumBones - 1; BoneIndex >= 0; --BoneIndex)
+	{
+		if (BoneParents[BoneIndex] != INDEX_NONE)
+		{
+			Children[BoneParents[BoneIndex]].Add(BoneIndex);
+		}
+		else
+		{
+			Stack.Add(BoneIndex);
+		}
+	}
+
+	Preorder.Reset(NumBones);
+	PreorderPosition.Init(INDEX_NONE, NumBones);
+	SubtreeEnd.Init(INDEX_NONE, NumBones);
+	while (Stack.Num() > 0)
+	{
+		const int32 BoneIndex = Stack.Pop(EAllowShrinking::No);
+		PreorderPosition[BoneIndex] = Preorder.Add(BoneIndex);
+		// Children were collected in descending order; push so the lowest index is visited first
+		for (const int32 Child : Children[BoneIndex])
+		{
+			Stack.Add(Child);
+		}
+	}
+	for (int32 Position = Preorder.Num() - 1; Position >= 0; --Position)
+	{
+		const int32 BoneIndex = Preorder[Position];
+		int32 End = Position + 1;
+		for (const int32 Child : Children[BoneIndex])
+		{
+			End = FMath::Max(End, SubtreeEnd[Child]);
+		}
+		SubtreeEnd[BoneIndex] = End;
+	}
+
+	// Steps
+	const int32 NumSteps = Description.Steps.Num();
+	StepTypes.SetNumUninitialized(NumSteps);
+	StepIndices.SetNumUninitialized(NumSteps);
+	for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+	{
+		StepTypes[StepIndex] = Description.Steps[StepIndex].Type;
+		StepIndices[StepIndex] = Description.Steps[StepIndex].Index;
+	}
+	NumBeforePhysicsSteps = FMath::Clamp(Description.NumBeforePhysicsSteps, 0, NumSteps);
+
+	// Append links
+	const int32 NumAppends = Description.Appends.Num();
+	AppendBones.SetNumUninitialized(NumAppends);
+	AppendTargetPoseIndices.SetNumUninitialized(NumAppends);
+	AppendSourcePoseIndices.SetNumUninitialized(NumAppends);
+	AppendSourceRestTranslations.SetNumUninitialized(NumAppends);
+	AppendRatios.SetNumUninitialized(NumAppends);
+	AppendFlags.SetNumUninitialized(NumAppends);
+	for (int32 AppendIndex = 0; AppendIndex < NumAppends; ++AppendIndex)
+	{
+		const FPmxRigAppend& Append = Description.Appends[AppendIndex];
+		const bool bValid = Description.Bones.IsValidIndex(Append.BoneIndex) && Description.Bones.IsValidIndex(Append.SourceBoneIndex);
+		AppendBones[AppendIndex] = bValid ? Append.BoneIndex : INDEX_NONE;
+		AppendTargetPoseIndices[AppendIndex] = bValid ? BonePoseIndices[Append.BoneIndex] : INDEX_NONE;
+		AppendSourcePoseIndices[AppendIndex] = bValid ? BonePoseIndices[Append.SourceBoneIndex] : INDEX_NONE;
+		AppendSourceRestTranslations[AppendIndex] = bValid ? BoneRestTranslations[Append.SourceBoneIndex] : FVector::ZeroVector;
+		AppendRatios[AppendIndex] = Append.Ratio;
+		AppendFlags[AppendIndex] = (Append.bRotation ? AppendRotation : 0) | (Append.bTranslation ? AppendTranslation : 0);
+	}
+
+	// IK chains and links
+	const int32 NumChains = Description.IKChains.Num();
+	ChainIKBones.SetNumUninitialized(NumChains);
+	ChainTargetBones.SetNumUninitialized(NumChains);
+	ChainLoopCounts.SetNumUninitialized(NumChains);
+	ChainLimitAngles.SetNumUninitialized(NumChains);
+	ChainFirstLinks.SetNumUninitialized(NumChains);
+	ChainNumLinks.SetNumUninitialized(NumChains);
+	for (int32 ChainIndex = 0; ChainIndex < NumChains; ++ChainIndex)
+	{
+		const FPmxRigIKChain& Chain = Description.IKChains[ChainIndex];
+		const bool bValid = Description.Bones.IsValidIndex(Chain.IKBoneIndex) && Description.Bones.IsValidIndex(Chain.TargetBoneIndex)
+			&& Chain.FirstLink >= 0 && Chain.FirstLink + Chain.NumLinks <= Description.IKLinks.Num();
+		ChainIKBones[ChainIndex] = bValid ? Chain.IKBoneIndex : INDEX_NONE;
+		ChainTargetBones[ChainIndex] = bValid ? Chain.TargetBoneIndex : INDEX_NONE;
+		ChainLoopCounts[ChainIndex] = bValid ? Chain.LoopCount : 0;
+		ChainLimitAngles[ChainIndex] = Chain.LimitAngle;
+		ChainFirstLinks[ChainIndex] = Chain.FirstLink;
+		ChainNumLinks[ChainIndex] = bValid ? Chain.NumLinks : 0;
+	}
+	ChainEnabled.Init(true, NumChains);
+
+	const int32 NumLinks = Description.IKLinks.Num();
+	LinkBones.SetNumUninitialized(NumLinks);
+	LinkPoseIndices.SetNumUninitialized(NumLinks);
+	LinkLimited.SetNumUninitialized(NumLinks);
+	LinkLimitMin.SetNumUninitialized(NumLinks);
+	LinkLimitMax.SetNumUninitialized(NumLinks);
+	for (int32 LinkIndex = 0; LinkIndex < NumLinks; ++LinkIndex)
+	{
+		const FPmxRigIKLink& Link = Description.IKLinks[LinkIndex];
+		const bool bValid = Description.Bones.IsValidIndex(Link.BoneIndex);
+		LinkBones[LinkIndex] = bValid ? Link.BoneIndex : INDEX_NONE;
+		LinkPoseIndices[LinkIndex] = bValid ? BonePoseIndices[Link.BoneIndex] : INDEX_NONE;
+		LinkLimited[LinkIndex] = Link.bLimitAngle ? 1 : 0;
+		LinkLimitMin[LinkIndex] = Link.LimitMin;
+		LinkLimitMax[LinkIndex] = Link.LimitMax;
+	}
+
+	// Scratch
+	ComponentRotations.Init(IdentityRotation, NumBones);
+	ComponentTranslations.Init(ZeroVector, NumBones);
+	ComponentScales.Init(UnitScale, NumBones);
+	RootParentRotations.Init(IdentityRotation, NumBones);
+	RootParentTranslations.Init(ZeroVector, NumBones);
+	RootParentScales.Init(UnitScale, NumBones);
+
+	NumPoseBones = PoseParents.Num();
+
+	UE_LOG(LogPMXRuntime, Log, TEXT("FPmxRigEvaluator: Bound %d/%d bones, %d IK chains (%d links), %d append links, %d steps"),
+		MatchedBones, NumBones, NumChains, NumLinks, NumAppends, NumSteps);
+	return true;
+}
+
+void FPmxRigEvaluator::Evaluate(TArrayView<FTransform> LocalPose)
+{
+	Evaluate(LocalPose, 0, StepTypes.Num());
+}
+
+void FPmxRigEvaluator::Evaluate(TArrayView<FTransform> LocalPose, int32 FirstStep, int32 LastStep)
+{
+	if (!IsInitialized() || LocalPose.Num() < NumPoseBones)
+	{
+		return;
+	}
+
+	const int32 EndStep = FMath::Min(LastStep, StepTypes.Num());
+	FirstStep = FMath::Max(0, FirstStep);
+	if (FirstStep >= EndStep)
+	{
+		return;
+	}
+
+	RefreshComponentSpace(LocalPose);
+
+	for (int32 StepIndex = FirstStep; StepIndex < EndStep; ++StepIndex)
+	{
+		if (StepTypes[StepIndex] == EPmxRigStepType::Append)
+		{
+			SolveAppend(LocalPose, StepIndices[StepIndex]);
+		}
+		else if (ChainEnabled[StepIndices[StepIndex]])
+		{
+			SolveIK(LocalPose, StepIndices[StepIndex]);
+		}
+	}
+}
+
+void FPmxRigEvaluator::SetIKChainEnabled(int32 ChainIndex, bool bEnabled)
+{
+	if (ChainEnabled.IsValidIndex(ChainIndex))
+	{
+		ChainEnabled[ChainIndex] = bEnabled;
+	}
+}
+
+int32 FPmxRigEvaluator::FindIKChainByBoneName(FName IKBoneName) const
+{
+	for (int32 ChainIndex = 0; ChainIndex < ChainIKBones.Num(); ++ChainIndex)
+	{
+		const int32 IKBone = ChainIKBones[ChainIndex];
+		if (IKBone != INDEX_NONE && BoneNames[IKBone] == IKBoneName)
+		{
+			return ChainIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FPmxRigEvaluator::RefreshComponentSpace(TArrayView<const FTransform> LocalPose)
+{
+	// Rig roots: accumulate the pose bones above them (usually just the synthetic Root joint)
+	for (int32 BoneIndex = 0; BoneIndex < RootPoseParents.Num(); ++BoneIndex)
+	{
+		if (BoneParents[BoneIndex] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		FTransform Accumulated = FTransform::Identity;
+		for (int32 PoseIndex = RootPoseParents[BoneIndex]; PoseIndex != INDEX_NONE; PoseIndex = PoseParents[PoseIndex])
+		{
+			Accumulated = Accumulated * LocalPose[PoseIndex];
+		}
+		PmxRigEvaluatorPrivate::LoadTransform(Accumulated, RootParentRotations[BoneIndex], RootParentTranslations[BoneIndex], RootParentScales[BoneIndex]);
+	}
+
+	for (const int32 BoneIndex : Preorder)
+	{
+		UpdateBone(LocalPose, BoneIndex);
+	}
+}
+
+void FPmxRigEvaluator::UpdateBone(TArrayView<const FTransform> LocalPose, int32 RigBoneIndex)
+{
+	using namespace PmxRigEvaluatorPrivate;
+
+	VectorRegister LocalRotation, LocalTranslation, LocalScale;
+	const int32 PoseIndex = BonePoseIndices[RigBoneIndex];
+	if (PoseIndex != INDEX_NONE)
+	{
+		LoadTransform(LocalPose[PoseIndex], LocalRotation, LocalTranslation, LocalScale);
+	}
+	else
+	{
+		LocalRotation = IdentityRotation;
+		LocalTranslation = VectorLoadFloat3_W0(&BoneRestTranslations[RigBoneIndex].X);
+		LocalScale = UnitScale;
+	}
+
+	const int32 Parent = BoneParents[RigBoneIndex];
+	if (Parent != INDEX_NONE)
+	{
+		Compose(ComponentRotations[Parent], ComponentTranslations[Parent], ComponentScales[Parent],
+			LocalRotation, LocalTranslation, LocalScale,
+			ComponentRotations[RigBoneIndex], ComponentTranslations[RigBoneIndex], ComponentScales[RigBoneIndex]);
+	}
+	else
+	{
+		Compose(RootParentRotations[RigBoneIndex], RootParentTranslations[RigBoneIndex], RootParentScales[RigBoneIndex],
+			LocalRotation, LocalTranslation, LocalScale,
+			ComponentRotations[RigBoneIndex], ComponentTranslations[RigBoneIndex], ComponentScales[RigBoneIndex]);
+	}
+}
+
+void FPmxRigEvaluator::UpdateSubtree(TArrayView<const FTransform> LocalPose, int32 RigBoneIndex)
+{
+	for (int32 Position = PreorderPosition[RigBoneIndex]; Position < SubtreeEnd[RigBoneIndex]; ++Position)
+	{
+		UpdateBone(LocalPose, Preorder[Position]);
+	}
+}
+
+void FPmxRigEvaluator::SolveAppend(TArrayView<FTransform> LocalPose, int32 AppendIndex)
+{
+	using namespace PmxRigEvaluatorPrivate;
+
+	const int32 Dst = AppendTargetPoseIndices[AppendIndex];
+	const int32 Src = AppendSourcePoseIndices[AppendIndex];
+	if (Dst == INDEX_NONE || Src == INDEX_NONE)
+	{
+		return;
+	}
+
+	FTransform& Target = LocalPose[Dst];
+	const float Ratio = AppendRatios[AppendIndex];
+	if (AppendFlags[AppendIndex] & AppendRotation)
+	{
+		// Bind rotations are identity, so the source local rotation is its rotation delta.
+		// Negative ratios apply the inverse rotation.
+		const FQuat SourceRotation = LocalPose[Src].GetRotation();
+		const FQuat AppendedRotation = Ratio >= 0.f
+			? FQuat::Slerp(FQuat::Identity, SourceRotation, Ratio)
+			: FQuat::Slerp(FQuat::Identity, SourceRotation.Inverse(), -Ratio);
+		Target.SetRotation((AppendedRotation * Target.GetRotation()).GetNormalized());
+	}
+	if (AppendFlags[AppendIndex] & AppendTranslation)
+	{
+		Target.AddToTranslation((LocalPose[Src].GetTranslation() - AppendSourceRestTranslations[AppendIndex]) * Ratio);
+	}
+
+	UpdateSubtree(LocalPose, AppendBones[AppendIndex]);
+}
+
+void FPmxRigEvaluator::SolveIK(TArrayView<FTransform> LocalPose, int32 ChainIndex)
+{
+	using namespace PmxRigEvaluatorPrivate;
+
+	const int32 IKBone = ChainIKBones[ChainIndex];
+	const int32 TargetBone = ChainTargetBones[ChainIndex];
+	if (IKBone == INDEX_NONE)
+	{
+		return;
+	}
+
+	constexpr double MinAngle = 1.0e-4;
+	constexpr double ConvergedDistanceSquared = 1.0e-6;
+	const VectorRegister Goal = ComponentTranslations[IKBone];
+	const double LimitAngle = ChainLimitAngles[ChainIndex];
+	const int32 FirstLink = ChainFirstLinks[ChainIndex];
+	const int32 EndLink = FirstLink + ChainNumLinks[ChainIndex];
+
+	for (int32 Iteration = 0; Iteration < ChainLoopCounts[ChainIndex]; ++Iteration)
+	{
+		for (int32 LinkIndex = FirstLink; LinkIndex < EndLink; ++LinkIndex)
+		{
+			const int32 PoseIndex = LinkPoseIndices[LinkIndex];
+			if (PoseIndex == INDEX_NONE)
+			{
+				continue;
+			}
+			const int32 LinkBone = LinkBones[LinkIndex];
+
+			// Rotate the link so the link->target direction points at the IK goal (in link space)
+			const VectorRegister InvLinkRotation = VectorQuaternionInverse(ComponentRotations[LinkBone]);
+			const VectorRegister LinkPosition = ComponentTranslations[LinkBone];
+			const VectorRegister ToTarget = VectorNormalizeSafe(
+				VectorQuaternionRotateVector(InvLinkRotation, VectorSubtract(ComponentTranslations[TargetBone], LinkPosition)), ZeroVector);
+			const VectorRegister ToGoal = VectorNormalizeSafe(
+				VectorQuaternionRotateVector(InvLinkRotation, VectorSubtract(Goal, LinkPosition)), ZeroVector);
+
+			double Angle = FMath::Acos(FMath::Clamp(VectorDot3Scalar(ToTarget, ToGoal), -1.0, 1.0));
+			if (Angle < MinAngle)
+			{
+				continue;
+			}
+			if (LimitAngle > 0.0)
+			{
+				Angle = FMath::Min(Angle, LimitAngle);
+			}
+
+			const VectorRegister Cross = VectorCross(ToTarget, ToGoal);
+			if (VectorDot3Scalar(Cross, Cross) < UE_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			double SinHalf, CosHalf;
+			FMath::SinCos(&SinHalf, &CosHalf, Angle * 0.5);
+			const VectorRegister Axis = VectorNormalizeAccurate(Cross);
+			const VectorRegister Delta = VectorMultiplyAdd(Axis, MakeVectorRegisterDouble(SinHalf, SinHalf, SinHalf, 0.0), MakeVectorRegisterDouble(0.0, 0.0, 0.0, CosHalf));
+
+			const FQuat LocalRotation = LocalPose[PoseIndex].GetRotation();
+			FQuat NewRotation;
+			VectorStore(VectorQuaternionMultiply2(VectorLoad(&LocalRotation.X), Delta), &NewRotation.X);
+			if (LinkLimited[LinkIndex])
+			{
+				NewRotation = ClampRotation(NewRotation, LinkLimitMin[LinkIndex], LinkLimitMax[LinkIndex]);
+			}
+			NewRotation.Normalize();
+			LocalPose[PoseIndex].SetRotation(NewRotation);
+
+			UpdateSubtree(LocalPose, LinkBone);
+		}
+
+		const VectorRegister Error = VectorSubtract(ComponentTranslations[TargetBone], Goal);
+		if (VectorDot3Scalar(Error, Error) < ConvergedDistanceSquared)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "PmxSdefDeformer.h"
+
+void FPmxSdefDeformer::ComputeCorrectiveCenters(const FVector3f& C, const FVector3f& R0, const FVector3f& R1, float Weight0, float Weight1, FVector3f& OutCR0, FVector3f& OutCR1)
+{
+	// Remove the weighted R offset so the blended sphere centers meet at C, then take the midpoints
+	const FVector3f WeightedR = R0 * Weight0 + R1 * Weight1;
+	OutCR0 = (C + (C + R0 - WeightedR)) * 0.5f;
+	OutCR1 = (C + (C + R1 - WeightedR)) * 0.5f;
+}
+
+void FPmxSdefDeformer::DeformReference(const FPmxSdefVertex& Vertex, const FMatrix44f& Skin0, const FMatrix44f& Skin1, FVector3f& OutPosition, FVector3f& OutNormal)
+{
+	const FMatrix Matrix0(Skin0);
+	const FMatrix Matrix1(Skin1);
+	const double Weight1 = Vertex.Weight1;
+	const double Weight0 = 1.0 - Weight1;
+
+	// Rotation part blended on the sphere; translation part from the corrective centers
+	const FQuat Rotation = FQuat::Slerp(FTransform(Matrix0).GetRotation(), FTransform(Matrix1).GetRotation(), Weight1);
+	const FVector Position = Rotation.RotateVector(FVector(Vertex.Position) - FVector(Vertex.C))
+		+ FVector(Matrix0.TransformPosition(FVector(Vertex.CR0))) * Weight0
+		+ FVector(Matrix1.TransformPosition(FVector(Vertex.CR1))) * Weight1;
+
+	OutPosition = FVector3f(Position);
+	OutNormal = FVector3f(Rotation.RotateVector(FVector(Vertex.Normal)));
+}
+
+void FPmxSdefDeformer::PackUVs(const FVector3f& C, const FVector3f& CR0, const FVector3f& CR1, float Weight1, FVector2f OutUVs[FPmxSdefDescription::NumPackedUVChannels])
+{
+	OutUVs[0] = FVector2f(C.X, C.Y);
+	OutUVs[1] = FVector2f(C.Z, CR0.X);
+	OutUVs[2] = FVector2f(CR0.Y, CR0.Z);
+	OutUVs[3] = FVector2f(CR1.X, CR1.Y);
+	OutUVs[4] = FVector2f(CR1.Z, Weight1);
+}
+
+bool FPmxSdefDeformer::UnpackUVs(const FVector2f UVs[FPmxSdefDescription::NumPackedUVChannels], FVector3f& OutC, FVector3f& OutCR0, FVector3f& OutCR1, float& OutWeight1)
+{
+	OutWeight1 = UVs[4].Y;
+	if (OutWeight1 < 0.f)
+	{
+		return false;
+	}
+
+	OutC = FVector3f(UVs[0].X, UVs[0].Y, UVs[1].X);
+	OutCR0 = FVector3f(UVs[1].Y, UVs[2].X, UVs[2].Y);
+	OutCR1 = FVector3f(UVs[3].X, UVs[3].Y, UVs[4].X);
+	return true;
+}
+
@@ -0,0 +1,210 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "Math/RandomStream.h"
+#include "LogPMXRuntime.h"
+#include "PmxSdefData.h"
+#include "PmxSdefDeformer.h"
+#if WITH_EDITOR
+#include "Rendering/SkeletalMeshModel.h"
+#include "Rendering/SkeletalMeshLODModel.h"
+#endif
+
+namespace PmxSdefVerify
+{
+	static void BuildComponentSpace(const FReferenceSkeleton& RefSkeleton, TConstArrayView<FTransform> LocalPose, TArray<FTransform>& OutComponentSpace)
+	{
+		OutComponentSpace.SetNumUninitialized(LocalPose.Num());
+		for (int32 BoneIndex = 0; BoneIndex < LocalPose.Num(); ++BoneIndex)
+		{
+			const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+			OutComponentSpace[BoneIndex] = ParentIndex != INDEX_NONE ? LocalPose[BoneIndex] * OutComponentSpace[ParentIndex] : LocalPose[BoneIndex];
+		}
+	}
+
+#if WITH_EDITOR
+	/**
+	 * Compare the packed UV stream of the imported LOD 0 with the stored subset, matching render vertices to PMX vertices
+	 * through MeshToImportVertexMap; returns the number of mismatching render vertices (INDEX_NONE if LOD 0 has no map)
+	 */
+	static int32 VerifyPackedUVs(const USkeletalMesh& SkeletalMesh, const FPmxSdefDescription& Description, int32& OutNumPacked)
+	{
+		OutNumPacked = 0;
+		const FSkeletalMeshModel* ImportedModel = SkeletalMesh.GetImportedModel();
+		const int32 FirstChannel = Description.PackedUVChannel;
+		if (!ImportedModel || ImportedModel->LODModels.IsEmpty() || FirstChannel < 0 || FirstChannel + FPmxSdefDescription::NumPackedUVChannels > MAX_TEXCOORDS)
+		{
+			return 0;
+		}
+		const TArray<int32>& ImportVertexMap = ImportedModel->LODModels[0].MeshToImportVertexMap;
+		if (ImportVertexMap.IsEmpty())
+		{
+			return INDEX_NONE;
+		}
+
+		TMap<int32, const FPmxSdefVertex*> VertexByIndex;
+		for (const FPmxSdefVertex& Vertex : Description.Vertices)
+		{
+			VertexByIndex.Add(Vertex.VertexIndex, &Vertex);
+		}
+
+		int32 NumMismatches = 0;
+		for (const FSkelMeshSection& Section : ImportedModel->LODModels[0].Sections)
+		{
+			for (int32 SoftIndex = 0; SoftIndex < Section.SoftVertices.Num(); ++SoftIndex)
+			{
+				const FSoftSkinVertex& SoftVertex = Section.SoftVertices[SoftIndex];
+				FVector3f C, CR0, CR1;
+				float Weight1 = 0.f;
+				const bool bPacked = FPmxSdefDeformer::UnpackUVs(&SoftVertex.UVs[FirstChannel], C, CR0, CR1, Weight1);
+				const int32 RenderIndex = Section.BaseVertexIndex + SoftIndex;
+				const FPmxSdefVertex* const* Found = ImportVertexMap.IsValidIndex(RenderIndex) ? VertexByIndex.Find(ImportVertexMap[RenderIndex]) : nullptr;
+				OutNumPacked += bPacked ? 1 : 0;
+
+				if (bPacked != (Found != nullptr))
+				{
+					++NumMismatches;
+				}
+				else if (Found && (!C.Equals((*Found)->C, 1.e-3f) || !CR0.Equals((*Found)->CR0, 1.e-3f) || !CR1.Equals((*Found)->CR1, 1.e-3f)
+					|| !FMath::IsNearlyEqual(Weight1, (*Found)->Weight1, 1.e-4f)))
+				{
+					++NumMismatches;
+				}
+			}
+		}
+		return NumMismatches;
+	}
+#endif
+
+	/**
+	 * PMX.Sdef.Verify <SkeletalMeshPath> [Poses=32]
+	 * Checks that the stored SDEF subset reproduces the bind pose with the double precision reference and (in the editor)
+	 * that the packed UV stream matches the subset. Also reports how far SDEF moves vertices away from linear blend
+	 * skinning on random poses, i.e. what the linear weights the mesh renders with give up.
+	 */
+	static void Run(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogPMXRuntime, Display, TEXT("Usage: PMX.Sdef.Verify <SkeletalMeshPath> [Poses=32]"));
+			return;
+		}
+
+		USkeletalMesh* SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, *Args[0]);
+		const UPmxSdefUserData* SdefData = SkeletalMesh ? SkeletalMesh->GetAssetUserData<UPmxSdefUserData>() : nullptr;
+		if (!SdefData || SdefData->Description.IsEmpty())
+		{
+			UE_LOG(LogPMXRuntime, Warning, TEXT("PMX.Sdef.Verify: '%s' is not a skeletal mesh with PMX SDEF data"), *Args[0]);
+			return;
+		}
+
+		const FPmxSdefDescription& Description = SdefData->Description;
+		const FReferenceSkeleton& RefSkeleton = SkeletalMesh->GetRefSkeleton();
+		const int32 NumPoses = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 32;
+		const int32 NumBones = RefSkeleton.GetNum();
+		const TArray<FTransform>& RefPose = RefSkeleton.GetRefBonePose();
+
+		TArray<FTransform> RefComponentSpace;
+		BuildComponentSpace(RefSkeleton, RefPose, RefComponentSpace);
+		TArray<FMatrix44f> InvRefMatrices;
+		InvRefMatrices.SetNumUninitialized(NumBones);
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			InvRefMatrices[BoneIndex] = FMatrix44f(RefComponentSpace[BoneIndex].ToMatrixWithScale().Inverse());
+		}
+
+		// Subset bones resolved against the skeleton once
+		TArray<int32> BoneMap;
+		BoneMap.Reserve(Description.Bones.Num());
+		for (const FName BoneName : Description.Bones)
+		{
+			BoneMap.Add(RefSkeleton.FindBoneIndex(BoneName));
+		}
+		auto FindBone = [&BoneMap](uint16 Index)
+		{
+			return BoneMap.IsValidIndex(Index) ? BoneMap[Index] : INDEX_NONE;
+		};
+
+		// Bind pose: identity skinning must give back the rest position
+		double MaxBindError = 0.0;
+		int32 NumBound = 0;
+		for (const FPmxSdefVertex& Vertex : Description.Vertices)
+		{
+			if (FindBone(Vertex.Bone0) != INDEX_NONE && FindBone(Vertex.Bone1) != INDEX_NONE)
+			{
+				FVector3f Position, Normal;
+				FPmxSdefDeformer::DeformReference(Vertex, FMatrix44f::Identity, FMatrix44f::Identity, Position, Normal);
+				MaxBindError = FMath::Max(MaxBindError, (double)FVector3f::Dist(Position, Vertex.Position));
+				++NumBound;
+			}
+		}
+
+		FRandomStream Random(0x53444546);
+		TArray<FTransform> LocalPose;
+		TArray<FTransform> ComponentSpace;
+		TArray<FMatrix44f> RefToLocals;
+		RefToLocals.SetNumUninitialized(NumBones);
+		double SumLinearOffset = 0.0;
+		double MaxLinearOffset = 0.0;
+		int64 NumSamples = 0;
+		for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			LocalPose = RefPose;
+			for (FTransform& Local : LocalPose)
+			{
+				const FQuat Offset(Random.GetUnitVector(), FMath::DegreesToRadians(Random.FRandRange(0.f, 60.f)));
+				Local.SetRotation(Offset * Local.GetRotation());
+			}
+			BuildComponentSpace(RefSkeleton, LocalPose, ComponentSpace);
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				RefToLocals[BoneIndex] = InvRefMatrices[BoneIndex] * FMatrix44f(ComponentSpace[BoneIndex].ToMatrixWithScale());
+			}
+
+			for (const FPmxSdefVertex& Vertex : Description.Vertices)
+			{
+				const int32 Bone0 = FindBone(Vertex.Bone0);
+				const int32 Bone1 = FindBone(Vertex.Bone1);
+				if (Bone0 == INDEX_NONE || Bone1 == INDEX_NONE)
+				{
+					continue;
+				}
+
+				FVector3f ReferencePosition, ReferenceNormal;
+				FPmxSdefDeformer::DeformReference(Vertex, RefToLocals[Bone0], RefToLocals[Bone1], ReferencePosition, ReferenceNormal);
+				const FVector3f Linear = FVector3f(RefToLocals[Bone0].TransformPosition(Vertex.Position)) * (1.f - Vertex.Weight1)
+					+ FVector3f(RefToLocals[Bone1].TransformPosition(Vertex.Position)) * Vertex.Weight1;
+				const double LinearOffset = FVector3f::Dist(Linear, ReferencePosition);
+				SumLinearOffset += LinearOffset;
+				MaxLinearOffset = FMath::Max(MaxLinearOffset, LinearOffset);
+				++NumSamples;
+			}
+		}
+
+		UE_LOG(LogPMXRuntime, Display, TEXT("PMX.Sdef.Verify: %s, %d of %d vertices SDEF (%d bound), bind pose error %.5f"),
+			*SkeletalMesh->GetName(), Description.Vertices.Num(), Description.NumMeshVertices, NumBound, MaxBindError);
+		UE_LOG(LogPMXRuntime, Display, TEXT("PMX.Sdef.Verify: SDEF vs linear blend offset over %d poses avg %.3f, max %.3f"),
+			NumPoses, NumSamples > 0 ? SumLinearOffset / NumSamples : 0.0, MaxLinearOffset);
+
+#if WITH_EDITOR
+		int32 NumPacked = 0;
+		const int32 NumMismatches = VerifyPackedUVs(*SkeletalMesh, Description, NumPacked);
+		if (Description.PackedUVChannel != INDEX_NONE && NumMismatches == INDEX_NONE)
+		{
+			UE_LOG(LogPMXRuntime, Display, TEXT("PMX.Sdef.Verify: LOD 0 has no import vertex map, packed UV stream not checked"));
+		}
+		else if (Description.PackedUVChannel != INDEX_NONE)
+		{
+			UE_LOG(LogPMXRuntime, Display, TEXT("PMX.Sdef.Verify: Packed UV stream (channels %d-%d): %d SDEF vertices, %d mismatches"),
+				Description.PackedUVChannel, Description.PackedUVChannel + FPmxSdefDescription::NumPackedUVChannels - 1, NumPacked, NumMismatches);
+		}
+#endif
+	}
+
+	static FAutoConsoleCommand VerifyCommand(
+		TEXT("PMX.Sdef.Verify"),
+		TEXT("Verify the PMX SDEF data of a mesh (bind pose, packed UVs, offset from linear skinning). Usage: PMX.Sdef.Verify <SkeletalMeshPath> [Poses=32]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
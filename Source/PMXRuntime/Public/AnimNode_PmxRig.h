@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNodeBase.h"
+#include "PmxRigEvaluator.h"
+#include "AnimNode_PmxRig.generated.h"
+
+class UPmxRigDefinition;
+
+/** Which part of the PMX rig a node evaluates */
+UENUM(BlueprintType)
+enum class EPmxRigEvaluationPhase : uint8
+{
+	/** Every step */
+	All,
+
+	/** Steps of bones without the after-physics flag */
+	BeforePhysics,
+
+	/** Steps of bones with the after-physics flag (place after the physics node) */
+	AfterPhysics
+};
+
+/**
+ * Evaluates a PMX rig (append links and MMD-style CCD IK) on the incoming local pose
+ * The rig is bound to the required bones in CacheBones; evaluation performs no heap allocation.
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct PMXRUNTIME_API FAnimNode_PmxRig : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = Links)
+	FPoseLink Source;
+
+	/** Rig generated at PMX import (<Mesh>_Rig) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PMX Rig", meta = (PinHiddenByDefault))
+	TObjectPtr<UPmxRigDefinition> RigDefinition;
+
+	UPROPERTY(EditAnywhere, Category = "PMX Rig")
+	EPmxRigEvaluationPhase Phase = EPmxRigEvaluationPhase::All;
+
+	/** Evaluate IK chains (append links are always evaluated) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PMX Rig", meta = (PinHiddenByDefault))
+	bool bEnableIK = true;
+
+	/** IK bones whose chains are disabled (PMX_IKDisabled_<Bone> curves of imported motions are applied on top) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PMX Rig", meta = (PinHiddenByDefault))
+	TArray<FName> DisabledIKBones;
+
+	//~ Begin FAnimNode_Base interface
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+	//~ End FAnimNode_Base interface
+
+private:
+	void ApplyIKToggles();
+	void BindRig(const FBoneContainer& RequiredBones);
+
+	FPmxRigEvaluator Evaluator;
+
+	/** Rig the evaluator was bound to (rebinds when the pin value changes) */
+	TWeakObjectPtr<UPmxRigDefinition> BoundRig;
+
+	/** Evaluator chain index and IK-disabled curve name per bound IK chain */
+	TArray<TPair<int32, FName>> IKCurves;
+};
@@ -0,0 +1,7 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+PMXRUNTIME_API DECLARE_LOG_CATEGORY_EXTERN(LogPMXRuntime, Log, All);
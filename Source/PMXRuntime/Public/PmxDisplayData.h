@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "PmxDisplayData.generated.h"
+
+class USkeletalMesh;
+
+/** One PMX display frame: the bones and morphs an MMD editor shows together */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxDisplayGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	FString Name;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	FString NameEng;
+
+	/** Special frame (Root / 表情) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	bool bSpecial = false;
+
+	/** Skeleton bone names in display order */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	TArray<FName> Bones;
+
+	/** Morph target names in display order */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	TArray<FName> Morphs;
+
+	/** Reference skeleton indices of Bones that exist in the mesh (filled by UPmxDisplayUserData::BuildLookupTables) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	TArray<int32> BoneIndices;
+
+	/** USkeletalMesh::GetMorphTargets() indices of Morphs that exist in the mesh */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	TArray<int32> MorphIndices;
+};
+
+/** Display frames of one model, in PMX order */
+USTRUCT()
+struct PMXRUNTIME_API FPmxDisplayDescription
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Display")
+	TArray<FPmxDisplayGroup> Groups;
+
+	bool IsEmpty() const { return Groups.IsEmpty(); }
+};
+
+/**
+ * PMX display frames attached to an imported skeletal mesh
+ * Frame -> bone / morph index lists and the reverse bone / morph -> frame tables are precomputed at import,
+ * so tools can filter large rigs by frame without scanning names.
+ * Read with USkeletalMesh::GetAssetUserData<UPmxDisplayUserData>().
+ */
+UCLASS(BlueprintType)
+class PMXRUNTIME_API UPmxDisplayUserData : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Display")
+	FPmxDisplayDescription Description;
+
+	/** Group of each reference skeleton bone (INDEX_NONE = not in any frame); a bone listed twice keeps its first frame */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Display")
+	TArray<int32> GroupByBone;
+
+	/** Group of each morph target (INDEX_NONE = not in any frame) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Display")
+	TArray<int32> GroupByMorph;
+
+	/**
+	 * Resolve bone and morph names against the mesh and rebuild all lookup tables
+	 * Call again if the mesh skeleton or morph targets change.
+	 * @return Number of names that were not found in the mesh
+	 */
+	int32 BuildLookupTables(const USkeletalMesh& SkeletalMesh);
+
+	/** Group index by PMX or English frame name, or INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "PMX Display")
+	int32 FindGroup(const FString& GroupName) const;
+
+	/** Group of a reference skeleton bone, or INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "PMX Display")
+	int32 GetBoneGroup(int32 BoneIndex) const
+	{
+		return GroupByBone.IsValidIndex(BoneIndex) ? GroupByBone[BoneIndex] : INDEX_NONE;
+	}
+
+	/** Group of a morph target, or INDEX_NONE */
+	UFUNCTION(BlueprintPure, Category = "PMX Display")
+	int32 GetMorphGroup(int32 MorphIndex) const
+	{
+		return GroupByMorph.IsValidIndex(MorphIndex) ? GroupByMorph[MorphIndex] : INDEX_NONE;
+	}
+};
@@ -0,0 +1,48 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "UObject/SoftObjectPath.h"
+#include "PmxImportManifest.generated.h"
+
+/** Content hashes of one PMX import, per section, and the assets each factory node produced */
+USTRUCT()
+struct PMXRUNTIME_API FPmxImportManifest
+{
+	GENERATED_BODY()
+
+	/** Full path of the imported PMX file */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Import")
+	FString SourceFile;
+
+	/** Section key (Vertices, Indices, Bones, MaterialSlots, DisplayFrames, Material/<i>, Texture/<i>, Morph/<i>, Bodies, Joints, Options) -> content hash */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Import")
+	TMap<FString, uint64> SectionHashes;
+
+	/** Factory node UID -> asset it created; lets a reimport point skipped nodes at their existing assets */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Import")
+	TMap<FString, FSoftObjectPath> NodeAssets;
+
+	bool IsEmpty() const { return SectionHashes.IsEmpty(); }
+};
+
+/**
+ * Import manifest attached to a skeletal mesh imported from PMX
+ * Compared against the manifest of the new file on reimport so only the assets whose sections changed are rebuilt.
+ * Editor only: stripped when cooking.
+ */
+UCLASS()
+class PMXRUNTIME_API UPmxImportManifestUserData : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleAnywhere, Category = "PMX Import")
+	FPmxImportManifest Manifest;
+
+	//~ Begin UObject Interface
+	virtual bool IsEditorOnly() const override { return true; }
+	//~ End UObject Interface
+};
@@ -0,0 +1,187 @@
+﻿// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "PmxRigDefinition.generated.h"
+
+class USkeleton;
+
+/** Bone entry of a PMX rig (indexed by PMX bone index) */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigBone
+{
+	GENERATED_BODY()
+
+	/** Final skeleton bone name */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	FName Name;
+
+	/** Original PMX bone name (the name motions reference) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	FString SourceName;
+
+	/** Parent rig bone (INDEX_NONE = skeleton root) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 ParentIndex = INDEX_NONE;
+
+	/** Bind pose translation relative to the parent (UE space) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	FVector3f RestTranslation = FVector3f::ZeroVector;
+
+	/** PMX deform layer */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 Layer = 0;
+
+	/** Evaluated after physics (PMX flag 0x1000) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	bool bAfterPhysics = false;
+};
+
+/** One link of a CCD IK chain */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigIKLink
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 BoneIndex = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	bool bLimitAngle = false;
+
+	/** Per-axis rotation limits in radians (UE axes X/Y/Z) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	FVector3f LimitMin = FVector3f::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	FVector3f LimitMax = FVector3f::ZeroVector;
+};
+
+/** CCD IK chain; links are stored in FPmxRigDescription::IKLinks[FirstLink, FirstLink + NumLinks) from target side to root side */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigIKChain
+{
+	GENERATED_BODY()
+
+	/** IK control bone (goal) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 IKBoneIndex = INDEX_NONE;
+
+	/** End effector bone pulled towards the IK bone */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 TargetBoneIndex = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 LoopCount = 0;
+
+	/** Maximum rotation per link per iteration (radians) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	float LimitAngle = 0.f;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 FirstLink = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 NumLinks = 0;
+};
+
+/** Additional parent (append / 付与) link */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigAppend
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 BoneIndex = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 SourceBoneIndex = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	float Ratio = 0.f;
+
+	/** Append rotation (PMX flag 0x0100) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	bool bRotation = false;
+
+	/** Append translation (PMX flag 0x0200) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	bool bTranslation = false;
+};
+
+UENUM(BlueprintType)
+enum class EPmxRigStepType : uint8
+{
+	Append,
+	IK
+};
+
+/** One evaluation step; Index points into Appends or IKChains */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigStep
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	EPmxRigStepType Type = EPmxRigStepType::Append;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 Index = INDEX_NONE;
+};
+
+/**
+ * Evaluation-ordered PMX rig: bones, CCD IK chains and append links.
+ * Steps are sorted the way MMD evaluates bones (after-physics flag, then Layer, then bone index);
+ * Steps[0, NumBeforePhysicsSteps) run before physics, the rest after.
+ */
+USTRUCT(BlueprintType)
+struct PMXRUNTIME_API FPmxRigDescription
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	TArray<FPmxRigBone> Bones;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	TArray<FPmxRigIKLink> IKLinks;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	TArray<FPmxRigIKChain> IKChains;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	TArray<FPmxRigAppend> Appends;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	TArray<FPmxRigStep> Steps;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX Rig")
+	int32 NumBeforePhysicsSteps = 0;
+
+	bool IsEmpty() const { return Steps.IsEmpty(); }
+
+	/** Animation curve that disables the IK chain of an IK bone while above 0.5 (written by the VMD importer) */
+	static FName GetIKDisabledCurveName(FName IKBoneName)
+	{
+		return FName(*(TEXT("PMX_IKDisabled_") + IKBoneName.ToString()));
+	}
+};
+
+/**
+ * Reusable PMX rig asset generated at import (IK chains and append links of one model)
+ * Evaluated at runtime by FPmxRigEvaluator.
+ */
+UCLASS(BlueprintType)
+class PMXRUNTIME_API UPmxRigDefinition : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Skeleton the rig was generated for */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Rig", AssetRegistrySearchable)
+	TSoftObjectPtr<USkeleton> Skeleton;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PMX Rig")
+	FPmxRigDescription Description;
+};
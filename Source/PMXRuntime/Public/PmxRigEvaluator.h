@@ -0,0 +1,121 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PmxRigDefinition.h"
+
+struct FReferenceSkeleton;
+struct FBoneContainer;
+
+/**
+ * Native evaluator for a PMX rig description (append links and CCD IK)
+ * The description is flattened into solver arrays indexed by pose bone index when bound;
+ * component space is kept in vector registers. Evaluate() performs no heap allocation.
+ */
+class PMXRUNTIME_API FPmxRigEvaluator
+{
+public:
+	/**
+	 * Bind a rig description to a reference skeleton (bones are matched by name)
+	 * LocalPose passed to Evaluate() is then indexed by reference skeleton bone index.
+	 * @return False if no rig bone could be matched
+	 */
+	bool Initialize(const FPmxRigDescription& Description, const FReferenceSkeleton& RefSkeleton);
+
+	/**
+	 * Bind a rig description to the required bones of an anim instance
+	 * LocalPose passed to Evaluate() is then indexed by compact pose bone index.
+	 * @return False if no rig bone could be matched
+	 */
+	bool Initialize(const FPmxRigDescription& Description, const FBoneContainer& RequiredBones);
+
+	void Reset();
+
+	bool IsInitialized() const { return NumPoseBones > 0; }
+
+	int32 GetNumSteps() const { return StepTypes.Num(); }
+	int32 GetNumBeforePhysicsSteps() const { return NumBeforePhysicsSteps; }
+
+	/**
+	 * Evaluate steps [FirstStep, LastStep) in place
+	 * @param LocalPose Local space transforms indexed by the pose bone index used in Initialize()
+	 */
+	void Evaluate(TArrayView<FTransform> LocalPose, int32 FirstStep, int32 LastStep);
+
+	/** Evaluate every step (before and after physics) */
+	void Evaluate(TArrayView<FTransform> LocalPose);
+
+	/** Enable or disable one IK chain (e.g. from motion IK toggles) */
+	void SetIKChainEnabled(int32 ChainIndex, bool bEnabled);
+
+	bool IsIKChainEnabled(int32 ChainIndex) const { return ChainEnabled.IsValidIndex(ChainIndex) && ChainEnabled[ChainIndex]; }
+
+	/** Index of the IK chain driven by the given IK bone name, or INDEX_NONE */
+	int32 FindIKChainByBoneName(FName IKBoneName) const;
+
+private:
+	bool Bind(const FPmxRigDescription& Description, TFunctionRef<int32(FName)> FindPoseIndex, TArray<int32>&& InPoseParents);
+
+	void RefreshComponentSpace(TArrayView<const FTransform> LocalPose);
+	void UpdateBone(TArrayView<const FTransform> LocalPose, int32 RigBoneIndex);
+	void UpdateSubtree(TArrayView<const FTransform> LocalPose, int32 RigBoneIndex);
+	void SolveAppend(TArrayView<FTransform> LocalPose, int32 AppendIndex);
+	void SolveIK(TArrayView<FTransform> LocalPose, int32 ChainIndex);
+
+	int32 NumPoseBones = 0;
+
+	/** Pose parent per pose bone index */
+	TArray<int32> PoseParents;
+
+	// Bones (rig bone index)
+	TArray<FName> BoneNames;
+	TArray<int32> BonePoseIndices;
+	TArray<int32> BoneParents;
+	TArray<int32> RootPoseParents;
+	TArray<FVector> BoneRestTranslations;
+
+	/** Rig bones in depth-first preorder; the subtree of a bone is [PreorderPosition, SubtreeEnd) */
+	TArray<int32> Preorder;
+	TArray<int32> PreorderPosition;
+	TArray<int32> SubtreeEnd;
+
+	// Steps
+	TArray<EPmxRigStepType> StepTypes;
+	TArray<int32> StepIndices;
+	int32 NumBeforePhysicsSteps = 0;
+
+	// Append links
+	TArray<int32> AppendBones;
+	TArray<int32> AppendTargetPoseIndices;
+	TArray<int32> AppendSourcePoseIndices;
+	TArray<FVector> AppendSourceRestTranslations;
+	TArray<float> AppendRatios;
+	TArray<uint8> AppendFlags;
+
+	// IK chains
+	TArray<int32> ChainIKBones;
+	TArray<int32> ChainTargetBones;
+	TArray<int32> ChainLoopCounts;
+	TArray<float> ChainLimitAngles;
+	TArray<int32> ChainFirstLinks;
+	TArray<int32> ChainNumLinks;
+	TBitArray<> ChainEnabled;
+
+	// IK links
+	TArray<int32> LinkBones;
+	TArray<int32> LinkPoseIndices;
+	TArray<uint8> LinkLimited;
+	TArray<FVector3f> LinkLimitMin;
+	TArray<FVector3f> LinkLimitMax;
+
+	/** Component space per rig bone (scratch) */
+	TArray<VectorRegister> ComponentRotations;
+	TArray<VectorRegister> ComponentTranslations;
+	TArray<VectorRegister> ComponentScales;
+
+	/** Component space of the pose bone above each rig root (scratch, identity for other bones) */
+	TArray<VectorRegister> RootParentRotations;
+	TArray<VectorRegister> RootParentTranslations;
+	TArray<VectorRegister> RootParentScales;
+};
@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "PmxSdefData.generated.h"
+
+/**
+ * One SDEF (spherical deform) vertex; corrective centers are precomputed at import (mesh space)
+ * CR0 / CR1 are the centers of the PMX R0 / R1 spheres after the weighted R offset is removed,
+ * so Weight0 * CR0 + Weight1 * CR1 == C and the bind pose deforms to itself.
+ */
+USTRUCT()
+struct PMXRUNTIME_API FPmxSdefVertex
+{
+	GENERATED_BODY()
+
+	/**
+	 * PMX vertex index, which is also the import vertex index of LOD 0
+	 * The mesh build splits and reorders vertices, so render vertices are matched through their packed UVs
+	 * (or LOD 0's MeshToImportVertexMap in the editor) rather than stored here.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	int32 VertexIndex = INDEX_NONE;
+
+	/** Indices into FPmxSdefDescription::Bones */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	uint16 Bone0 = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	uint16 Bone1 = 0;
+
+	/** Weight of Bone1 (Bone0 gets 1 - Weight1) */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	float Weight1 = 0.f;
+
+	/** Bind pose position and normal */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FVector3f Position = FVector3f::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FVector3f Normal = FVector3f::ZAxisVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FVector3f C = FVector3f::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FVector3f CR0 = FVector3f::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FVector3f CR1 = FVector3f::ZeroVector;
+};
+
+/** SDEF vertex subset of the imported model */
+USTRUCT()
+struct PMXRUNTIME_API FPmxSdefDescription
+{
+	GENERATED_BODY()
+
+	/** Skeleton bone names referenced by the vertices */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	TArray<FName> Bones;
+
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	TArray<FPmxSdefVertex> Vertices;
+
+	/** PMX vertex count of the model the subset was taken from */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	int32 NumMeshVertices = 0;
+
+	/**
+	 * First UV channel of the packed SDEF stream (INDEX_NONE = not packed)
+	 * Channels [First, First + NumPackedUVChannels): (C.x, C.y) (C.z, CR0.x) (CR0.y, CR0.z) (CR1.x, CR1.y) (CR1.z, Weight1);
+	 * non-SDEF vertices are zero with Weight1 = -1.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	int32 PackedUVChannel = INDEX_NONE;
+
+	static constexpr int32 NumPackedUVChannels = 5;
+
+	bool IsEmpty() const { return Vertices.IsEmpty(); }
+};
+
+/**
+ * SDEF data attached to an imported skeletal mesh
+ * Read with USkeletalMesh::GetAssetUserData<UPmxSdefUserData>(); FPmxSdefDeformer::DeformReference evaluates it.
+ */
+UCLASS(BlueprintType)
+class PMXRUNTIME_API UPmxSdefUserData : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleAnywhere, Category = "PMX SDEF")
+	FPmxSdefDescription Description;
+};
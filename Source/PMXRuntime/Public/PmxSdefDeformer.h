@@ -0,0 +1,29 @@
+// Copyright (c) 2025 Jeonghyeon Ha. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PmxSdefData.h"
+
+/**
+ * SDEF (spherical deform) math shared by the importer and PMX.Sdef.Verify
+ * Only the CPU reference is provided; the engine renders SDEF vertices with their linear (BDEF2) weights.
+ */
+class PMXRUNTIME_API FPmxSdefDeformer
+{
+public:
+	/** Corrective sphere centers from the PMX C / R0 / R1 parameters (any space, weights sum to 1) */
+	static void ComputeCorrectiveCenters(const FVector3f& C, const FVector3f& R0, const FVector3f& R1, float Weight0, float Weight1, FVector3f& OutCR0, FVector3f& OutCR1);
+
+	/**
+	 * Reference SDEF evaluation of one vertex in double precision (verification and offline use)
+	 * @param Skin0, Skin1 Reference to posed component space matrices of the two bones
+	 */
+	static void DeformReference(const FPmxSdefVertex& Vertex, const FMatrix44f& Skin0, const FMatrix44f& Skin1, FVector3f& OutPosition, FVector3f& OutNormal);
+
+	/** Packed UV values of one vertex (see FPmxSdefDescription::PackedUVChannel) */
+	static void PackUVs(const FVector3f& C, const FVector3f& CR0, const FVector3f& CR1, float Weight1, FVector2f OutUVs[FPmxSdefDescription::NumPackedUVChannels]);
+
+	/** @return False for a non-SDEF vertex */
+	static bool UnpackUVs(const FVector2f UVs[FPmxSdefDescription::NumPackedUVChannels], FVector3f& OutC, FVector3f& OutCR0, FVector3f& OutCR1, float& OutWeight1);
+};